@@ -1774,9 +1774,17 @@ void
 OMR::CodeGenerator::reserveCodeCache()
    {
    int32_t numReserved = 0;
-   int32_t compThreadID = 0;
+   int32_t compThreadID = self()->comp()->getCompThreadID();
 
-   _codeCache = TR::CodeCacheManager::instance()->reserveCodeCache(false, 0, compThreadID, &numReserved);
+   // Hot code goes to the hot segment while it has room, apart from the rest
+   TR::CodeCache *codeCache = NULL;
+   if (self()->comp()->getMethodHotness() >= hot)
+      codeCache = TR::CodeCacheManager::instance()->reserveHotCodeCache(compThreadID);
+
+   if (!codeCache)
+      codeCache = TR::CodeCacheManager::instance()->reserveCodeCache(false, 0, compThreadID, &numReserved);
+
+   _codeCache = codeCache;
 
    if (!_codeCache) // Cannot reserve a cache; all are used
       {
@@ -3072,6 +3080,16 @@ void OMR::CodeGenerator::addRelocation(TR::Relocation *r)
       }
    }
 
+// Absolute references to labels are also recorded as internal relocations,
+// which is all the persistent code cache needs to move the code
+//
+static bool
+isAbsoluteLabelReference(TR::Relocation *r)
+   {
+   return r->isExternalRelocation() &&
+          static_cast<TR::ExternalRelocation *>(r)->getTargetKind() == TR_AbsoluteMethodAddress;
+   }
+
 void OMR::CodeGenerator::addExternalRelocation(TR::Relocation *r, const char *generatingFileName, uintptr_t generatingLineNumber, TR::Node *node, TR::ExternalRelocationPositionRequest where)
    {
    TR_ASSERT(generatingFileName, "External relocation location has improper NULL filename specified");
@@ -3083,10 +3101,19 @@ void OMR::CodeGenerator::addExternalRelocation(TR::Relocation *r, const char *ge
       genData->node = node;
       self()->addExternalRelocation(r, genData, where);
       }
+   else if (self()->comp()->compilePersistentCode() && !isAbsoluteLabelReference(r))
+      {
+      self()->comp()->setCompilePersistentCode(false);
+      }
    }
 
 void OMR::CodeGenerator::addExternalRelocation(TR::Relocation *r, TR::RelocationDebugInfo* info, TR::ExternalRelocationPositionRequest where)
    {
+   if (self()->comp()->compilePersistentCode() && !isAbsoluteLabelReference(r))
+      {
+      self()->comp()->setCompilePersistentCode(false);
+      }
+
    if (self()->comp()->compileRelocatableCode())
       {
       TR_ASSERT(info, "External relocation location does not have associated debug information");
@@ -3117,6 +3144,45 @@ OMR::CodeGenerator::addStaticRelocation(const TR::StaticRelocation &relocation)
    _staticRelocationList.push_back(relocation);
    }
 
+// Targets that only a downstream project knows how to relocate cannot be
+// kept in the persistent code cache
+//
+void
+OMR::CodeGenerator::addProjectSpecializedRelocation(uint8_t *location,
+                                                    uint8_t *target,
+                                                    uint8_t *target2,
+                                                    TR_ExternalRelocationTargetKind kind,
+                                                    char *generatingFileName,
+                                                    uintptr_t generatingLineNumber,
+                                                    TR::Node *node)
+   {
+   self()->comp()->setCompilePersistentCode(false);
+   }
+
+void
+OMR::CodeGenerator::addProjectSpecializedPairRelocation(uint8_t *location1,
+                                                        uint8_t *location2,
+                                                        uint8_t *target,
+                                                        TR_ExternalRelocationTargetKind kind,
+                                                        char *generatingFileName,
+                                                        uintptr_t generatingLineNumber,
+                                                        TR::Node *node)
+   {
+   self()->comp()->setCompilePersistentCode(false);
+   }
+
+void
+OMR::CodeGenerator::addProjectSpecializedRelocation(TR::Instruction *instr,
+                                                    uint8_t *target,
+                                                    uint8_t *target2,
+                                                    TR_ExternalRelocationTargetKind kind,
+                                                    char *generatingFileName,
+                                                    uintptr_t generatingLineNumber,
+                                                    TR::Node *node)
+   {
+   self()->comp()->setCompilePersistentCode(false);
+   }
+
 intptr_t OMR::CodeGenerator::hiValue(intptr_t address)
    {
    if (self()->comp()->compileRelocatableCode()) // We don't want to store values using HI_VALUE at compile time, otherwise, we do this a 2nd time when we relocate (and new value is based on old one)
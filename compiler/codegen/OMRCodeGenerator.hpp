@@ -1177,21 +1177,21 @@ public:
                                           TR_ExternalRelocationTargetKind kind,
                                           char *generatingFileName,
                                           uintptr_t generatingLineNumber,
-                                          TR::Node *node) {}
+                                          TR::Node *node);
    void addProjectSpecializedPairRelocation(uint8_t *location1,
                                           uint8_t *location2,
                                           uint8_t *target,
                                           TR_ExternalRelocationTargetKind kind,
                                           char *generatingFileName,
                                           uintptr_t generatingLineNumber,
-                                          TR::Node *node) {}
+                                          TR::Node *node);
    void addProjectSpecializedRelocation(TR::Instruction *instr,
                                           uint8_t *target,
                                           uint8_t *target2,
                                           TR_ExternalRelocationTargetKind kind,
                                           char *generatingFileName,
                                           uintptr_t generatingLineNumber,
-                                          TR::Node *node) {}
+                                          TR::Node *node);
 
    void apply8BitLabelRelativeRelocation(int32_t * cursor, TR::LabelSymbol * label);
    void apply12BitLabelRelativeRelocation(int32_t * cursor, TR::LabelSymbol * label, bool isCheckDisp = true);
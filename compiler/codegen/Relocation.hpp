@@ -85,6 +85,12 @@ class Relocation
 
    virtual bool isExternalRelocation() { return false; }
 
+   /** true if the value written does not change when the code is moved */
+   virtual bool isPositionIndependent() { return false; }
+
+   /** true if the value written is the address of a label */
+   virtual bool isLabelAbsolute() { return false; }
+
    TR::RelocationDebugInfo* getDebugInfo();
 
    void setDebugInfo(TR::RelocationDebugInfo* info);
@@ -118,6 +124,7 @@ class LabelRelative8BitRelocation : public TR::LabelRelocation
    LabelRelative8BitRelocation() : TR::LabelRelocation() {}
    LabelRelative8BitRelocation(uint8_t *p, TR::LabelSymbol *l)
       : TR::LabelRelocation(p, l) {}
+   virtual bool isPositionIndependent() { return true; }
    virtual void apply(TR::CodeGenerator *codeGen);
    };
 
@@ -129,6 +136,7 @@ class LabelRelative12BitRelocation : public TR::LabelRelocation
    LabelRelative12BitRelocation(uint8_t *p, TR::LabelSymbol *l, bool isCheckDisp = true)
       : TR::LabelRelocation(p, l), _isCheckDisp(isCheckDisp) {}
    bool isCheckDisp() {return _isCheckDisp;}
+   virtual bool isPositionIndependent() { return true; }
    virtual void apply(TR::CodeGenerator *codeGen);
    };
 
@@ -155,6 +163,7 @@ class LabelRelative16BitRelocation : public TR::LabelRelocation
    int8_t getAddressDifferenceDivisor()  {return _addressDifferenceDivisor;}
    int8_t setAddressDifferenceDivisor(int8_t d) {return (_addressDifferenceDivisor = d);}
 
+   virtual bool isPositionIndependent() { return true; }
    virtual void apply(TR::CodeGenerator *codeGen);
    };
 
@@ -164,6 +173,7 @@ class LabelRelative24BitRelocation : public TR::LabelRelocation
    LabelRelative24BitRelocation() : TR::LabelRelocation() {}
    LabelRelative24BitRelocation(uint8_t *p, TR::LabelSymbol *l)
       : TR::LabelRelocation(p, l) {}
+   virtual bool isPositionIndependent() { return true; }
    virtual void apply(TR::CodeGenerator *codeGen);
    };
 
@@ -173,6 +183,7 @@ class LabelRelative32BitRelocation : public TR::LabelRelocation
    LabelRelative32BitRelocation() : TR::LabelRelocation() {}
    LabelRelative32BitRelocation(uint8_t *p, TR::LabelSymbol *l)
       : TR::LabelRelocation(p, l) {}
+   virtual bool isPositionIndependent() { return true; }
    virtual void apply(TR::CodeGenerator *codeGen);
    };
 
@@ -204,6 +215,7 @@ class InstructionLabelRelative16BitRelocation : public TR::LabelRelocation
    InstructionLabelRelative16BitRelocation(TR::Instruction* cursor, int32_t offset, TR::LabelSymbol* l, int32_t divisor);
 
    virtual uint8_t* getUpdateLocation();
+   virtual bool isPositionIndependent() { return true; }
    virtual void apply(TR::CodeGenerator* cg);
 
    private:
@@ -241,6 +253,7 @@ class InstructionLabelRelative32BitRelocation : public TR::LabelRelocation
    InstructionLabelRelative32BitRelocation(TR::Instruction* cursor, int32_t offset, TR::LabelSymbol* l, int32_t divisor);
 
    virtual uint8_t* getUpdateLocation();
+   virtual bool isPositionIndependent() { return true; }
    virtual void apply(TR::CodeGenerator* cg);
 
    private:
@@ -256,6 +269,7 @@ class LabelAbsoluteRelocation : public TR::LabelRelocation
    LabelAbsoluteRelocation() : TR::LabelRelocation() {}
    LabelAbsoluteRelocation(uint8_t *p, TR::LabelSymbol *l)
       : TR::LabelRelocation(p, l) {}
+   virtual bool isLabelAbsolute() { return true; }
    virtual void apply(TR::CodeGenerator *codeGen);
    };
 
@@ -105,6 +105,7 @@
 #include "ras/IlVerifier.hpp"
 #include "control/Recompilation.hpp"
 #include "runtime/CodeCacheExceptions.hpp"
+#include "runtime/PersistentCodeCache.hpp"
 #include "ilgen/IlGen.hpp"
 #include "env/RegionProfiler.hpp"
 #include "omrformatconsts.h"
@@ -284,6 +285,7 @@ OMR::Compilation::Compilation(
    _gpuPtxList(m),
    _gpuKernelLineNumberList(m),
    _gpuPtxCount(0),
+   _compilePersistentCode(false),
    _bitVectorPool(self()),
    _typeLayoutMap((LayoutComparator()), LayoutAllocator(self()->region())),
    _tlsManager(*self())
@@ -1044,6 +1046,23 @@ int32_t OMR::Compilation::compile()
          }
 #endif
 
+      // A body compiled from the same trees in an earlier run can be reused
+      // in place of optimizing and generating code
+      //
+      TR::PersistentCodeCache *persistentCodeCache = TR::PersistentCodeCache::instance();
+      TR::PersistentCodeCache::Key persistentCodeKey;
+      bool storePersistentCode = false;
+      if (persistentCodeCache && persistentCodeCache->computeKey(self(), persistentCodeKey))
+         {
+         if (persistentCodeCache->load(self(), persistentCodeKey))
+            {
+            if (printCodegenTime) compTime.stopTiming(self());
+            return COMPILATION_SUCCEEDED;
+            }
+         self()->setCompilePersistentCode(true);
+         storePersistentCode = true;
+         }
+
       if (_recompilationInfo)
          {
          _recompilationInfo->beforeOptimization();
@@ -1114,6 +1133,9 @@ int32_t OMR::Compilation::compile()
            codegenTime.stopTiming(self());
         }
 
+      if (storePersistentCode)
+         persistentCodeCache->store(self(), persistentCodeKey);
+
       if (_recompilationInfo)
          _recompilationInfo->endOfCompilation();
 
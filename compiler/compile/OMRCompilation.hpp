@@ -353,6 +353,15 @@ public:
    //
    bool compilePortableCode() { return false; }
 
+   // Is this compilation producing code to be kept in the persistent code
+   // cache?  Such code is loaded at a different address in a later process,
+   // so it may only refer outside of itself through static relocations.
+   // Code generators reset this when they emit a reference they cannot
+   // describe that way.
+   //
+   bool compilePersistentCode() { return _compilePersistentCode; }
+   void setCompilePersistentCode(bool b) { _compilePersistentCode = b; }
+
    // Maximum number of internal pointers that can be managed.
    //
    int32_t maxInternalPointers();
@@ -1324,6 +1333,8 @@ private:
    ListHeadAndTail<int32_t> _gpuKernelLineNumberList; //TODO: fix to get real line numbers
    int32_t _gpuPtxCount;
 
+   bool _compilePersistentCode;
+
    BitVectorPool _bitVectorPool; //MUST be declared after _trMemory
 
    typedef TR::typed_allocator<std::pair<TR_OpaqueClassBlock* const, const TR::TypeLayout *>, TR::Region &> LayoutAllocator;
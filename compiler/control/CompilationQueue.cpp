@@ -0,0 +1,604 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "control/CompilationQueue.hpp"
+
+#include <new>
+#include <stddef.h>
+#include <stdint.h>
+#include "compile/Compilation.hpp"
+#include "control/CompileMethod.hpp"
+#include "control/Options.hpp"
+#include "control/Options_inlines.hpp"
+#include "env/CompilerEnv.hpp"
+#include "env/VerboseLog.hpp"
+#include "infra/Assert.hpp"
+#include "infra/ThreadLocal.hpp"
+#include "runtime/CodeCacheManager.hpp"
+#include "thread_api.h"
+
+TR::CompilationQueue *TR::CompilationQueue::_instance = NULL;
+
+TR::CompilationRequest::CompilationRequest(TR::CompilationQueue *queue, void *key, TR::IlGeneratorMethodDetails &details, TR_Hotness hotness) :
+   _queue(queue),
+   _key(key),
+   _details(details),
+   _hotness(hotness),
+   _state(Queued),
+   _references(1),
+   _startPC(NULL),
+   _rc(COMPILATION_REQUESTED),
+   _callbacks(NULL),
+   _next(NULL),
+   _previous(NULL),
+   _hashNext(NULL)
+   {
+   }
+
+bool
+TR::CompilationRequest::isDone()
+   {
+   TR::CompilationQueue::attachCurrentThread();
+   omrthread_monitor_enter(_queue->_completionMonitor);
+   bool done = (Done == _state);
+   omrthread_monitor_exit(_queue->_completionMonitor);
+   return done;
+   }
+
+uint8_t *
+TR::CompilationRequest::wait(int32_t &rc)
+   {
+   TR::CompilationQueue::attachCurrentThread();
+   omrthread_monitor_enter(_queue->_completionMonitor);
+   while (Done != _state)
+      omrthread_monitor_wait(_queue->_completionMonitor);
+   omrthread_monitor_exit(_queue->_completionMonitor);
+
+   rc = _rc;
+   return _startPC;
+   }
+
+TR::CompilationQueue::CompilationQueue() :
+   _queueMonitor(NULL),
+   _completionMonitor(NULL),
+   _compilationMonitor(NULL),
+   _threadCount(0),
+   _activeThreads(0),
+   _lastCompilationThreadID(0),
+   _liveRequests(0),
+   _shuttingDown(false),
+   _freeOnLastRelease(false),
+   _queueDepth(0),
+   _maxQueueDepth(0),
+   _requestCount(0),
+   _mergedCount(0),
+   _upgradedCount(0),
+   _compiledCount(0),
+   _failedCount(0),
+   _cancelledCount(0)
+   {
+   for (int32_t h = 0; h < numHotnessLevels; h++)
+      {
+      _queueHead[h] = NULL;
+      _queueTail[h] = NULL;
+      }
+   for (uintptr_t i = 0; i < PENDING_TABLE_SIZE; i++)
+      _pending[i] = NULL;
+   }
+
+TR::CompilationQueue *
+TR::CompilationQueue::startup(uint32_t compilationThreads, uintptr_t stackSize)
+   {
+   TR_ASSERT(NULL == _instance, "compilation queue already started");
+   if (NULL != _instance)
+      return _instance;
+
+   // omrthread_self() cannot be trusted until the thread library has been
+   // initialized, which the first attach does
+   omrthread_t self = NULL;
+   if (0 != omrthread_attach_ex(&self, J9THREAD_ATTR_DEFAULT))
+      return NULL;
+
+   void *storage = TR::Compiler->persistentAllocator().allocate(sizeof(TR::CompilationQueue), std::nothrow);
+   if (NULL == storage)
+      return NULL;
+
+   TR::CompilationQueue *queue = new (storage) TR::CompilationQueue();
+   if (!queue->initialize(compilationThreads, stackSize))
+      {
+      queue->destroy();
+      return NULL;
+      }
+
+   _instance = queue;
+   return queue;
+   }
+
+bool
+TR::CompilationQueue::initialize(uint32_t compilationThreads, uintptr_t stackSize)
+   {
+   if (0 != omrthread_monitor_init_with_name(&_queueMonitor, 0, "JIT-CompilationQueueMonitor"))
+      return false;
+   if (0 != omrthread_monitor_init_with_name(&_completionMonitor, 0, "JIT-CompilationCompletionMonitor"))
+      return false;
+   if (0 != omrthread_monitor_init_with_name(&_compilationMonitor, 0, "JIT-CompilationMonitor"))
+      return false;
+
+   if (0 == compilationThreads)
+      compilationThreads = 1;
+
+   omrthread_monitor_enter(_queueMonitor);
+   for (uint32_t i = 0; i < compilationThreads; i++)
+      {
+      omrthread_t thread = NULL;
+      _activeThreads += 1;
+      if (0 != omrthread_create(&thread, stackSize, J9THREAD_PRIORITY_NORMAL, 0, compilationThreadEntry, this))
+         {
+         _activeThreads -= 1;
+         break;
+         }
+      _threadCount += 1;
+      }
+
+   // Run with however many threads could be created
+   bool started = (0 != _threadCount);
+   if (!started)
+      _shuttingDown = true;
+   omrthread_monitor_exit(_queueMonitor);
+
+   return started;
+   }
+
+void
+TR::CompilationQueue::tearDown()
+   {
+   if (NULL != _compilationMonitor)
+      omrthread_monitor_destroy(_compilationMonitor);
+   if (NULL != _completionMonitor)
+      omrthread_monitor_destroy(_completionMonitor);
+   if (NULL != _queueMonitor)
+      omrthread_monitor_destroy(_queueMonitor);
+   }
+
+void
+TR::CompilationQueue::destroy()
+   {
+   tearDown();
+   this->~CompilationQueue();
+   TR::Compiler->persistentAllocator().deallocate(this);
+   }
+
+void
+TR::CompilationQueue::shutdown()
+   {
+   TR::CompilationQueue *queue = _instance;
+   if (NULL == queue)
+      return;
+
+   attachCurrentThread();
+
+   // Cancel whatever has not been picked up yet, then let the compilation
+   // threads finish the requests they hold and exit.
+   //
+   TR::CompilationRequest *cancelled = NULL;
+   omrthread_monitor_enter(queue->_queueMonitor);
+   queue->_shuttingDown = true;
+   TR::CompilationRequest *request = NULL;
+   while (NULL != (request = queue->nextRequest()))
+      {
+      request->_next = cancelled;
+      cancelled = request;
+      }
+   omrthread_monitor_notify_all(queue->_queueMonitor);
+   while (0 != queue->_activeThreads)
+      omrthread_monitor_wait(queue->_queueMonitor);
+   omrthread_monitor_exit(queue->_queueMonitor);
+
+   while (NULL != cancelled)
+      {
+      request = cancelled;
+      cancelled = request->_next;
+      request->_next = NULL;
+      queue->complete(request, NULL, COMPILATION_FAILED, true);
+      }
+
+   queue->reportStatistics();
+
+   _instance = NULL;
+
+   // Requests still held keep the queue alive; the last release frees it
+   omrthread_monitor_enter(queue->_completionMonitor);
+   bool held = (0 != queue->_liveRequests);
+   queue->_freeOnLastRelease = held;
+   omrthread_monitor_exit(queue->_completionMonitor);
+
+   if (!held)
+      queue->destroy();
+   }
+
+omrthread_t
+TR::CompilationQueue::attachCurrentThread()
+   {
+   omrthread_t self = omrthread_self();
+   if (NULL == self)
+      {
+      if (0 != omrthread_attach_ex(&self, J9THREAD_ATTR_DEFAULT))
+         self = NULL;
+      }
+   return self;
+   }
+
+TR::CompilationRequest *
+TR::CompilationQueue::request(void *key, TR::IlGeneratorMethodDetails &details, TR_Hotness hotness, TR::CompilationCallback callback, void *userData)
+   {
+   TR_ASSERT(hotness >= minHotness && hotness <= maxHotness, "cannot queue a compilation with hotness %d", hotness);
+   if ((hotness < minHotness) || (hotness > maxHotness))
+      return NULL;
+
+   if (NULL == attachCurrentThread())
+      return NULL;
+
+   TR::PersistentAllocator &allocator = TR::Compiler->persistentAllocator();
+
+   TR::CompilationRequest::Callback *callbackNode = NULL;
+   if (NULL != callback)
+      {
+      callbackNode = static_cast<TR::CompilationRequest::Callback *>(allocator.allocate(sizeof(TR::CompilationRequest::Callback), std::nothrow));
+      if (NULL == callbackNode)
+         return NULL;
+      callbackNode->_function = callback;
+      callbackNode->_userData = userData;
+      callbackNode->_next = NULL;
+      }
+
+   omrthread_monitor_enter(_queueMonitor);
+
+   if (_shuttingDown)
+      {
+      omrthread_monitor_exit(_queueMonitor);
+      if (NULL != callbackNode)
+         allocator.deallocate(callbackNode);
+      return NULL;
+      }
+
+   _requestCount += 1;
+
+   bool created = false;
+   TR::CompilationRequest *request = findPending(key);
+   if (NULL != request)
+      {
+      // The method is already on its way; share the request and make it
+      // hotter if it has not been picked up yet.
+      //
+      _mergedCount += 1;
+      if ((TR::CompilationRequest::Queued == request->_state) && (hotness > request->_hotness))
+         {
+         dequeue(request);
+         request->_hotness = hotness;
+         enqueue(request);
+         _upgradedCount += 1;
+         }
+      }
+   else
+      {
+      void *storage = allocator.allocate(sizeof(TR::CompilationRequest), std::nothrow);
+      if (NULL == storage)
+         {
+         omrthread_monitor_exit(_queueMonitor);
+         if (NULL != callbackNode)
+            allocator.deallocate(callbackNode);
+         return NULL;
+         }
+
+      // The queue holds the initial reference until the request is done
+      //
+      request = new (storage) TR::CompilationRequest(this, key, details, hotness);
+      created = true;
+      uintptr_t bucket = hashKey(key);
+      request->_hashNext = _pending[bucket];
+      _pending[bucket] = request;
+      enqueue(request);
+
+      _queueDepth += 1;
+      if (_queueDepth > _maxQueueDepth)
+         _maxQueueDepth = _queueDepth;
+
+      omrthread_monitor_notify(_queueMonitor);
+      }
+
+   if (NULL != callbackNode)
+      {
+      callbackNode->_next = request->_callbacks;
+      request->_callbacks = callbackNode;
+      }
+
+   omrthread_monitor_enter(_completionMonitor);
+   if (created)
+      _liveRequests += 1;
+   request->_references += 1;
+   omrthread_monitor_exit(_completionMonitor);
+
+   TR_Hotness queuedHotness = request->_hotness;
+   uint32_t queueDepth = _queueDepth;
+   omrthread_monitor_exit(_queueMonitor);
+
+   if (TR::Options::getVerboseOption(TR_VerboseCompileRequest))
+      TR_VerboseLog::writeLineLocked(TR_Vlog_CR, "queued %p (%s) queue depth=%u", key, TR::Compilation::getHotnessName(queuedHotness), queueDepth);
+
+   return request;
+   }
+
+TR::CompilationRequest *
+TR::CompilationQueue::find(void *key)
+   {
+   attachCurrentThread();
+   omrthread_monitor_enter(_queueMonitor);
+   TR::CompilationRequest *request = findPending(key);
+   if (NULL != request)
+      {
+      omrthread_monitor_enter(_completionMonitor);
+      request->_references += 1;
+      omrthread_monitor_exit(_completionMonitor);
+      }
+   omrthread_monitor_exit(_queueMonitor);
+   return request;
+   }
+
+void
+TR::CompilationQueue::release(TR::CompilationRequest *request)
+   {
+   TR::CompilationQueue *queue = request->_queue;
+   attachCurrentThread();
+   omrthread_monitor_enter(queue->_completionMonitor);
+   TR_ASSERT(0 != request->_references, "releasing compilation request %p with no references", request);
+   request->_references -= 1;
+   bool lastReference = (0 == request->_references);
+   bool lastRequest = false;
+   if (lastReference)
+      {
+      queue->_liveRequests -= 1;
+      lastRequest = queue->_freeOnLastRelease && (0 == queue->_liveRequests);
+      }
+   omrthread_monitor_exit(queue->_completionMonitor);
+
+   if (lastReference)
+      {
+      TR_ASSERT(TR::CompilationRequest::Done == request->_state, "freeing compilation request %p before it is done", request);
+      request->~CompilationRequest();
+      TR::Compiler->persistentAllocator().deallocate(request);
+      }
+
+   // The queue was shut down while this request was held
+   if (lastRequest)
+      queue->destroy();
+   }
+
+int J9THREAD_PROC
+TR::CompilationQueue::compilationThreadEntry(void *queue)
+   {
+   static_cast<TR::CompilationQueue *>(queue)->compilationThreadLoop();
+   return 0;
+   }
+
+void
+TR::CompilationQueue::compilationThreadLoop()
+   {
+   omrthread_monitor_enter(_queueMonitor);
+
+   // Compilations on application threads use ID 0
+   int32_t compThreadID = ++_lastCompilationThreadID;
+
+   while (true)
+      {
+      TR::CompilationRequest *request = nextRequest();
+      if (NULL != request)
+         {
+         omrthread_monitor_exit(_queueMonitor);
+         compile(request, compThreadID);
+         omrthread_monitor_enter(_queueMonitor);
+         }
+      else if (_shuttingDown)
+         {
+         break;
+         }
+      else
+         {
+         omrthread_monitor_wait(_queueMonitor);
+         }
+      }
+
+   // Hand back the code cache kept between compilations before shutdown can
+   // go on to tear the code caches down
+   TR::CodeCacheManager::instance()->releaseThreadCodeCache(compThreadID);
+
+   _activeThreads -= 1;
+   omrthread_monitor_notify_all(_queueMonitor);
+   // Exits the monitor and the thread without touching the queue again
+   omrthread_exit(_queueMonitor);
+   }
+
+void
+TR::CompilationQueue::compile(TR::CompilationRequest *request, int32_t compThreadID)
+   {
+   int32_t rc = COMPILATION_FAILED;
+   uint8_t *startPC = NULL;
+
+   // Compilations share the code cache manager, the code caches, symbol and
+   // relocation registration, the perf map file and the CPU description; each
+   // of these is either locked or published with a write barrier. The current
+   // compilation itself is only kept per thread where thread local storage is
+   // supported; elsewhere the compilation threads take turns. The
+   // serializeCompilations option makes them take turns everywhere, to rule
+   // out a race in state that has not been audited for a particular front end.
+   //
+#if defined(SUPPORTS_THREAD_LOCAL)
+   bool serialize = TR::Options::getCmdLineOptions()->getOption(TR_SerializeCompilations);
+#else
+   bool serialize = true;
+#endif
+   if (serialize)
+      omrthread_monitor_enter(_compilationMonitor);
+   try
+      {
+      startPC = compileMethodFromDetails(NULL, request->_details, request->_hotness, rc, compThreadID);
+      }
+   catch (...)
+      {
+      // Nothing may escape a compilation thread
+      startPC = NULL;
+      rc = COMPILATION_FAILED;
+      }
+   if (serialize)
+      omrthread_monitor_exit(_compilationMonitor);
+
+   complete(request, startPC, rc, false);
+   }
+
+void
+TR::CompilationQueue::complete(TR::CompilationRequest *request, uint8_t *startPC, int32_t rc, bool cancelled)
+   {
+   // A compilation that was refused without producing an error code still failed
+   if ((NULL == startPC) && ((COMPILATION_SUCCEEDED == rc) || (COMPILATION_REQUESTED == rc)))
+      rc = COMPILATION_FAILED;
+
+   // Once the request leaves the pending table no new callback can be added
+   // to it, and a new request for the same key starts a fresh compilation.
+   //
+   omrthread_monitor_enter(_queueMonitor);
+   removePending(request);
+   TR::CompilationRequest::Callback *callbacks = request->_callbacks;
+   request->_callbacks = NULL;
+   if (cancelled)
+      _cancelledCount += 1;
+   else if (NULL != startPC)
+      _compiledCount += 1;
+   else
+      _failedCount += 1;
+   omrthread_monitor_exit(_queueMonitor);
+
+   request->_startPC = startPC;
+   request->_rc = rc;
+
+   while (NULL != callbacks)
+      {
+      TR::CompilationRequest::Callback *callback = callbacks;
+      callbacks = callback->_next;
+      callback->_function(request, callback->_userData);
+      TR::Compiler->persistentAllocator().deallocate(callback);
+      }
+
+   omrthread_monitor_enter(_completionMonitor);
+   request->_state = TR::CompilationRequest::Done;
+   omrthread_monitor_notify_all(_completionMonitor);
+   omrthread_monitor_exit(_completionMonitor);
+
+   release(request);
+   }
+
+void
+TR::CompilationQueue::enqueue(TR::CompilationRequest *request)
+   {
+   TR_Hotness hotness = request->_hotness;
+   request->_next = NULL;
+   request->_previous = _queueTail[hotness];
+   if (NULL != _queueTail[hotness])
+      _queueTail[hotness]->_next = request;
+   else
+      _queueHead[hotness] = request;
+   _queueTail[hotness] = request;
+   }
+
+void
+TR::CompilationQueue::dequeue(TR::CompilationRequest *request)
+   {
+   TR_Hotness hotness = request->_hotness;
+   if (NULL != request->_previous)
+      request->_previous->_next = request->_next;
+   else
+      _queueHead[hotness] = request->_next;
+   if (NULL != request->_next)
+      request->_next->_previous = request->_previous;
+   else
+      _queueTail[hotness] = request->_previous;
+   request->_next = NULL;
+   request->_previous = NULL;
+   }
+
+TR::CompilationRequest *
+TR::CompilationQueue::nextRequest()
+   {
+   for (int32_t h = maxHotness; h >= minHotness; h--)
+      {
+      TR::CompilationRequest *request = _queueHead[h];
+      if (NULL != request)
+         {
+         dequeue(request);
+         request->_state = TR::CompilationRequest::InProgress;
+         _queueDepth -= 1;
+         return request;
+         }
+      }
+   return NULL;
+   }
+
+TR::CompilationRequest *
+TR::CompilationQueue::findPending(void *key)
+   {
+   TR::CompilationRequest *request = _pending[hashKey(key)];
+   while ((NULL != request) && (key != request->_key))
+      request = request->_hashNext;
+   return request;
+   }
+
+void
+TR::CompilationQueue::removePending(TR::CompilationRequest *request)
+   {
+   TR::CompilationRequest **link = &_pending[hashKey(request->_key)];
+   while (NULL != *link)
+      {
+      if (request == *link)
+         {
+         *link = request->_hashNext;
+         request->_hashNext = NULL;
+         return;
+         }
+      link = &(*link)->_hashNext;
+      }
+   }
+
+void
+TR::CompilationQueue::reportStatistics()
+   {
+   if (TR::Options::getVerboseOption(TR_VerbosePerformance))
+      {
+      TR_VerboseLog::writeLineLocked(
+         TR_Vlog_PERF,
+         "compilation queue: threads=%u requests=%u merged=%u upgraded=%u compiled=%u failed=%u cancelled=%u maxDepth=%u",
+         _threadCount,
+         _requestCount,
+         _mergedCount,
+         _upgradedCount,
+         _compiledCount,
+         _failedCount,
+         _cancelledCount,
+         _maxQueueDepth);
+      }
+   }
@@ -0,0 +1,238 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#ifndef TR_COMPILATIONQUEUE_INCL
+#define TR_COMPILATIONQUEUE_INCL
+
+#include <stddef.h>
+#include <stdint.h>
+#include "compile/CompilationTypes.hpp"
+#include "ilgen/IlGeneratorMethodDetails.hpp"
+#include "omrthread.h"
+
+namespace TR { class CompilationQueue; }
+namespace TR { class CompilationRequest; }
+
+namespace TR
+{
+
+/**
+ * @brief Invoked on the compilation thread once a request has finished, before
+ *        any thread blocked in CompilationRequest::wait() is released.
+ */
+typedef void (*CompilationCallback)(TR::CompilationRequest *request, void *userData);
+
+/**
+ * @brief A compilation queued on a TR::CompilationQueue.
+ *
+ * A request is also the future handed back to the requester: once isDone()
+ * answers true, getStartPC() and getReturnCode() hold the result of the
+ * compilation.  Requests are reference counted; every request returned by
+ * CompilationQueue::request() must be handed back to CompilationQueue::release().
+ */
+class CompilationRequest
+   {
+   friend class TR::CompilationQueue;
+
+   public:
+
+   enum State
+      {
+      Queued,
+      InProgress,
+      Done
+      };
+
+   void *getKey() const { return _key; }
+   TR_Hotness getHotness() const { return _hotness; }
+   TR::IlGeneratorMethodDetails &getDetails() { return _details; }
+
+   /**
+    * @brief The entry point of the compiled body, or NULL if the compilation
+    *        failed or was cancelled.  Only meaningful once isDone().
+    */
+   uint8_t *getStartPC() const { return _startPC; }
+
+   /**
+    * @brief The compilation return code (see CompilationReturnCodes).
+    *        COMPILATION_REQUESTED until the request is done.
+    */
+   int32_t getReturnCode() const { return _rc; }
+
+   bool isDone();
+
+   /**
+    * @brief Block until the request is done.
+    * @param[out] rc the compilation return code
+    * @returns the entry point of the compiled body, or NULL on failure
+    */
+   uint8_t *wait(int32_t &rc);
+
+   private:
+
+   struct Callback
+      {
+      TR::CompilationCallback _function;
+      void *_userData;
+      Callback *_next;
+      };
+
+   CompilationRequest(TR::CompilationQueue *queue, void *key, TR::IlGeneratorMethodDetails &details, TR_Hotness hotness);
+
+   TR::CompilationQueue *_queue;
+   void *_key;
+   TR::IlGeneratorMethodDetails _details;
+   TR_Hotness _hotness;
+   State _state;
+   uint32_t _references;
+   uint8_t *_startPC;
+   int32_t _rc;
+   Callback *_callbacks;
+
+   TR::CompilationRequest *_next;     ///< link in the queued list of its hotness level
+   TR::CompilationRequest *_previous;
+   TR::CompilationRequest *_hashNext; ///< link in the pending request table
+   };
+
+/**
+ * @brief An asynchronous compilation service.
+ *
+ * Methods are handed to a pool of omrthread compilation threads that run
+ * compileMethodFromDetails() on them while the requesting thread carries on.
+ * The compilation threads run in parallel, each with its own compilation
+ * thread ID and reserved code cache.  Queued requests are served hottest first
+ * and first come first served within a hotness level.  Requests are deduplicated on a caller supplied key: asking
+ * again for a method that is still queued or being compiled returns the
+ * existing request, raising its hotness if it has not been picked up yet.
+ *
+ * Threads using the queue are attached to the thread library on first use if
+ * they are not already.
+ */
+class CompilationQueue
+   {
+   friend class TR::CompilationRequest;
+
+   public:
+
+   static const uint32_t DEFAULT_COMPILATION_THREADS = 1;
+   static const uintptr_t DEFAULT_COMPILATION_THREAD_STACK_SIZE = 1024 * 1024;
+
+   /**
+    * @brief Create the queue and start its compilation threads.
+    * @returns the queue, or NULL if it could not be started
+    */
+   static TR::CompilationQueue *startup(uint32_t compilationThreads = DEFAULT_COMPILATION_THREADS, uintptr_t stackSize = DEFAULT_COMPILATION_THREAD_STACK_SIZE);
+
+   /**
+    * @brief Cancel the requests that are still queued, wait for the ones in
+    *        progress and stop the compilation threads.
+    *
+    * Requests should all have been released by then; if some are still held
+    * the queue stays allocated so that their holders stay safe, and is freed
+    * when the last of them is released.
+    */
+   static void shutdown();
+
+   static TR::CompilationQueue *instance() { return _instance; }
+
+   /**
+    * @brief Queue a compilation.
+    *
+    * @param key identifies the method for deduplication
+    * @param details describes the method; it is copied into the request
+    * @param hotness the optimization level of the compilation
+    * @param callback invoked on the compilation thread when the request is done; may be NULL
+    * @param userData passed to callback
+    * @returns the request, which must be released by the caller, or NULL if
+    *          the queue is shutting down or out of memory
+    */
+   TR::CompilationRequest *request(void *key, TR::IlGeneratorMethodDetails &details, TR_Hotness hotness, TR::CompilationCallback callback = NULL, void *userData = NULL);
+
+   /**
+    * @brief Find the request pending for key, if any.
+    * @returns the request with a reference for the caller, or NULL
+    */
+   TR::CompilationRequest *find(void *key);
+
+   /**
+    * @brief Drop a reference to a request.
+    */
+   static void release(TR::CompilationRequest *request);
+
+   uint32_t getCompilationThreadCount() const { return _threadCount; }
+
+   private:
+
+   static const uintptr_t PENDING_TABLE_SIZE = 256;
+
+   CompilationQueue();
+
+   bool initialize(uint32_t compilationThreads, uintptr_t stackSize);
+   void tearDown();
+   void destroy();
+
+   static omrthread_t attachCurrentThread();
+   static int J9THREAD_PROC compilationThreadEntry(void *queue);
+   void compilationThreadLoop();
+
+   void compile(TR::CompilationRequest *request, int32_t compThreadID);
+   void complete(TR::CompilationRequest *request, uint8_t *startPC, int32_t rc, bool cancelled);
+
+   void enqueue(TR::CompilationRequest *request);
+   void dequeue(TR::CompilationRequest *request);
+   TR::CompilationRequest *nextRequest();
+
+   uintptr_t hashKey(void *key) const { return (((uintptr_t)key) >> 3) % PENDING_TABLE_SIZE; }
+   TR::CompilationRequest *findPending(void *key);
+   void removePending(TR::CompilationRequest *request);
+
+   void reportStatistics();
+
+   static TR::CompilationQueue *_instance;
+
+   omrthread_monitor_t _queueMonitor;      ///< guards the queue, the pending table and the thread count
+   omrthread_monitor_t _completionMonitor; ///< guards request states, reference counts and _liveRequests
+   omrthread_monitor_t _compilationMonitor; ///< serializes calls into the compiler where it has no thread local storage or with serializeCompilations
+
+   TR::CompilationRequest *_queueHead[numHotnessLevels];
+   TR::CompilationRequest *_queueTail[numHotnessLevels];
+   TR::CompilationRequest *_pending[PENDING_TABLE_SIZE];
+
+   uint32_t _threadCount;
+   uint32_t _activeThreads;
+   int32_t _lastCompilationThreadID;
+   uint32_t _liveRequests;
+   bool _shuttingDown;
+   bool _freeOnLastRelease; ///< set by shutdown() when requests were still held; guarded by _completionMonitor
+
+   uint32_t _queueDepth;
+   uint32_t _maxQueueDepth;
+   uint32_t _requestCount;
+   uint32_t _mergedCount;
+   uint32_t _upgradedCount;
+   uint32_t _compiledCount;
+   uint32_t _failedCount;
+   uint32_t _cancelledCount;
+   };
+
+}
+
+#endif
@@ -56,38 +56,37 @@
 #include "infra/Assert.hpp"
 #include "infra/String.hpp"
 #include "ras/Debug.hpp"
-#include "env/SystemSegmentProvider.hpp"
 #include "env/DebugSegmentProvider.hpp"
+#include "env/PooledSegmentProvider.hpp"
+#include "env/SharedSegmentPool.hpp"
 #include "omrformatconsts.h"
 #include "runtime/CodeCacheManager.hpp"
+#include "runtime/PersistentCodeCache.hpp"
 
-static void
-writePerfToolEntry(void *start, uint32_t size, const char *name)
+static FILE *
+openPerfToolFile()
    {
-   // race condition
-   static bool firstAttempt = true;
-   static FILE *perfFile = 0;
-
-   if (firstAttempt)
-      {
-      firstAttempt = false;
 #if defined(OMR_OS_WINDOWS)
-      int jvmPid = _getpid();
+   int jvmPid = _getpid();
 #else
-      pid_t jvmPid = getpid();
+   pid_t jvmPid = getpid();
 #endif
-      static const int maxPerfFilenameSize = 15 + sizeof(jvmPid)* 3; // "/tmp/perf-%ld.map"
-      char perfFilename[maxPerfFilenameSize] = { 0 };
+   static const int maxPerfFilenameSize = 15 + sizeof(jvmPid)* 3; // "/tmp/perf-%ld.map"
+   char perfFilename[maxPerfFilenameSize] = { 0 };
+
+   bool truncated = TR::snprintfTrunc(perfFilename, maxPerfFilenameSize, "/tmp/perf-%" OMR_PRId64 ".map", static_cast<int64_t>(jvmPid));
+   if (truncated)
+      return NULL;
+
+   return fopen(perfFilename, "a");
+   }
+
+static void
+writePerfToolEntry(void *start, uint32_t size, const char *name)
+   {
+   // Compilations running in parallel all wait for the first one to open the file
+   static FILE *perfFile = openPerfToolFile();
 
-      bool truncated = TR::snprintfTrunc(perfFilename, maxPerfFilenameSize, "/tmp/perf-%" OMR_PRId64 ".map", static_cast<int64_t>(jvmPid));
-      if (!truncated)
-         {
-         perfFile = fopen(perfFilename, "a");
-         }
-      if (!perfFile) // couldn't open the file
-         {
-         }
-      }
    if (perfFile)
       {
       // perf does not want 0x leading the hex start address and length of the compiled code region
@@ -148,6 +147,13 @@ int32_t commonJitInit(OMR::FrontEnd &fe, char *cmdLineOptions)
    TR::Options::getCmdLineOptions()->setOption(TR_NoRecompile);
    TR::CompilationController::init(NULL);
 
+   // Scratch segments are recycled across compilations unless asked otherwise
+   if (!TR::Options::getCmdLineOptions()->getOption(TR_DisableSharedSegmentPool))
+      TR::SharedSegmentPool::create(1 << 16, TR::RawAllocator());
+
+   if (TR::Options::getCmdLineOptions()->getPersistentCodeCacheFileName())
+      TR::PersistentCodeCache::create(TR::Options::getCmdLineOptions()->getPersistentCodeCacheFileName(), TR::RawAllocator());
+
    void *pseudoTOC = NULL;
 #if defined(TR_TARGET_POWER)
 
@@ -270,13 +276,14 @@ compileMethodFromDetails(
       OMR_VMThread *omrVMThread,
       TR::IlGeneratorMethodDetails & details,
       TR_Hotness hotness,
-      int32_t &rc)
+      int32_t &rc,
+      int32_t compThreadID)
    {
    uint64_t translationStartTime = TR::Compiler->vm.getUSecClock();
    OMR::FrontEnd &fe = OMR::FrontEnd::singleton();
    auto jitConfig = fe.jitConfig();
    TR::RawAllocator rawAllocator;
-   TR::SystemSegmentProvider defaultSegmentProvider(1 << 16, rawAllocator);
+   TR::PooledSegmentProvider defaultSegmentProvider(1 << 16, TR::SharedSegmentPool::instance(), rawAllocator);
    TR::DebugSegmentProvider debugSegmentProvider(1 << 16, rawAllocator);
    TR::SegmentAllocator &scratchSegmentProvider =
       TR::Options::getCmdLineOptions()->getOption(TR_EnableScratchMemoryDebugging) ?
@@ -328,7 +335,7 @@ compileMethodFromDetails(
    // FIXME: perhaps use stack memory instead
 
    TR_ASSERT(TR::comp() == NULL, "there seems to be a current TLS TR::Compilation object %p for this thread. At this point there should be no current TR::Compilation object", TR::comp());
-   TR::Compilation compiler(0, omrVMThread, &fe, &compilee, request, options, dispatchRegion, &trMemory, plan);
+   TR::Compilation compiler(compThreadID, omrVMThread, &fe, &compilee, request, options, dispatchRegion, &trMemory, plan);
    TR_ASSERT(TR::comp() == &compiler, "the TLS TR::Compilation object %p for this thread does not match the one %p just created.", TR::comp(), &compiler);
 
    try
@@ -464,7 +471,8 @@ compileMethodFromDetails(
    // A better place to do this would have been the destructor for
    // TR::Compilation. We'll need exceptions working instead of setjmp
    // before we can get working, and we need to make sure the other
-   // frontends are properly calling the destructor
+   // frontends are properly calling the destructor.  A compilation thread
+   // may keep the cache reserved for its next compilation.
    TR::CodeCache *codeCache = compiler.cg() ? compiler.cg()->getCodeCache() : NULL;
    TR::CodeCacheManager::instance()->unreserveCodeCache(codeCache);
 
@@ -229,7 +229,7 @@ enum TR_CompilationOptions
    TR_EnableYieldVMAccess                 = 0x02000000 + 4,
    TR_DisableNoVMAccess                   = 0x04000000 + 4,
    TR_DisableStoreSinking                 = 0x08000000 + 4,
-   // Available                           = 0x10000000 + 4,
+   TR_SerializeCompilations               = 0x10000000 + 4,
    TR_HWProfileDeleteEmptyBlocks          = 0x20000000 + 4,
    TR_DisableLiveMonitorMetadata          = 0x40000000 + 4,
    TR_DisableMonitorOpts                  = 0x80000000 + 4,
@@ -390,7 +390,7 @@ enum TR_CompilationOptions
    // Available                           = 0x00000040 + 10,
    // Available                           = 0x00000080 + 10,
    TR_FirstLevelProfiling                 = 0x00000100 + 10,
-   // Available                           = 0x00000200 + 10,
+   TR_DisableSharedSegmentPool            = 0x00000200 + 10,
    // Available                           = 0x00000400 + 10,
    // Available                           = 0x00000800 + 10,
    // Available                           = 0x00001000 + 10,
@@ -1487,6 +1487,8 @@ public:
       _maxSzForVPInliningWarm = 0;
       _loopyAsyncCheckInsertionMaxEntryFreq = 0;
       _objectFileName = 0;
+      _persistentCodeCacheFileName = 0;
+      _hotCodeCacheKB = 0;
 
       memset(_options, 0, sizeof(_options));
       memset(_disabledOptimizations, false, sizeof(_disabledOptimizations));
@@ -1540,6 +1542,9 @@ public:
    void            setLogFile(TR::FILE * f)  {_logFile = f;}
    char *          getLogFileName()      {return _logFileName;}
 
+   char *          getStartOptions()     {return _startOptions;}
+   char *          getEnvOptions()       {return _envOptions;}
+
    char *          getBlockShufflingSequence(){ return _blockShufflingSequence; }
 
    int32_t         getRandomSeed(){ return _randomSeed; }
@@ -2002,6 +2007,8 @@ public:
    void disableCHOpts(); // disable CHOpts, but also IPA and prex which depend on the chtable
 
    const char *getObjectFileName() { return _objectFileName; }
+   const char *getPersistentCodeCacheFileName() { return _persistentCodeCacheFileName; }
+   int32_t getHotCodeCacheKB() { return _hotCodeCacheKB; }
 
 protected:
    void  jitPreProcess();
@@ -2478,6 +2485,8 @@ protected:
    int32_t                     _loopyAsyncCheckInsertionMaxEntryFreq;
 
    char *                      _objectFileName; //Name of the relocatable ELF file *.o if one is to be generated
+   char *                      _persistentCodeCacheFileName; //Name of the file compiled code is kept in across runs
+   int32_t                     _hotCodeCacheKB; //Size of the code cache segment hot compilations are placed in
 
    }; // TR::Options
 
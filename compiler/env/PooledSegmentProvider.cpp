@@ -0,0 +1,53 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "env/PooledSegmentProvider.hpp"
+#include "infra/Assert.hpp"
+
+OMR::PooledSegmentProvider::PooledSegmentProvider(size_t segmentSize, TR::SharedSegmentPool *pool, TR::RawAllocator rawAllocator) :
+   TR::SystemSegmentProvider(segmentSize, rawAllocator),
+   _pool(pool)
+   {
+   TR_ASSERT(!pool || pool->segmentSize() == segmentSize, "Segment size %zu does not match the pool's %zu", segmentSize, pool->segmentSize());
+   }
+
+OMR::PooledSegmentProvider::~PooledSegmentProvider() throw()
+   {
+   // Return the segments to the pool while this class's hooks still apply
+   releaseSegments();
+   if (_pool)
+      _pool->compilationEnded();
+   }
+
+void *
+OMR::PooledSegmentProvider::allocateSegmentArea(size_t size)
+   {
+   return _pool ? _pool->allocate(size) : TR::SystemSegmentProvider::allocateSegmentArea(size);
+   }
+
+void
+OMR::PooledSegmentProvider::deallocateSegmentArea(void *area, size_t size) throw()
+   {
+   if (_pool)
+      _pool->deallocate(area, size);
+   else
+      TR::SystemSegmentProvider::deallocateSegmentArea(area, size);
+   }
@@ -0,0 +1,62 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#ifndef OMR_POOLED_SEGMENT_PROVIDER
+#define OMR_POOLED_SEGMENT_PROVIDER
+
+#pragma once
+
+#ifndef TR_POOLED_SEGMENT_PROVIDER
+#define TR_POOLED_SEGMENT_PROVIDER
+namespace OMR { class PooledSegmentProvider; }
+namespace TR { using OMR::PooledSegmentProvider; }
+#endif
+
+#include <stddef.h>
+#include "env/SystemSegmentProvider.hpp"
+#include "env/RawAllocator.hpp"
+#include "env/SharedSegmentPool.hpp"
+
+namespace OMR {
+
+/** @class PooledSegmentProvider
+ *  @brief A segment provider for a single compilation that draws its memory
+ *  from a TR::SharedSegmentPool, so that segments are recycled across
+ *  compilations rather than returned to the operating system.  Without a
+ *  pool it behaves exactly like a TR::SystemSegmentProvider.
+ **/
+class PooledSegmentProvider : public TR::SystemSegmentProvider
+   {
+public:
+   PooledSegmentProvider(size_t segmentSize, TR::SharedSegmentPool *pool, TR::RawAllocator rawAllocator);
+   ~PooledSegmentProvider() throw();
+
+protected:
+   virtual void *allocateSegmentArea(size_t size);
+   virtual void deallocateSegmentArea(void *area, size_t size) throw();
+
+private:
+   TR::SharedSegmentPool * const _pool;
+   };
+
+} // namespace OMR
+
+#endif // OMR_POOLED_SEGMENT_PROVIDER
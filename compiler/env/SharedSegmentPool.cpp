@@ -0,0 +1,424 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if (defined(LINUX) && !defined(OMRZTPF)) || defined(__APPLE__) || defined(_AIX)
+#include <sys/mman.h>
+#if defined(__APPLE__) || !defined(MAP_ANONYMOUS)
+#define MAP_ANONYMOUS MAP_ANON
+#endif
+#elif defined(OMR_OS_WINDOWS)
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+#endif /* defined(OMR_OS_WINDOWS) */
+
+#include "env/SharedSegmentPool.hpp"
+
+#include <new>
+#include "control/Options.hpp"
+#include "control/Options_inlines.hpp"
+#include "env/VerboseLog.hpp"
+#include "infra/Assert.hpp"
+#include "infra/Monitor.hpp"
+#include "infra/ThreadLocal.hpp"
+
+static tlsDefine(void *, segmentPoolThreadCache);
+static tlsDefine(void *, segmentPoolThreadCacheGeneration);
+static bool segmentPoolTLSAllocated = false;
+
+OMR::SharedSegmentPool *OMR::SharedSegmentPool::_instance = NULL;
+uintptr_t OMR::SharedSegmentPool::_generation = 0;
+
+OMR::SharedSegmentPool::SharedSegmentPool(size_t segmentSize, TR::RawAllocator rawAllocator) :
+   _segmentSize(segmentSize),
+   _rawAllocator(rawAllocator),
+   _monitor(NULL),
+   _threadCaches(NULL),
+   _free(SegmentVectorAllocator(rawAllocator)),
+   _releasedCount(0),
+   _mappedSegments(0),
+   _outstandingSegments(0),
+   _windowPeakOutstanding(0),
+   _compilationsSinceTrim(0),
+   _requests(0),
+   _reused(0),
+   _largeRequests(0),
+   _releasedSegments(0),
+   _unmappedSegments(0),
+   _mappedBytes(0),
+   _peakMappedBytes(0)
+   {
+   }
+
+OMR::SharedSegmentPool::~SharedSegmentPool() throw()
+   {
+   if (NULL != _monitor)
+      TR::Monitor::destroy(_monitor);
+   }
+
+OMR::SharedSegmentPool *
+OMR::SharedSegmentPool::create(size_t segmentSize, TR::RawAllocator rawAllocator)
+   {
+   if (NULL != _instance)
+      return _instance;
+
+   void *storage = rawAllocator.allocate(sizeof(SharedSegmentPool), std::nothrow);
+   if (NULL == storage)
+      return NULL;
+
+   SharedSegmentPool *pool = new (storage) SharedSegmentPool(segmentSize, rawAllocator);
+   pool->_monitor = TR::Monitor::create("JIT-SharedSegmentPoolMonitor");
+   if (NULL == pool->_monitor)
+      {
+      pool->~SharedSegmentPool();
+      rawAllocator.deallocate(storage);
+      return NULL;
+      }
+
+   // The thread local keys and the generation are in place before the pool
+   // is published, which leaving the monitor orders
+   pool->_monitor->enter();
+   if (!segmentPoolTLSAllocated)
+      {
+      tlsAlloc(segmentPoolThreadCache);
+      tlsAlloc(segmentPoolThreadCacheGeneration);
+      segmentPoolTLSAllocated = true;
+      }
+   _generation += 1;
+   pool->_monitor->exit();
+
+   _instance = pool;
+   return pool;
+   }
+
+void
+OMR::SharedSegmentPool::destroy()
+   {
+   SharedSegmentPool *pool = _instance;
+   if (NULL == pool)
+      return;
+
+   ThreadCache *cache = pool->_threadCaches;
+   while (NULL != cache)
+      {
+      pool->foldStatistics(cache);
+      while (0 != cache->_count)
+         pool->unmap(cache->_segments[--cache->_count], pool->_segmentSize);
+      ThreadCache *next = cache->_next;
+      pool->_rawAllocator.deallocate(cache);
+      cache = next;
+      }
+   pool->_threadCaches = NULL;
+
+   for (size_t i = 0; i < pool->_free.size(); i++)
+      pool->unmap(pool->_free[i], pool->_segmentSize);
+   pool->_free.clear();
+
+   pool->reportStatistics();
+
+   _instance = NULL;
+   TR::RawAllocator rawAllocator(pool->_rawAllocator);
+   pool->~SharedSegmentPool();
+   rawAllocator.deallocate(pool);
+   }
+
+// The calling thread's cache for this pool, or NULL if it has none yet
+OMR::SharedSegmentPool::ThreadCache *
+OMR::SharedSegmentPool::currentThreadCache()
+   {
+   if (reinterpret_cast<uintptr_t>(tlsGet(segmentPoolThreadCacheGeneration, void *)) != _generation)
+      return NULL;
+   return static_cast<ThreadCache *>(tlsGet(segmentPoolThreadCache, void *));
+   }
+
+OMR::SharedSegmentPool::ThreadCache *
+OMR::SharedSegmentPool::threadCache()
+   {
+   ThreadCache *cache = currentThreadCache();
+   if (NULL == cache)
+      {
+      cache = static_cast<ThreadCache *>(_rawAllocator.allocate(sizeof(ThreadCache), std::nothrow));
+      if (NULL == cache)
+         return NULL;
+      cache->_count = 0;
+      cache->_requests = 0;
+      cache->_hits = 0;
+
+      _monitor->enter();
+      cache->_next = _threadCaches;
+      _threadCaches = cache;
+      _monitor->exit();
+
+      tlsSet(segmentPoolThreadCache, cache);
+      tlsSet(segmentPoolThreadCacheGeneration, reinterpret_cast<void *>(_generation));
+      }
+   return cache;
+   }
+
+void *
+OMR::SharedSegmentPool::allocate(size_t size)
+   {
+   if (size != _segmentSize)
+      {
+      void *area = map(size);
+      _monitor->enter();
+      _largeRequests += 1;
+      _mappedBytes += size;
+      _peakMappedBytes = _mappedBytes > _peakMappedBytes ? _mappedBytes : _peakMappedBytes;
+      _monitor->exit();
+      return area;
+      }
+
+   ThreadCache *cache = threadCache();
+   if (NULL != cache)
+      {
+      cache->_requests += 1;
+      if (0 == cache->_count)
+         refill(cache);
+      if (0 != cache->_count)
+         {
+         cache->_hits += 1;
+         return cache->_segments[--cache->_count];
+         }
+      }
+   else
+      {
+      _monitor->enter();
+      _requests += 1;
+      if (!_free.empty())
+         {
+         void *area = _free.back();
+         _free.pop_back();
+         _releasedCount = _releasedCount > _free.size() ? _free.size() : _releasedCount;
+         _reused += 1;
+         _outstandingSegments += 1;
+         _windowPeakOutstanding = _outstandingSegments > _windowPeakOutstanding ? _outstandingSegments : _windowPeakOutstanding;
+         _monitor->exit();
+         return area;
+         }
+      _monitor->exit();
+      }
+
+   void *area = map(_segmentSize);
+   _monitor->enter();
+   _mappedSegments += 1;
+   _outstandingSegments += 1;
+   _windowPeakOutstanding = _outstandingSegments > _windowPeakOutstanding ? _outstandingSegments : _windowPeakOutstanding;
+   _mappedBytes += _segmentSize;
+   _peakMappedBytes = _mappedBytes > _peakMappedBytes ? _mappedBytes : _peakMappedBytes;
+   _monitor->exit();
+   return area;
+   }
+
+void
+OMR::SharedSegmentPool::deallocate(void *area, size_t size) throw()
+   {
+   if (size != _segmentSize)
+      {
+      unmap(area, size);
+      _monitor->enter();
+      _mappedBytes -= size;
+      _monitor->exit();
+      return;
+      }
+
+   ThreadCache *cache = currentThreadCache();
+   if (NULL != cache)
+      {
+      if (THREAD_CACHE_CAPACITY == cache->_count)
+         spill(cache, THREAD_CACHE_CAPACITY / 2);
+      cache->_segments[cache->_count++] = area;
+      return;
+      }
+
+   _monitor->enter();
+   try
+      {
+      _free.push_back(area);
+      _outstandingSegments -= 1;
+      _monitor->exit();
+      }
+   catch (...)
+      {
+      _outstandingSegments -= 1;
+      _mappedSegments -= 1;
+      _mappedBytes -= _segmentSize;
+      _unmappedSegments += 1;
+      _monitor->exit();
+      unmap(area, _segmentSize);
+      }
+   }
+
+// Move up to half a cache worth of free segments from the pool to the cache
+void
+OMR::SharedSegmentPool::refill(ThreadCache *cache)
+   {
+   _monitor->enter();
+   foldStatistics(cache);
+   uint32_t batch = THREAD_CACHE_CAPACITY / 2;
+   while ((0 != batch) && !_free.empty())
+      {
+      cache->_segments[cache->_count++] = _free.back();
+      _free.pop_back();
+      _outstandingSegments += 1;
+      batch -= 1;
+      }
+   _releasedCount = _releasedCount > _free.size() ? _free.size() : _releasedCount;
+   _windowPeakOutstanding = _outstandingSegments > _windowPeakOutstanding ? _outstandingSegments : _windowPeakOutstanding;
+   _monitor->exit();
+   }
+
+// Return all but keep of the cached segments to the pool
+void
+OMR::SharedSegmentPool::spill(ThreadCache *cache, uint32_t keep) throw()
+   {
+   _monitor->enter();
+   while (cache->_count > keep)
+      {
+      void *area = cache->_segments[--cache->_count];
+      _outstandingSegments -= 1;
+      try
+         {
+         _free.push_back(area);
+         }
+      catch (...)
+         {
+         unmap(area, _segmentSize);
+         _mappedSegments -= 1;
+         _mappedBytes -= _segmentSize;
+         _unmappedSegments += 1;
+         }
+      }
+   _monitor->exit();
+   }
+
+// Caller holds the monitor
+void
+OMR::SharedSegmentPool::foldStatistics(ThreadCache *cache)
+   {
+   _requests += cache->_requests;
+   _reused += cache->_hits;
+   cache->_requests = 0;
+   cache->_hits = 0;
+   }
+
+void
+OMR::SharedSegmentPool::compilationEnded()
+   {
+   ThreadCache *cache = currentThreadCache();
+   _monitor->enter();
+   if (NULL != cache)
+      foldStatistics(cache);
+   _compilationsSinceTrim += 1;
+   if (_compilationsSinceTrim >= TRIM_INTERVAL)
+      trim();
+   _monitor->exit();
+   }
+
+// Caller holds the monitor
+void
+OMR::SharedSegmentPool::trim() throw()
+   {
+   // Segments that recent compilations could ask for again on top of what is
+   // already out of the pool
+   size_t demand = _windowPeakOutstanding > _outstandingSegments ? _windowPeakOutstanding - _outstandingSegments : 0;
+   size_t keepMapped = 2 * demand;
+
+   // The coldest segments are at the front
+   if (_free.size() > keepMapped)
+      {
+      size_t excess = _free.size() - keepMapped;
+      for (size_t i = 0; i < excess; i++)
+         unmap(_free[i], _segmentSize);
+      _mappedSegments -= excess;
+      _mappedBytes -= excess * _segmentSize;
+      _unmappedSegments += excess;
+      _free.erase(_free.begin(), _free.begin() + excess);
+      _releasedCount = _releasedCount > excess ? _releasedCount - excess : 0;
+      }
+
+   while (_free.size() - _releasedCount > demand)
+      {
+      releasePages(_free[_releasedCount], _segmentSize);
+      _releasedCount += 1;
+      _releasedSegments += 1;
+      }
+
+   _windowPeakOutstanding = _outstandingSegments;
+   _compilationsSinceTrim = 0;
+   }
+
+void *
+OMR::SharedSegmentPool::map(size_t size)
+   {
+#if (defined(LINUX) && !defined(OMRZTPF)) || defined(__APPLE__) || defined(_AIX)
+   void *area = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_ANONYMOUS | MAP_PRIVATE, -1, 0);
+   if (area == MAP_FAILED) throw std::bad_alloc();
+#elif defined(OMR_OS_WINDOWS)
+   void *area = VirtualAlloc(NULL, size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+   if (!area) throw std::bad_alloc();
+#else
+   void *area = _rawAllocator.allocate(size);
+#endif /* (defined(LINUX) && !defined(OMRZTPF)) || defined(__APPLE__) || defined(_AIX) */
+   return area;
+   }
+
+void
+OMR::SharedSegmentPool::unmap(void *area, size_t size) throw()
+   {
+#if (defined(LINUX) && !defined(OMRZTPF)) || defined(__APPLE__) || defined(_AIX)
+   munmap(area, size);
+#elif defined(OMR_OS_WINDOWS)
+   VirtualFree(area, 0, MEM_RELEASE);
+#else
+   _rawAllocator.deallocate(area, size);
+#endif /* (defined(LINUX) && !defined(OMRZTPF)) || defined(__APPLE__) || defined(_AIX) */
+   }
+
+// Give the physical pages back while keeping the address range mapped
+void
+OMR::SharedSegmentPool::releasePages(void *area, size_t size) throw()
+   {
+#if ((defined(LINUX) && !defined(OMRZTPF)) || defined(__APPLE__) || defined(_AIX)) && defined(MADV_DONTNEED)
+   madvise(area, size, MADV_DONTNEED);
+#elif defined(OMR_OS_WINDOWS)
+   VirtualAlloc(area, size, MEM_RESET, PAGE_READWRITE);
+#endif
+   }
+
+void
+OMR::SharedSegmentPool::reportStatistics()
+   {
+   if (TR::Options::getCmdLineOptions() && TR::Options::getVerboseOption(TR_VerbosePerformance))
+      {
+      double reuseRate = _requests ? (100.0 * _reused) / _requests : 0.0;
+      TR_VerboseLog::writeLineLocked(
+         TR_Vlog_MEMORY,
+         "scratch segment pool: segment=%lluKB requests=%llu reused=%llu (%.1f%%) large=%llu peak=%lluKB released=%llu unmapped=%llu",
+         static_cast<unsigned long long>(_segmentSize) / 1024,
+         static_cast<unsigned long long>(_requests),
+         static_cast<unsigned long long>(_reused),
+         reuseRate,
+         static_cast<unsigned long long>(_largeRequests),
+         static_cast<unsigned long long>(_peakMappedBytes) / 1024,
+         static_cast<unsigned long long>(_releasedSegments),
+         static_cast<unsigned long long>(_unmappedSegments));
+      }
+   }
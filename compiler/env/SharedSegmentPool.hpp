@@ -0,0 +1,162 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#ifndef OMR_SHARED_SEGMENT_POOL
+#define OMR_SHARED_SEGMENT_POOL
+
+#pragma once
+
+#ifndef TR_SHARED_SEGMENT_POOL
+#define TR_SHARED_SEGMENT_POOL
+namespace OMR { class SharedSegmentPool; }
+namespace TR { using OMR::SharedSegmentPool; }
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+#include "env/TypedAllocator.hpp"
+#include "env/RawAllocator.hpp"
+
+namespace TR { class Monitor; }
+
+namespace OMR {
+
+/** @class SharedSegmentPool
+ *  @brief The SharedSegmentPool class keeps the memory behind compiler scratch
+ *  segments around between compilations.
+ *
+ *  Segments of the default size are recycled instead of being mapped and
+ *  unmapped for every compilation.  Each thread keeps a small cache of free
+ *  segments so that most requests are served without taking the pool lock;
+ *  the caches spill into, and refill from, the process-wide pool in batches.
+ *
+ *  Every few compilations the pool is trimmed against the high water mark of
+ *  the segments drawn from it since the previous trim: free segments beyond
+ *  that demand have their pages handed back to the operating system with
+ *  madvise, keeping the address range for reuse, and segments beyond twice
+ *  that demand are unmapped.  Larger requests bypass the pool.
+ **/
+class SharedSegmentPool
+   {
+public:
+   static SharedSegmentPool *create(size_t segmentSize, TR::RawAllocator rawAllocator);
+   static SharedSegmentPool *instance() { return _instance; }
+
+   /**
+    * @brief Free every pooled segment and the thread caches themselves,
+    *        and report the pool statistics under verbose={performance}.
+    *        No compilation may be running.
+    */
+   static void destroy();
+
+   size_t segmentSize() const { return _segmentSize; }
+
+   void *allocate(size_t size);
+   void deallocate(void *area, size_t size) throw();
+
+   /**
+    * @brief Called at the end of each compilation to fold the thread's
+    *        statistics into the pool and trim it periodically.
+    */
+   void compilationEnded();
+
+   /// Default size segments currently mapped, wherever they are
+   size_t mappedSegments() const { return _mappedSegments; }
+
+   /// Free default size segments held by the pool itself, not by thread caches
+   size_t freeSegments() const { return _free.size(); }
+
+   /// Free segments whose pages have been given back but that are still mapped
+   size_t releasedFreeSegments() const { return _releasedCount; }
+
+   /// Default size segments unmapped by trimming since the pool was created
+   uint64_t unmappedSegments() const { return _unmappedSegments; }
+
+   /// Segments a thread keeps cached before spilling half of them to the pool
+   static const uint32_t THREAD_CACHE_CAPACITY = 16;
+
+   /// Compilations between two trims of the pool
+   static const uint32_t TRIM_INTERVAL = 32;
+
+private:
+
+   struct ThreadCache
+      {
+      void *_segments[THREAD_CACHE_CAPACITY];
+      uint32_t _count;
+      uint64_t _requests;
+      uint64_t _hits;
+      ThreadCache *_next;
+      };
+
+   SharedSegmentPool(size_t segmentSize, TR::RawAllocator rawAllocator);
+   ~SharedSegmentPool() throw();
+
+   ThreadCache *currentThreadCache();
+   ThreadCache *threadCache();
+   void refill(ThreadCache *cache);
+   void spill(ThreadCache *cache, uint32_t keep) throw();
+   void foldStatistics(ThreadCache *cache);
+   void trim() throw();
+   void reportStatistics();
+
+   void *map(size_t size);
+   void unmap(void *area, size_t size) throw();
+   void releasePages(void *area, size_t size) throw();
+
+   static SharedSegmentPool *_instance;
+
+   /// Each pool gets a new generation.  A thread only uses the cache it
+   /// recorded for the current generation, so the caches of a destroyed pool
+   /// can be freed although threads still point at them
+   static uintptr_t _generation;
+
+   /// Caches of all threads that have used this pool
+   ThreadCache *_threadCaches;
+
+   size_t const _segmentSize;
+   TR::RawAllocator _rawAllocator;
+   TR::Monitor *_monitor;
+
+   typedef TR::typed_allocator<void *, TR::RawAllocator> SegmentVectorAllocator;
+
+   /// Free segments; the first _releasedCount have had their pages given back
+   std::vector<void *, SegmentVectorAllocator> _free;
+   size_t _releasedCount;
+
+   size_t _mappedSegments;     ///< default size segments currently mapped
+   size_t _outstandingSegments; ///< default size segments outside the shared pool
+   size_t _windowPeakOutstanding;
+   uint32_t _compilationsSinceTrim;
+
+   uint64_t _requests;
+   uint64_t _reused;
+   uint64_t _largeRequests;
+   uint64_t _releasedSegments;
+   uint64_t _unmappedSegments;
+   size_t _mappedBytes;
+   size_t _peakMappedBytes;
+   };
+
+}
+
+#endif // OMR_SHARED_SEGMENT_POOL
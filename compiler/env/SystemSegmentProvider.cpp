@@ -32,18 +32,38 @@ OMR::SystemSegmentProvider::SystemSegmentProvider(size_t segmentSize, TR::RawAll
    }
 
 OMR::SystemSegmentProvider::~SystemSegmentProvider() throw()
+   {
+   releaseSegments();
+   }
+
+void *
+OMR::SystemSegmentProvider::allocateSegmentArea(size_t size)
+   {
+   return _rawAllocator.allocate(size);
+   }
+
+void
+OMR::SystemSegmentProvider::deallocateSegmentArea(void *area, size_t size) throw()
+   {
+   _rawAllocator.deallocate(area);
+   }
+
+void
+OMR::SystemSegmentProvider::releaseSegments() throw()
    {
    for (auto it = _segments.begin(); it != _segments.end(); ++it)
       {
-      _rawAllocator.deallocate((*it).base());
+      deallocateSegmentArea((*it).base(), (*it).size());
       }
+   _segments.clear();
+   _currentBytesAllocated = 0;
    }
 
 TR::MemorySegment &
 OMR::SystemSegmentProvider::request(size_t requiredSize)
    {
    size_t adjustedSize = ( ( requiredSize + (defaultSegmentSize() - 1) ) / defaultSegmentSize() ) * defaultSegmentSize();
-   void *newSegmentArea = _rawAllocator.allocate(adjustedSize);
+   void *newSegmentArea = allocateSegmentArea(adjustedSize);
    try
       {
       auto result = _segments.insert( TR::MemorySegment(newSegmentArea, adjustedSize) );
@@ -55,7 +75,7 @@ OMR::SystemSegmentProvider::request(size_t requiredSize)
       }
    catch (...)
       {
-      _rawAllocator.deallocate(newSegmentArea);
+      deallocateSegmentArea(newSegmentArea, adjustedSize);
       throw;
       }
    }
@@ -64,7 +84,7 @@ void
 OMR::SystemSegmentProvider::release(TR::MemorySegment &segment) throw()
    {
    auto it = _segments.find(segment);
-   _rawAllocator.deallocate(segment.base());
+   deallocateSegmentArea(segment.base(), segment.size());
    _currentBytesAllocated -= segment.size();
    TR_ASSERT(it != _segments.end(), "Segment lookup should never fail");
    _segments.erase(it);
@@ -52,6 +52,21 @@ public:
    size_t allocationLimit() const throw();
    void setAllocationLimit(size_t);
 
+protected:
+   /**
+    * @brief Hooks through which every segment is allocated and freed, for
+    *        providers that take their memory from elsewhere.
+    */
+   virtual void *allocateSegmentArea(size_t size);
+   virtual void deallocateSegmentArea(void *area, size_t size) throw();
+
+   /**
+    * @brief Free all outstanding segments.  A provider that overrides the
+    *        hooks calls this from its own destructor, since the hooks are no
+    *        longer dispatched to it by the time this class is destroyed.
+    */
+   void releaseSegments() throw();
+
 private:
    TR::RawAllocator _rawAllocator;
    size_t _currentBytesAllocated;
@@ -38,6 +38,7 @@
 #include "codegen/CodeGenerator.hpp"
 #include "compile/Compilation.hpp"
 #include "compile/SymbolReferenceTable.hpp"
+#include "control/CompilationQueue.hpp"
 #include "control/CompileMethod.hpp"
 #include "control/Recompilation.hpp"
 #include "infra/Assert.hpp"
@@ -122,7 +123,9 @@ OMR::MethodBuilder::MethodBuilder(TR::TypeDictionary *types, TR::VirtualMachineS
    _inlineSiteIndex(-1),
    _nextInlineSiteIndex(0),
    _returnBuilder(NULL),
-   _returnSymbolName(NULL)
+   _returnSymbolName(NULL),
+   _asyncRequest(NULL),
+   _asyncResolvedMethod(NULL)
    {
    _definingLine[0] = '\0';
    }
@@ -155,7 +158,9 @@ OMR::MethodBuilder::MethodBuilder(TR::MethodBuilder *callerMB, TR::VirtualMachin
    _inlineSiteIndex(callerMB->getNextInlineSiteIndex()),
    _nextInlineSiteIndex(0),
    _returnBuilder(NULL),
-   _returnSymbolName(NULL)
+   _returnSymbolName(NULL),
+   _asyncRequest(NULL),
+   _asyncResolvedMethod(NULL)
    {
    _definingLine[0] = '\0';
    initialize(callerMB->_details, callerMB->_methodSymbol, callerMB->_fe, callerMB->_symRefTab);
@@ -163,6 +168,13 @@ OMR::MethodBuilder::MethodBuilder(TR::MethodBuilder *callerMB, TR::VirtualMachin
 
 OMR::MethodBuilder::~MethodBuilder()
    {
+   // A compilation thread may still be working on this method
+   if (NULL != _asyncRequest)
+      {
+      void *entry = NULL;
+      CompileAsyncResult(&entry, true);
+      }
+
    // Cleanup allocations in _memoryRegion *before* its destroyed in
    // the MethodBuilder::MemoryManager destructor
    _symbols.clear();
@@ -725,6 +737,14 @@ OMR::MethodBuilder::Compile(void **entry)
    int32_t rc=0;
    *entry = (void *) compileMethodFromDetails(NULL, details, warm, rc);
 
+   compilationDone();
+
+   return rc;
+   }
+
+void
+OMR::MethodBuilder::compilationDone()
+   {
    // let TypeDictionary know to clear out sym refs used in this compilation so
    // no dangling pointers
    typeDictionary()->NotifyCompilationDone();
@@ -734,6 +754,69 @@ OMR::MethodBuilder::Compile(void **entry)
    // and reset _connectedTrees so MethodBuilder can be inlined if needed
    _symbols.clear();
    _connectedTrees = false;
+   }
+
+// Runs on the compilation thread, before the requester can observe the result
+void
+OMR::MethodBuilder::asyncCompilationDone(TR::CompilationRequest *request, void *methodBuilder)
+   {
+   static_cast<OMR::MethodBuilder *>(methodBuilder)->compilationDone();
+   }
+
+int32_t
+OMR::MethodBuilder::CompileAsync(int32_t hotness)
+   {
+   TR::CompilationQueue *queue = TR::CompilationQueue::instance();
+   if (NULL == queue || NULL != _asyncRequest)
+      return COMPILATION_FAILED;
+   if (hotness < minHotness || hotness > maxHotness)
+      return COMPILATION_FAILED;
+
+   // The resolved method has to outlive this call, so it cannot live on the
+   // stack the way it does for Compile()
+   _asyncResolvedMethod = new (PERSISTENT_NEW) TR::ResolvedMethod(static_cast<TR::MethodBuilder *>(this));
+   if (NULL == _asyncResolvedMethod)
+      return COMPILATION_FAILED;
+
+   TR::IlGeneratorMethodDetails details(_asyncResolvedMethod);
+   _asyncRequest = queue->request(this, details, static_cast<TR_Hotness>(hotness), asyncCompilationDone, this);
+   if (NULL == _asyncRequest)
+      {
+      _asyncResolvedMethod->~ResolvedMethod();
+      TR_Memory::jitPersistentFree(_asyncResolvedMethod);
+      _asyncResolvedMethod = NULL;
+      return COMPILATION_FAILED;
+      }
+
+   return COMPILATION_REQUESTED;
+   }
+
+int32_t
+OMR::MethodBuilder::CompileAsyncResult(void **entry, bool wait)
+   {
+   if (NULL == _asyncRequest)
+      return COMPILATION_FAILED;
+
+   int32_t rc = COMPILATION_REQUESTED;
+   if (wait)
+      {
+      *entry = (void *) _asyncRequest->wait(rc);
+      }
+   else if (_asyncRequest->isDone())
+      {
+      *entry = (void *) _asyncRequest->getStartPC();
+      rc = _asyncRequest->getReturnCode();
+      }
+   else
+      {
+      return COMPILATION_REQUESTED;
+      }
+
+   TR::CompilationQueue::release(_asyncRequest);
+   _asyncRequest = NULL;
+   _asyncResolvedMethod->~ResolvedMethod();
+   TR_Memory::jitPersistentFree(_asyncResolvedMethod);
+   _asyncResolvedMethod = NULL;
 
    return rc;
    }
@@ -34,6 +34,7 @@
 
 class TR_BitVector;
 namespace TR { class BytecodeBuilder; }
+namespace TR { class CompilationRequest; }
 namespace TR { class ResolvedMethod; }
 namespace TR { class SymbolReference; }
 namespace TR { class VirtualMachineState; }
@@ -146,6 +147,23 @@ class MethodBuilder : public TR::IlBuilder
 
    int32_t Compile(void **entry);
 
+   /**
+    * @brief queue this method for compilation on the threads of the running TR::CompilationQueue
+    *        so that the caller can carry on while it is compiled
+    * @param hotness the optimization level of the compilation, a TR_Hotness value
+    * @returns COMPILATION_REQUESTED if the compilation was queued, otherwise COMPILATION_FAILED
+    */
+   int32_t CompileAsync(int32_t hotness);
+
+   /**
+    * @brief collect the result of the last CompileAsync
+    * @param entry set to the entry point of the compiled method once the compilation is done
+    * @param wait if true, block until the compilation is done
+    * @returns COMPILATION_REQUESTED while the compilation is still in progress, otherwise
+    *          the return code of the compilation
+    */
+   int32_t CompileAsyncResult(void **entry, bool wait);
+
    /**
     * @brief will be called if a Call is issued to a function that has not yet been defined, provides a
     *        mechanism for MethodBuilder subclasses to provide method lookup on demand rather than all up
@@ -296,7 +314,14 @@ class MethodBuilder : public TR::IlBuilder
     */
    const char * adjustNameForInlinedSite(const char *name);
 
+   /*
+    * @brief forget the symbols of the compilation that just finished so none are left dangling
+    */
+   void compilationDone();
+
    private:
+   static void asyncCompilationDone(TR::CompilationRequest *request, void *methodBuilder);
+
    // We have MemoryManager as the first member of TypeDictionary, so that
    // it is the last one to get destroyed and all objects allocated using
    // MemoryManager->_memoryRegion may be safely destroyed in the destructor.
@@ -388,6 +413,9 @@ class MethodBuilder : public TR::IlBuilder
    TR::IlBuilder             * _returnBuilder;
    const char                * _returnSymbolName;
 
+   TR::CompilationRequest    * _asyncRequest;
+   TR::ResolvedMethod        * _asyncResolvedMethod;
+
 private:
    static ClientAllocator      _clientAllocator;
    static ImplGetter _getImpl;
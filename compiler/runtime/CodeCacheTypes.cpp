@@ -22,6 +22,10 @@
 #include "runtime/CodeCacheTypes.hpp"
 #include "runtime/CodeCacheManager.hpp"
 
+#if defined(TR_CODECACHE_LOCKFREE_LOOKUP)
+#include "AtomicSupport.hpp"
+#endif
+
 namespace OMR
 {
 
@@ -142,6 +146,10 @@ CodeCacheHashTable::findUnresolvedMethod(void *constPool, int32_t constPoolIndex
 
 // Find an existing resolved method in the hash table
 //
+// Lookups may run without the code cache mutex while entries are added under
+// it; an entry that is being removed at the same time may be missed, so a
+// lookup that comes back empty has to be repeated with the mutex held.
+//
 CodeCacheHashEntry *
 CodeCacheHashTable::findResolvedMethod(TR_OpaqueMethodBlock *method)
    {
@@ -163,6 +171,11 @@ CodeCacheHashTable::add(CodeCacheHashEntry *entry)
    {
    size_t bucket = entry->_key % _size;
    entry->_next = _buckets[bucket];
+
+   // The entry must be complete before lock free lookups can reach it
+#if defined(TR_CODECACHE_LOCKFREE_LOOKUP)
+   VM_AtomicSupport::writeBarrier();
+#endif
    _buckets[bucket] = entry;
    }
 
@@ -45,6 +45,14 @@
 #define mcc_printf(fmt, ...) ((void)0)
 #endif
 
+/*
+ *  Lookups in the code cache hash tables may skip the code cache mutex only
+ *  where the write barrier that publishes new entries is available
+ */
+#if !defined(TR_TARGET_POWER) || !defined(__clang__)
+#define TR_CODECACHE_LOCKFREE_LOOKUP
+#endif
+
 class TR_OpaqueMethodBlock;
 namespace TR { class CodeCacheManager; }
 
@@ -45,6 +45,10 @@
 #include "runtime/CodeCacheConfig.hpp"
 #include "runtime/Runtime.hpp"
 
+#if defined(TR_CODECACHE_LOCKFREE_LOOKUP)
+#include "AtomicSupport.hpp"
+#endif
+
 #ifdef LINUX
 #include <elf.h>
 #include <unistd.h>
@@ -559,6 +563,14 @@ OMR::CodeCache::reserveResolvedTrampoline(TR_OpaqueMethodBlock *method,
    if (!config.needsMethodTrampolines())
       return retValue;
 
+#if defined(TR_CODECACHE_LOCKFREE_LOOKUP)
+   // Most calls are for methods that already have a reservation, which
+   // parallel compilations can find without taking the mutex. Without a
+   // write barrier to publish entries, the lookup stays under the mutex.
+   if (_resolvedMethodHT->findResolvedMethod(method))
+      return retValue;
+#endif
+
    // scope for cache critical section
       {
       CacheCriticalSection reserveTrampoline(self());
@@ -591,12 +603,25 @@ OMR::CodeCacheTrampolineCode *
 OMR::CodeCache::findTrampoline(TR_OpaqueMethodBlock * method)
    {
    CodeCacheTrampolineCode *trampoline;
+   CodeCacheHashEntry *entry;
+
+#if defined(TR_CODECACHE_LOCKFREE_LOOKUP)
+   // Once created, a trampoline is found without taking the mutex. Without a
+   // write barrier to publish it, the lookup stays under the mutex.
+   entry = _resolvedMethodHT->findResolvedMethod(method);
+   if (entry)
+      {
+      trampoline = entry->_info._resolved._currentTrampoline;
+      if (trampoline)
+         return trampoline;
+      }
+#endif
 
    // scope for critical section
       {
       CacheCriticalSection resolveAndCreateTrampoline(self());
 
-      CodeCacheHashEntry *entry = _resolvedMethodHT->findResolvedMethod(method);
+      entry = _resolvedMethodHT->findResolvedMethod(method);
       trampoline = entry->_info._resolved._currentTrampoline;
       if (!trampoline)
          {
@@ -606,8 +631,13 @@ OMR::CodeCache::findTrampoline(TR_OpaqueMethodBlock * method)
 
          self()->createTrampoline(trampoline, newPC, method);
 
-         entry->_info._resolved._currentTrampoline = trampoline;
          entry->_info._resolved._currentStartPC = newPC;
+
+         // Publish the trampoline only once its code is in place
+#if defined(TR_CODECACHE_LOCKFREE_LOOKUP)
+         VM_AtomicSupport::writeBarrier();
+#endif
+         entry->_info._resolved._currentTrampoline = trampoline;
          }
       }
 
@@ -1144,6 +1174,123 @@ OMR::CodeCache::updateMaxSizeOfFreeBlocks(CodeCacheFreeCacheBlock *blockPtr, siz
       }
    }
 
+// Give the free blocks that border the cold-warm hole back to the hole, so that
+// the space they hold is contiguous again.  The free block list is sorted by
+// address and adjacent blocks are merged, so only the last warm block and the
+// first cold block can border the hole.
+// The caller must hold the code cache mutex.
+void
+OMR::CodeCache::mergeFreeBlocksIntoHole()
+   {
+   CodeCacheFreeCacheBlock *lastWarmLink = NULL;
+   CodeCacheFreeCacheBlock *lastWarmLinkPrev = NULL;
+   CodeCacheFreeCacheBlock *prevLink = NULL;
+   CodeCacheFreeCacheBlock *currLink;
+
+   for (currLink = _freeBlockList; currLink && (uint8_t *)currLink < _warmCodeAlloc; prevLink = currLink, currLink = currLink->_next)
+      {
+      lastWarmLinkPrev = prevLink;
+      lastWarmLink = currLink;
+      }
+
+#if defined(OSX) && defined(AARCH64)
+   pthread_jit_write_protect_np(0);
+#endif
+
+   bool merged = false;
+
+   // currLink is the first cold block, if there is one
+   if (currLink && (uint8_t *)currLink == _coldCodeAlloc)
+      {
+      if (prevLink)
+         prevLink->_next = currLink->_next;
+      else
+         _freeBlockList = currLink->_next;
+      _coldCodeAlloc += currLink->_size;
+      merged = true;
+      }
+
+   if (lastWarmLink && (uint8_t *)lastWarmLink + lastWarmLink->_size == _warmCodeAlloc)
+      {
+      if (lastWarmLinkPrev)
+         lastWarmLinkPrev->_next = lastWarmLink->_next;
+      else
+         _freeBlockList = lastWarmLink->_next;
+      _warmCodeAlloc = (uint8_t *)lastWarmLink;
+      merged = true;
+      }
+
+#if defined(OSX) && defined(AARCH64)
+   pthread_jit_write_protect_np(1);
+#endif
+
+   if (!merged)
+      return;
+
+   _sizeOfLargestFreeWarmBlock = 0;
+   _sizeOfLargestFreeColdBlock = 0;
+   for (currLink = _freeBlockList; currLink; currLink = currLink->_next)
+      self()->updateMaxSizeOfFreeBlocks(currLink, currLink->_size);
+
+   TR::CodeCacheConfig &config = _manager->codeCacheConfig();
+   if (config.verboseReclamation())
+      {
+      TR_VerboseLog::writeLineLocked(TR_Vlog_CODECACHE,"--ccr-- mergeFreeBlocksIntoHole CC=%p warmCodeAlloc=%p coldCodeAlloc=%p _sizeOfLargestFreeWarmBlock=%d _sizeOfLargestFreeColdBlock=%d",
+         this, _warmCodeAlloc, _coldCodeAlloc, _sizeOfLargestFreeWarmBlock, _sizeOfLargestFreeColdBlock);
+      }
+   }
+
+
+OMR::CodeCacheMethodHeader *
+OMR::CodeCache::findMethodHeader(void *startPC)
+   {
+   TR::CodeCacheConfig &config = _manager->codeCacheConfig();
+   uint8_t *pc = static_cast<uint8_t *>(startPC);
+   uint8_t *base = self()->getCodeBase();
+
+   if (pc < base + sizeof(CodeCacheMethodHeader) || pc >= _warmCodeAlloc)
+      return NULL;
+
+   // Warm bodies start on an alignment boundary, with the code right after the
+   // header; only zeroed entry padding within the alignment may come before
+   // startPC.  Any other address is not the start of a body.
+   size_t alignment = config.codeCacheAlignment();
+   uint8_t *candidate = (uint8_t *)((uintptr_t)(pc - sizeof(CodeCacheMethodHeader)) & ~(uintptr_t)(alignment - 1));
+   if (candidate < base)
+      return NULL;
+
+   CodeCacheMethodHeader *header = (CodeCacheMethodHeader *)candidate;
+   if (memcmp(header->_eyeCatcher, config.warmEyeCatcher(), sizeof(header->_eyeCatcher)) != 0)
+      return NULL;
+
+   uint8_t *codeStart = candidate + sizeof(CodeCacheMethodHeader);
+   if (pc < codeStart || pc >= codeStart + alignment || candidate + header->_size <= pc)
+      return NULL;
+
+   for (uint8_t *padding = codeStart; padding < pc; padding++)
+      {
+      if (*padding != 0)
+         return NULL;
+      }
+
+   return header;
+   }
+
+
+bool
+OMR::CodeCache::freeMethodBody(CodeCacheMethodHeader *header)
+   {
+   CacheCriticalSection freeingMethodBody(self());
+
+   uint8_t *start = (uint8_t *)header;
+   if (!self()->addFreeBlock2(start, start + header->_size))
+      return false;
+
+   self()->mergeFreeBlocksIntoHole();
+   return true;
+   }
+
+
 // Find the smallest free block that will satisfy the request.
 //
 // isCold indicates whether a warm or cold block of memory is required.
@@ -1395,6 +1542,23 @@ OMR::CodeCache::printFreeBlocks()
    }
 
 
+void
+OMR::CodeCache::getFreeBlockStats(size_t &freeBlockBytes, uint32_t &numFreeBlocks, size_t &largestFreeBlock)
+   {
+   freeBlockBytes = 0;
+   numFreeBlocks = 0;
+   largestFreeBlock = 0;
+
+   CacheCriticalSection walkFreeList(self());
+   for (CodeCacheFreeCacheBlock *currLink = _freeBlockList; currLink; currLink = currLink->_next)
+      {
+      freeBlockBytes += currLink->_size;
+      numFreeBlocks++;
+      largestFreeBlock = std::max(largestFreeBlock, (size_t)currLink->_size);
+      }
+   }
+
+
 //-------------------- checkForErrors ---------------------------------
 // Scan the entire list of free blocks and make sure numbers make sense
 // Blocks should be in ascending order of their addresses
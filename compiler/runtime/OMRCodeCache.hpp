@@ -111,6 +111,27 @@ public:
 
    CodeCacheMethodHeader *addFreeBlock(void *metaData);
 
+   /**
+    * @brief Finds the header of the warm method body that starts at the given
+    *        address.  The code of a body follows its header, apart from zeroed
+    *        entry padding within the code cache alignment.
+    *
+    * @param[in] startPC : the start PC of a method body in this code cache
+    *
+    * @return the method header, or NULL if startPC is not the start of a body
+    */
+   CodeCacheMethodHeader *findMethodHeader(void *startPC);
+
+   /**
+    * @brief Returns a method body to the free blocks of this code cache.  Free
+    *        blocks next to the cold-warm hole are merged back into the hole.
+    *
+    * @param[in] header : the header of the method body
+    *
+    * @return true if the body was reclaimed; false otherwise.
+    */
+   bool freeMethodBody(CodeCacheMethodHeader *header);
+
    uint8_t *findFreeBlock(size_t size, bool isCold, bool isMethodHeaderNeeded);
 
    void reserve(int32_t reservingCompThreadID);
@@ -175,6 +196,15 @@ public:
    bool                       addResolvedMethod(TR_OpaqueMethodBlock *method);
 
    void                       printOccupancyStats();
+
+   /**
+    * @brief Measures how the reclaimed space of this code cache is split up.
+    *
+    * @param[out] freeBlockBytes : bytes held in the free blocks
+    * @param[out] numFreeBlocks : number of free blocks
+    * @param[out] largestFreeBlock : size of the largest free block
+    */
+   void                       getFreeBlockStats(size_t &freeBlockBytes, uint32_t &numFreeBlocks, size_t &largestFreeBlock);
    void                       printFreeBlocks();
    void                       checkForErrors();
    void                       writeMethodHeader(void *freeBlock, size_t size, bool isCold);
@@ -200,6 +230,10 @@ public:
    uint32_t                   flags() { return _flags; }
    void                       addFlags(uint32_t newFlags) { _flags |= newFlags; }
 
+   // Set on the code cache of the hot segment, which only hot compilations allocate from
+   static const uint32_t      HOT_SEGMENT = 0x80000000;
+   bool                       isHotSegment() { return (_flags & HOT_SEGMENT) != 0; }
+
    bool                       isCCPreLoadedCodeInitialized()                            { return _CCPreLoadedCodeInitialized; }
    void                       setCCPreLoadedCodeAddress(TR_CCPreLoadedCode h, void * a) { _CCPreLoadedCode[h] = a; }
    void *                     getCCPreLoadedCodeAddress(TR_CCPreLoadedCode h, TR::CodeGenerator *cg);
@@ -221,6 +255,7 @@ public:
 
 private:
    void                       updateMaxSizeOfFreeBlocks(CodeCacheFreeCacheBlock *blockPtr, size_t blockSize);
+   void                       mergeFreeBlocksIntoHole();
 
    CodeCacheFreeCacheBlock *  removeFreeBlock(size_t blockSize,
                                               CodeCacheFreeCacheBlock *prev,
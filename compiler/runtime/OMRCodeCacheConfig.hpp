@@ -86,6 +86,7 @@ class OMR_EXTENSIBLE CodeCacheConfig
          _codeCacheKB(0),
          _codeCacheTotalKB(0),
          _codeCachePadKB(0),
+         _hotCodeCacheKB(0),
          _codeCacheAlignment(0),
          _codeCacheHelperAlignmentBytes(32),
          _codeCacheTrampolineAlignmentBytes(8),
@@ -162,6 +163,12 @@ class OMR_EXTENSIBLE CodeCacheConfig
 
    size_t highCodeCacheOccupancyThresholdInBytes() const { return _highCodeCacheOccupancyThresholdInBytes; }
 
+   /**
+    * @brief Size of the code cache segment kept for hot compilations, in KB.
+    *        A size of 0 means that hot and cold code share all code caches.
+    */
+   size_t hotCodeCacheKB() const { return _hotCodeCacheKB; }
+
    size_t largeCodePageSize() const { return _largeCodePageSize; }
    uint32_t largeCodePageFlags() const { return _largeCodePageFlags; }
    bool allowedToGrowCache() const { return _allowedToGrowCache; }
@@ -187,6 +194,7 @@ class OMR_EXTENSIBLE CodeCacheConfig
    size_t _codeCacheKB;
    size_t _codeCacheTotalKB;
    size_t _codeCachePadKB;
+   size_t _hotCodeCacheKB;               /*!< size of the hot code cache segment; 0 if there is none */
    size_t _codeCacheAlignment;
 
    size_t _highCodeCacheOccupancyThresholdInBytes;
@@ -48,6 +48,7 @@
 #if (HOST_OS == OMR_LINUX)
 #include <elf.h>
 #include <unistd.h>
+#include <sys/mman.h>
 #include "codegen/ELFGenerator.hpp"
 
 TR::CodeCacheSymbolContainer * OMR::CodeCacheManager::_symbolContainer = NULL;
@@ -63,7 +64,9 @@ OMR::CodeCacheManager::CodeCacheManager(TR::RawAllocator rawAllocator) :
    _initialized(false),
    _codeCacheFull(false),
    _currTotalUsedInBytes(0),
-   _maxUsedInBytes(0)
+   _maxUsedInBytes(0),
+   _hotCodeCache(NULL),
+   _hotCodeCacheSegment(NULL)
    {
    }
 
@@ -155,6 +158,9 @@ OMR::CodeCacheManager::initialize(
    if (!(_usageMonitor = TR::Monitor::create("CodeCacheUsageMonitor")))
       return NULL;
 
+   for (int32_t i = 0; i < MAX_THREAD_CODE_CACHES; i++)
+      _threadCodeCaches[i] = NULL;
+
 #if defined(TR_HOST_POWER)
    #define REACHEABLE_RANGE_KB (32*1024)
 #elif defined(TR_HOST_ARM64)
@@ -190,6 +196,9 @@ OMR::CodeCacheManager::initialize(
 
    _curNumberOfCodeCaches = cachesCreatedOnInit;
 
+   if (config.hotCodeCacheKB() > 0)
+      self()->allocateHotCodeCache();
+
    return codeCache;
    }
 
@@ -229,6 +238,14 @@ OMR::CodeCacheManager::destroy()
    }
 #endif // HOST_OS == OMR_LINUX
 
+   if (self()->codeCacheConfig().verboseCodeCache())
+      self()->reportFragmentation();
+
+   for (int32_t i = 0; i < MAX_THREAD_CODE_CACHES; i++)
+      _threadCodeCaches[i] = NULL;
+
+   TR::CodeCacheMemorySegment *hotSegment = _hotCodeCache ? _hotCodeCache->segment() : NULL;
+
    TR::CodeCache *codeCache = self()->getFirstCodeCache();
    while (codeCache != NULL)
       {
@@ -243,6 +260,14 @@ OMR::CodeCacheManager::destroy()
       self()->freeCodeCacheSegment(_codeCacheRepositorySegment);
       }
 
+   if (_hotCodeCacheSegment)
+      {
+      self()->freeMemory(hotSegment);
+      self()->freeCodeCacheSegment(_hotCodeCacheSegment);
+      _hotCodeCacheSegment = NULL;
+      }
+   _hotCodeCache = NULL;
+
    _initialized = false;
    }
 
@@ -297,10 +322,37 @@ OMR::CodeCacheManager::unreserveCodeCache(TR::CodeCache *codeCache)
    if (!codeCache)
       return;
 
+   // A compilation thread holds on to a cache that still has room in it
+   int32_t compThreadID = codeCache->getReservingCompThreadID();
+   if (self()->keepsThreadCodeCache(compThreadID) &&
+       !codeCache->isHotSegment() &&
+       !_threadCodeCaches[compThreadID] &&
+       codeCache->almostFull() == TR_no)
+      {
+      _threadCodeCaches[compThreadID] = codeCache;
+      return;
+      }
+
    CacheListCriticalSection scanCacheList(self());
    codeCache->unreserve();
 }
 
+void
+OMR::CodeCacheManager::releaseThreadCodeCache(int32_t compThreadID)
+   {
+   if (!self()->keepsThreadCodeCache(compThreadID))
+      return;
+
+   TR::CodeCache *codeCache = _threadCodeCaches[compThreadID];
+   if (!codeCache)
+      return;
+
+   _threadCodeCaches[compThreadID] = NULL;
+
+   CacheListCriticalSection scanCacheList(self());
+   codeCache->unreserve();
+   }
+
 // The size estimate is just that a guess. We should reserve a code cache that has at least
 // that much space available. If sizeEstimate is 0, then there is no estimate.
 // compThreadID is the ID of the compilation thread requesting the reservation
@@ -316,12 +368,38 @@ OMR::CodeCacheManager::reserveCodeCache(bool compilationCodeAllocationsMustBeCon
    int32_t numCachesAlreadyReserved = 0;
    TR::CodeCache *codeCache = NULL;
 
+   // A compilation thread first tries the cache it kept from its last
+   // compilation, which is still reserved for it
+   if (self()->keepsThreadCodeCache(compThreadID) && _threadCodeCaches[compThreadID])
+      {
+      codeCache = _threadCodeCaches[compThreadID];
+      _threadCodeCaches[compThreadID] = NULL;
+      TR_ASSERT(codeCache->isReserved() && codeCache->getReservingCompThreadID() == compThreadID,
+                "cache %p kept by compilation thread %d is not reserved for it\n", codeCache, compThreadID);
+
+      if (codeCache->almostFull() == TR_no &&
+          (sizeEstimate == 0 ||
+           codeCache->getFreeContiguousSpace() >= sizeEstimate ||
+           codeCache->getSizeOfLargestFreeWarmBlock() >= sizeEstimate))
+         {
+         *numReserved = 0;
+         return codeCache;
+         }
+
+      CacheListCriticalSection scanCacheList(self());
+      codeCache->unreserve();
+      codeCache = NULL;
+      }
+
    // Scan the list of code caches; must acquire a mutex
    //
       {
       CacheListCriticalSection scanCacheList(self());
       for (codeCache = self()->getFirstCodeCache(); codeCache; codeCache = codeCache->next())
          {
+         if (codeCache->isHotSegment()) // kept for hot compilations
+            continue;
+
          if (!codeCache->isReserved()) // we cannot touch the reserved ones
             {
             TR_YesNoMaybe almostFull = codeCache->almostFull();
@@ -382,6 +460,20 @@ OMR::CodeCacheManager::reserveCodeCache(bool compilationCodeAllocationsMustBeCon
    return codeCache;
    }
 
+TR::CodeCache *
+OMR::CodeCacheManager::reserveHotCodeCache(int32_t compThreadID)
+   {
+   if (!_hotCodeCache)
+      return NULL;
+
+   CacheListCriticalSection scanCacheList(self());
+   if (_hotCodeCache->isReserved() || _hotCodeCache->almostFull() == TR_yes)
+      return NULL;
+
+   _hotCodeCache->reserve(compThreadID);
+   return _hotCodeCache;
+   }
+
 //------------------------------ getNewCodeCache -----------------------------
 // Searches for a code cache that hasn't been used before. If not found it
 // tries to allocate a new code cache. If that fails too, it returns NULL
@@ -637,6 +729,9 @@ OMR::CodeCacheManager::allocateCodeMemoryWithRetries(size_t warmCodeSize,
 
          for (codeCache = self()->getFirstCodeCache(); codeCache; codeCache = codeCache->next())
             {
+            if (codeCache->isHotSegment()) // kept for hot compilations
+               continue;
+
             numCachesVisited++;
             // Our current cache is reserved, so we cannot find it again
             if (!codeCache->isReserved())
@@ -904,6 +999,9 @@ OMR::CodeCacheManager::registerCompiledMethod(const char *sig, uint8_t *startPC,
    newSymbol->_start = startPC;
    newSymbol->_size = codeSize;
    newSymbol->_next = NULL;
+
+   // Methods compiled in parallel register themselves concurrently
+   CacheListCriticalSection updateSymbols(self());
    if(_symbolContainer->_head){
       _symbolContainer->_tail->_next = newSymbol;
       _symbolContainer->_tail = newSymbol;
@@ -947,6 +1045,8 @@ OMR::CodeCacheManager::registerStaticRelocation(const TR::StaticRelocation &relo
       newRelocSymbol->_start = 0;
       newRelocSymbol->_size = 0;
       newRelocSymbol->_next = NULL;
+
+      CacheListCriticalSection updateSymbols(self());
       if(_relocatableSymbolContainer->_head){
             _relocatableSymbolContainer->_tail->_next = newRelocSymbol;
             _relocatableSymbolContainer->_tail = newRelocSymbol;
@@ -1244,6 +1344,129 @@ OMR::CodeCacheManager::allocateCodeCacheFromNewSegment(
    }
 
 
+TR::CodeCache *
+OMR::CodeCacheManager::allocateHotCodeCache()
+   {
+   TR::CodeCacheConfig &config = self()->codeCacheConfig();
+
+   // The hot segment is made of whole pages, which start on a page boundary
+   size_t pageSize = config.largeCodePageSize() ? config.largeCodePageSize() : HOT_CODE_CACHE_PAGE_SIZE;
+   size_t hotCodeCacheSize = align(config.hotCodeCacheKB() << 10, pageSize);
+
+   // One more page leaves room to align the start of the hot segment
+   size_t segmentSizeAllocated = 0;
+   TR::CodeCacheMemorySegment *segment = self()->allocateCodeCacheSegment(hotCodeCacheSize + pageSize, segmentSizeAllocated, NULL);
+   if (!segment)
+      {
+      if (config.verboseCodeCache())
+         TR_VerboseLog::writeLineLocked(TR_Vlog_FAILURE, "cannot allocate the hot code cache segment of size %u KB", (uint32_t)(hotCodeCacheSize >> 10));
+      return NULL;
+      }
+
+   uint8_t *hotCodeCacheBase = (uint8_t *)align((size_t)segment->segmentBase(), pageSize);
+   TR::CodeCacheMemorySegment *hotSegment = NULL;
+   if (hotCodeCacheBase + hotCodeCacheSize <= segment->segmentTop())
+      hotSegment = static_cast<TR::CodeCacheMemorySegment *>(self()->getMemory(sizeof(TR::CodeCacheMemorySegment)));
+
+   if (!hotSegment)
+      {
+      self()->freeCodeCacheSegment(segment);
+      return NULL;
+      }
+
+   new (hotSegment) TR::CodeCacheMemorySegment(hotCodeCacheBase, hotCodeCacheBase + hotCodeCacheSize);
+
+#if (HOST_OS == OMR_LINUX) && defined(MADV_HUGEPAGE)
+   // Ask for transparent huge pages, unless the project allocates code caches from large pages already
+   if (!config.largeCodePageSize() &&
+       madvise(hotCodeCacheBase, hotCodeCacheSize, MADV_HUGEPAGE) != 0 &&
+       config.verboseCodeCache())
+      {
+      TR_VerboseLog::writeLineLocked(TR_Vlog_CODECACHE, "huge pages are not available for the hot code cache segment");
+      }
+#endif
+
+   TR::CodeCache *codeCache = self()->allocateCodeCacheObject(hotSegment, hotCodeCacheSize);
+   if (!codeCache)
+      {
+      self()->freeMemory(hotSegment);
+      self()->freeCodeCacheSegment(segment);
+      return NULL;
+      }
+
+   codeCache->addFlags(TR::CodeCache::HOT_SEGMENT);
+   _hotCodeCacheSegment = segment;
+   _hotCodeCache = codeCache;
+   self()->addCodeCache(codeCache);
+
+   if (config.verboseCodeCache())
+      {
+      TR_VerboseLog::writeLineLocked(TR_Vlog_CODECACHE, "hot CodeCache allocated %p @ " POINTER_PRINTF_FORMAT "-" POINTER_PRINTF_FORMAT " pageSize=%u KB",
+                                     codeCache, codeCache->getCodeBase(), codeCache->getCodeTop(), (uint32_t)(pageSize >> 10));
+      }
+
+   return codeCache;
+   }
+
+
+bool
+OMR::CodeCacheManager::freeMethodBody(void *startPC)
+   {
+   TR::CodeCache *codeCache = self()->findCodeCacheFromPC(startPC);
+   if (!codeCache)
+      return false;
+
+   CodeCacheMethodHeader *header = codeCache->findMethodHeader(startPC);
+   if (!header)
+      return false;
+
+   uint32_t size = header->_size;
+   if (!codeCache->freeMethodBody(header))
+      return false;
+
+   TR::CodeCacheConfig &config = self()->codeCacheConfig();
+   if (config.verboseCodeCache())
+      {
+      TR_VerboseLog::writeLineLocked(TR_Vlog_CODECACHE, "freed method body @ " POINTER_PRINTF_FORMAT " size=%u in %sCodeCache %p",
+                                     startPC, size, codeCache->isHotSegment() ? "hot " : "", codeCache);
+      }
+
+   return true;
+   }
+
+
+void
+OMR::CodeCacheManager::reportFragmentation()
+   {
+   CacheListCriticalSection scanCacheList(self());
+
+   for (TR::CodeCache *codeCache = self()->getFirstCodeCache(); codeCache; codeCache = codeCache->next())
+      {
+      size_t freeBlockBytes = 0;
+      uint32_t numFreeBlocks = 0;
+      size_t largestFreeBlock = 0;
+      codeCache->getFreeBlockStats(freeBlockBytes, numFreeBlocks, largestFreeBlock);
+
+      // Fragmentation is the share of the free space that is not part of its largest piece
+      size_t holeBytes = codeCache->getFreeContiguousSpace();
+      size_t freeBytes = holeBytes + freeBlockBytes;
+      size_t largestFreeBytes = std::max(holeBytes, largestFreeBlock);
+      uint32_t fragmentation = freeBytes ? (uint32_t)((freeBytes - largestFreeBytes) * 100 / freeBytes) : 0;
+
+      TR_VerboseLog::writeLineLocked(TR_Vlog_CODECACHE, "%sCodeCache %p: size=%u free=%u hole=%u freeBlocks=%u freeBlockBytes=%u largestFreeBlock=%u fragmentation=%u%%",
+                                     codeCache->isHotSegment() ? "hot " : "",
+                                     codeCache,
+                                     (uint32_t)(codeCache->getCodeTop() - codeCache->getCodeBase()),
+                                     (uint32_t)freeBytes,
+                                     (uint32_t)holeBytes,
+                                     numFreeBlocks,
+                                     (uint32_t)freeBlockBytes,
+                                     (uint32_t)largestFreeBlock,
+                                     fragmentation);
+      }
+   }
+
+
 bool
 OMR::CodeCacheManager::isStartPCInRXCode(intptr_t startPC, void *jitConfig)
    {
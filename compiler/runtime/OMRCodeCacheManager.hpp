@@ -175,6 +175,75 @@ public:
                                     int32_t *numReserved);
    TR::CodeCache * getNewCodeCache(int32_t reservingCompThreadID);
 
+   /**
+    * @brief Huge page size the hot segment is aligned to, unless the project
+    *        backs code caches with large pages of its own
+    */
+   static const size_t HOT_CODE_CACHE_PAGE_SIZE = 2 * 1024 * 1024;
+
+   /**
+    * @brief The hot segment is a code cache of its own, sized by
+    *        CodeCacheConfig::hotCodeCacheKB(), that only compilations at hot
+    *        and above allocate from.  Keeping hot code together there means
+    *        fewer pages, and fewer iTLB entries, for the code that runs most.
+    *
+    * @return the code cache of the hot segment, or NULL if there is none
+    */
+   TR::CodeCache * getHotCodeCache() { return _hotCodeCache; }
+
+   /**
+    * @brief Reserve the hot segment for a compilation at hot or above
+    *
+    * @param[in] compThreadID : the ID of the compilation thread requesting the reservation
+    *
+    * @return the hot code cache, or NULL if there is no hot segment or if it
+    *         is reserved or full
+    */
+   TR::CodeCache * reserveHotCodeCache(int32_t compThreadID);
+
+   /**
+    * @brief Return the body of a method compiled earlier to the free blocks of
+    *        its code cache, for later compilations to reuse.  The caller must
+    *        make sure that the body is neither running nor called any more.
+    *        Code that the body keeps apart from itself, such as cold code
+    *        and jump tables, is not reclaimed.  Its ELF symbols and perf map
+    *        entries stay as they are, so they may describe a later body
+    *        that reuses the space.
+    *
+    * @param[in] startPC : the start PC of the method body
+    *
+    * @return true if the body was reclaimed; false if startPC is not the start
+    *         of a method body in a code cache
+    */
+   bool freeMethodBody(void *startPC);
+
+   /**
+    * @brief Report the free space of every code cache, and how fragmented it
+    *        is, to the verbose log
+    */
+   void reportFragmentation();
+
+   /**
+    * @brief Compilation threads with an ID in [1, MAX_THREAD_CODE_CACHES) keep
+    *        the code cache of their last compilation reserved, so that their
+    *        next compilation gets it back without going through the code
+    *        cache list.  Threads with other IDs reserve a cache per compilation.
+    */
+   static const int32_t MAX_THREAD_CODE_CACHES = 64;
+
+   bool keepsThreadCodeCache(int32_t compThreadID) const
+      {
+      return compThreadID > 0 && compThreadID < MAX_THREAD_CODE_CACHES;
+      }
+
+   /**
+    * @brief Unreserve the code cache kept by a compilation thread.  To be
+    *        called by the compilation thread itself before it exits.
+    *
+    * @param[in] compThreadID : the ID of the calling compilation thread
+    */
+   void releaseThreadCodeCache(int32_t compThreadID);
+
    uint8_t * allocateCodeMemory(size_t warmCodeSize,
                                 size_t coldCodeSize,
                                 TR::CodeCache **codeCache_pp,
@@ -199,6 +268,16 @@ public:
       size_t segmentSizeInBytes,
       int32_t reservingCompilationTID);
 
+   /**
+    * @brief Allocate the hot segment from memory of its own and start
+    *        managing it.  Unless the project already backs code caches with
+    *        large pages, huge pages are requested for it where the OS
+    *        supports it.
+    *
+    * @return the code cache of the hot segment; NULL on failure
+    */
+   TR::CodeCache * allocateHotCodeCache();
+
    TR::CodeCache * findCodeCacheFromPC(void *inCacheAddress);
 
    /**
@@ -344,6 +423,12 @@ protected:
    TR::Monitor                   *_usageMonitor;
    size_t                         _currTotalUsedInBytes;
    size_t                         _maxUsedInBytes;
+
+   // Indexed by compilation thread ID; each slot is only accessed by its own thread
+   TR::CodeCache                 *_threadCodeCaches[MAX_THREAD_CODE_CACHES];
+
+   TR::CodeCache                 *_hotCodeCache;                      /*!< code cache of the hot segment, if there is one */
+   TR::CodeCacheMemorySegment    *_hotCodeCacheSegment;               /*!< memory the hot segment was allocated from */
 #if (HOST_OS == OMR_LINUX)
    public:
    /**
@@ -0,0 +1,883 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if (defined(LINUX) && !defined(OMRZTPF)) || defined(__APPLE__) || defined(_AIX)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define PERSISTENT_CODE_CACHE_MMAP
+#endif
+
+#include "runtime/PersistentCodeCache.hpp"
+
+#include <new>
+#include <stdio.h>
+#include <string.h>
+#include "codegen/CodeGenerator.hpp"
+#include "codegen/Relocation.hpp"
+#include "codegen/StaticRelocation.hpp"
+#include "compile/Compilation.hpp"
+#include "compile/ResolvedMethod.hpp"
+#include "compile/SymbolReferenceTable.hpp"
+#include "control/Options.hpp"
+#include "control/Options_inlines.hpp"
+#include "control/Recompilation.hpp"
+#include "env/CompilerEnv.hpp"
+#include "env/VerboseLog.hpp"
+#include "il/Block.hpp"
+#include "il/Node.hpp"
+#include "il/Node_inlines.hpp"
+#include "il/ResolvedMethodSymbol.hpp"
+#include "il/StaticSymbol.hpp"
+#include "il/Symbol.hpp"
+#include "il/SymbolReference.hpp"
+#include "il/TreeTop.hpp"
+#include "il/TreeTop_inlines.hpp"
+#include "infra/Monitor.hpp"
+
+OMR::PersistentCodeCache *OMR::PersistentCodeCache::_instance = NULL;
+
+static const char PERSISTENT_CODE_CACHE_EYECATCHER[8] = { 'O', 'M', 'R', 'J', 'I', 'T', 'P', 'C' };
+
+// Every part of the file starts on an 8 byte boundary
+//
+static size_t
+alignedSize(size_t size)
+   {
+   return (size + 7) & ~static_cast<size_t>(7);
+   }
+
+struct OMR::PersistentCodeCache::FileHeader
+   {
+   char _eyecatcher[8];
+   uint32_t _version;
+   uint32_t _pointerSize;
+   ProcessorFingerprint _fingerprint;
+   uint64_t _numEntries;
+   };
+
+struct OMR::PersistentCodeCache::RelocationRecord
+   {
+   uint32_t _offset;     ///< of the location in the code
+   uint8_t _kind;        ///< a RelocationKind
+   uint8_t _size;        ///< of the location in bytes
+   uint16_t _padding;
+   uint32_t _nameOffset; ///< of the call target name, for SymbolAddress
+   };
+
+/**
+ * An entry is followed by its relocation records, the names they refer to
+ * and its code, each padded to 8 bytes.
+ */
+struct OMR::PersistentCodeCache::EntryHeader
+   {
+   uint64_t _key[2];
+   uint64_t _size;          ///< of the whole entry
+   uint32_t _codeSize;
+   uint32_t _entryOffset;   ///< of the method entry point in the code
+   uint32_t _codeAlignment; ///< of the code start modulo CODE_ALIGNMENT
+   uint32_t _numRelocations;
+   uint32_t _namesSize;
+   uint32_t _padding;
+
+   static size_t sizeFor(size_t numRelocations, size_t namesSize, size_t codeSize)
+      {
+      return sizeof(EntryHeader)
+         + alignedSize(numRelocations * sizeof(RelocationRecord))
+         + alignedSize(namesSize)
+         + alignedSize(codeSize);
+      }
+
+   const RelocationRecord *relocations() const
+      {
+      return reinterpret_cast<const RelocationRecord *>(this + 1);
+      }
+
+   const char *names() const
+      {
+      return reinterpret_cast<const char *>(this + 1) + alignedSize(_numRelocations * sizeof(RelocationRecord));
+      }
+
+   const uint8_t *code() const
+      {
+      return reinterpret_cast<const uint8_t *>(names()) + alignedSize(_namesSize);
+      }
+   };
+
+static uint64_t
+readAddress(const uint8_t *location, uint8_t size)
+   {
+   if (size == 4)
+      {
+      uint32_t value;
+      memcpy(&value, location, sizeof(value));
+      return value;
+      }
+   uint64_t value;
+   memcpy(&value, location, sizeof(value));
+   return value;
+   }
+
+static void
+writeAddress(uint8_t *location, uint8_t size, uint64_t value)
+   {
+   if (size == 4)
+      {
+      uint32_t narrowValue = static_cast<uint32_t>(value);
+      memcpy(location, &narrowValue, sizeof(narrowValue));
+      }
+   else
+      {
+      memcpy(location, &value, sizeof(value));
+      }
+   }
+
+namespace {
+
+/**
+ * Hashes everything a compiled body depends on into two independent 64 bit
+ * lanes, so that different methods sharing a key is not a practical concern.
+ */
+class KeyHasher
+   {
+public:
+   KeyHasher() : _fnv(UINT64_C(0xcbf29ce484222325)), _mix(UINT64_C(0x6a09e667f3bcc908)) {}
+
+   void add(const void *data, size_t size)
+      {
+      const uint8_t *bytes = static_cast<const uint8_t *>(data);
+      for (size_t i = 0; i < size; i++)
+         {
+         _fnv = (_fnv ^ bytes[i]) * UINT64_C(0x100000001b3);
+         _mix = (_mix ^ bytes[i]) * UINT64_C(0x9e3779b97f4a7c15);
+         _mix ^= _mix >> 29;
+         }
+      }
+
+   void add(uint64_t value) { add(&value, sizeof(value)); }
+
+   void add(const char *string)
+      {
+      size_t length = string ? strlen(string) : 0;
+      add(static_cast<uint64_t>(length));
+      add(string, length);
+      }
+
+   void finish(OMR::PersistentCodeCache::Key &key)
+      {
+      key._hash[0] = _fnv;
+      key._hash[1] = _mix ^ (_mix >> 31);
+      }
+
+private:
+   uint64_t _fnv;
+   uint64_t _mix;
+   };
+
+}
+
+static const uint64_t BACK_REFERENCE = UINT64_C(0xffffffffffffffff);
+
+static void
+hashSymbolReference(TR::Compilation *comp, TR::SymbolReference *symRef, KeyHasher &hasher)
+   {
+   TR::Symbol *sym = symRef->getSymbol();
+   hasher.add(static_cast<uint64_t>(symRef->getReferenceNumber()));
+   hasher.add(static_cast<uint64_t>(symRef->getOffset()));
+   hasher.add(static_cast<uint64_t>(sym->getFlags()));
+   hasher.add(static_cast<uint64_t>(sym->getFlags2()));
+   hasher.add(static_cast<uint64_t>(sym->getSize()));
+
+   if (sym->getResolvedMethodSymbol())
+      {
+      // Call targets are relocated by name, so their addresses do not matter
+      //
+      TR_ResolvedMethod *method = sym->getResolvedMethodSymbol()->getResolvedMethod();
+      hasher.add(method->externalName(comp->trMemory()));
+      hasher.add(method->signature(comp->trMemory()));
+      hasher.add(static_cast<uint64_t>(sym->getMethodSymbol()->getMethodAddress() != NULL));
+      }
+   else if (sym->getMethodSymbol())
+      {
+      hasher.add(reinterpret_cast<uintptr_t>(sym->getMethodSymbol()->getMethodAddress()));
+      }
+   else if (sym->getStaticSymbol())
+      {
+      hasher.add(reinterpret_cast<uintptr_t>(sym->getStaticSymbol()->getStaticAddress()));
+      }
+   }
+
+static bool
+hashNode(TR::Compilation *comp, TR::Node *node, vcount_t visitCount, KeyHasher &hasher)
+   {
+   if (node->getVisitCount() == visitCount)
+      {
+      hasher.add(BACK_REFERENCE);
+      hasher.add(static_cast<uint64_t>(node->getGlobalIndex()));
+      return true;
+      }
+   node->setVisitCount(visitCount);
+
+   TR::ILOpCode &opCode = node->getOpCode();
+   hasher.add(static_cast<uint64_t>(node->getOpCodeValue()));
+   hasher.add(static_cast<uint64_t>(node->getDataType().getDataType()));
+   hasher.add(static_cast<uint64_t>(node->getNumChildren()));
+   hasher.add(static_cast<uint64_t>(node->getFlags().getValue()));
+
+   if (opCode.isLoadConst())
+      {
+      if (node->getDataType().isIntegral())
+         hasher.add(static_cast<uint64_t>(node->get64bitIntegralValue()));
+      else if (node->getDataType() == TR::Float)
+         hasher.add(static_cast<uint64_t>(node->getFloatBits()));
+      else if (node->getDataType() == TR::Double)
+         hasher.add(node->getDoubleBits());
+      else if (node->getDataType() == TR::Address)
+         hasher.add(node->getAddress());
+      else
+         return false;
+      }
+   else if (node->getOpCodeValue() == TR::BBStart || node->getOpCodeValue() == TR::BBEnd)
+      {
+      hasher.add(static_cast<uint64_t>(node->getBlock()->getNumber()));
+      hasher.add(static_cast<uint64_t>(node->getBlock()->isCold()));
+      }
+   else if (opCode.hasSymbolReference())
+      {
+      hashSymbolReference(comp, node->getSymbolReference(), hasher);
+      }
+   else if (opCode.isBranch())
+      {
+      hasher.add(static_cast<uint64_t>(node->getBranchDestination()->getNode()->getBlock()->getNumber()));
+      if (opCode.isCase())
+         hasher.add(static_cast<uint64_t>(node->getCaseConstant()));
+      }
+
+   for (int32_t i = 0; i < node->getNumChildren(); i++)
+      {
+      if (!hashNode(comp, node->getChild(i), visitCount, hasher))
+         return false;
+      }
+   return true;
+   }
+
+OMR::PersistentCodeCache::PersistentCodeCache(const char *fileName, TR::RawAllocator rawAllocator) :
+   _fileName(fileName),
+   _rawAllocator(rawAllocator),
+   _monitor(NULL),
+   _mapping(NULL),
+   _mappingSize(0),
+   _mapHandle(NULL),
+   _entries(std::less<Key>(), EntryMapAllocator(rawAllocator)),
+   _loadedEntries(0),
+   _storedEntries(0),
+   _hits(0),
+   _misses(0),
+   _rejected(0)
+   {
+   memset(&_fingerprint, 0, sizeof(_fingerprint));
+   _fingerprint._description = TR::Compiler->target.cpu.getProcessorDescription();
+#if defined(TR_TARGET_X86)
+   // Without a port library the processor description is not filled in, so
+   // identify the processor by what CPUID reports
+   //
+   memcpy(_fingerprint._targetIdentification, TR::Compiler->target.cpu.getX86ProcessorVendorId(), 12);
+   _fingerprint._targetIdentification[3] = TR::Compiler->target.cpu.getX86ProcessorSignature();
+   _fingerprint._targetIdentification[4] = TR::Compiler->target.cpu.getX86ProcessorFeatureFlags();
+   _fingerprint._targetIdentification[5] = TR::Compiler->target.cpu.getX86ProcessorFeatureFlags2();
+   _fingerprint._targetIdentification[6] = TR::Compiler->target.cpu.getX86ProcessorFeatureFlags8();
+#endif
+   }
+
+OMR::PersistentCodeCache::~PersistentCodeCache() throw()
+   {
+   if (NULL != _monitor)
+      TR::Monitor::destroy(_monitor);
+   }
+
+OMR::PersistentCodeCache *
+OMR::PersistentCodeCache::create(const char *fileName, TR::RawAllocator rawAllocator)
+   {
+   if (NULL != _instance)
+      return _instance;
+
+   void *storage = rawAllocator.allocate(sizeof(PersistentCodeCache), std::nothrow);
+   if (NULL == storage)
+      return NULL;
+
+   PersistentCodeCache *cache = new (storage) PersistentCodeCache(fileName, rawAllocator);
+   cache->_monitor = TR::Monitor::create("JIT-PersistentCodeCacheMonitor");
+   if (NULL == cache->_monitor)
+      {
+      cache->~PersistentCodeCache();
+      rawAllocator.deallocate(storage);
+      return NULL;
+      }
+
+   cache->mapFile();
+   if (NULL != cache->_mapping && !cache->indexFile())
+      {
+      if (TR::Options::getVerboseOption(TR_VerboseCodeCache))
+         TR_VerboseLog::writeLineLocked(TR_Vlog_CODECACHE, "persistent code cache %s was written for another processor or is damaged; ignoring it", fileName);
+      cache->_entries.clear();
+      cache->unmapFile();
+      }
+
+   _instance = cache;
+   return cache;
+   }
+
+void
+OMR::PersistentCodeCache::destroy()
+   {
+   PersistentCodeCache *cache = _instance;
+   if (NULL == cache)
+      return;
+
+   cache->writeFile();
+   cache->reportStatistics();
+
+   for (auto it = cache->_entries.begin(); it != cache->_entries.end(); ++it)
+      {
+      const uint8_t *entry = reinterpret_cast<const uint8_t *>(it->second);
+      if (entry < cache->_mapping || entry >= cache->_mapping + cache->_mappingSize)
+         cache->_rawAllocator.deallocate(const_cast<uint8_t *>(entry));
+      }
+   cache->_entries.clear();
+   cache->unmapFile();
+
+   _instance = NULL;
+   TR::RawAllocator rawAllocator(cache->_rawAllocator);
+   cache->~PersistentCodeCache();
+   rawAllocator.deallocate(cache);
+   }
+
+void
+OMR::PersistentCodeCache::mapFile()
+   {
+   if (NULL != TR::Compiler->omrPortLib)
+      {
+      OMRPORT_ACCESS_FROM_OMRPORT(TR::Compiler->omrPortLib);
+      intptr_t fd = omrfile_open(_fileName, EsOpenRead, 0);
+      if (fd < 0)
+         return;
+      int64_t length = omrfile_flength(fd);
+      if (length >= static_cast<int64_t>(sizeof(FileHeader)))
+         {
+         _mapHandle = omrmmap_map_file(fd, 0, static_cast<uintptr_t>(length), "JIT persistent code cache", OMRPORT_MMAP_FLAG_READ, OMRMEM_CATEGORY_JIT);
+         if (NULL != _mapHandle)
+            {
+            _mapping = static_cast<const uint8_t *>(_mapHandle->pointer);
+            _mappingSize = static_cast<size_t>(length);
+            }
+         }
+      omrfile_close(fd);
+      return;
+      }
+
+#if defined(PERSISTENT_CODE_CACHE_MMAP)
+   int fd = open(_fileName, O_RDONLY);
+   if (fd < 0)
+      return;
+   struct stat fileStatus;
+   if (0 == fstat(fd, &fileStatus) && fileStatus.st_size >= static_cast<off_t>(sizeof(FileHeader)))
+      {
+      void *mapping = mmap(NULL, static_cast<size_t>(fileStatus.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+      if (MAP_FAILED != mapping)
+         {
+         _mapping = static_cast<const uint8_t *>(mapping);
+         _mappingSize = static_cast<size_t>(fileStatus.st_size);
+         }
+      }
+   close(fd);
+#else
+   FILE *file = fopen(_fileName, "rb");
+   if (NULL == file)
+      return;
+   if (0 == fseek(file, 0, SEEK_END))
+      {
+      long length = ftell(file);
+      if (length >= static_cast<long>(sizeof(FileHeader)) && 0 == fseek(file, 0, SEEK_SET))
+         {
+         uint8_t *contents = static_cast<uint8_t *>(_rawAllocator.allocate(static_cast<size_t>(length), std::nothrow));
+         if (NULL != contents && fread(contents, 1, static_cast<size_t>(length), file) == static_cast<size_t>(length))
+            {
+            _mapping = contents;
+            _mappingSize = static_cast<size_t>(length);
+            }
+         else if (NULL != contents)
+            {
+            _rawAllocator.deallocate(contents);
+            }
+         }
+      }
+   fclose(file);
+#endif
+   }
+
+void
+OMR::PersistentCodeCache::unmapFile() throw()
+   {
+   if (NULL == _mapping)
+      return;
+
+   if (NULL != _mapHandle)
+      {
+      OMRPORT_ACCESS_FROM_OMRPORT(TR::Compiler->omrPortLib);
+      omrmmap_unmap_file(_mapHandle);
+      _mapHandle = NULL;
+      }
+   else
+      {
+#if defined(PERSISTENT_CODE_CACHE_MMAP)
+      munmap(const_cast<uint8_t *>(_mapping), _mappingSize);
+#else
+      _rawAllocator.deallocate(const_cast<uint8_t *>(_mapping));
+#endif
+      }
+
+   _mapping = NULL;
+   _mappingSize = 0;
+   }
+
+bool
+OMR::PersistentCodeCache::indexFile()
+   {
+   const FileHeader *header = reinterpret_cast<const FileHeader *>(_mapping);
+   if (0 != memcmp(header->_eyecatcher, PERSISTENT_CODE_CACHE_EYECATCHER, sizeof(header->_eyecatcher))
+       || header->_version != VERSION
+       || header->_pointerSize != sizeof(void *)
+       || 0 != memcmp(&header->_fingerprint, &_fingerprint, sizeof(_fingerprint)))
+      return false;
+
+   size_t offset = alignedSize(sizeof(FileHeader));
+   for (uint64_t i = 0; i < header->_numEntries; i++)
+      {
+      if (offset > _mappingSize || _mappingSize - offset < sizeof(EntryHeader))
+         return false;
+
+      const EntryHeader *entry = reinterpret_cast<const EntryHeader *>(_mapping + offset);
+      if (entry->_size != EntryHeader::sizeFor(entry->_numRelocations, entry->_namesSize, entry->_codeSize)
+          || entry->_size > _mappingSize - offset
+          || entry->_entryOffset >= entry->_codeSize
+          || entry->_codeAlignment >= CODE_ALIGNMENT
+          || (entry->_namesSize > 0 && entry->names()[entry->_namesSize - 1] != '\0'))
+         return false;
+
+      const RelocationRecord *relocations = entry->relocations();
+      for (uint32_t r = 0; r < entry->_numRelocations; r++)
+         {
+         const RelocationRecord &relocation = relocations[r];
+         if ((relocation._size != 4 && relocation._size != 8)
+             || relocation._offset > entry->_codeSize
+             || relocation._size > entry->_codeSize - relocation._offset)
+            return false;
+
+         if (relocation._kind == BodyAddress)
+            {
+            if (readAddress(entry->code() + relocation._offset, relocation._size) > entry->_codeSize)
+               return false;
+            }
+         else if (relocation._kind != SymbolAddress || relocation._nameOffset >= entry->_namesSize)
+            {
+            return false;
+            }
+         }
+
+      Key key = { { entry->_key[0], entry->_key[1] } };
+      if (_entries.insert(std::make_pair(key, entry)).second)
+         _loadedEntries++;
+      offset += static_cast<size_t>(entry->_size);
+      }
+
+   return true;
+   }
+
+void
+OMR::PersistentCodeCache::writeFile()
+   {
+   if (0 == _storedEntries)
+      return;
+
+   size_t fileNameLength = strlen(_fileName);
+   char *tempFileName = static_cast<char *>(_rawAllocator.allocate(fileNameLength + sizeof(".tmp"), std::nothrow));
+   if (NULL == tempFileName)
+      return;
+   memcpy(tempFileName, _fileName, fileNameLength);
+   memcpy(tempFileName + fileNameLength, ".tmp", sizeof(".tmp"));
+
+   // Write a new file and rename it over the old one, so that a process
+   // starting meanwhile sees either file whole
+   //
+   FileHeader header;
+   memset(&header, 0, sizeof(header));
+   memcpy(header._eyecatcher, PERSISTENT_CODE_CACHE_EYECATCHER, sizeof(header._eyecatcher));
+   header._version = VERSION;
+   header._pointerSize = sizeof(void *);
+   header._fingerprint = _fingerprint;
+   header._numEntries = _entries.size();
+
+   bool written = false;
+   FILE *file = fopen(tempFileName, "wb");
+   if (NULL != file)
+      {
+      static const uint8_t padding[8] = { 0 };
+      size_t paddingSize = alignedSize(sizeof(header)) - sizeof(header);
+      written = fwrite(&header, sizeof(header), 1, file) == 1
+         && (0 == paddingSize || fwrite(padding, paddingSize, 1, file) == 1);
+      for (auto it = _entries.begin(); written && it != _entries.end(); ++it)
+         written = fwrite(it->second, static_cast<size_t>(it->second->_size), 1, file) == 1;
+      written = (0 == fclose(file)) && written;
+      }
+
+   // The old file may still be mapped, which some platforms do not allow
+   // renaming over
+   //
+   if (written)
+      {
+#if defined(OMR_OS_WINDOWS)
+      remove(_fileName);
+#endif
+      written = (0 == rename(tempFileName, _fileName));
+      }
+
+   if (!written)
+      {
+      remove(tempFileName);
+      if (TR::Options::getVerboseOption(TR_VerboseCodeCache))
+         TR_VerboseLog::writeLineLocked(TR_Vlog_CODECACHE, "persistent code cache %s could not be written", _fileName);
+      }
+
+   _rawAllocator.deallocate(tempFileName);
+   }
+
+void
+OMR::PersistentCodeCache::reportStatistics()
+   {
+   if (TR::Options::getCmdLineOptions() && TR::Options::getVerboseOption(TR_VerboseCodeCache))
+      {
+      TR_VerboseLog::writeLineLocked(
+         TR_Vlog_CODECACHE,
+         "persistent code cache %s: entries=%u loaded=%u hits=%llu misses=%llu stored=%u rejected=%llu",
+         _fileName,
+         static_cast<uint32_t>(_entries.size()),
+         _loadedEntries,
+         static_cast<unsigned long long>(_hits),
+         static_cast<unsigned long long>(_misses),
+         _storedEntries,
+         static_cast<unsigned long long>(_rejected));
+      }
+   }
+
+bool
+OMR::PersistentCodeCache::computeKey(TR::Compilation *comp, Key &key)
+   {
+   if (comp->getRecompilationInfo()
+       || comp->compileRelocatableCode()
+       || comp->isOutOfProcessCompilation()
+       || comp->getOption(TR_EmitRelocatableELFFile)
+       || comp->getOption(TR_EmitExecutableELFFile))
+      return false;
+
+   KeyHasher hasher;
+   hasher.add(static_cast<uint64_t>(VERSION));
+   hasher.add(static_cast<uint64_t>(sizeof(void *)));
+   hasher.add(&_fingerprint, sizeof(_fingerprint));
+   hasher.add(comp->signature());
+   hasher.add(static_cast<uint64_t>(comp->getMethodHotness()));
+   hasher.add(static_cast<uint64_t>(comp->getOptLevel()));
+
+   for (uint32_t word = 0; word <= TR_OWM; word++)
+      {
+      uint32_t bits = 0;
+      for (uint32_t bit = 5; bit < 32; bit++)
+         {
+         if (comp->getOptions()->getAnyOption((1u << bit) | word))
+            bits |= 1u << bit;
+         }
+      hasher.add(static_cast<uint64_t>(bits));
+      }
+
+   for (int32_t opt = 0; opt < OMR::numOpts; opt++)
+      hasher.add(static_cast<uint64_t>(comp->getOptions()->isDisabled(static_cast<OMR::Optimizations>(opt))));
+
+   // Numeric, string and method specific option values are all set from the
+   // option strings, so these stand in for the rest of the option state
+   TR::Options *cmdLineOptions = TR::Options::getCmdLineOptions();
+   hasher.add(cmdLineOptions->getStartOptions());
+   hasher.add(cmdLineOptions->getEnvOptions());
+
+   vcount_t visitCount = comp->incOrResetVisitCount();
+   for (TR::TreeTop *tt = comp->getStartTree(); tt; tt = tt->getNextTreeTop())
+      {
+      if (!hashNode(comp, tt->getNode(), visitCount, hasher))
+         return false;
+      }
+
+   hasher.finish(key);
+   return true;
+   }
+
+void *
+OMR::PersistentCodeCache::findCallTarget(TR::Compilation *comp, const char *name)
+   {
+   TR::SymbolReferenceTable *symRefTab = comp->getSymRefTab();
+   void *target = NULL;
+   for (int32_t i = symRefTab->getIndexOfFirstSymRef(); i < symRefTab->getNumSymRefs(); i++)
+      {
+      TR::SymbolReference *symRef = symRefTab->getSymRef(i);
+      if (NULL == symRef || NULL == symRef->getSymbol() || NULL == symRef->getSymbol()->getResolvedMethodSymbol())
+         continue;
+
+      TR::ResolvedMethodSymbol *methodSymbol = symRef->getSymbol()->getResolvedMethodSymbol();
+      void *address = methodSymbol->getMethodAddress();
+      if (NULL == address || 0 != strcmp(methodSymbol->getResolvedMethod()->externalName(comp->trMemory()), name))
+         continue;
+
+      // A name that stands for two different functions cannot be relocated
+      //
+      if (NULL != target && target != address)
+         return NULL;
+      target = address;
+      }
+   return target;
+   }
+
+bool
+OMR::PersistentCodeCache::load(TR::Compilation *comp, const Key &key)
+   {
+   _monitor->enter();
+   auto it = _entries.find(key);
+   const EntryHeader *entry = (it != _entries.end()) ? it->second : NULL;
+   if (NULL == entry)
+      _misses++;
+   _monitor->exit();
+
+   if (NULL == entry)
+      return false;
+
+   const RelocationRecord *relocations = entry->relocations();
+   void **targets = static_cast<void **>(comp->trMemory()->allocateHeapMemory((entry->_numRelocations + 1) * sizeof(void *)));
+   for (uint32_t r = 0; r < entry->_numRelocations; r++)
+      {
+      targets[r] = NULL;
+      if (relocations[r]._kind == SymbolAddress)
+         {
+         targets[r] = findCallTarget(comp, entry->names() + relocations[r]._nameOffset);
+         if (NULL == targets[r])
+            {
+            _monitor->enter();
+            _misses++;
+            _monitor->exit();
+            return false;
+            }
+         }
+      }
+
+   TR::CodeGenerator *cg = comp->cg();
+   cg->reserveCodeCache();
+   uint8_t *coldCode = NULL;
+   uint8_t *buffer = cg->allocateCodeMemory(entry->_codeSize + CODE_ALIGNMENT, 0, &coldCode);
+
+   // Keep the code at the same alignment it was generated at, which the
+   // entry point alignment and any aligned data in the body rely on
+   //
+   uint8_t *start = buffer + ((entry->_codeAlignment - reinterpret_cast<uintptr_t>(buffer)) & (CODE_ALIGNMENT - 1));
+   memcpy(start, entry->code(), entry->_codeSize);
+
+   for (uint32_t r = 0; r < entry->_numRelocations; r++)
+      {
+      uint8_t *location = start + relocations[r]._offset;
+      uint64_t value = (relocations[r]._kind == BodyAddress)
+         ? reinterpret_cast<uintptr_t>(start) + readAddress(location, relocations[r]._size)
+         : reinterpret_cast<uintptr_t>(targets[r]);
+      writeAddress(location, relocations[r]._size, value);
+      }
+
+   // Hand back the part of the alignment slack the body does not use
+   //
+   cg->getCodeCache()->trimCodeMemoryAllocation(buffer, (start - buffer) + entry->_codeSize);
+
+   cg->setBinaryBufferStart(start);
+   cg->setBinaryBufferCursor(start + entry->_codeSize);
+   cg->setPrePrologueSize(entry->_entryOffset);
+   comp->getMethodSymbol()->setMethodAddress(cg->getCodeStart());
+   cg->syncCode(start, entry->_codeSize);
+
+   _monitor->enter();
+   _hits++;
+   _monitor->exit();
+
+   if (TR::Options::getVerboseOption(TR_VerboseCodeCache))
+      TR_VerboseLog::writeLineLocked(TR_Vlog_CODECACHE, "loaded %s from the persistent code cache @ " POINTER_PRINTF_FORMAT, comp->signature(), cg->getCodeStart());
+
+   return true;
+   }
+
+void
+OMR::PersistentCodeCache::store(TR::Compilation *comp, const Key &key)
+   {
+   TR::CodeGenerator *cg = comp->cg();
+   uint8_t *start = cg->getBinaryBufferStart();
+   uint8_t *end = cg->getCodeEnd();
+   size_t codeSize = end - start;
+
+   // Bodies with inlined methods are only valid while the inlined methods
+   // are, which the key does not capture
+   //
+   bool storable = comp->compilePersistentCode() && 0 == comp->getNumInlinedCallSites() && NULL != start;
+
+   TR::list<TR::Relocation *> &internalRelocations = cg->getRelocationList();
+   auto &staticRelocations = cg->getStaticRelocations();
+   size_t maxRelocations = internalRelocations.size() + staticRelocations.size();
+   RelocationRecord *records = static_cast<RelocationRecord *>(comp->trMemory()->allocateHeapMemory((maxRelocations + 1) * sizeof(RelocationRecord)));
+   uint32_t numRelocations = 0;
+   size_t namesSize = 0;
+
+   for (auto it = internalRelocations.begin(); storable && it != internalRelocations.end(); ++it)
+      {
+      TR::Relocation *relocation = *it;
+      if (relocation->isPositionIndependent())
+         continue;
+
+      uint8_t *location = relocation->getUpdateLocation();
+      if (!relocation->isLabelAbsolute()
+          || location < start
+          || location + sizeof(uintptr_t) > end)
+         {
+         storable = false;
+         break;
+         }
+
+      uintptr_t value = static_cast<uintptr_t>(readAddress(location, sizeof(uintptr_t)));
+      if (value < reinterpret_cast<uintptr_t>(start) || value > reinterpret_cast<uintptr_t>(end))
+         {
+         storable = false;
+         break;
+         }
+
+      RelocationRecord &record = records[numRelocations++];
+      memset(&record, 0, sizeof(record));
+      record._offset = static_cast<uint32_t>(location - start);
+      record._kind = BodyAddress;
+      record._size = sizeof(uintptr_t);
+      }
+
+   for (auto it = staticRelocations.begin(); storable && it != staticRelocations.end(); ++it)
+      {
+      uint8_t *location = it->location();
+      TR::StaticRelocationSize expectedSize = (sizeof(uintptr_t) == 8) ? TR::StaticRelocationSize::word64 : TR::StaticRelocationSize::word32;
+      if (it->type() != TR::StaticRelocationType::Absolute
+          || it->size() != expectedSize
+          || location < start
+          || location + sizeof(uintptr_t) > end
+          || findCallTarget(comp, it->symbol()) != reinterpret_cast<void *>(readAddress(location, sizeof(uintptr_t))))
+         {
+         storable = false;
+         break;
+         }
+
+      RelocationRecord &record = records[numRelocations++];
+      memset(&record, 0, sizeof(record));
+      record._offset = static_cast<uint32_t>(location - start);
+      record._kind = SymbolAddress;
+      record._size = sizeof(uintptr_t);
+      record._nameOffset = static_cast<uint32_t>(namesSize);
+      namesSize += strlen(it->symbol()) + 1;
+      }
+
+   if (!storable)
+      {
+      _monitor->enter();
+      _rejected++;
+      _monitor->exit();
+      return;
+      }
+
+   size_t entrySize = EntryHeader::sizeFor(numRelocations, namesSize, codeSize);
+   uint8_t *storage = static_cast<uint8_t *>(_rawAllocator.allocate(entrySize, std::nothrow));
+   if (NULL == storage)
+      return;
+   memset(storage, 0, entrySize);
+
+   EntryHeader *entry = reinterpret_cast<EntryHeader *>(storage);
+   entry->_key[0] = key._hash[0];
+   entry->_key[1] = key._hash[1];
+   entry->_size = entrySize;
+   entry->_codeSize = static_cast<uint32_t>(codeSize);
+   entry->_entryOffset = static_cast<uint32_t>(cg->getCodeStart() - start);
+   entry->_codeAlignment = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(start) & (CODE_ALIGNMENT - 1));
+   entry->_numRelocations = numRelocations;
+   entry->_namesSize = static_cast<uint32_t>(namesSize);
+
+   memcpy(const_cast<RelocationRecord *>(entry->relocations()), records, numRelocations * sizeof(RelocationRecord));
+   uint8_t *code = const_cast<uint8_t *>(entry->code());
+   memcpy(code, start, codeSize);
+
+   // Keep body addresses as offsets and call targets as names, which is all
+   // that does not depend on where this process put things
+   //
+   char *names = const_cast<char *>(entry->names());
+   auto staticRelocation = staticRelocations.begin();
+   for (uint32_t r = 0; r < numRelocations; r++)
+      {
+      uint8_t *location = code + records[r]._offset;
+      if (records[r]._kind == BodyAddress)
+         {
+         writeAddress(location, records[r]._size, readAddress(location, records[r]._size) - reinterpret_cast<uintptr_t>(start));
+         }
+      else
+         {
+         writeAddress(location, records[r]._size, 0);
+         strcpy(names + records[r]._nameOffset, staticRelocation->symbol());
+         ++staticRelocation;
+         }
+      }
+
+   _monitor->enter();
+   bool inserted = _entries.insert(std::make_pair(key, static_cast<const EntryHeader *>(entry))).second;
+   if (inserted)
+      _storedEntries++;
+   _monitor->exit();
+
+   if (!inserted)
+      _rawAllocator.deallocate(storage);
+   }
+
+uint64_t
+OMR::PersistentCodeCache::hits()
+   {
+   _monitor->enter();
+   uint64_t hits = _hits;
+   _monitor->exit();
+   return hits;
+   }
+
+uint64_t
+OMR::PersistentCodeCache::misses()
+   {
+   _monitor->enter();
+   uint64_t misses = _misses;
+   _monitor->exit();
+   return misses;
+   }
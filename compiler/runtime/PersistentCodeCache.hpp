@@ -0,0 +1,175 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#ifndef OMR_PERSISTENT_CODE_CACHE
+#define OMR_PERSISTENT_CODE_CACHE
+
+#pragma once
+
+#ifndef TR_PERSISTENT_CODE_CACHE
+#define TR_PERSISTENT_CODE_CACHE
+namespace OMR { class PersistentCodeCache; }
+namespace TR { using OMR::PersistentCodeCache; }
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+#include <map>
+#include "env/TypedAllocator.hpp"
+#include "env/RawAllocator.hpp"
+#include "omrport.h"
+
+namespace TR { class Compilation; }
+namespace TR { class Monitor; }
+
+namespace OMR {
+
+/** @class PersistentCodeCache
+ *  @brief The PersistentCodeCache class keeps compiled method bodies in a
+ *  file, so that a later run of the same program loads them instead of
+ *  compiling the methods again.
+ *
+ *  Bodies are keyed by a hash of the trees IL generation produced for the
+ *  method, the compilation options and the processor the code was generated
+ *  for.  The file is mapped when the JIT starts.  A compilation whose key is
+ *  found copies the body into the code cache and relocates it instead of
+ *  optimizing and generating code; one whose key is missing generates
+ *  persistent code (see TR::Compilation::compilePersistentCode()), which is
+ *  added to the file when the JIT shuts down.
+ *
+ *  Bodies refer to the functions they call through static relocations, which
+ *  are resolved by name against the call targets of the compilation loading
+ *  them, and to their own labels through relocations rebased on the address
+ *  they are loaded at.  A file written for another processor, pointer size or
+ *  file version is ignored and replaced.
+ **/
+class PersistentCodeCache
+   {
+public:
+   struct Key
+      {
+      uint64_t _hash[2];
+
+      bool operator<(const Key &other) const
+         {
+         return _hash[0] != other._hash[0] ? _hash[0] < other._hash[0] : _hash[1] < other._hash[1];
+         }
+      };
+
+   /**
+    * @brief Map the file, if it exists, and index the bodies it holds.
+    */
+   static PersistentCodeCache *create(const char *fileName, TR::RawAllocator rawAllocator);
+   static PersistentCodeCache *instance() { return _instance; }
+
+   /**
+    * @brief Write the file back if bodies were added to it, unmap it and report
+    *        the statistics under verbose={codecache}.  No compilation may be
+    *        running.
+    */
+   static void destroy();
+
+   /**
+    * @brief Compute the key of a compilation whose IL has just been generated.
+    *        The key covers the trees, the whole option state, the pointer
+    *        size and the processor.
+    * @returns false if the compilation cannot use the persistent code cache
+    */
+   bool computeKey(TR::Compilation *comp, Key &key);
+
+   /**
+    * @brief Install the body stored under key as the result of the compilation.
+    * @returns true if it was installed; the method symbol of the compilation
+    *          then holds its entry point
+    */
+   bool load(TR::Compilation *comp, const Key &key);
+
+   /**
+    * @brief Add the body a compilation has just generated under key, unless
+    *        it refers to something that cannot be relocated.
+    */
+   void store(TR::Compilation *comp, const Key &key);
+
+   /// Number of compilations a stored body was installed for
+   uint64_t hits();
+
+   /// Number of compilations that looked for a body and found none usable
+   uint64_t misses();
+
+private:
+   static const uint32_t VERSION = 1;
+   static const uint32_t CODE_ALIGNMENT = 64;
+
+   struct FileHeader;
+   struct EntryHeader;
+   struct RelocationRecord;
+
+   enum RelocationKind
+      {
+      BodyAddress,   ///< the address of a location in the body, stored as its offset
+      SymbolAddress  ///< the address of a named call target, stored as zero
+      };
+
+   /// Identifies the processor code was generated for
+   struct ProcessorFingerprint
+      {
+      OMRProcessorDesc _description;
+      uint32_t _targetIdentification[8]; ///< what the description does not cover on this target
+      };
+
+   PersistentCodeCache(const char *fileName, TR::RawAllocator rawAllocator);
+   ~PersistentCodeCache() throw();
+
+   void mapFile();
+   void unmapFile() throw();
+   bool indexFile();
+   void writeFile();
+   void reportStatistics();
+
+   static void *findCallTarget(TR::Compilation *comp, const char *name);
+
+   static PersistentCodeCache *_instance;
+
+   const char *_fileName;
+   TR::RawAllocator _rawAllocator;
+   TR::Monitor *_monitor;
+   ProcessorFingerprint _fingerprint;
+
+   const uint8_t *_mapping;
+   size_t _mappingSize;
+   J9MmapHandle *_mapHandle; ///< set if the port library mapped the file
+
+   typedef TR::typed_allocator<std::pair<const Key, const EntryHeader *>, TR::RawAllocator> EntryMapAllocator;
+
+   /// Bodies from the file, which live in the mapping, and bodies added since
+   std::map<Key, const EntryHeader *, std::less<Key>, EntryMapAllocator> _entries;
+
+   uint32_t _loadedEntries;
+   uint32_t _storedEntries;
+   uint64_t _hits;
+   uint64_t _misses;
+   uint64_t _rejected;
+   };
+
+}
+
+#endif // OMR_PERSISTENT_CODE_CACHE
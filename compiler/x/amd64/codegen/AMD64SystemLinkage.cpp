@@ -867,7 +867,7 @@ TR::Register *TR::AMD64SystemLinkage::buildDirectDispatch(
          methodSymRef,
          cg());
 
-      if (comp()->getOption(TR_EmitRelocatableELFFile))
+      if (comp()->getOption(TR_EmitRelocatableELFFile) || comp()->compilePersistentCode())
          {
          LoadRegisterInstruction->setReloKind(TR_NativeMethodAbsolute);
          }
@@ -300,6 +300,8 @@ bool OMR::X86::AMD64::MemoryReference::needsAddressLoadInstruction(intptr_t next
       return false;
    else if (cg->comp()->isOutOfProcessCompilation() && sr.getSymbol() && sr.getSymbol()->isStatic() && !sr.getSymbol()->isStaticAddressWithinMethodBounds())
       return true;
+   else if (cg->comp()->compilePersistentCode())
+      return true; // The code will run at another address, so RIP relative addressing would not reach the same target
    else if (IS_32BIT_RIP(displacement, nextInstructionAddress))
       return false;
    else
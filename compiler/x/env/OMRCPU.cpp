@@ -86,10 +86,13 @@ OMR::X86::CPU::queryX86TargetCPUID()
 
    if (!buf)
       {
-      buf = reinterpret_cast<TR_X86CPUIDBuffer *>(malloc(sizeof(TR_X86CPUIDBuffer)));
-      if (!buf)
+      // Only publish the buffer once it is filled in; compilations running
+      // in parallel may race to get here, leaving one of the buffers unused
+      TR_X86CPUIDBuffer *newBuf = reinterpret_cast<TR_X86CPUIDBuffer *>(malloc(sizeof(TR_X86CPUIDBuffer)));
+      if (!newBuf)
          return NULL;
-      jitGetCPUID(buf);
+      jitGetCPUID(newBuf);
+      buf = newBuf;
       }
 
    return buf;
@@ -24,20 +24,32 @@
 
 #include "CompactSchemeFixupObject.hpp"
 #include "EnvironmentStandard.hpp"
+#include "ObjectIterator.hpp"
+#include "SlotObject.hpp"
+#include "SparseVirtualMemory.hpp"
 
 #if defined(OMR_GC_MODRON_COMPACTION)
 
 void
 MM_CompactSchemeFixupObject::fixupObject(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr)
 {
-#error provide an implementation to fix objects during a compact
+	GC_ObjectIterator objectIterator(_omrVM, objectPtr);
+	GC_SlotObject *slotObject = NULL;
+	while (NULL != (slotObject = objectIterator.nextSlot())) {
+		_compactScheme->fixupObjectSlot(slotObject);
+	}
+
+	if (objectPtr->isOffHeap() && (NULL != objectPtr->begin())) {
+		/* the proxy may have moved, the sparse data entry must follow it */
+		env->getExtensions()->largeObjectVirtualMemory->updateSparseDataEntryAfterObjectHasMoved(objectPtr->begin(), objectPtr);
+	}
 }
 
 
 void
 MM_CompactSchemeFixupObject::verifyForwardingPtr(omrobjectptr_t objectPtr, omrobjectptr_t forwardingPtr)
 {
-#error provide an implementation to verify objects after a compact is complete
+	/* example objects carry no state that could be checked against the forwarded location */
 }
 
 #endif /* OMR_GC_MODRON_COMPACTION */
@@ -51,4 +51,11 @@ MM_ConcurrentMarkingDelegate::collectRoots(MM_EnvironmentBase *env, uintptr_t co
 
 	return bytesScanned;
 }
+
+void
+MM_ConcurrentMarkingDelegate::acquireExclusiveVMAccessAndSignalThreadsToActivateWriteBarrier(MM_EnvironmentBase *env)
+{
+	/* Example threads need no signal, the collector only has to prepare for concurrent marking under exclusive access */
+	_collector->acquireExclusiveVMAccessAndSignalThreadsToActivateWriteBarrier(env);
+}
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
@@ -28,7 +28,7 @@
 #include "omrgcconsts.h"
 #include "omrport.h"
 
-#include "ConcurrentSafepointCallback.hpp"
+#include "ConcurrentSafepointCallbackExample.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
 
@@ -97,7 +97,7 @@ public:
 	MMINLINE MM_ConcurrentSafepointCallback*
 	createSafepointCallback(MM_EnvironmentBase *env)
 	{
-		return MM_ConcurrentSafepointCallback::newInstance(env);
+		return MM_ConcurrentSafepointCallbackExample::newInstance(env);
 	}
 
 	/**
@@ -209,7 +209,7 @@ public:
 	/**
 	 * Firstly acquire exclusive VM access, and then signal threads to activate WB.
 	 */
-	void acquireExclusiveVMAccessAndSignalThreadsToActivateWriteBarrier(MM_EnvironmentBase *env) {}
+	void acquireExclusiveVMAccessAndSignalThreadsToActivateWriteBarrier(MM_EnvironmentBase *env);
 
 	/**
 	 * This can be used to optimize the concurrent write barrier(s) by conditioning threads to stop
@@ -0,0 +1,70 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "ConcurrentSafepointCallbackExample.hpp"
+
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+#include "EnvironmentBase.hpp"
+
+MM_ConcurrentSafepointCallbackExample *
+MM_ConcurrentSafepointCallbackExample::newInstance(MM_EnvironmentBase *env)
+{
+	MM_ConcurrentSafepointCallbackExample *callback;
+
+	callback = (MM_ConcurrentSafepointCallbackExample *)env->getForge()->allocate(sizeof(MM_ConcurrentSafepointCallbackExample), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != callback) {
+		new(callback) MM_ConcurrentSafepointCallbackExample(env);
+	}
+	return callback;
+}
+
+void
+MM_ConcurrentSafepointCallbackExample::kill(MM_EnvironmentBase *env)
+{
+	env->getForge()->free(this);
+}
+
+void
+#if defined(AIXPPC) || defined(LINUXPPC)
+MM_ConcurrentSafepointCallbackExample::registerCallback(MM_EnvironmentBase *env, SafepointCallbackHandler handler, void *userData, bool cancelAfterGC)
+#else
+MM_ConcurrentSafepointCallbackExample::registerCallback(MM_EnvironmentBase *env, SafepointCallbackHandler handler, void *userData)
+#endif /* defined(AIXPPC) || defined(LINUXPPC) */
+{
+	_handler = handler;
+	_userData = userData;
+}
+
+void
+MM_ConcurrentSafepointCallbackExample::requestCallback(MM_EnvironmentBase *env)
+{
+	if (NULL != _handler) {
+		_handler(env->getOmrVMThread(), _userData);
+	}
+}
+
+void
+MM_ConcurrentSafepointCallbackExample::cancelCallback(MM_EnvironmentBase *env)
+{
+	/* Callbacks are never left pending, there is nothing to cancel */
+}
+
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
@@ -0,0 +1,69 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(CONCURRENTSAFEPOINTCALLBACKEXAMPLE_HPP_)
+#define CONCURRENTSAFEPOINTCALLBACKEXAMPLE_HPP_
+
+#include "omrcfg.h"
+
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+#include "ConcurrentSafepointCallback.hpp"
+
+/**
+ * Example threads only ever pay allocation tax from within an allocation, where they hold no
+ * state that the write barrier activation could invalidate. A requested callback is therefore
+ * run immediately on the requesting thread rather than deferred to an async event.
+ */
+class MM_ConcurrentSafepointCallbackExample : public MM_ConcurrentSafepointCallback
+{
+private:
+protected:
+public:
+
+private:
+protected:
+public:
+	static MM_ConcurrentSafepointCallbackExample *newInstance(MM_EnvironmentBase *env);
+	virtual void kill(MM_EnvironmentBase *env);
+
+#if defined(AIXPPC) || defined(LINUXPPC)
+	virtual void registerCallback(MM_EnvironmentBase *env, SafepointCallbackHandler handler, void *userData, bool cancelAfterGC = false);
+#else
+	virtual void registerCallback(MM_EnvironmentBase *env, SafepointCallbackHandler handler, void *userData);
+#endif /* defined(AIXPPC) || defined(LINUXPPC) */
+
+	virtual void requestCallback(MM_EnvironmentBase *env);
+
+	virtual void cancelCallback(MM_EnvironmentBase *env);
+
+	/**
+	 * Create a MM_ConcurrentSafepointCallbackExample object
+	 */
+	MM_ConcurrentSafepointCallbackExample(MM_EnvironmentBase *env)
+		: MM_ConcurrentSafepointCallback(env)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+
+#endif /* CONCURRENTSAFEPOINTCALLBACKEXAMPLE_HPP_ */
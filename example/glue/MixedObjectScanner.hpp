@@ -47,8 +47,8 @@ protected:
 	 * @param[in] flags Scanning context flags
 	 */
 	MMINLINE GC_MixedObjectScanner(MM_EnvironmentBase *env, omrobjectptr_t objectPtr, uintptr_t flags)
-		: GC_ObjectScanner(env, (fomrobject_t *)objectPtr + 1, 0, flags)
-		, _endPtr((fomrobject_t *)((uint8_t*)objectPtr + MM_GCExtensionsBase::getExtensions(env->getOmrVM())->objectModel.getConsumedSizeInBytesWithHeader(objectPtr)))
+		: GC_ObjectScanner(env, objectPtr->isOffHeap() ? objectPtr->begin() : (fomrobject_t *)objectPtr + 1, 0, flags)
+		, _endPtr(objectPtr->isOffHeap() ? objectPtr->end() : (fomrobject_t *)((uint8_t*)objectPtr + MM_GCExtensionsBase::getExtensions(env->getOmrVM())->objectModel.getConsumedSizeInBytesWithHeader(objectPtr)))
 		, _mapPtr(_scanPtr)
 	{
 		_typeId = __FUNCTION__;
@@ -72,22 +72,48 @@ private:
 	RawObjectHeader _value;
 };
 
+/**
+ * The slots of an off-heap object are held in sparse virtual memory (see MM_SparseVirtualMemory). The object
+ * in the heap is a proxy whose body, after the header slot, records where the slots are.
+ */
+struct OffHeapData
+{
+	Slot *slots;
+	uintptr_t sizeInBytes;
+};
+
 class Object
 {
 public:
+	/**
+	 * Flag set in the header of off-heap objects. The collector uses the age bits and the low three bits
+	 * of the flags byte (heap holes and forwarding tags), the remaining bit is free for the language.
+	 */
+	static const ObjectFlags OFF_HEAP = 0x08;
+
 	static ObjectSize allocSize(ObjectSize nslots) {
 		return ObjectSize(sizeof(ObjectHeader) + sizeof(fomrobject_t) * nslots);
 	}
 
+	static ObjectSize offHeapProxySize() {
+		return ObjectSize(sizeof(uintptr_t) + sizeof(OffHeapData));
+	}
+
 	explicit Object(ObjectSize sizeInBytes, ObjectFlags flags = 0) : header(sizeInBytes, flags) {}
 
-	size_t sizeOfSlotsInBytes() const { return header.sizeInBytes() - sizeof(ObjectHeader); }
+	bool isOffHeap() const { return OFF_HEAP == (header.flags() & OFF_HEAP); }
+
+	OffHeapData* offHeapData() { return (OffHeapData*)((uintptr_t)this + sizeof(uintptr_t)); }
+
+	const OffHeapData* offHeapData() const { return (const OffHeapData*)((uintptr_t)this + sizeof(uintptr_t)); }
+
+	size_t sizeOfSlotsInBytes() const { return isOffHeap() ? offHeapData()->sizeInBytes : header.sizeInBytes() - sizeof(ObjectHeader); }
 
 	size_t slotCount() const { return sizeOfSlotsInBytes() / sizeof(Slot); }
 
-	Slot* slots() { return (Slot*)(this + 1); }
+	Slot* slots() { return isOffHeap() ? offHeapData()->slots : (Slot*)(this + 1); }
 
-	const Slot* slots() const { return (Slot*)(this + 1); }
+	const Slot* slots() const { return isOffHeap() ? offHeapData()->slots : (Slot*)(this + 1); }
 
 	Slot* begin() { return slots(); }
 
@@ -23,7 +23,9 @@
 #define OBJECTALLOCATIONMODEL_HPP_
 
 #include "AllocateInitialization.hpp"
+#include "GCExtensionsBase.hpp"
 #include "ObjectModel.hpp"
+#include "SparseVirtualMemory.hpp"
 
 /**
  * Class definition for the Java object allocation model.
@@ -45,11 +47,31 @@ public:
 
 protected:
 private:
+	MM_EnvironmentBase * const _env; /**< environment of the allocating thread */
+	void *_offHeapData; /**< sparse region reserved for the slots, or NULL if the object is allocated entirely in the heap or the region is mapped to a proxy */
+	uintptr_t const _offHeapSizeInBytes; /**< size of the slots held off-heap, or 0 if the object is allocated entirely in the heap */
 
 	/*
 	 * Member functions
 	 */
 private:
+	/**
+	 * Objects of at least virtualLargeObjectHeapThreshold bytes keep their slots in largeObjectVirtualMemory
+	 * when it is enabled and has room for them. They fall back to the heap otherwise. The sparse region is
+	 * reserved before the proxy is allocated so that the decision to allocate a proxy cannot be undone by
+	 * another thread taking the sparse space first.
+	 */
+	MMINLINE static void *
+	reserveOffHeapData(MM_EnvironmentBase *env, uintptr_t requiredSizeInBytes)
+	{
+		MM_GCExtensionsBase *extensions = env->getExtensions();
+		void *offHeapData = NULL;
+		if (extensions->isVirtualLargeObjectHeapEnabled && (requiredSizeInBytes >= extensions->virtualLargeObjectHeapThreshold)) {
+			offHeapData = extensions->largeObjectVirtualMemory->reserveSparseFreeEntry(requiredSizeInBytes - sizeof(ObjectHeader));
+		}
+		return offHeapData;
+	}
+
 protected:
 public:
 	/**
@@ -61,7 +83,24 @@ public:
 		omrobjectptr_t objectPtr = (omrobjectptr_t)allocatedBytes;
 
 		if (NULL != objectPtr) {
-			objectPtr->header.sizeInBytes((ObjectSize)getAllocateDescription()->getBytesRequested());
+			if (0 != _offHeapSizeInBytes) {
+				MM_SparseVirtualMemory *largeObjectVirtualMemory = env->getExtensions()->largeObjectVirtualMemory;
+				objectPtr->header.assign(Object::offHeapProxySize(), objectPtr->header.flags() | Object::OFF_HEAP);
+				OffHeapData *offHeapData = objectPtr->offHeapData();
+				if (largeObjectVirtualMemory->mapReservedSparseFreeEntryToHeapObject(_offHeapData, objectPtr, _offHeapSizeInBytes)) {
+					offHeapData->slots = (Slot *)_offHeapData;
+					offHeapData->sizeInBytes = _offHeapSizeInBytes;
+				} else {
+					/* leave an empty proxy behind as floating garbage */
+					largeObjectVirtualMemory->releaseReservedSparseFreeEntry(env, _offHeapData, _offHeapSizeInBytes);
+					offHeapData->slots = NULL;
+					offHeapData->sizeInBytes = 0;
+					objectPtr = NULL;
+				}
+				_offHeapData = NULL;
+			} else {
+				objectPtr->header.sizeInBytes((ObjectSize)getAllocateDescription()->getBytesRequested());
+			}
 		}
 
 		return objectPtr;
@@ -71,7 +110,26 @@ public:
 	 * Constructor.
 	 */
 	MM_ObjectAllocationModel(MM_EnvironmentBase *env,  uintptr_t requiredSizeInBytes, uintptr_t allocateObjectFlags = 0)
-		: MM_AllocateInitialization(env, allocation_category_example, requiredSizeInBytes, allocateObjectFlags)
+		: MM_ObjectAllocationModel(env, requiredSizeInBytes, allocateObjectFlags, reserveOffHeapData(env, requiredSizeInBytes))
+	{}
+
+	/**
+	 * Destructor. Releases the sparse region if the proxy could not be allocated in the heap.
+	 */
+	~MM_ObjectAllocationModel()
+	{
+		if (NULL != _offHeapData) {
+			_env->getExtensions()->largeObjectVirtualMemory->releaseReservedSparseFreeEntry(_env, _offHeapData, _offHeapSizeInBytes);
+			_offHeapData = NULL;
+		}
+	}
+
+private:
+	MM_ObjectAllocationModel(MM_EnvironmentBase *env,  uintptr_t requiredSizeInBytes, uintptr_t allocateObjectFlags, void *offHeapData)
+		: MM_AllocateInitialization(env, allocation_category_example, (NULL != offHeapData) ? Object::offHeapProxySize() : requiredSizeInBytes, allocateObjectFlags)
+		, _env(env)
+		, _offHeapData(offHeapData)
+		, _offHeapSizeInBytes((NULL != offHeapData) ? (requiredSizeInBytes - sizeof(ObjectHeader)) : 0)
 	{}
 };
 #endif /* OBJECTALLOCATIONMODEL_HPP_ */
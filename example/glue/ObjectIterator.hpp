@@ -48,12 +48,18 @@ private:
 	MMINLINE void
 	initialize(OMR_VM *omrVM, omrobjectptr_t objectPtr)
 	{
-		/* Start _scanPtr after header */
-		_scanPtr = (fomrobject_t *)objectPtr + 1;
+		if (objectPtr->isOffHeap()) {
+			/* Slots are held in sparse virtual memory, the proxy only records where */
+			_scanPtr = objectPtr->begin();
+			_endPtr = objectPtr->end();
+		} else {
+			/* Start _scanPtr after header */
+			_scanPtr = (fomrobject_t *)objectPtr + 1;
 
-		MM_GCExtensionsBase *extensions = (MM_GCExtensionsBase *)omrVM->_gcOmrVMExtensions;
-		uintptr_t size = extensions->objectModel.getConsumedSizeInBytesWithHeader(objectPtr);
-		_endPtr = (fomrobject_t *)((U_8*)objectPtr + size);
+			MM_GCExtensionsBase *extensions = (MM_GCExtensionsBase *)omrVM->_gcOmrVMExtensions;
+			uintptr_t size = extensions->objectModel.getConsumedSizeInBytesWithHeader(objectPtr);
+			_endPtr = (fomrobject_t *)((U_8*)objectPtr + size);
+		}
 	}
 
 protected:
@@ -19,6 +19,8 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
  *******************************************************************************/
 
+#include <string.h>
+
 #include "EnvironmentBase.hpp"
 #include "AllocateInitialization.hpp"
 #include "GCExtensionsBase.hpp"
@@ -38,6 +40,14 @@ GC_ObjectModelDelegate::initializeAllocation(MM_EnvironmentBase *env, void *allo
 	return objectPtr;
 }
 
+void
+GC_ObjectModelDelegate::initializeMinimumSizeObject(MM_EnvironmentBase *env, void *allocAddr)
+{
+	omrobjectptr_t objectPtr = (omrobjectptr_t)allocAddr;
+	objectPtr->header.assign(OMR_MINIMUM_OBJECT_SIZE, 0);
+	memset(objectPtr->slots(), 0, objectPtr->sizeOfSlotsInBytes());
+}
+
 #if defined(OMR_GC_MODRON_SCAVENGER)
 void
 GC_ObjectModelDelegate::calculateObjectDetailsForCopy(MM_EnvironmentBase *env, MM_ForwardedHeader *forwardedHeader, uintptr_t *objectCopySizeInBytes, uintptr_t *reservedObjectSizeInBytes, uintptr_t *hotFieldAlignmentDescriptor)
@@ -223,6 +223,25 @@ public:
 	}
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC) */
 
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	/**
+	 * Returns a key identifying the shape of an object, used by the scavenger to learn hot fields
+	 * (scavengerHotFieldLearning enabled). Objects with the same key must have their reference slots
+	 * at the same offsets, typically the key is the address of the object's class.
+	 *
+	 * Example objects consist of a header followed by reference slots only, so the object size
+	 * identifies the shape. Off-heap objects are not learned, their slots are not in the heap object.
+	 *
+	 * @param objectPtr pointer to the object
+	 * @return the shape key of the object, or 0 if hot fields should not be learned for the object
+	 */
+	MMINLINE uintptr_t
+	getObjectShapeKey(omrobjectptr_t objectPtr)
+	{
+		return objectPtr->isOffHeap() ? 0 : getObjectSizeInBytesWithHeader(objectPtr);
+	}
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+
 	/**
 	 * The following methods (defined(OMR_GC_MODRON_SCAVENGER)) are required if generational GC is
  	 * configured for the build (--enable-OMR_GC_MODRON_SCAVENGER in configure_includes/configure_*.mk).
@@ -285,8 +304,14 @@ public:
 	void calculateObjectDetailsForCopy(MM_EnvironmentBase *env, MM_ForwardedHeader *forwardedHeader, uintptr_t *objectCopySizeInBytes, uintptr_t *objectReserveSizeInBytes, uintptr_t *hotFieldAlignmentDescriptor);
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
 
-	MMINLINE void
-	initializeMinimumSizeObject(MM_EnvironmentBase *env, void *allocAddr) {}
+	/**
+	 * Seal the unused tail of a thread local heap with a minimum sized object, so that the SATB barrier
+	 * can premark the allocated range up to a known object boundary.
+	 *
+	 * @param[in] env points to the environment for the calling thread
+	 * @param[in] allocAddr address of the OMR_MINIMUM_OBJECT_SIZE bytes to initialize
+	 */
+	void initializeMinimumSizeObject(MM_EnvironmentBase *env, void *allocAddr);
 
 	/**
 	 * Constructor receives a copy of OMR's object flags mask, normalized to low order byte.
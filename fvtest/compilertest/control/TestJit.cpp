@@ -29,9 +29,11 @@
 #include "env/IO.hpp"
 #include "compile/ResolvedMethod.hpp"
 #include "env/RawAllocator.hpp"
+#include "env/SharedSegmentPool.hpp"
 #include "ilgen/IlGeneratorMethodDetails_inlines.hpp"
 #include "ilgen/MethodBuilder.hpp"
 #include "runtime/CodeCache.hpp"
+#include "runtime/PersistentCodeCache.hpp"
 #include "runtime/Runtime.hpp"
 #include "runtime/TestJitConfig.hpp"
 
@@ -84,13 +86,14 @@ initializeCodeCache(TR::CodeCacheManager & codeCacheManager)
    codeCacheConfig._trampolineSpacePercentage = 5;
    codeCacheConfig._allowedToGrowCache = true;
    codeCacheConfig._lowCodeCacheThreshold = 0;
-   codeCacheConfig._verboseCodeCache = false;
+   codeCacheConfig._verboseCodeCache = TR::Options::getVerboseOption(TR_VerboseCodeCache);
    codeCacheConfig._verbosePerformance = false;
    codeCacheConfig._verboseReclamation = false;
    codeCacheConfig._doSanityChecks = false;
    codeCacheConfig._codeCacheTotalKB = 16*1024;
    codeCacheConfig._codeCacheKB = 128;
    codeCacheConfig._codeCachePadKB = 0;
+   codeCacheConfig._hotCodeCacheKB = TR::Options::getCmdLineOptions()->getHotCodeCacheKB();
    codeCacheConfig._codeCacheAlignment = 32;
    codeCacheConfig._codeCacheFreeBlockRecylingEnabled = true;
    codeCacheConfig._largeCodePageSize = 0;
@@ -197,6 +200,9 @@ shutdownJit()
    {
    auto fe = TestCompiler::FrontEnd::instance();
 
+   TR::PersistentCodeCache::destroy();
+   TR::SharedSegmentPool::destroy();
+
    TR::CodeCacheManager &codeCacheManager = fe->codeCacheManager();
    codeCacheManager.destroy();
 
@@ -0,0 +1,141 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include <gtest/gtest.h>
+
+#include "Jit.hpp"
+#include "env/SharedSegmentPool.hpp"
+
+/**
+ * Runs each test against a pool of its own, created on the test thread after
+ * the one set up by the JIT has been destroyed.
+ */
+class SharedSegmentPoolTest : public ::testing::Test
+   {
+   public:
+
+   static void SetUpTestCase()
+      {
+      ASSERT_TRUE(initializeJit()) << "Failed to initialize the JIT.";
+      }
+
+   static void TearDownTestCase()
+      {
+      shutdownJit();
+      }
+
+   virtual void SetUp()
+      {
+      TR::SharedSegmentPool::destroy();
+      _pool = TR::SharedSegmentPool::create(SEGMENT_SIZE, TR::RawAllocator());
+      ASSERT_TRUE(NULL != _pool);
+      }
+
+   virtual void TearDown()
+      {
+      TR::SharedSegmentPool::destroy();
+      }
+
+   void endCompilations(uint32_t count)
+      {
+      for (uint32_t i = 0; i < count; i++)
+         _pool->compilationEnded();
+      }
+
+   static const size_t SEGMENT_SIZE = 1 << 16;
+
+   TR::SharedSegmentPool *_pool;
+   };
+
+TEST_F(SharedSegmentPoolTest, FreedSegmentIsReused)
+   {
+   void *first = _pool->allocate(SEGMENT_SIZE);
+   ASSERT_TRUE(NULL != first);
+   _pool->deallocate(first, SEGMENT_SIZE);
+
+   void *second = _pool->allocate(SEGMENT_SIZE);
+   EXPECT_EQ(first, second) << "A freed segment should be handed out again";
+   EXPECT_EQ(1u, _pool->mappedSegments());
+
+   void *large = _pool->allocate(2 * SEGMENT_SIZE);
+   ASSERT_TRUE(NULL != large);
+   EXPECT_EQ(1u, _pool->mappedSegments()) << "Larger requests should bypass the pool";
+   _pool->deallocate(large, 2 * SEGMENT_SIZE);
+   _pool->deallocate(second, SEGMENT_SIZE);
+   }
+
+TEST_F(SharedSegmentPoolTest, SegmentsOfDestroyedPoolAreNotReused)
+   {
+   void *segment = _pool->allocate(SEGMENT_SIZE);
+   ASSERT_TRUE(NULL != segment);
+   _pool->deallocate(segment, SEGMENT_SIZE);
+
+   // The thread's cache is freed along with the pool; the new pool must not
+   // find it
+   TR::SharedSegmentPool::destroy();
+   _pool = TR::SharedSegmentPool::create(SEGMENT_SIZE, TR::RawAllocator());
+   ASSERT_TRUE(NULL != _pool);
+
+   segment = _pool->allocate(SEGMENT_SIZE);
+   ASSERT_TRUE(NULL != segment);
+   EXPECT_EQ(1u, _pool->mappedSegments());
+   _pool->deallocate(segment, SEGMENT_SIZE);
+   }
+
+TEST_F(SharedSegmentPoolTest, IdleSegmentsAreReleasedThenUnmapped)
+   {
+   const size_t count = 40;
+   void *segments[count];
+
+   for (size_t i = 0; i < count; i++)
+      {
+      segments[i] = _pool->allocate(SEGMENT_SIZE);
+      ASSERT_TRUE(NULL != segments[i]);
+      }
+   for (size_t i = 0; i < count; i++)
+      _pool->deallocate(segments[i], SEGMENT_SIZE);
+   ASSERT_EQ(count, _pool->mappedSegments());
+   ASSERT_LT(0u, _pool->freeSegments()) << "The thread cache should have spilled into the pool";
+
+   // Every free segment may be asked for again, so all of them are kept
+   endCompilations(TR::SharedSegmentPool::TRIM_INTERVAL);
+   EXPECT_EQ(count, _pool->mappedSegments());
+   EXPECT_EQ(0u, _pool->releasedFreeSegments());
+   EXPECT_EQ(0u, _pool->unmappedSegments());
+
+   // A smaller demand keeps the segments mapped but gives back the pages of
+   // those beyond it
+   for (size_t i = 0; i < 30; i++)
+      segments[i] = _pool->allocate(SEGMENT_SIZE);
+   for (size_t i = 0; i < 30; i++)
+      _pool->deallocate(segments[i], SEGMENT_SIZE);
+   endCompilations(TR::SharedSegmentPool::TRIM_INTERVAL);
+   EXPECT_EQ(count, _pool->mappedSegments());
+   EXPECT_LT(0u, _pool->releasedFreeSegments());
+   EXPECT_EQ(0u, _pool->unmappedSegments());
+
+   // Without any demand, every free segment of the pool is unmapped
+   endCompilations(TR::SharedSegmentPool::TRIM_INTERVAL);
+   EXPECT_EQ(0u, _pool->freeSegments());
+   EXPECT_LT(0u, _pool->unmappedSegments());
+   EXPECT_EQ(count, _pool->mappedSegments() + _pool->unmappedSegments());
+   }
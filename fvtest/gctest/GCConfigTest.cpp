@@ -19,15 +19,25 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
  *******************************************************************************/
 
+#include "AtomicOperations.hpp"
 #include "CollectorLanguageInterface.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCConfigTest.hpp"
+#include "MarkMap.hpp"
 #include "ObjectAllocationModel.hpp"
 #include "ObjectModel.hpp"
 #include "omrExampleVM.hpp"
 #include "omrgc.h"
+#include "omrgcallocationsampling.h"
+#include "omrgcheapwalk.h"
+#include "ParallelDispatcher.hpp"
+#if defined(OMR_GC_MODRON_STANDARD)
+#include "ParallelGlobalGC.hpp"
+#include "ParallelHeapWalker.hpp"
+#endif /* defined(OMR_GC_MODRON_STANDARD) */
 #include "SlotObject.hpp"
 #include "StandardWriteBarrier.hpp"
+#include "VerboseBinaryReader.hpp"
 #include "VerboseWriterChain.hpp"
 
 //#define OMRGCTEST_PRINTFILE
@@ -43,21 +53,62 @@
 const char *gcTests[] = {"fvtest/gctest/configuration/sample_GC_config.xml"
                         , "fvtest/gctest/configuration/test_system_gc.xml"
                         , "fvtest/gctest/configuration/global_GC_config.xml"
+                        , "fvtest/gctest/configuration/global_lockfree_GC_config.xml"
+                        , "fvtest/gctest/configuration/packetlist_locked_1thread_GC_config.xml"
+                        , "fvtest/gctest/configuration/packetlist_lockfree_1thread_GC_config.xml"
+                        , "fvtest/gctest/configuration/packetlist_locked_4threads_GC_config.xml"
+                        , "fvtest/gctest/configuration/packetlist_lockfree_4threads_GC_config.xml"
+                        , "fvtest/gctest/configuration/packetlist_locked_16threads_GC_config.xml"
+                        , "fvtest/gctest/configuration/packetlist_lockfree_16threads_GC_config.xml"
+                        , "fvtest/gctest/configuration/global_scalar_heapmapscan_GC_config.xml"
+                        , "fvtest/gctest/configuration/global_linear_freelist_GC_config.xml"
+                        , "fvtest/gctest/configuration/global_sizeclass_freelist_GC_config.xml"
+                        , "fvtest/gctest/configuration/global_hugepage_GC_config.xml"
+                        , "fvtest/gctest/configuration/global_adaptive_tlh_GC_config.xml"
+                        , "fvtest/gctest/configuration/global_binary_verbose_GC_config.xml"
+                        , "fvtest/gctest/configuration/global_adaptive_threads_GC_config.xml"
+                        , "fvtest/gctest/configuration/global_parallel_heapwalk_GC_config.xml"
+                        , "fvtest/gctest/configuration/global_allocation_sampling_GC_config.xml"
+#if defined(OMR_GC_MODRON_COMPACTION)
+                        , "fvtest/gctest/configuration/global_incremental_compact_GC_config.xml"
+#endif
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
                         , "fvtest/gctest/configuration/optavgpause_GC_config.xml"
+                        , "fvtest/gctest/configuration/optavgpause_card_cleaning_GC_config.xml"
+#endif
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK) && defined(OMR_GC_REALTIME)
+                        , "fvtest/gctest/configuration/optavgpause_satb_GC_config.xml"
+#endif
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK) && defined(OMR_GC_CONCURRENT_SWEEP)
+                        , "fvtest/gctest/configuration/optavgpause_concurrent_sweep_lazy_GC_config.xml"
 #endif
 #if defined(OMR_GC_MODRON_SCAVENGER)
                         , "fvtest/gctest/configuration/scavenger_GC_config.xml"
                         , "fvtest/gctest/configuration/scavenger_GC_backout_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_prefetch_GC_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_remembered_set_GC_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_numa_GC_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_hotfield_GC_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_resize_predictor_GC_config.xml"
+                        , "fvtest/gctest/configuration/gencon_offheap_GC_config.xml"
+#endif
+#if defined(OMR_GC_MODRON_SCAVENGER) && defined(OMR_GC_MODRON_COMPACTION)
+                        , "fvtest/gctest/configuration/gencon_offheap_compact_GC_config.xml"
 #endif
 #if defined(OMR_GC_MODRON_SCAVENGER) && defined(OMR_GC_MODRON_CONCURRENT_MARK)
                         , "fvtest/gctest/configuration/gencon_GC_config.xml"
                         , "fvtest/gctest/configuration/gencon_GC_backout_config.xml"
+#endif
+#if defined(OMR_GC_SEGREGATED_HEAP)
+                        , "fvtest/gctest/configuration/segregated_GC_config.xml"
+                        , "fvtest/gctest/configuration/segregated_nursery_GC_config.xml"
 #endif
                         };
 
 const char *perfTests[] = {"perftest/gctest/configuration/21645_core.20150126.202455.11862202.0001.xml",
-								"perftest/gctest/configuration/24404_core.20140723.091737.5812.0002.xml"};
+								"perftest/gctest/configuration/24404_core.20140723.091737.5812.0002.xml",
+								"perftest/gctest/configuration/sweep_scalar_1GB.xml",
+								"perftest/gctest/configuration/sweep_vector_1GB.xml"};
 void
 GCConfigTest::SetUp()
 {
@@ -108,7 +159,7 @@ GCConfigTest::SetUp()
 	if (NULL == verboseFile) {
 		FAIL() << "Failed to allocate native memory.";
 	}
-	omrstr_printf(verboseFile, MAX_NAME_LENGTH, "%s_%d_%lld.xml", verboseFileNamePrefix, omrsysinfo_get_pid(), omrtime_current_time_millis());
+	omrstr_printf(verboseFile, MAX_NAME_LENGTH, "%s_%d_%lld.%s", verboseFileNamePrefix, omrsysinfo_get_pid(), omrtime_current_time_millis(), env->getExtensions()->binaryLogging ? "vgc" : "xml");
 	verboseManager = MM_VerboseManager::newInstance(env, exampleVM->_omrVM);
 	verboseManager->configureVerboseGC(exampleVM->_omrVM, verboseFile, numOfFiles, numOfCycles);
 	gcTestEnv->log("Verbose File: %s\n", verboseFile);
@@ -145,6 +196,9 @@ GCConfigTest::TearDown()
 		exampleVM->objectTable = NULL;
 	}
 
+	/* a failed test may have left allocation sampling started */
+	OMR_GC_StopAllocationSampling(exampleVM->_omrVMThread);
+
 	/* close verboseManager and clean up verbose files */
 	if (NULL != verboseManager) {
 		verboseManager->closeStreams(env);
@@ -200,6 +254,9 @@ GCConfigTest::TearDown()
 
 	exampleVM->_omrVMThread = NULL;
 
+	/* a configuration may have set the CPU count seen by the GC */
+	omrsysinfo_set_number_user_specified_CPUs(0);
+
 	printMemUsed("TearDown()", gcTestEnv->portLib);
 }
 
@@ -310,18 +367,24 @@ GCConfigTest::allocateHelper(const char *objName, uintptr_t size)
 	MM_ObjectAllocationModel *noGc = new(objectAllocationModelSpace)
 			MM_ObjectAllocationModel(env, size, MM_ObjectAllocationModel::selectObjectAllocationFlags(false, false, false, true));
 	objEntry.objPtr = OMR_GC_AllocateObject(exampleVM->_omrVMThread, noGc);
+	noGc->~MM_ObjectAllocationModel();
 
 	if (NULL == objEntry.objPtr) {
 		gcTestEnv->log("No free memory to allocate %s of size 0x%llx, GC start.\n", objName, size);
 		MM_ObjectAllocationModel *withGc = new(objectAllocationModelSpace)
 				MM_ObjectAllocationModel(env, size, MM_ObjectAllocationModel::selectObjectAllocationFlags(false, false, false, false));
 		objEntry.objPtr = OMR_GC_AllocateObject(exampleVM->_omrVMThread, withGc);
+		withGc->~MM_ObjectAllocationModel();
 	}
 
 	ObjectEntry *newEntry = NULL;
 	if (NULL != objEntry.objPtr) {
 		uintptr_t consumedSize = env->getExtensions()->objectModel.getConsumedSizeInBytesWithHeader(objEntry.objPtr);
 		uintptr_t adjustedSize = env->getExtensions()->objectModel.adjustSizeInBytes(size);
+		if (objEntry.objPtr->isOffHeap()) {
+			/* only the proxy is consumed in the heap, the slots are held off-heap */
+			consumedSize = env->getExtensions()->objectModel.adjustSizeInBytes(sizeof(ObjectHeader) + objEntry.objPtr->sizeOfSlotsInBytes());
+		}
 		if (consumedSize == adjustedSize) {
 			gcTestEnv->log(LEVEL_VERBOSE, "Allocate object name: %s(%p[0x%llx])\n", objEntry.name, objEntry.objPtr, consumedSize);
 		} else {
@@ -613,6 +676,10 @@ GCConfigTest::attachChildEntry(ObjectEntry *parentEntry, ObjectEntry *childEntry
 	uintptr_t size = extensions->objectModel.getConsumedSizeInBytesWithHeader(parentEntry->objPtr);
 	fomrobject_t *firstSlot = (fomrobject_t *)parentEntry->objPtr + 1;
 	fomrobject_t *endSlot = (fomrobject_t *)((uint8_t *)parentEntry->objPtr + size);
+	if (parentEntry->objPtr->isOffHeap()) {
+		firstSlot = parentEntry->objPtr->begin();
+		endSlot = parentEntry->objPtr->end();
+	}
 	uintptr_t slotCount = endSlot - firstSlot;
 
 	if ((uint32_t)parentEntry->numOfRef < slotCount) {
@@ -678,6 +745,10 @@ GCConfigTest::removeObjectFromParentSlot(const char *name, ObjectEntry *parentEn
 	uintptr_t size = extensions->objectModel.getConsumedSizeInBytesWithHeader(parentEntry->objPtr);
 	fomrobject_t *currentSlot = (fomrobject_t *)parentEntry->objPtr + 1;
 	fomrobject_t *endSlot = (fomrobject_t *)((uint8_t *)parentEntry->objPtr + size);
+	if (parentEntry->objPtr->isOffHeap()) {
+		currentSlot = parentEntry->objPtr->begin();
+		endSlot = parentEntry->objPtr->end();
+	}
 
 	int32_t rt = 1;
 	ObjectEntry *objEntry = find(name);
@@ -690,7 +761,7 @@ GCConfigTest::removeObjectFromParentSlot(const char *name, ObjectEntry *parentEn
 		GC_SlotObject slotObject(exampleVM->_omrVM, currentSlot);
 		if (objEntry->objPtr == slotObject.readReferenceFromSlot()) {
 			gcTestEnv->log(LEVEL_VERBOSE, "Remove object %s(%p[0x%llx]) from parent %s(%p[0x%llx]) slot %p.\n", name, objEntry->objPtr, objEntry->objPtr->header.raw(), parentEntry->name, parentEntry->objPtr, parentEntry->objPtr->header.raw(), slotObject.readAddressFromSlot());
-			slotObject.writeReferenceToSlot(NULL);
+			standardWriteBarrierStore(exampleVM->_omrVMThread, parentEntry->objPtr, currentSlot, NULL);
 			rt = 0;
 			break;
 		}
@@ -809,6 +880,32 @@ printFile(const char *name)
 }
 #endif
 
+pugi::xml_parse_result
+GCConfigTest::loadVerboseFile(pugi::xml_document *verboseDoc, const char *fileName)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+
+	if (!env->getExtensions()->binaryLogging) {
+		return verboseDoc->load_file(fileName);
+	}
+
+	/* binary logs are verified through their XML conversion */
+	pugi::xml_parse_result result;
+	char xmlFile[MAX_NAME_LENGTH];
+	const char *error = NULL;
+	omrstr_printf(xmlFile, MAX_NAME_LENGTH, "%s.xml", fileName);
+	if (MM_VerboseBinaryReader::convertToXML(fileName, xmlFile, &error)) {
+		result = verboseDoc->load_file(xmlFile);
+	} else {
+		gcTestEnv->log(LEVEL_VERBOSE, "Failed to convert binary verbose log %s: %s\n", fileName, error);
+		result.status = pugi::status_file_not_found;
+	}
+	if (false == gcTestEnv->keepLog) {
+		omrfile_unlink(xmlFile);
+	}
+	return result;
+}
+
 int32_t
 GCConfigTest::verifyVerboseGC(pugi::xpath_node_set verboseGCs)
 {
@@ -830,7 +927,7 @@ GCConfigTest::verifyVerboseGC(pugi::xpath_node_set verboseGCs)
 	do {
 		pugi::xml_document verboseDoc;
 		if (0 == numOfFiles) {
-			verboseDoc.load_file(verboseFile);
+			loadVerboseFile(&verboseDoc, verboseFile);
 			gcTestEnv->log("Parsing verbose log %s:\n", verboseFile);
 #if defined(OMRGCTEST_PRINTFILE)
 			printFile(verboseFile);
@@ -838,7 +935,7 @@ GCConfigTest::verifyVerboseGC(pugi::xpath_node_set verboseGCs)
 		} else {
 			char currentVerboseFile[MAX_NAME_LENGTH];
 			omrstr_printf(currentVerboseFile, MAX_NAME_LENGTH, "%s.%03zu", verboseFile, seq++);
-			pugi::xml_parse_result result = verboseDoc.load_file(currentVerboseFile);
+			pugi::xml_parse_result result = loadVerboseFile(&verboseDoc, currentVerboseFile);
 			if (pugi::status_file_not_found == result.status) {
 				break;
 			}
@@ -973,12 +1070,255 @@ GCConfigTest::triggerOperation(pugi::xml_node node)
 			}
 			OMRGCTEST_CHECK_RT(rt);
 			verboseManager->getWriterChain()->endOfCycle(env);
+		} else if (0 == strcmp(node.name(), "heapWalk")) {
+			rt = heapWalk(node);
+			OMRGCTEST_CHECK_RT(rt);
+		} else if (0 == strcmp(node.name(), "allocationSampling")) {
+			rt = allocationSampling(node);
+			OMRGCTEST_CHECK_RT(rt);
+		} else if (0 == strcmp(node.name(), "allocationProfile")) {
+			rt = allocationProfile(node);
+			OMRGCTEST_CHECK_RT(rt);
+		}
+	}
+done:
+	return rt;
+}
+
+typedef struct HeapWalkCensus {
+	uintptr_t objectCount;
+	uintptr_t objectBytes;
+	uintptr_t slotCount;
+	uintptr_t nonNullSlotCount;
+} HeapWalkCensus;
+
+static void
+heapWalkCensusObject(OMR_VMThread *omrVMThread, omrobjectptr_t object, void *workerState)
+{
+	HeapWalkCensus *census = (HeapWalkCensus *)workerState;
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(omrVMThread->_vm);
+	census->objectCount += 1;
+	census->objectBytes += extensions->objectModel.getConsumedSizeInBytesWithHeader(object);
+}
+
+static void
+heapWalkCensusSlot(OMR_VMThread *omrVMThread, omrobjectptr_t object, omrobjectptr_t *slot, void *workerState)
+{
+	HeapWalkCensus *census = (HeapWalkCensus *)workerState;
+	census->slotCount += 1;
+	if (NULL != *slot) {
+		census->nonNullSlotCount += 1;
+	}
+}
+
+static void
+heapWalkCensusMerge(OMR_VMThread *omrVMThread, void *workerState, void *userData)
+{
+	HeapWalkCensus *census = (HeapWalkCensus *)workerState;
+	HeapWalkCensus *total = (HeapWalkCensus *)userData;
+	total->objectCount += census->objectCount;
+	total->objectBytes += census->objectBytes;
+	total->slotCount += census->slotCount;
+	total->nonNullSlotCount += census->nonNullSlotCount;
+}
+
+#if defined(OMR_GC_MODRON_STANDARD)
+static void
+heapWalkCountObject(OMR_VMThread *omrVMThread, MM_HeapRegionDescriptor *region, omrobjectptr_t object, void *userData)
+{
+	MM_AtomicOperations::add((volatile uintptr_t *)userData, 1);
+}
+#endif /* defined(OMR_GC_MODRON_STANDARD) */
+
+int32_t
+GCConfigTest::heapWalk(pugi::xml_node node)
+{
+	int32_t rt = 0;
+	HeapWalkCensus serialCensus = {0, 0, 0, 0};
+	HeapWalkCensus parallelCensus = {0, 0, 0, 0};
+	OMR_GC_HeapWalkParameters parameters = {heapWalkCensusObject, heapWalkCensusSlot, heapWalkCensusMerge, sizeof(HeapWalkCensus), 1, &serialCensus};
+	uintptr_t workersUsed = 0;
+
+	/* A single worker walk is the reference the parallel walk must agree with */
+	rt = (int32_t)OMR_GC_ParallelHeapWalk(exampleVM->_omrVMThread, &parameters, &workersUsed);
+	if (OMR_ERROR_NONE != rt) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to perform OMR_GC_ParallelHeapWalk with error code %d.\n", __FILE__, __LINE__, rt);
+		goto done;
+	}
+
+	parameters.workerCount = (uintptr_t)node.attribute("workerCount").as_int();
+	parameters.userData = &parallelCensus;
+	rt = (int32_t)OMR_GC_ParallelHeapWalk(exampleVM->_omrVMThread, &parameters, &workersUsed);
+	if (OMR_ERROR_NONE != rt) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to perform OMR_GC_ParallelHeapWalk with error code %d.\n", __FILE__, __LINE__, rt);
+		goto done;
+	}
+	gcTestEnv->log("Heap walk with %zu workers found %zu objects (%zu bytes), %zu slots (%zu non-null)\n",
+			workersUsed, parallelCensus.objectCount, parallelCensus.objectBytes, parallelCensus.slotCount, parallelCensus.nonNullSlotCount);
+
+	if ((1 != parameters.workerCount) && (1 < env->getExtensions()->dispatcher->threadCountMaximum()) && (1 >= workersUsed)) {
+		rt = 1;
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Parallel heap walk ran on %zu worker.\n", __FILE__, __LINE__, workersUsed);
+		goto done;
+	}
+
+	if ((0 == parallelCensus.objectCount)
+		|| (serialCensus.objectCount != parallelCensus.objectCount)
+		|| (serialCensus.objectBytes != parallelCensus.objectBytes)
+		|| (serialCensus.slotCount != parallelCensus.slotCount)
+		|| (serialCensus.nonNullSlotCount != parallelCensus.nonNullSlotCount)
+	) {
+		rt = 1;
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Parallel heap walk disagrees with single worker walk (%zu objects, %zu bytes, %zu slots, %zu non-null).\n",
+				__FILE__, __LINE__, serialCensus.objectCount, serialCensus.objectBytes, serialCensus.slotCount, serialCensus.nonNullSlotCount);
+		goto done;
+	}
+
+#if defined(OMR_GC_MODRON_STANDARD)
+	if (!node.attribute("allocateObjects").empty()) {
+		/* Objects allocated after the walk are missing from its mark map, so a parallel walk that does not mark again must still find them */
+		MM_ParallelHeapWalker *heapWalker = (MM_ParallelHeapWalker *)((MM_ParallelGlobalGC *)env->getExtensions()->getGlobalCollector())->getHeapWalker();
+		if (heapWalker->getMarkMap()->isMarkMapValid()) {
+			rt = 1;
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d The mark map of the heap walk is still valid after the walk.\n", __FILE__, __LINE__);
+			goto done;
+		}
+
+		int32_t allocateObjects = node.attribute("allocateObjects").as_int();
+		for (int32_t i = 0; i < allocateObjects; i++) {
+			if (NULL == createObject("HEAPWALK", GARBAGE_ROOT, 0, i, (10 * sizeof(fomrobject_t)) + sizeof(uintptr_t))) {
+				rt = 1;
+				goto done;
+			}
+		}
+
+		volatile uintptr_t serialCount = 0;
+		volatile uintptr_t parallelCount = 0;
+		env->acquireExclusiveVMAccess();
+		heapWalker->allObjectsDo(env, heapWalkCountObject, (void *)&serialCount, 0, false, false);
+		heapWalker->allObjectsDo(env, heapWalkCountObject, (void *)&parallelCount, 0, true, false);
+		env->releaseExclusiveVMAccess();
+		gcTestEnv->log("Heap walk without marking after %d allocations found %zu objects\n", allocateObjects, parallelCount);
+
+		if (serialCount != parallelCount) {
+			rt = 1;
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Parallel heap walk without marking found %zu objects, single threaded walk found %zu.\n", __FILE__, __LINE__, parallelCount, serialCount);
 		}
 	}
+#endif /* defined(OMR_GC_MODRON_STANDARD) */
+
 done:
 	return rt;
 }
 
+/* Frame standing in for the allocating call in the sites reported by allocationSiteWalk() */
+#define ALLOCATION_SITE_TEST_FRAME 0x1000
+
+/**
+ * Report the size of the sampled object as the innermost frame, so objects of each size make up one site.
+ */
+static uintptr_t
+allocationSiteWalk(OMR_VMThread *omrVMThread, omrobjectptr_t object, uintptr_t *frames, uintptr_t maxFrames, void *userData)
+{
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(omrVMThread->_vm);
+	uintptr_t frameCount = 0;
+	if (frameCount < maxFrames) {
+		frames[frameCount++] = extensions->objectModel.getConsumedSizeInBytesWithHeader(object);
+	}
+	if (frameCount < maxFrames) {
+		frames[frameCount++] = ALLOCATION_SITE_TEST_FRAME;
+	}
+	return frameCount;
+}
+
+int32_t
+GCConfigTest::allocationSampling(pugi::xml_node node)
+{
+	OMR_GC_AllocationSamplingParameters parameters = {
+		(uintptr_t)node.attribute("samplingBytes").as_int(),
+		(uintptr_t)node.attribute("siteCount").as_int(),
+		(uintptr_t)node.attribute("maxFrames").as_int(),
+		allocationSiteWalk,
+		NULL
+	};
+
+	int32_t rt = (int32_t)OMR_GC_StartAllocationSampling(exampleVM->_omrVMThread, &parameters);
+	if (OMR_ERROR_NONE != rt) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to perform OMR_GC_StartAllocationSampling with error code %d.\n", __FILE__, __LINE__, rt);
+	}
+	return rt;
+}
+
+int32_t
+GCConfigTest::allocationProfile(pugi::xml_node node)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	char profileFile[MAX_NAME_LENGTH];
+	char line[2048];
+	uintptr_t totalCount = 0;
+	uintptr_t totalBytes = 0;
+	uintptr_t inUseCount = 0;
+	uintptr_t inUseBytes = 0;
+	uintptr_t samplingBytes = 0;
+	uintptr_t siteLines = 0;
+	uintptr_t siteSampleCount = 0;
+	uintptr_t siteCount = (uintptr_t)node.attribute("siteCount").as_int();
+	intptr_t fileDescriptor = -1;
+
+	omrstr_printf(profileFile, MAX_NAME_LENGTH, "%s.heap", verboseFile);
+	int32_t rt = (int32_t)OMR_GC_WriteAllocationProfile(exampleVM->_omrVMThread, profileFile);
+	if (OMR_ERROR_NONE != rt) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to perform OMR_GC_WriteAllocationProfile with error code %d.\n", __FILE__, __LINE__, rt);
+		goto done;
+	}
+
+	/* the profile must parse as a pprof heap_v2 profile with no more sites than the sketch keeps */
+	fileDescriptor = omrfile_open(profileFile, EsOpenRead, 0444);
+	if ((-1 == fileDescriptor)
+		|| (line != omrfile_read_text(fileDescriptor, line, sizeof(line)))
+		|| (5 != sscanf(line, "heap profile: %zu: %zu [%zu: %zu] @ heap_v2/%zu", &inUseCount, &inUseBytes, &totalCount, &totalBytes, &samplingBytes))
+		|| (0 == totalCount)
+		|| ((uintptr_t)node.attribute("samplingBytes").as_int() != samplingBytes)
+	) {
+		rt = 1;
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Allocation profile %s has no valid header.\n", __FILE__, __LINE__, profileFile);
+		goto done;
+	}
+	while (line == omrfile_read_text(fileDescriptor, line, sizeof(line))) {
+		uintptr_t count = 0;
+		uintptr_t bytes = 0;
+		if ((4 != sscanf(line, "%zu: %zu [%zu: %zu] @", &inUseCount, &inUseBytes, &count, &bytes)) || (0 == count) || (bytes < count)) {
+			rt = 1;
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Allocation profile %s has an invalid site: %s\n", __FILE__, __LINE__, profileFile, line);
+			goto done;
+		}
+		siteLines += 1;
+		siteSampleCount += count;
+	}
+	gcTestEnv->log("Allocation profile found %zu samples (%zu bytes) in %zu sites\n", totalCount, totalBytes, siteLines);
+
+	if ((0 == siteLines) || (siteLines > siteCount) || (siteSampleCount > totalCount)) {
+		rt = 1;
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Allocation profile %s reports %zu sites with %zu samples for at most %zu sites and %zu samples.\n",
+				__FILE__, __LINE__, profileFile, siteLines, siteSampleCount, siteCount, totalCount);
+		goto done;
+	}
+
+	rt = (int32_t)OMR_GC_StopAllocationSampling(exampleVM->_omrVMThread);
+	if (OMR_ERROR_NONE != rt) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to perform OMR_GC_StopAllocationSampling with error code %d.\n", __FILE__, __LINE__, rt);
+	}
+
+done:
+	if (-1 != fileDescriptor) {
+		omrfile_close(fileDescriptor);
+	}
+	if (!gcTestEnv->keepLog) {
+		omrfile_unlink(profileFile);
+	}
+	return rt;
+}
+
 int32_t
 GCConfigTest::iniXMLStr(const char *configStyle)
 {
@@ -0,0 +1,86 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include "HeapMapScan.hpp"
+#include "gcTestHelpers.hpp"
+
+#include <gtest/gtest.h>
+#include <string.h>
+
+#define SLOT_COUNT 160
+
+/**
+ * Fill the slots with a pseudo random pattern in which roughly one slot in density is non-zero.
+ */
+static void
+fillSlots(uintptr_t *slots, uintptr_t density, uint32_t *seed)
+{
+	for (uintptr_t i = 0; i < SLOT_COUNT; i++) {
+		*seed = (*seed * 1103515245) + 12345;
+		uintptr_t bits = ((uintptr_t)*seed << 16) ^ (uintptr_t)(*seed >> 16);
+		slots[i] = (0 == ((*seed >> 8) % density)) ? (bits | 1) : 0;
+	}
+}
+
+/**
+ * Compare every implementation the processor supports with the scalar one, over runs of every length and
+ * alignment in a range of slot patterns.
+ */
+TEST(HeapMapScanTest, VectorScansMatchScalar)
+{
+	MM_HeapMapScan::Implementation widest = MM_HeapMapScan::selectImplementation(gcTestEnv->getPortLibrary());
+	uintptr_t slots[SLOT_COUNT];
+	uint32_t seed = 1;
+	const uintptr_t densities[] = {1, 3, 17, 64, SLOT_COUNT * 4};
+
+	for (uintptr_t d = 0; d < sizeof(densities) / sizeof(densities[0]); d++) {
+		fillSlots(slots, densities[d], &seed);
+		for (uintptr_t base = 0; base < 9; base++) {
+			for (uintptr_t top = base; top <= SLOT_COUNT; top++) {
+				uintptr_t *expectedSlot = MM_HeapMapScan::findNonEmptySlot(MM_HeapMapScan::SCALAR, slots + base, slots + top);
+				uintptr_t expectedCount = MM_HeapMapScan::countSetBits(MM_HeapMapScan::SCALAR, slots + base, slots + top);
+				for (int i = MM_HeapMapScan::SCALAR + 1; i <= widest; i++) {
+					MM_HeapMapScan::Implementation implementation = (MM_HeapMapScan::Implementation)i;
+					ASSERT_EQ(expectedSlot, MM_HeapMapScan::findNonEmptySlot(implementation, slots + base, slots + top))
+						<< MM_HeapMapScan::getImplementationName(implementation) << " slots [" << base << ", " << top << ") density " << densities[d];
+					ASSERT_EQ(expectedCount, MM_HeapMapScan::countSetBits(implementation, slots + base, slots + top))
+						<< MM_HeapMapScan::getImplementationName(implementation) << " slots [" << base << ", " << top << ") density " << densities[d];
+				}
+			}
+		}
+	}
+
+	/* a single bit in each position of each slot */
+	for (uintptr_t slot = 0; slot < SLOT_COUNT; slot++) {
+		for (uintptr_t bit = 0; bit < (sizeof(uintptr_t) * 8); bit++) {
+			memset(slots, 0, sizeof(slots));
+			slots[slot] = (uintptr_t)1 << bit;
+			for (int i = MM_HeapMapScan::SCALAR + 1; i <= widest; i++) {
+				MM_HeapMapScan::Implementation implementation = (MM_HeapMapScan::Implementation)i;
+				ASSERT_EQ(slots + slot, MM_HeapMapScan::findNonEmptySlot(implementation, slots, slots + SLOT_COUNT))
+					<< MM_HeapMapScan::getImplementationName(implementation) << " slot " << slot << " bit " << bit;
+				ASSERT_EQ((uintptr_t)1, MM_HeapMapScan::countSetBits(implementation, slots, slots + SLOT_COUNT))
+					<< MM_HeapMapScan::getImplementationName(implementation) << " slot " << slot << " bit " << bit;
+			}
+		}
+	}
+}
@@ -83,7 +83,80 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 				} else if (0 == strcmp(attr.name(), "maxSizeDefaultMemorySpace")) {
 					extensions->maxSizeDefaultMemorySpace = atoi(attr.value()) * unitSize;
 				} else if (0 == strcmp(attr.name(), "gcthreadCount")) {
-					/* TODO: support multi-thread GC*/
+					extensions->gcThreadCount = atoi(attr.value());
+					extensions->gcThreadCountForced = true;
+				} else if (0 == strcmp(attr.name(), "gcmaxthreadCount")) {
+					extensions->gcThreadCount = atoi(attr.value());
+					extensions->gcThreadCountSpecified = true;
+				} else if (0 == strcmp(attr.name(), "activeCPUCount")) {
+					/* the GC sizes its thread pool and each dispatch from the target CPU count */
+					OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+					omrsysinfo_set_number_user_specified_CPUs(atoi(attr.value()));
+				} else if (0 == strcmp(attr.name(), "dispatcherAdaptiveThreading")) {
+					extensions->dispatcherAdaptiveThreading = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "dispatcherAdaptiveThreadingTargetUtilization")) {
+					extensions->dispatcherAdaptiveThreadingTargetUtilization = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "packetListLockFree")) {
+					extensions->packetListLockFree = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "heapMapVectorScan")) {
+					extensions->heapMapVectorScan = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "freeListSizeClassIndex")) {
+					extensions->freeListSizeClassIndex = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "heapTransparentHugePages")) {
+					extensions->heapTransparentHugePages = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "heapHugePageCollapse")) {
+					extensions->heapHugePageCollapse = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "gcCountBetweenHugePageCollapse")) {
+					extensions->gcCountBetweenHugePageCollapse = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "gcCountBetweenHugePageCoverageSample")) {
+					extensions->gcCountBetweenHugePageCoverageSample = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "virtualLargeObjectHeap")) {
+					extensions->isVirtualLargeObjectHeapRequested = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "virtualLargeObjectHeapThreshold")) {
+					extensions->virtualLargeObjectHeapThreshold = atoi(attr.value()) * unitSize;
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+				} else if (0 == strcmp(attr.name(), "finalCardCleaningBatchSize")) {
+					extensions->finalCardCleaningBatchSize = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "optimizeConcurrentWB")) {
+					extensions->optimizeConcurrentWB = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "concurrentSlack")) {
+					extensions->concurrentSlack = atoi(attr.value()) * unitSize;
+#if defined(OMR_GC_REALTIME)
+				} else if (0 == strcmp(attr.name(), "snapshotAtTheBeginningBarrier")) {
+					extensions->configurationOptions._forceOptionWriteBarrierSATB = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "sATBBarrierPacketBatch")) {
+					extensions->sATBBarrierPacketBatch = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "sATBConcurrentDrain")) {
+					extensions->sATBConcurrentDrain = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "sATBConcurrentDrainThreshold")) {
+					extensions->sATBConcurrentDrainThreshold = atoi(attr.value());
+#endif /* defined(OMR_GC_REALTIME) */
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+				} else if (0 == strcmp(attr.name(), "concurrentSweep")) {
+					extensions->concurrentSweep = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "concurrentSweepLazy")) {
+					extensions->concurrentSweepLazy = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#endif /* defined(OMR_GC_CONCURRENT_SWEEP) */
+				} else if (0 == strcmp(attr.name(), "tlhAdaptiveSizing")) {
+					extensions->tlhAdaptiveSizing = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "tlhAdaptiveRefreshInterval")) {
+					extensions->tlhAdaptiveRefreshInterval = atoi(attr.value());
+#if defined(OMR_GC_MODRON_COMPACTION)
+				} else if (0 == strcmp(attr.name(), "compactOnGlobalGC")) {
+					extensions->compactOnGlobalGC = (0 == j9_cmdla_stricmp(attr.value(), "true")) ? 1 : 0;
+					extensions->noCompactOnGlobalGC = (0 == extensions->compactOnGlobalGC) ? 1 : 0;
+				} else if (0 == strcmp(attr.name(), "incrementalCompact")) {
+					extensions->incrementalCompact = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "incrementalCompactMaxLiveBytes")) {
+					extensions->incrementalCompactMaxLiveBytes = atoi(attr.value()) * unitSize;
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
+#if defined(OMR_GC_SEGREGATED_HEAP)
+				} else if (0 == strcmp(attr.name(), "segregatedNursery")) {
+					extensions->segregatedNursery = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "segregatedNurserySize")) {
+					extensions->segregatedNurserySize = atoi(attr.value()) * unitSize;
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 				} else if (0 == strcmp(attr.name(), "GCPolicy")) {
 					if (0 == j9_cmdla_stricmp(attr.value(), "gencon")) {
 #if defined(OMR_GC_MODRON_SCAVENGER)
@@ -91,8 +164,14 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 #else
 						gcTestEnv->log(LEVEL_ERROR, "WARNING: GCPolicy=gencon ignored, requires OMR_GC_MODRON_SCAVENGER (see configure_common.mk)\n");
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+					} else if (0 == j9_cmdla_stricmp(attr.value(), "segregated")) {
+#if defined(OMR_GC_SEGREGATED_HEAP)
+						_useSegregatedGC = true;
+#else
+						gcTestEnv->log(LEVEL_ERROR, "WARNING: GCPolicy=segregated ignored, requires OMR_GC_SEGREGATED_HEAP (see configure_common.mk)\n");
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 					} else  if (0 != j9_cmdla_stricmp(attr.value(), "optavgpause")) {
-						gcTestEnv->log(LEVEL_ERROR, "Failed: Unrecognized GC policy (expected gencon or optavgpause): %s\n", attr.value());
+						gcTestEnv->log(LEVEL_ERROR, "Failed: Unrecognized GC policy (expected gencon, segregated or optavgpause): %s\n", attr.value());
 						result = false;
 					}
 				} else if (0 == strcmp(attr.name(), "concurrentMark")) {
@@ -106,7 +185,25 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 					extensions->fvtest_forceScavengerBackout = (0 == j9_cmdla_stricmp(attr.value(), "true"));
 				} else if (0 == strcmp(attr.name(), "forcePoisonEvacuate")) {
 					extensions->fvtest_forcePoisonEvacuate = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "scavengerPrefetchDistance")) {
+					extensions->scavengerPrefetchDistance = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "scavengerRememberedSetScanBatchSize")) {
+					extensions->scavengerRememberedSetScanBatchSize = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "scavengerNUMAAware")) {
+					extensions->scavengerNUMAAware = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "scavengerHotFieldLearning")) {
+					extensions->scavengerHotFieldLearning = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "scavengerHotFieldSamplingRate")) {
+					extensions->scavengerHotFieldSamplingRate = atoi(attr.value());
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+				} else if (0 == strcmp(attr.name(), "heapResizePredictor")) {
+					extensions->heapResizePredictor = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "heapResizePredictorHistory")) {
+					extensions->heapResizePredictorHistory = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "binaryLogging")) {
+					extensions->binaryLogging = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "simulatedNUMANodeCount")) {
+					extensions->_numaManager.setSimulatedNodeCountForFVTest(atoi(attr.value()));
 				} else if ((0 == strcmp(attr.name(), "verboseLog")) || (0 == strcmp(attr.name(), "numOfFiles")) || (0 == strcmp(attr.name(), "numOfCycles")) || (0 == strcmp(attr.name(), "sizeUnit"))) {
 				} else {
 					gcTestEnv->log(LEVEL_ERROR, "Failed: Unrecognized option: %s\n", attr.name());
@@ -0,0 +1,58 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * Converts a binary verbose GC log (-Xgc:binaryLogging) back to the XML verbose GC format.
+ *
+ * usage: omrgcverboseconvert <binary log> [<xml file>]
+ *
+ * The XML is written to standard output when no output file is given.
+ */
+
+#include <stdio.h>
+
+#include "VerboseBinaryReader.hpp"
+
+int
+main(int argc, char **argv)
+{
+	if ((2 > argc) || (3 < argc)) {
+		fprintf(stderr, "usage: %s <binary log> [<xml file>]\n", argv[0]);
+		return 2;
+	}
+
+	const char *error = NULL;
+	bool result = false;
+	if (3 == argc) {
+		result = MM_VerboseBinaryReader::convertToXML(argv[1], argv[2], &error);
+	} else {
+		MM_VerboseBinaryReader reader;
+		result = reader.open(argv[1]) && reader.writeXML(stdout);
+		error = reader.getError();
+	}
+
+	if (!result) {
+		fprintf(stderr, "%s: %s: %s\n", argv[0], argv[1], (NULL != error) ? error : "conversion failed");
+		return 1;
+	}
+	return 0;
+}
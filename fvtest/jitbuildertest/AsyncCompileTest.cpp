@@ -0,0 +1,122 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "JBTestUtil.hpp"
+
+// Return codes of compiledMethodBuilderEntry()
+#define COMPILATION_SUCCEEDED 0
+#define COMPILATION_REQUESTED 1
+
+// Hotness levels accepted by compileMethodBuilderAsync()
+#define HOTNESS_COLD 1
+#define HOTNESS_WARM 2
+#define HOTNESS_HOT 3
+
+typedef int32_t (AddConstantFunction)(int32_t);
+
+DEFINE_BUILDER(AddOne,
+               Int32,
+               PARAM("param", Int32))
+   {
+   Return(Add(Load("param"), ConstInt32(1)));
+   return true;
+   }
+
+DEFINE_BUILDER(AddTen,
+               Int32,
+               PARAM("param", Int32))
+   {
+   Return(Add(Load("param"), ConstInt32(10)));
+   return true;
+   }
+
+class AsyncCompileTest : public JitBuilderTest
+   {
+   public:
+
+   static void SetUpTestCase()
+      {
+      JitBuilderTest::SetUpTestCase();
+      ASSERT_TRUE(startCompilationThreads(2)) << "Failed to start the compilation threads.";
+      }
+   };
+
+TEST_F(AsyncCompileTest, WaitForEntryPoint)
+   {
+   OMR::JitBuilder::TypeDictionary types;
+   AddOne builder(&types);
+
+   ASSERT_EQ(COMPILATION_REQUESTED, compileMethodBuilderAsync(&builder, HOTNESS_WARM));
+
+   void *entry = NULL;
+   ASSERT_EQ(COMPILATION_SUCCEEDED, compiledMethodBuilderEntry(&builder, &entry, true));
+   ASSERT_TRUE(NULL != entry);
+
+   AddConstantFunction *addOne = (AddConstantFunction *)entry;
+   EXPECT_EQ(42, addOne(41));
+   }
+
+TEST_F(AsyncCompileTest, PollForEntryPoint)
+   {
+   OMR::JitBuilder::TypeDictionary types;
+   AddTen builder(&types);
+
+   ASSERT_EQ(COMPILATION_REQUESTED, compileMethodBuilderAsync(&builder, HOTNESS_COLD));
+
+   // A second request for the same method is refused while the first is outstanding
+   EXPECT_NE(COMPILATION_REQUESTED, compileMethodBuilderAsync(&builder, HOTNESS_HOT));
+
+   void *entry = NULL;
+   int32_t rc = compiledMethodBuilderEntry(&builder, &entry, false);
+   if (COMPILATION_REQUESTED == rc)
+      rc = compiledMethodBuilderEntry(&builder, &entry, true);
+   ASSERT_EQ(COMPILATION_SUCCEEDED, rc);
+
+   AddConstantFunction *addTen = (AddConstantFunction *)entry;
+   EXPECT_EQ(52, addTen(42));
+
+   // The result has been collected
+   EXPECT_NE(COMPILATION_SUCCEEDED, compiledMethodBuilderEntry(&builder, &entry, true));
+   }
+
+TEST_F(AsyncCompileTest, ManyOutstandingRequests)
+   {
+   const int32_t numMethods = 16;
+   OMR::JitBuilder::TypeDictionary types;
+   std::vector<AddOne *> builders;
+
+   for (int32_t i = 0; i < numMethods; i++)
+      {
+      builders.push_back(new AddOne(&types));
+      int32_t hotness = (0 == (i % 3)) ? HOTNESS_HOT : HOTNESS_WARM;
+      ASSERT_EQ(COMPILATION_REQUESTED, compileMethodBuilderAsync(builders[i], hotness));
+      }
+
+   for (int32_t i = 0; i < numMethods; i++)
+      {
+      void *entry = NULL;
+      ASSERT_EQ(COMPILATION_SUCCEEDED, compiledMethodBuilderEntry(builders[i], &entry, true)) << "method " << i;
+      AddConstantFunction *addOne = (AddConstantFunction *)entry;
+      EXPECT_EQ(i + 1, addOne(i));
+      delete builders[i];
+      }
+   }
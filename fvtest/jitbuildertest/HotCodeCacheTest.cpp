@@ -0,0 +1,131 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "JBTestUtil.hpp"
+
+// Return codes of compiledMethodBuilderEntry()
+#define COMPILATION_SUCCEEDED 0
+#define COMPILATION_REQUESTED 1
+
+// Hotness levels accepted by compileMethodBuilderAsync()
+#define HOTNESS_WARM 2
+#define HOTNESS_HOT 3
+
+typedef int32_t (AddConstantFunction)(int32_t);
+
+DEFINE_BUILDER(AddSeven,
+               Int32,
+               PARAM("param", Int32))
+   {
+   Return(Add(Load("param"), ConstInt32(7)));
+   return true;
+   }
+
+/**
+ * Runs the JIT with a hot code cache segment and a single compilation thread,
+ * so that every compilation at a given hotness uses the same code cache.
+ */
+class HotCodeCacheTest : public ::testing::Test
+   {
+   public:
+
+   static void SetUpTestCase()
+      {
+      ASSERT_TRUE(initializeJitWithOptions((char *)"-Xjit:acceptHugeMethods,useILValidator,hotCodeCacheKB=2048")) << "Failed to initialize the JIT.";
+      ASSERT_TRUE(startCompilationThreads(1)) << "Failed to start the compilation threads.";
+      }
+
+   static void TearDownTestCase()
+      {
+      shutdownJit();
+      }
+
+   AddConstantFunction *compile(int32_t hotness)
+      {
+      OMR::JitBuilder::TypeDictionary types;
+      AddSeven builder(&types);
+      void *entry = NULL;
+      EXPECT_EQ(COMPILATION_REQUESTED, compileMethodBuilderAsync(&builder, hotness));
+      EXPECT_EQ(COMPILATION_SUCCEEDED, compiledMethodBuilderEntry(&builder, &entry, true));
+      return (AddConstantFunction *)entry;
+      }
+   };
+
+TEST_F(HotCodeCacheTest, HotBodiesAreKeptApart)
+   {
+   AddConstantFunction *warm = compile(HOTNESS_WARM);
+   AddConstantFunction *hot = compile(HOTNESS_HOT);
+   AddConstantFunction *nextWarm = compile(HOTNESS_WARM);
+   ASSERT_TRUE(NULL != warm && NULL != hot && NULL != nextWarm);
+
+   EXPECT_EQ(8, warm(1));
+   EXPECT_EQ(8, hot(1));
+   EXPECT_EQ(8, nextWarm(1));
+
+   // The hot body was placed in the hot code cache, apart from the warm ones
+   void *hotBase = getHotCodeCacheBase();
+   void *hotTop = getHotCodeCacheTop();
+   ASSERT_TRUE(NULL != hotBase) << "No hot code cache was created";
+   EXPECT_LE(hotBase, (void *)hot);
+   EXPECT_LT((void *)hot, hotTop);
+   EXPECT_FALSE(hotBase <= (void *)warm && (void *)warm < hotTop);
+   EXPECT_FALSE(hotBase <= (void *)nextWarm && (void *)nextWarm < hotTop);
+   }
+
+TEST_F(HotCodeCacheTest, FreedBodyIsReused)
+   {
+   AddConstantFunction *warm = compile(HOTNESS_WARM);
+   ASSERT_TRUE(NULL != warm);
+   EXPECT_EQ(10, warm(3));
+
+   EXPECT_TRUE(freeCompiledMethod((void *)warm));
+   EXPECT_FALSE(freeCompiledMethod((void *)warm)) << "A body can only be freed once";
+
+   AddConstantFunction *recompiled = compile(HOTNESS_WARM);
+   EXPECT_EQ((void *)warm, (void *)recompiled);
+   EXPECT_EQ(10, recompiled(3));
+   }
+
+TEST_F(HotCodeCacheTest, FreedHotBodyIsReused)
+   {
+   AddConstantFunction *hot = compile(HOTNESS_HOT);
+   ASSERT_TRUE(NULL != hot);
+   EXPECT_EQ(12, hot(5));
+
+   EXPECT_TRUE(freeCompiledMethod((void *)hot));
+
+   AddConstantFunction *recompiled = compile(HOTNESS_HOT);
+   EXPECT_EQ((void *)hot, (void *)recompiled);
+   EXPECT_EQ(12, recompiled(5));
+   }
+
+TEST_F(HotCodeCacheTest, OnlyCompiledBodiesAreFreed)
+   {
+   int32_t notCode = 0;
+   EXPECT_FALSE(freeCompiledMethod((void *)&notCode));
+
+   AddConstantFunction *warm = compile(HOTNESS_WARM);
+   ASSERT_TRUE(NULL != warm);
+   EXPECT_FALSE(freeCompiledMethod((void *)((uint8_t *)warm + 1))) << "Only the start of a body can be freed";
+   EXPECT_EQ(10, warm(3));
+   EXPECT_TRUE(freeCompiledMethod((void *)warm));
+   }
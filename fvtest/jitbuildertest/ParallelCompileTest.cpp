@@ -0,0 +1,221 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "JBTestUtil.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <stdio.h>
+#include <thread>
+
+// Return codes of compiledMethodBuilderEntry()
+#define COMPILATION_SUCCEEDED 0
+#define COMPILATION_REQUESTED 1
+
+// Hotness level accepted by compileMethodBuilderAsync()
+#define HOTNESS_WARM 2
+
+#define NUM_THREADS 16
+#define NUM_METHODS 2048
+
+typedef int32_t (ScaledSumFunction)(int32_t);
+
+/*
+ * Counts the compilations generating IL at the same time.  Until two have been
+ * seen together, each one waits a while for another to join it, so that a lock
+ * serializing compilations shows up as a maximum of one.  Only the first wait
+ * that runs out is made, so such a lock does not stall every compilation.
+ */
+class OverlapProbe
+   {
+   public:
+
+   static void reset() { _active = 0; _maxActive = 0; _timedOut = false; }
+   static int32_t maxActive() { return _maxActive; }
+
+   static void enter()
+      {
+      int32_t active = ++_active;
+      int32_t seen = _maxActive;
+      while (active > seen && !_maxActive.compare_exchange_weak(seen, active))
+         ;
+
+      auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+      while (_maxActive < 2 && !_timedOut)
+         {
+         if (std::chrono::steady_clock::now() >= deadline)
+            _timedOut = true;
+         std::this_thread::yield();
+         }
+      }
+
+   static void exit() { --_active; }
+
+   private:
+
+   static std::atomic<int32_t> _active;
+   static std::atomic<int32_t> _maxActive;
+   static std::atomic<bool> _timedOut;
+   };
+
+std::atomic<int32_t> OverlapProbe::_active(0);
+std::atomic<int32_t> OverlapProbe::_maxActive(0);
+std::atomic<bool> OverlapProbe::_timedOut(false);
+
+/*
+ * Computes scale * (0 + 1 + ... + (n - 1)).  Every instance is compiled into a
+ * method body of its own, with enough control flow to keep the optimizer busy.
+ */
+class ScaledSum : public OMR::JitBuilder::MethodBuilder
+   {
+   public:
+
+   ScaledSum(OMR::JitBuilder::TypeDictionary *types, int32_t scale)
+      : OMR::JitBuilder::MethodBuilder(types),
+        _scale(scale)
+      {
+      DefineLine(LINETOSTR(__LINE__));
+      DefineFile(__FILE__);
+      DefineName("scaledSum");
+      DefineParameter("n", Int32);
+      DefineReturnType(Int32);
+      }
+
+   virtual bool buildIL()
+      {
+      OverlapProbe::enter();
+      Store("sum", ConstInt32(0));
+
+      OMR::JitBuilder::IlBuilder *loop = NULL;
+      ForLoopUp((char *)"i", &loop, ConstInt32(0), Load("n"), ConstInt32(1));
+      loop->Store("sum",
+      loop->   Add(
+      loop->      Load("sum"),
+      loop->      Mul(
+      loop->         Load("i"),
+      loop->         ConstInt32(_scale))));
+
+      Return(Load("sum"));
+      OverlapProbe::exit();
+      return true;
+      }
+
+   static int32_t expected(int32_t scale, int32_t n) { return scale * (n * (n - 1) / 2); }
+
+   private:
+
+   int32_t _scale;
+   };
+
+/*
+ * Each method gets its own type dictionary: dictionaries cache per compilation
+ * state and must not be shared by compilations running at the same time.
+ */
+struct ScaledSumMethod
+   {
+   ScaledSumMethod(int32_t scale) : _types(), _builder(&_types, scale), _entry(NULL) { }
+
+   OMR::JitBuilder::TypeDictionary _types;
+   ScaledSum _builder;
+   void *_entry;
+   };
+
+static void
+reportThroughput(const char *how, int32_t methods, std::chrono::steady_clock::duration elapsed)
+   {
+   double seconds = std::chrono::duration<double>(elapsed).count();
+   printf("[          ] compiled %d methods on %d %s in %.3fs (%.0f methods/s)\n",
+          methods, NUM_THREADS, how, seconds, seconds > 0 ? methods / seconds : 0.0);
+   }
+
+class ParallelCompileTest : public JitBuilderTest
+   {
+   public:
+
+   static void SetUpTestCase()
+      {
+      JitBuilderTest::SetUpTestCase();
+      ASSERT_TRUE(startCompilationThreads(NUM_THREADS)) << "Failed to start the compilation threads.";
+      }
+
+   virtual void SetUp() { OverlapProbe::reset(); }
+   };
+
+TEST_F(ParallelCompileTest, CompilationThreads)
+   {
+   std::vector<ScaledSumMethod *> methods;
+   for (int32_t i = 0; i < NUM_METHODS; i++)
+      methods.push_back(new ScaledSumMethod(i));
+
+   auto start = std::chrono::steady_clock::now();
+   for (int32_t i = 0; i < NUM_METHODS; i++)
+      ASSERT_EQ(COMPILATION_REQUESTED, compileMethodBuilderAsync(&methods[i]->_builder, HOTNESS_WARM)) << "method " << i;
+   for (int32_t i = 0; i < NUM_METHODS; i++)
+      ASSERT_EQ(COMPILATION_SUCCEEDED, compiledMethodBuilderEntry(&methods[i]->_builder, &methods[i]->_entry, true)) << "method " << i;
+   reportThroughput("compilation threads", NUM_METHODS, std::chrono::steady_clock::now() - start);
+   EXPECT_GT(OverlapProbe::maxActive(), 1) << "Compilations never ran at the same time.";
+
+   for (int32_t i = 0; i < NUM_METHODS; i++)
+      {
+      ScaledSumFunction *scaledSum = (ScaledSumFunction *)methods[i]->_entry;
+      ASSERT_EQ(ScaledSum::expected(i, 10), scaledSum(10)) << "method " << i;
+      delete methods[i];
+      }
+   }
+
+TEST_F(ParallelCompileTest, ApplicationThreads)
+   {
+   std::vector<ScaledSumMethod *> methods;
+   for (int32_t i = 0; i < NUM_METHODS; i++)
+      methods.push_back(new ScaledSumMethod(i));
+
+   // Thread t compiles methods t, t + NUM_THREADS, t + 2 * NUM_THREADS, ...
+   int32_t failures[NUM_THREADS] = { 0 };
+   std::vector<std::thread> threads;
+   auto start = std::chrono::steady_clock::now();
+   for (int32_t t = 0; t < NUM_THREADS; t++)
+      {
+      threads.push_back(std::thread([&methods, &failures, t]()
+         {
+         for (int32_t i = t; i < NUM_METHODS; i += NUM_THREADS)
+            {
+            if (COMPILATION_SUCCEEDED != compileMethodBuilder(&methods[i]->_builder, &methods[i]->_entry))
+               failures[t] += 1;
+            }
+         }));
+      }
+   for (int32_t t = 0; t < NUM_THREADS; t++)
+      threads[t].join();
+   reportThroughput("application threads", NUM_METHODS, std::chrono::steady_clock::now() - start);
+   EXPECT_GT(OverlapProbe::maxActive(), 1) << "Compilations never ran at the same time.";
+
+   for (int32_t t = 0; t < NUM_THREADS; t++)
+      EXPECT_EQ(0, failures[t]) << "thread " << t;
+
+   for (int32_t i = 0; i < NUM_METHODS; i++)
+      {
+      ScaledSumFunction *scaledSum = (ScaledSumFunction *)methods[i]->_entry;
+      ASSERT_TRUE(NULL != scaledSum) << "method " << i;
+      ASSERT_EQ(ScaledSum::expected(i, 10), scaledSum(10)) << "method " << i;
+      delete methods[i];
+      }
+   }
@@ -0,0 +1,289 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "JBTestUtil.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+typedef int32_t (Int32Function)(int32_t);
+
+static int32_t
+addOne(int32_t value)
+   {
+   #define TARGET_LINE LINETOSTR(__LINE__)
+   return value + 1;
+   }
+
+static int32_t
+addTwo(int32_t value)
+   {
+   return value + 2;
+   }
+
+// The function compiled code calls through "target", which is at another
+// address in a later run of the program
+static void *callTarget = (void *)&addOne;
+
+DEFINE_BUILDER(CallTarget,
+               Int32,
+               PARAM("param", Int32))
+   {
+   DefineFunction((char *)"target",
+                  (char *)__FILE__,
+                  (char *)TARGET_LINE,
+                  callTarget,
+                  Int32,
+                  1,
+                  Int32);
+
+   Return(Mul(Call("target", 1, Load("param")), ConstInt32(3)));
+   return true;
+   }
+
+DEFINE_BUILDER(DenseSwitch,
+               Int32,
+               PARAM("selector", Int32))
+   {
+   OMR::JitBuilder::IlBuilder *defaultBuilder = NULL;
+   OMR::JitBuilder::IlBuilder *caseBuilders[6] = { NULL };
+   TableSwitch(Load("selector"), &defaultBuilder, true, 6,
+               MakeCase(0, &caseBuilders[0], false),
+               MakeCase(1, &caseBuilders[1], false),
+               MakeCase(2, &caseBuilders[2], false),
+               MakeCase(3, &caseBuilders[3], false),
+               MakeCase(4, &caseBuilders[4], false),
+               MakeCase(5, &caseBuilders[5], false));
+
+   for (int32_t i = 0; i < 6; i++)
+      caseBuilders[i]->Return(caseBuilders[i]->ConstInt32(100 + i * 7));
+   defaultBuilder->Return(defaultBuilder->ConstInt32(-1));
+
+   Return(ConstInt32(-2));
+   return true;
+   }
+
+/**
+ * Each test runs the JIT more than once, as separate runs of a program would,
+ * with a code cache file of its own.
+ */
+class PersistentCodeCacheTest : public ::testing::Test
+   {
+   public:
+
+   void SetUp()
+      {
+      _fileName = std::string("jitbuildertest.") + ::testing::UnitTest::GetInstance()->current_test_info()->name() + ".jitcache";
+      std::remove(_fileName.c_str());
+      callTarget = (void *)&addOne;
+      }
+
+   void TearDown()
+      {
+      std::remove(_fileName.c_str());
+      callTarget = (void *)&addOne;
+      }
+
+   void startJit()
+      {
+      std::string options = "-Xjit:acceptHugeMethods,useILValidator,persistentCodeCache=" + _fileName;
+      ASSERT_TRUE(initializeJitWithOptions((char *)options.c_str())) << "Failed to initialize the JIT.";
+      }
+
+   std::string readFile()
+      {
+      std::string contents;
+      FILE *file = fopen(_fileName.c_str(), "rb");
+      if (NULL == file)
+         return contents;
+      char buffer[4096];
+      size_t count = 0;
+      while (0 != (count = fread(buffer, 1, sizeof(buffer), file)))
+         contents.append(buffer, count);
+      fclose(file);
+      return contents;
+      }
+
+   void writeFile(const std::string &contents)
+      {
+      FILE *file = fopen(_fileName.c_str(), "wb");
+      ASSERT_TRUE(NULL != file);
+      EXPECT_EQ(contents.size(), fwrite(contents.data(), 1, contents.size(), file));
+      fclose(file);
+      }
+
+   long fileSize()
+      {
+      FILE *file = fopen(_fileName.c_str(), "rb");
+      if (NULL == file)
+         return -1;
+      fseek(file, 0, SEEK_END);
+      long size = ftell(file);
+      fclose(file);
+      return size;
+      }
+
+   protected:
+   std::string _fileName;
+   };
+
+TEST_F(PersistentCodeCacheTest, CallTargetIsRelocated)
+   {
+   Int32Function *function = NULL;
+
+   startJit();
+   ASSERT_COMPILE(OMR::JitBuilder::TypeDictionary, CallTarget, function);
+   EXPECT_EQ(15, function(4));
+   EXPECT_EQ(0, getPersistentCodeCacheHits());
+   EXPECT_EQ(1, getPersistentCodeCacheMisses());
+   shutdownJit();
+
+   long size = fileSize();
+   ASSERT_GT(size, 0) << "The compiled body was not kept";
+
+   callTarget = (void *)&addTwo;
+   startJit();
+   ASSERT_COMPILE(OMR::JitBuilder::TypeDictionary, CallTarget, function);
+   EXPECT_EQ(1, getPersistentCodeCacheHits()) << "The body compiled by the first run was not reused";
+   EXPECT_EQ(0, getPersistentCodeCacheMisses());
+   EXPECT_EQ(18, function(4));
+   shutdownJit();
+
+   EXPECT_EQ(size, fileSize());
+   }
+
+TEST_F(PersistentCodeCacheTest, BodyIsLoadedAtAnotherAddress)
+   {
+   Int32Function *function = NULL;
+
+   startJit();
+   ASSERT_COMPILE(OMR::JitBuilder::TypeDictionary, CallTarget, function);
+   EXPECT_EQ(15, function(4));
+   shutdownJit();
+
+   long size = fileSize();
+   ASSERT_GT(size, 0) << "The compiled body was not kept";
+   Int32Function *firstAddress = function;
+
+   // Compile something else first, so that the body is loaded elsewhere
+   callTarget = (void *)&addTwo;
+   startJit();
+   Int32Function *other = NULL;
+   ASSERT_COMPILE(OMR::JitBuilder::TypeDictionary, DenseSwitch, other);
+   ASSERT_COMPILE(OMR::JitBuilder::TypeDictionary, CallTarget, function);
+   EXPECT_EQ(1, getPersistentCodeCacheHits()) << "The body compiled by the first run was not reused";
+   EXPECT_NE((void *)firstAddress, (void *)function);
+   EXPECT_EQ(18, function(4));
+   EXPECT_EQ(-3, function(-3));
+   shutdownJit();
+
+   EXPECT_EQ(size, fileSize());
+   }
+
+TEST_F(PersistentCodeCacheTest, JumpTableBodyIsNotKept)
+   {
+   Int32Function *function = NULL;
+
+   // The jump table is allocated apart from the body, which could not be
+   // moved without it
+   startJit();
+   ASSERT_COMPILE(OMR::JitBuilder::TypeDictionary, DenseSwitch, function);
+   for (int32_t i = 0; i < 6; i++)
+      EXPECT_EQ(100 + i * 7, function(i));
+   EXPECT_EQ(-1, function(6));
+   shutdownJit();
+
+   EXPECT_EQ(-1, fileSize());
+   }
+
+TEST_F(PersistentCodeCacheTest, DamagedFileIsReplaced)
+   {
+   FILE *file = fopen(_fileName.c_str(), "wb");
+   ASSERT_TRUE(NULL != file);
+   fputs("not a code cache", file);
+   fclose(file);
+
+   Int32Function *function = NULL;
+   startJit();
+   ASSERT_COMPILE(OMR::JitBuilder::TypeDictionary, CallTarget, function);
+   EXPECT_EQ(15, function(4));
+   shutdownJit();
+
+   file = fopen(_fileName.c_str(), "rb");
+   ASSERT_TRUE(NULL != file);
+   char eyecatcher[8] = { 0 };
+   EXPECT_EQ(1u, fread(eyecatcher, sizeof(eyecatcher), 1, file));
+   fclose(file);
+   EXPECT_EQ(0, memcmp(eyecatcher, "OMRJITPC", sizeof(eyecatcher)));
+   }
+
+TEST_F(PersistentCodeCacheTest, DamagedFullSizeHeaderIsReplaced)
+   {
+   Int32Function *function = NULL;
+
+   startJit();
+   ASSERT_COMPILE(OMR::JitBuilder::TypeDictionary, CallTarget, function);
+   shutdownJit();
+
+   std::string contents = readFile();
+   ASSERT_GT(contents.size(), 16u) << "The compiled body was not kept";
+
+   // Keep the eyecatcher but damage everything after it, so the header is
+   // read in full and rejected rather than skipped for being short
+   std::string damaged = contents;
+   for (size_t i = 8; i < damaged.size(); i++)
+      damaged[i] = static_cast<char>(0xa5);
+   writeFile(damaged);
+
+   callTarget = (void *)&addTwo;
+   startJit();
+   ASSERT_COMPILE(OMR::JitBuilder::TypeDictionary, CallTarget, function);
+   EXPECT_EQ(18, function(4));
+   shutdownJit();
+
+   EXPECT_EQ(contents.size(), readFile().size());
+   EXPECT_EQ(0, memcmp(readFile().data(), "OMRJITPC", 8));
+   }
+
+TEST_F(PersistentCodeCacheTest, TruncatedEntryIsReplaced)
+   {
+   Int32Function *function = NULL;
+
+   startJit();
+   ASSERT_COMPILE(OMR::JitBuilder::TypeDictionary, CallTarget, function);
+   shutdownJit();
+
+   std::string contents = readFile();
+   ASSERT_GT(contents.size(), 16u) << "The compiled body was not kept";
+
+   // The header is intact and counts an entry the file no longer holds whole
+   writeFile(contents.substr(0, contents.size() - 8));
+
+   callTarget = (void *)&addTwo;
+   startJit();
+   ASSERT_COMPILE(OMR::JitBuilder::TypeDictionary, CallTarget, function);
+   EXPECT_EQ(18, function(4));
+   shutdownJit();
+
+   EXPECT_EQ(contents.size(), readFile().size());
+   }
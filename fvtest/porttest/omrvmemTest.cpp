@@ -1618,6 +1618,73 @@ exit:
 	reportTestExit(OMRPORTLIB, testName);
 }
 
+/**
+ * Verify huge page advice and coverage on a committed range of default sized pages.
+ *
+ * Advising the range must either succeed or be unsupported. Where coverage can be measured, it never
+ * exceeds the range, and a successful collapse backs the 2M aligned part of the range with huge pages.
+ */
+TEST(PortVmemTest, vmem_test_hugepage_advice_and_coverage)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	const char *testName = "omrvmem_test_hugepage_advice_and_coverage";
+	uintptr_t *pageSizes = NULL;
+	uintptr_t byteAmount = 2 * D2M;
+	char *memPtr = NULL;
+	struct J9PortVmemIdentifier vmemID;
+	uint64_t hugePageBytes = 0;
+	int32_t adviseRC = 0;
+	int32_t collapseRC = 0;
+	int32_t coverageRC = 0;
+
+	reportTestEntry(OMRPORTLIB, testName);
+
+	pageSizes = omrvmem_supported_page_sizes();
+	memPtr = (char *)omrvmem_reserve_memory(
+					0, byteAmount, &vmemID,
+					OMRPORT_VMEM_MEMORY_MODE_READ | OMRPORT_VMEM_MEMORY_MODE_WRITE | OMRPORT_VMEM_MEMORY_MODE_COMMIT,
+					pageSizes[0], OMRMEM_CATEGORY_PORT_LIBRARY);
+	if (NULL == memPtr) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "unable to reserve and commit 0x%zx bytes with page size 0x%zx\n", byteAmount, pageSizes[0]);
+		goto exit;
+	}
+
+	adviseRC = omrvmem_advise_hugepages(memPtr, byteAmount, OMRPORT_VMEM_HUGEPAGE_ADVISE);
+	if ((0 != adviseRC) && (OMRPORT_ERROR_VMEM_NOT_SUPPORTED != adviseRC)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrvmem_advise_hugepages(OMRPORT_VMEM_HUGEPAGE_ADVISE) returned %d\n", adviseRC);
+	}
+	memset(memPtr, 0xa5, byteAmount);
+
+	/* the collapse may fail for lack of free huge pages, so only its outcome is checked below */
+	collapseRC = omrvmem_advise_hugepages(memPtr, byteAmount, OMRPORT_VMEM_HUGEPAGE_COLLAPSE);
+	portTestEnv->log("omrvmem_advise_hugepages: advise returned %d, collapse returned %d\n", adviseRC, collapseRC);
+
+	coverageRC = omrvmem_get_hugepage_coverage(memPtr, byteAmount, &hugePageBytes);
+#if defined(LINUX)
+	if (0 != coverageRC) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrvmem_get_hugepage_coverage returned %d\n", coverageRC);
+	}
+#endif /* defined(LINUX) */
+	if (0 == coverageRC) {
+		portTestEnv->log("0x%zx of 0x%zx bytes are backed by huge pages\n", (uintptr_t)hugePageBytes, byteAmount);
+		if (hugePageBytes > byteAmount) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "0x%llx bytes backed by huge pages exceed the 0x%zx byte range\n", hugePageBytes, byteAmount);
+		}
+		if ((0 == collapseRC) && (hugePageBytes < D2M)) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "only 0x%llx bytes are backed by huge pages after a successful collapse\n", hugePageBytes);
+		}
+	} else if (OMRPORT_ERROR_VMEM_NOT_SUPPORTED != coverageRC) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrvmem_get_hugepage_coverage returned %d\n", coverageRC);
+	}
+
+	if (0 != omrvmem_free_memory(memPtr, byteAmount, &vmemID)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrvmem_free_memory failed to free 0x%zx bytes at %p\n", byteAmount, memPtr);
+	}
+
+exit:
+	reportTestExit(OMRPORTLIB, testName);
+}
+
 #if defined(ENABLE_RESERVE_MEMORY_EX_TESTS)
 
 /**
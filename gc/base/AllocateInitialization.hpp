@@ -30,6 +30,7 @@
 #include "omrutil.h"
 
 #include "AllocateDescription.hpp"
+#include "AllocationSiteSampler.hpp"
 #include "AtomicOperations.hpp"
 #include "Base.hpp"
 #include "EnvironmentBase.hpp"
@@ -224,6 +225,13 @@ public:
 					MM_AtomicOperations::writeBarrier();
 					/* reflect the current OMR flags in the object header back into allocate description */
 					_allocateDescription.setObjectFlags((uint32_t)objectModel->getObjectFlags(objectPtr));
+					/* count the allocation against the thread's allocation site sampling interval */
+					uintptr_t allocatedBytes = _allocateDescription.getContiguousBytes();
+					if (allocatedBytes < env->_allocationSiteSampleBytesRemaining) {
+						env->_allocationSiteSampleBytesRemaining -= allocatedBytes;
+					} else {
+						MM_AllocationSiteSampler::sampleAllocation(env, objectPtr, _allocationCategory, allocatedBytes);
+					}
 #if defined(OMR_GC_ALLOCATION_TAX)
 					/* if concurrent mark is enabled thread might have to pay tax - must save/restore allocated object in case of GC */
 					env->saveObjects(objectPtr);
@@ -57,6 +57,16 @@ public:
 		VM_AtomicSupport::nop();
 	}
 
+	/**
+	 * Hint to the processor that the cache line containing address will be read soon.
+	 * @param address the address to prefetch
+	 */
+	MMINLINE_DEBUG static void
+	prefetchForRead(const void *address)
+	{
+		VM_AtomicSupport::prefetchForRead(address);
+	}
+
 	/**
 	 * @Deprecated use the readWriteBarrier
 	 */
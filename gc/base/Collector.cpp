@@ -433,6 +433,16 @@ MM_Collector::postCollect(MM_EnvironmentBase* env, MM_MemorySubSpace* subSpace)
 
 	internalPostCollect(env, subSpace);
 
+	if (_globalCollector && extensions->heapHugePageCollapse) {
+		/* the surviving objects are in place now, so back them with huge pages before khugepaged would get to them;
+		 * the collapse copies memory inside the pause, so it is only done every gcCountBetweenHugePageCollapse collections */
+		_collectionsSinceHugePageCollapse += 1;
+		if (_collectionsSinceHugePageCollapse >= extensions->gcCountBetweenHugePageCollapse) {
+			_collectionsSinceHugePageCollapse = 0;
+			extensions->heap->collapseHugePages(env);
+		}
+	}
+
 	extensions->bytesAllocatedMost = 0;
 	extensions->vmThreadAllocatedMost = NULL;
 
@@ -66,6 +66,7 @@ protected:
 	uintptr_t _cycleType;
 
 	uint64_t _mainThreadCpuTimeStart; /**< slot to store the main CPU time at the beginning of the collection */
+	uintptr_t _collectionsSinceHugePageCollapse; /**< global collections completed since the heap was last collapsed into transparent huge pages */
 
 public:
 	/**
@@ -313,6 +314,7 @@ public:
 		, _collectorExpandedSize(0)
 		, _cycleType(OMR_GC_CYCLE_TYPE_DEFAULT)
 		, _mainThreadCpuTimeStart(0)
+		, _collectionsSinceHugePageCollapse(0)
 	{
 		_typeId = __FUNCTION__;
 	}
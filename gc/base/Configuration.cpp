@@ -436,7 +436,7 @@ MM_Configuration::initializeGCThreadCount(MM_EnvironmentBase* env)
 {
 	MM_GCExtensionsBase* extensions = env->getExtensions();
 
-	if (!extensions->gcThreadCountForced) {
+	if (!extensions->gcThreadCountForced && !extensions->gcThreadCountSpecified) {
 		OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
 		extensions->gcThreadCount = omrsysinfo_get_number_CPUs_by_type(OMRPORT_CPU_TARGET);
 
@@ -461,12 +461,42 @@ MM_Configuration::initializeGCParameters(MM_EnvironmentBase* env)
 		extensions->packetListSplit = (extensions->gcThreadCount - 1) / 8  +  1;
 	}
 
+	if (extensions->heapMapVectorScan) {
+		extensions->heapMapScanImplementation = MM_HeapMapScan::selectImplementation(env->getPortLibrary());
+	}
+
+	/* the predictor needs at least one cycle of history to smooth over */
+	if (0 == extensions->heapResizePredictorHistory) {
+		extensions->heapResizePredictorHistory = 1;
+	}
+
+#if defined(OMR_GC_MODRON_COMPACTION)
+	/* bound the incremental compaction window to an eighth of the heap unless specified */
+	if (extensions->incrementalCompact && (0 == extensions->incrementalCompactMaxLiveBytes)) {
+		extensions->incrementalCompactMaxLiveBytes = extensions->memoryMax / 8;
+	}
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
+
 #if defined(OMR_GC_MODRON_SCAVENGER)
 	/* initialize scan cache lock splitting factor */
 	if (0 == extensions->cacheListSplit) {
 		extensions->cacheListSplit = (extensions->gcThreadCount - 1) / 8  +  1;
 	}
 	if (extensions->scavengerEnabled) {
+		if (SCAVENGER_PREFETCH_RING_SIZE < extensions->scavengerPrefetchDistance) {
+			extensions->scavengerPrefetchDistance = SCAVENGER_PREFETCH_RING_SIZE;
+		}
+		if (extensions->scavengerHotFieldLearning && (MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_NONE == extensions->scavengerScanOrdering)) {
+			/* learned hot fields are only consumed by depth copying, which requires dynamic breadth first ordering */
+			extensions->scavengerScanOrdering = MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_DYNAMIC_BREADTH_FIRST;
+		}
+		if (0 == extensions->scavengerHotFieldSamplingRate) {
+			extensions->scavengerHotFieldSamplingRate = 1;
+		}
+		if ((0 != extensions->scavengerPrefetchDistance) && (MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_NONE == extensions->scavengerScanOrdering)) {
+			/* prefetching batches all slots of an object, so it pairs with the breadth first copy loop */
+			extensions->scavengerScanOrdering = MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_BREADTH_FIRST;
+		}
 		if (MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_NONE == extensions->scavengerScanOrdering) {
 			extensions->scavengerScanOrdering = MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_HIERARCHICAL;
 		} else if (MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_DYNAMIC_BREADTH_FIRST == extensions->scavengerScanOrdering) {
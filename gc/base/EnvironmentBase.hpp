@@ -49,6 +49,7 @@ class MM_Collector;
 class MM_HeapRegionQueue;
 class MM_MemorySpace;
 class MM_ObjectAllocationInterface;
+class MM_Packet;
 class MM_SegregatedAllocationTracker;
 class MM_Task;
 class MM_Validator;
@@ -57,6 +58,9 @@ class MM_Validator;
 #define GC_UNMARK	0
 #define GC_MARK		0x20
 
+/* Upper bound on the empty SATB barrier packets a thread may claim ahead of use */
+#define SATB_BARRIER_PACKET_RESERVE_MAXIMUM 16
+
 /**
  * Type of thread.
  * @ingroup GC_Base_Core
@@ -143,12 +147,18 @@ public:
 	MM_WorkPacketStats _workPacketStatsRSScan;   /**< work packet Stats specifically for RS Scan Phase of Concurrent STW GC */
 
 	uint64_t _workerThreadCpuTimeNanos;	/**< Total CPU time used by this worker thread (or 0 for non-workers) */
+	uint64_t _taskStallTime; /**< Time, in hi-res ticks, this thread has spent stalled inside parallel tasks. Never reset; the dispatcher samples it for adaptive threading */
+	uintptr_t _taskWorkStallCount; /**< Number of task stalls that ended by acquiring more work. Never reset */
+	uintptr_t _taskCompleteStallCount; /**< Number of task stalls that ended with no work left. Never reset */
 
 	MM_FreeEntrySizeClassStats _freeEntrySizeClassStats;  /**< GC thread local statistics structure for heap free entry size (sizeClass) distribution */
 
 	uintptr_t _oolTraceAllocationBytes; /**< Tracks the bytes allocated since the last ool object trace */
 	uintptr_t _traceAllocationBytes;  /**< Tracks the bytes allocated since the last object trace */
 	uintptr_t _traceAllocationBytesCurrentTLH; /**< keep the bytes of times of sampling threshold for last object trace(include allocation bytes inside TLH) */
+	uintptr_t _allocationSiteSampleBytesRemaining; /**< bytes left to allocate before the allocation site sampler is next consulted */
+	uintptr_t _allocationSiteSamplerEpoch; /**< epoch of the allocation site sampler that drew _allocationSiteSampleBytesRemaining */
+	uint64_t _allocationSiteSampleSeed; /**< state of the generator of allocation site sampling intervals, 0 until first used */
 
 	uintptr_t approxScanCacheCount; /**< Local copy of approximate entries in global Cache Scan List. Updated upon allocation of new cache. */
 
@@ -158,6 +168,13 @@ public:
 
 	MM_RootScannerStats _rootScannerStats; /**< Per thread stats to track the performance of the root scanner */
 
+#if defined(OMR_GC_REALTIME)
+	MM_Packet *_sATBBarrierPacketReserve[SATB_BARRIER_PACKET_RESERVE_MAXIMUM]; /**< Empty barrier packets claimed by a batched SATB fragment refresh, already on the in-use list */
+	uintptr_t _sATBBarrierPacketReserveCount; /**< Number of packets left in _sATBBarrierPacketReserve */
+	uintptr_t _sATBBarrierPacketReserveEpoch; /**< Barrier packet epoch the reserve was claimed in; a reserve from an older epoch has been flushed and is dropped */
+	MM_GCRememberedSetFragment _sATBBarrierRememberedSetFragment; /**< Fragment the out-of-line SATB barrier records overwritten references in; fragmentParent is NULL until first used */
+#endif /* OMR_GC_REALTIME */
+
 	const char * _lastSyncPointReached; /**< string indicating latest sync point reached by this associated env's thread */
 
 #if defined(OMR_GC_SEGREGATED_HEAP)
@@ -620,6 +637,13 @@ public:
 		_workUnitToHandle = 0;
 	}
 
+	/**
+	 * Record time spent stalled inside a parallel task, for the dispatcher's utilization history.
+	 * @param startTime hi-res time at which the stall started
+	 * @param endTime hi-res time at which the stall ended
+	 */
+	MMINLINE void addToTaskStallTime(uint64_t startTime, uint64_t endTime) { _taskStallTime += (endTime - startTime); }
+
 	MMINLINE void setThreadScanned(bool threadScanned) { _threadScanned = threadScanned; };
 	MMINLINE bool isThreadScanned() { return _threadScanned; };
 
@@ -729,12 +753,23 @@ public:
 		,_failAllocOnExcessiveGC(false)
 		,_currentTask(NULL)
 		,_workerThreadCpuTimeNanos(0)
+		,_taskStallTime(0)
+		,_taskWorkStallCount(0)
+		,_taskCompleteStallCount(0)
 		,_freeEntrySizeClassStats()
 		,_oolTraceAllocationBytes(0)
 		,_traceAllocationBytes(0)
 		,_traceAllocationBytesCurrentTLH(0)
+		,_allocationSiteSampleBytesRemaining(0)
+		,_allocationSiteSamplerEpoch(0)
+		,_allocationSiteSampleSeed(0)
 		,approxScanCacheCount(0)
 		,_activeValidator(NULL)
+#if defined(OMR_GC_REALTIME)
+		,_sATBBarrierPacketReserveCount(0)
+		,_sATBBarrierPacketReserveEpoch(0)
+		,_sATBBarrierRememberedSetFragment()
+#endif /* OMR_GC_REALTIME */
 		,_lastSyncPointReached(NULL)
 #if defined(OMR_GC_SEGREGATED_HEAP)
 		,_allocationTracker(NULL)
@@ -786,12 +821,23 @@ public:
 		,_failAllocOnExcessiveGC(false)
 		,_currentTask(NULL)
 		,_workerThreadCpuTimeNanos(0)
+		,_taskStallTime(0)
+		,_taskWorkStallCount(0)
+		,_taskCompleteStallCount(0)
 		,_freeEntrySizeClassStats()
 		,_oolTraceAllocationBytes(0)
 		,_traceAllocationBytes(0)
 		,_traceAllocationBytesCurrentTLH(0)
+		,_allocationSiteSampleBytesRemaining(0)
+		,_allocationSiteSamplerEpoch(0)
+		,_allocationSiteSampleSeed(0)
 		,approxScanCacheCount(0)
 		,_activeValidator(NULL)
+#if defined(OMR_GC_REALTIME)
+		,_sATBBarrierPacketReserveCount(0)
+		,_sATBBarrierPacketReserveEpoch(0)
+		,_sATBBarrierRememberedSetFragment()
+#endif /* OMR_GC_REALTIME */
 		,_lastSyncPointReached(NULL)
 #if defined(OMR_GC_SEGREGATED_HEAP)
 		,_allocationTracker(NULL)
@@ -28,6 +28,7 @@
 #include "omrmemcategories.h"
 #include "modronbase.h"
 
+#include "AllocationSiteSampler.hpp"
 #include "CollectorLanguageInterface.hpp"
 #include "EnvironmentBase.hpp"
 #if defined(OMR_GC_MODRON_SCAVENGER)
@@ -237,6 +238,11 @@ MM_GCExtensionsBase::tearDown(MM_EnvironmentBase* env)
 	}
 #endif /* defined(OMR_GC_REALTIME) */
 
+	if (NULL != allocationSiteSampler) {
+		allocationSiteSampler->kill(env);
+		allocationSiteSampler = NULL;
+	}
+
 	objectModel.tearDown(this);
 	mixedObjectModel.tearDown(this);
 	indexableObjectModel.tearDown(this);
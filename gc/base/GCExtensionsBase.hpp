@@ -37,6 +37,7 @@
 #include "Forge.hpp"
 #include "GlobalGCStats.hpp"
 #include "GlobalVLHGCStats.hpp"
+#include "HeapMapScan.hpp"
 #include "LargeObjectAllocateStats.hpp"
 #include "MemoryHandle.hpp"
 #include "MixedObjectModel.hpp"
@@ -47,6 +48,7 @@
 #include "ScavengerStats.hpp"
 #include "SublistPool.hpp"
 
+class MM_AllocationSiteSampler;
 class MM_CardTable;
 class MM_ClassLoaderRememberedSet;
 class MM_CollectorLanguageInterface;
@@ -105,6 +107,12 @@ class HeapRegionStateTable;
 #define DEFAULT_SCAN_CACHE_MAXIMUM_SIZE (128 * 1024)
 #define DEFAULT_SCAN_CACHE_MINIMUM_SIZE (8 * 1024)
 
+/* The maximum number of slots the scavenger may hold with outstanding referent prefetches. */
+#define SCAVENGER_PREFETCH_RING_SIZE 32
+
+/* The number of hot field samples a scavenger thread buffers before flushing them to the shared hot field learner. */
+#define SCAVENGER_HOT_FIELD_SAMPLE_BUFFER_SIZE 64
+
 #define NO_ESTIMATE_FRAGMENTATION 			0x0
 #define LOCALGC_ESTIMATE_FRAGMENTATION 		0x1
 #define GLOBALGC_ESTIMATE_FRAGMENTATION 	0x2
@@ -270,6 +278,7 @@ public:
 #if defined(OMR_GC_CONCURRENT_SWEEP)
 	/* Temporary move from the leaf implementation */
 	bool concurrentSweep;
+	bool concurrentSweepLazy; /**< if true, a global collection does not sweep to satisfy the failed allocation; allocations that find a pool empty sweep just the chunks they need */
 #endif /* defined(OMR_GC_CONCURRENT_SWEEP) */
 
 	bool largePageWarnOnError;
@@ -281,10 +290,16 @@ public:
 #endif /* OMR_GC_DOUBLE_MAP_ARRAYLETS */
 	bool isVirtualLargeObjectHeapRequested;
 	bool isVirtualLargeObjectHeapEnabled;
+	uintptr_t virtualLargeObjectHeapThreshold; /**< objects of at least this size keep their data in largeObjectVirtualMemory, only a proxy is allocated in the heap */
 	uintptr_t requestedPageSize;
 	uintptr_t requestedPageFlags;
 	uintptr_t gcmetadataPageSize;
 	uintptr_t gcmetadataPageFlags;
+	bool heapTransparentHugePages; /**< if true, the heap is committed and decommitted in units of heapHugePageSize and committed ranges are advised to be backed by transparent huge pages */
+	bool heapHugePageCollapse; /**< if true, committed heap ranges are collapsed into transparent huge pages immediately rather than waiting for khugepaged */
+	uintptr_t gcCountBetweenHugePageCollapse; /**< number of global collections between collapses of the heap into transparent huge pages when heapHugePageCollapse is enabled */
+	uintptr_t gcCountBetweenHugePageCoverageSample; /**< number of collections between samples of the huge page coverage reported by verbose GC, which reads /proc/self/smaps on Linux */
+	uintptr_t heapHugePageSize; /**< the transparent huge page size the heap is aligned to when heapTransparentHugePages is enabled */
 
 #if defined(OMR_GC_MODRON_SCAVENGER)
 	MM_SublistPool rememberedSet;
@@ -295,6 +310,9 @@ public:
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
 #if defined(OMR_GC_REALTIME)
 	MM_RememberedSetSATB* sATBBarrierRememberedSet; /**< The snapshot at the beginning barrier remembered set used for the write barrier */
+	uintptr_t sATBBarrierPacketBatch; /**< Number of empty barrier packets a mutator claims per SATB fragment refresh (1 claims them one at a time) */
+	bool sATBConcurrentDrain; /**< If true, concurrent helpers are woken to drain full SATB barrier packets while mutators run */
+	uintptr_t sATBConcurrentDrainThreshold; /**< Number of full barrier packets published between wake-ups of the concurrent drainers */
 #endif /* defined(OMR_GC_REALTIME) */
 	ModronLnrlOptions lnrlOptions;
 
@@ -318,6 +336,8 @@ public:
 	uintptr_t frequentObjectAllocationSamplingRate; /**< # bytes to sample / # bytes allocated */
 	MM_FrequentObjectsStats* frequentObjectsStats;
 	uint32_t frequentObjectAllocationSamplingDepth; /**< # of frequent objects we'd like to report */
+	MM_AllocationSiteSampler *allocationSiteSampler; /**< samples allocations by allocation site, NULL unless sampling was started; installed and removed under exclusive VM access */
+	uintptr_t allocationSiteSamplerEpoch; /**< incremented each time allocation site sampling starts, so threads discard intervals drawn for an earlier sampler */
 
 	uint32_t estimateFragmentation; /**< Enable estimate fragmentation, NO_ESTIMATE_FRAGMENTATION, LOCALGC_ESTIMATE_FRAGMENTATION, GLOBALGC_ESTIMATE_FRAGMENTATION(default) */
 	bool processLargeAllocateStats; /**< Enable process LargeObjectAllocateStats */
@@ -328,6 +348,7 @@ public:
 	uint32_t largeObjectAllocationProfilingTopK; /**< number of most allocation size we want to track/report in large object allocation profiling */
 	MM_FreeEntrySizeClassStats freeEntrySizeClassStatsSimulated; /**< snapshot of free memory status used for simulated allocator for fragmentation estimation */
 	uintptr_t freeMemoryProfileMaxSizeClasses; /**< maximum number of sizeClass maintained for heap free memory profile (computed from SizeClassRatio) */
+	bool freeListSizeClassIndex; /**< if true, address ordered free lists keep a per size class index of where to start searching for large allocates */
 
 	volatile OMR_VMThread* gcExclusiveAccessThreadId; /**< thread token that represents the current "winning" thread for performing garbage collection */
 	omrthread_monitor_t gcExclusiveAccessMutex; /**< Mutex used for acquiring gc priviledges as well as for signalling waiting threads that GC has been completed */
@@ -348,6 +369,8 @@ public:
 	uintptr_t tlhIncrementSize;
 	uintptr_t tlhSurvivorDiscardThreshold; /**< below this size GC (Scavenger) will discard survivor copy cache TLH, if alloc not succeeded (otherwise we reuse memory for next TLH) */
 	uintptr_t tlhTenureDiscardThreshold; /**< below this size GC (Scavenger) will discard tenure copy cache TLH, if alloc not succeeded (otherwise we reuse memory for next TLH) */
+	bool tlhAdaptiveSizing; /**< if true, size TLH refreshes from the per-thread allocation rate rather than growing by tlhIncrementSize */
+	uintptr_t tlhAdaptiveRefreshInterval; /**< target time (in microseconds) between TLH refreshes of a thread when tlhAdaptiveSizing is enabled */
 
 	MM_AllocationStats allocationStats; /**< Statistics for allocations. */
 	uintptr_t bytesAllocatedMost;
@@ -399,6 +422,8 @@ public:
 
 	uintptr_t heapExpansionStabilizationCount; /**< GC count required before the heap is allowed to expand due to excessvie time after last heap expansion */
 	uintptr_t heapContractionStabilizationCount; /**< GC count required before the heap is allowed to contract due to excessvie time after last heap expansion */
+	bool heapResizePredictor; /**< if true, nursery and tenure are resized for the allocation demand forecast from recent cycles rather than only the demand of the last one */
+	uintptr_t heapResizePredictorHistory; /**< number of recent cycles the heap resize predictor averages over */
 
 	float heapSizeStartupHintConservativeFactor; /**< Use only a fraction of hints stored in SC */
 	float heapSizeStartupHintWeightNewValue;		/**< Learn slowly by historic averaging of stored hints */
@@ -406,6 +431,10 @@ public:
 
 	uintptr_t workpacketCount; /**< this value is ONLY set if -Xgcworkpackets is specified - otherwise the workpacket count is determined heuristically */
 	uintptr_t packetListSplit; /**< the number of ways to split packet lists, set by -XXgc:packetListLockSplit=, or determined heuristically based on the number of GC threads */
+	bool packetListLockFree; /**< if true, work packet sublists are lock-free tagged stacks rather than lock protected doubly linked lists */
+
+	bool heapMapVectorScan; /**< if true, runs of mark map slots are scanned with the widest vector instructions the processor supports */
+	MM_HeapMapScan::Implementation heapMapScanImplementation; /**< implementation used to scan runs of mark map slots, selected at startup */
 
 	uintptr_t markingArraySplitMaximumAmount; /**< maximum number of elements to split array scanning work in marking scheme */
 	uintptr_t markingArraySplitMinimumAmount; /**< minimum number of elements to split array scanning work in marking scheme */
@@ -463,7 +492,10 @@ public:
 	uintptr_t gcThreadCount; /**< Initial number of GC threads - chosen default or specified in java options*/
 	bool gcThreadCountForced; /**< true if number of GC threads is specified in java options. Currently we have a few ways to do this:
 										-Xgcthreads		-Xthreads= (RT only)	-XthreadCount= */
+	bool gcThreadCountSpecified; /**< true if the maximum number of GC threads is specified in options (-Xgcmaxthreads), fewer may still be used for a task */
 	uintptr_t dispatcherHybridNotifyThreadBound; /** Bound for determining hybrid notification type (Individual notifies for count < MIN(bound, maxThreads/2), otherwise notify_all) */
+	bool dispatcherAdaptiveThreading; /**< if true, the dispatcher picks the thread count of each task from the utilization seen the last time a task of the same type ran */
+	uintptr_t dispatcherAdaptiveThreadingTargetUtilization; /**< percentage of thread time a task should spend working rather than stalled before the dispatcher reduces its thread count */
 
 #if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC)
 	enum ScavengerScanOrdering {
@@ -517,8 +549,14 @@ public:
 	uintptr_t maxScavengeBeforeGlobal;
 	uintptr_t scvArraySplitMaximumAmount; /**< maximum number of elements to split array scanning work in the scavenger */
 	uintptr_t scvArraySplitMinimumAmount; /**< minimum number of elements to split array scanning work in the scavenger */
+	uintptr_t scavengerRememberedSetScanBatchSize; /**< number of remembered set slots a scavenger thread claims at once when scanning the remembered set list, zero (default) hands out whole puddles */
 	uintptr_t scavengerScanCacheMaximumSize; /**< maximum size of scan and copy caches before rounding, zero (default) means calculate them */
 	uintptr_t scavengerScanCacheMinimumSize; /**< minimum size of scan and copy caches before rounding, zero (default) means calculate them */
+	uintptr_t scavengerPrefetchDistance; /**< number of slots whose referents are prefetched ahead of copyAndForward() when scanning an object, zero (default) disables prefetching */
+	bool scavengerNUMAAware; /**< if true, scan and free cache lists are partitioned by NUMA node and GC threads prefer work produced on their own node */
+	bool scavengerHotFieldLearning; /**< if true, the scavenger samples which slots of each object shape lead to nursery objects and depth copies the hottest ones (implies dynamic breadth first scan ordering) */
+	uintptr_t scavengerHotFieldSamplingRate; /**< one in this many scanned scalar objects has its slots sampled for hot field learning */
+	uintptr_t scavengerHotFieldMinimumSamples; /**< number of times a slot must be sampled in a scavenge before it is learned as a hot field */
 	bool tiltedScavenge;
 	bool debugTiltedScavenge;
 	double survivorSpaceMinimumSizeRatio;
@@ -585,6 +623,8 @@ public:
 	uintptr_t compactOnSystemGC;
 	uintptr_t nocompactOnSystemGC;
 	bool compactToSatisfyAllocate;
+	bool incrementalCompact; /**< If true, each compaction evacuates only the most fragmented window of sub areas and leaves the rest in place */
+	uintptr_t incrementalCompactMaxLiveBytes; /**< Upper bound on live bytes in the window evacuated by an incremental compaction (0 means derive from heap size) */
 #endif /* defined(OMR_GC_MODRON_COMPACTION) */
 
 	bool payAllocationTax;
@@ -600,6 +640,7 @@ public:
 	uintptr_t concurrentSlack; /**< number of bytes to add to the concurrent kickoff threshold buffer */
 	uintptr_t cardCleanPass2Boost;
 	uintptr_t cardCleaningPasses;
+	uintptr_t finalCardCleaningBatchSize; /**< maximum number of dirty cards a thread claims at once in final card cleaning (1 claims them one at a time) */
 
 	UDATA fvtest_concurrentCardTablePreparationDelay; /**< Delay for concurrent card table preparation in milliseconds */
 
@@ -678,6 +719,8 @@ public:
 
 #if defined(OMR_GC_SEGREGATED_HEAP)
 	MM_SizeClasses* defaultSizeClasses;
+	bool segregatedNursery; /**< If true, the segregated collector runs nursery (minor) collections between full heap marks */
+	uintptr_t segregatedNurserySize; /**< Bytes of regions that may be handed out for allocation before a nursery collection is triggered (0 means derive from heap size) */
 #endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 
 #if defined(OMR_GC_VLHGC_CONCURRENT_COPY_FORWARD)
@@ -714,6 +757,7 @@ public:
 	bool verboseExtensions;
 	bool verboseNewFormat; /**< a flag, enabled by -XXgc:verboseNewFormat, to enable the new verbose GC format */
 	bool bufferedLogging; /**< Enabled by -Xgc:bufferedLogging.  Use buffered filestreams when writing logs (e.g. verbose:gc) to a file */
+	bool binaryLogging; /**< Enabled by -Xgc:binaryLogging.  Write verbose:gc files as the compact binary record stream instead of XML */
 
 	uintptr_t lowAllocationThreshold; /**< the lower bound of the allocation threshold range */
 	uintptr_t highAllocationThreshold; /**< the upper bound of the allocation threshold range */
@@ -1211,6 +1255,17 @@ public:
 	}
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
 
+	/**
+	 * Determine whether the dispatcher should size tasks from their utilization history.
+	 * Like adaptive threading, this must be ignored if GC thread count is forced.
+	 * @return TRUE if the dispatcher may reduce the thread count of a task, FALSE otherwise
+	 */
+	MMINLINE bool
+	dispatcherAdaptiveThreadingEnabled()
+	{
+		return (dispatcherAdaptiveThreading && !gcThreadCountForced);
+	}
+
 	/**
 	 * Returns TRUE if an object is old, FALSE otherwise.
 	 * @param objectPtr Pointer to an object
@@ -1501,6 +1556,7 @@ public:
 #endif /* defined(OMR_GC_VLHGC) */
 #if defined(OMR_GC_CONCURRENT_SWEEP)
 		, concurrentSweep(false)
+		, concurrentSweepLazy(false)
 #endif /* defined(OMR_GC_CONCURRENT_SWEEP) */
 		, largePageWarnOnError(false)
 		, largePageFailOnError(false)
@@ -1511,10 +1567,16 @@ public:
 #endif /* defined(OMR_GC_DOUBLE_MAP_ARRAYLETS) */
 		, isVirtualLargeObjectHeapRequested(false)
 		, isVirtualLargeObjectHeapEnabled(false)
+		, virtualLargeObjectHeapThreshold(1024 * 1024)
 		, requestedPageSize(0)
 		, requestedPageFlags(OMRPORT_VMEM_PAGE_FLAG_NOT_USED)
 		, gcmetadataPageSize(0)
 		, gcmetadataPageFlags(OMRPORT_VMEM_PAGE_FLAG_NOT_USED)
+		, heapTransparentHugePages(false)
+		, heapHugePageCollapse(false)
+		, gcCountBetweenHugePageCollapse(8)
+		, gcCountBetweenHugePageCoverageSample(16)
+		, heapHugePageSize(2 * 1024 * 1024)
 #if defined(OMR_GC_MODRON_SCAVENGER)
 		, rememberedSet()
 		, oldHeapSizeOnLastGlobalGC(UDATA_MAX)
@@ -1524,6 +1586,9 @@ public:
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
 #if defined(OMR_GC_REALTIME)
 		, sATBBarrierRememberedSet(NULL)
+		, sATBBarrierPacketBatch(1)
+		, sATBConcurrentDrain(false)
+		, sATBConcurrentDrainThreshold(4)
 #endif /* defined(OMR_GC_REALTIME) */
 		, heapBaseForBarrierRange0(NULL)
 		, heapSizeForBarrierRange0(0)
@@ -1539,6 +1604,8 @@ public:
 		, frequentObjectAllocationSamplingRate(100)
 		, frequentObjectsStats(NULL)
 		, frequentObjectAllocationSamplingDepth(0)
+		, allocationSiteSampler(NULL)
+		, allocationSiteSamplerEpoch(0)
 		, estimateFragmentation(GLOBALGC_ESTIMATE_FRAGMENTATION)
 		, processLargeAllocateStats(true) /* turn on processLargeAllocateStats by default */
 		, largeObjectAllocationProfilingThreshold(512)
@@ -1547,6 +1614,7 @@ public:
 		, largeObjectAllocationProfilingSizeClassRatio(120)
 		, largeObjectAllocationProfilingTopK(8)
 		, freeMemoryProfileMaxSizeClasses(0)
+		, freeListSizeClassIndex(false)
 		, gcExclusiveAccessThreadId(NULL)
 		, gcExclusiveAccessMutex(NULL)
 		, _lightweightNonReentrantLockPool(NULL)
@@ -1562,6 +1630,8 @@ public:
 		, tlhIncrementSize(4096)
 		, tlhSurvivorDiscardThreshold(tlhMinimumSize)
 		, tlhTenureDiscardThreshold(tlhMinimumSize)
+		, tlhAdaptiveSizing(false)
+		, tlhAdaptiveRefreshInterval(1000)
 		, allocationStats()
 		, bytesAllocatedMost(0)
 		, vmThreadAllocatedMost(NULL)
@@ -1599,11 +1669,16 @@ public:
 		, heapContractionGCRatioThreshold()
 		, heapExpansionStabilizationCount(0)
 		, heapContractionStabilizationCount(3)
+		, heapResizePredictor(false)
+		, heapResizePredictorHistory(8)
 		, heapSizeStartupHintConservativeFactor((float)0.7)
 		, heapSizeStartupHintWeightNewValue((float)0.8)
 		, useGCStartupHints(true)
 		, workpacketCount(0) /* only set if -Xgcworkpackets specified */
 		, packetListSplit(0)
+		, packetListLockFree(false)
+		, heapMapVectorScan(true)
+		, heapMapScanImplementation(MM_HeapMapScan::SCALAR)
 		, markingArraySplitMaximumAmount(DEFAULT_ARRAY_SPLIT_MAXIMUM_SIZE)
 		, markingArraySplitMinimumAmount(DEFAULT_ARRAY_SPLIT_MINIMUM_SIZE)
 		, rootScannerStatsEnabled(false)
@@ -1650,7 +1725,10 @@ public:
 #endif /* defined(OMR_GC_BATCH_CLEAR_TLH) */
 		, gcThreadCount(0)
 		, gcThreadCountForced(false)
+		, gcThreadCountSpecified(false)
 		, dispatcherHybridNotifyThreadBound(16)
+		, dispatcherAdaptiveThreading(false)
+		, dispatcherAdaptiveThreadingTargetUtilization(75)
 #if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC)
 		, scavengerScanOrdering(OMR_GC_SCAVENGER_SCANORDERING_NONE)
 		/* Start of options relating to dynamicBreadthFirstScanOrdering */
@@ -1698,8 +1776,14 @@ public:
 		, maxScavengeBeforeGlobal(0)
 		, scvArraySplitMaximumAmount(DEFAULT_ARRAY_SPLIT_MAXIMUM_SIZE)
 		, scvArraySplitMinimumAmount(DEFAULT_ARRAY_SPLIT_MINIMUM_SIZE)
+		, scavengerRememberedSetScanBatchSize(0)
 		, scavengerScanCacheMaximumSize(DEFAULT_SCAN_CACHE_MAXIMUM_SIZE)
 		, scavengerScanCacheMinimumSize(DEFAULT_SCAN_CACHE_MINIMUM_SIZE)
+		, scavengerPrefetchDistance(0)
+		, scavengerNUMAAware(false)
+		, scavengerHotFieldLearning(false)
+		, scavengerHotFieldSamplingRate(16)
+		, scavengerHotFieldMinimumSamples(4)
 		, tiltedScavenge(true)
 		, debugTiltedScavenge(false)
 		, survivorSpaceMinimumSizeRatio(0.10)
@@ -1749,6 +1833,8 @@ public:
 		, compactOnSystemGC(0)
 		, nocompactOnSystemGC(0)
 		, compactToSatisfyAllocate(false)
+		, incrementalCompact(false)
+		, incrementalCompactMaxLiveBytes(0)
 #endif /* defined(OMR_GC_MODRON_COMPACTION) */
 		, payAllocationTax(false)
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
@@ -1762,6 +1848,7 @@ public:
 		, concurrentSlack(0)
 		, cardCleanPass2Boost(2)
 		, cardCleaningPasses(2)
+		, finalCardCleaningBatchSize(16)
 		, fvtest_concurrentCardTablePreparationDelay(0)
 		, fvtest_forceConcurrentTLHMarkMapCommitFailure(0)
 		, fvtest_forceConcurrentTLHMarkMapCommitFailureCounter(0)
@@ -1819,6 +1906,8 @@ public:
 #endif /* defined(OMR_GC_REALTIME) || defined(OMR_GC_SEGREGATED_HEAP) */
 #if defined(OMR_GC_SEGREGATED_HEAP)
 		, defaultSizeClasses(NULL)
+		, segregatedNursery(false)
+		, segregatedNurserySize(0)
 #endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 #if defined(OMR_GC_VLHGC_CONCURRENT_COPY_FORWARD)
 		, heapRegionStateTable(NULL)
@@ -1846,6 +1935,7 @@ public:
 		, verboseExtensions(false)
 		, verboseNewFormat(true)
 		, bufferedLogging(false)
+		, binaryLogging(false)
 		, lowAllocationThreshold(UDATA_MAX)
 		, highAllocationThreshold(UDATA_MAX)
 		, disableInlineCacheForAllocationThreshold(false)
@@ -111,6 +111,12 @@ public:
 	 */
 	virtual void preAllocCacheFlush(MM_EnvironmentBase *env, void *base, void *top) {};
 
+	/* Used by the SATB barrier to notify the collector that enough full barrier packets have been published to be worth tracing concurrently */
+	virtual void drainBarrierPackets(MM_EnvironmentBase *env) {};
+
+	/* Used by the generational write barrier of collectors whose nursery is not a separate space (segregated nursery) */
+	virtual void nurseryWriteBarrier(MM_EnvironmentBase *env, omrobjectptr_t parentObject, omrobjectptr_t childObject) {};
+
 	MM_GlobalCollector()
 		: MM_Collector()
 		, _delegate()
@@ -33,6 +33,7 @@
 #include "HeapStats.hpp"
 #include "MemorySpace.hpp"
 #include "ModronAssertions.h"
+#include "SmoothedHeapResizePredictor.hpp"
 
 #include "mmhook_common.h"
 
@@ -51,12 +52,21 @@ MM_Heap::kill(MM_EnvironmentBase* env)
 bool
 MM_Heap::initialize(MM_EnvironmentBase* env)
 {
-	return true;
+	if (env->getExtensions()->heapResizePredictor) {
+		_heapResizePredictor = MM_SmoothedHeapResizePredictor::newInstance(env);
+	} else {
+		_heapResizePredictor = MM_HeapResizePredictor::newInstance(env);
+	}
+	return NULL != _heapResizePredictor;
 }
 
 void
 MM_Heap::tearDown(MM_EnvironmentBase* env)
 {
+	if (NULL != _heapResizePredictor) {
+		_heapResizePredictor->kill(env);
+		_heapResizePredictor = NULL;
+	}
 }
 
 /**
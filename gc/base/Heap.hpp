@@ -29,6 +29,7 @@
 
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
+#include "HeapResizePredictor.hpp"
 #include "HeapResizeStats.hpp"
 #include "PercolateStats.hpp"
 
@@ -55,6 +56,7 @@ protected:
 	uintptr_t _maximumMemorySize;
 
 	MM_HeapResizeStats _heapResizeStats;
+	MM_HeapResizePredictor *_heapResizePredictor; /**< chosen at startup by heapResizePredictor */
 	MM_PercolateStats _percolateStats;
 
 	MM_HeapRegionManager *_heapRegionManager;
@@ -75,6 +77,8 @@ public:
 
 	MMINLINE MM_HeapResizeStats *getResizeStats() { return &_heapResizeStats; }
 
+	MMINLINE MM_HeapResizePredictor *getResizePredictor() { return _heapResizePredictor; }
+
 	MMINLINE MM_PercolateStats *getPercolateStats() { return &_percolateStats; }
 
 	MMINLINE MM_MemorySpace *getDefaultMemorySpace() { return _defaultMemorySpace; }
@@ -112,6 +116,19 @@ public:
 	 * Return the page flags describing the pages used for the heap memory.
 	 */
 	virtual uintptr_t getPageFlags() = 0;
+
+	/**
+	 * Collapse the populated heap memory into transparent huge pages.
+	 * Has no effect unless the heap is committed in huge page units.
+	 */
+	virtual void collapseHugePages(MM_EnvironmentBase *env) {}
+
+	/**
+	 * Find how much of the heap memory is backed by transparent huge pages.
+	 * @param[out] hugePageBytes the number of bytes backed by huge pages
+	 * @return true on success, false if the heap can not report its huge page coverage
+	 */
+	virtual bool getHugePageCoverage(MM_EnvironmentBase *env, uint64_t *hugePageBytes) { return false; }
 	
 	virtual void *getHeapBase() = 0;
 	virtual void *getHeapTop() = 0;
@@ -179,6 +196,7 @@ public:
 		,_memorySpaceList(NULL)
 		,_maximumMemorySize(maximumMemorySize)
 		,_heapResizeStats()
+		,_heapResizePredictor(NULL)
 		,_percolateStats()
 		,_heapRegionManager(regionManager)
 	{
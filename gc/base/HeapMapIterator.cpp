@@ -24,6 +24,7 @@
 #include "Bits.hpp"
 #include "GCExtensionsBase.hpp"
 #include "HeapMap.hpp"
+#include "HeapMapScan.hpp"
 #include "Math.hpp"
 #include "ObjectModel.hpp"
 
@@ -131,6 +132,17 @@ MM_HeapMapIterator::nextObject()
 		_bitIndexHead = 0;
 		if(_heapSlotCurrent < _heapChunkTop) {
 			_heapMapSlotValue = *_heapMapSlotCurrent;
+			if (J9MODRON_HMI_SLOT_EMPTY == _heapMapSlotValue) {
+				/* Skip the rest of a run of empty map slots in bulk, stopping at the slot which covers the end of the chunk */
+				const uintptr_t heapSlotsPerHeapMapSlot = J9MODRON_HEAP_SLOTS_PER_HEAPMAP_BIT * J9BITS_BITS_IN_SLOT;
+				uintptr_t heapMapSlotsRemaining = ((uintptr_t)(_heapChunkTop - _heapSlotCurrent) + heapSlotsPerHeapMapSlot - 1) / heapSlotsPerHeapMapSlot;
+				uintptr_t *heapMapSlotNonEmpty = MM_HeapMapScan::findNonEmptySlot(_extensions->heapMapScanImplementation, _heapMapSlotCurrent, _heapMapSlotCurrent + heapMapSlotsRemaining);
+				_heapSlotCurrent += heapSlotsPerHeapMapSlot * (uintptr_t)(heapMapSlotNonEmpty - _heapMapSlotCurrent);
+				_heapMapSlotCurrent = heapMapSlotNonEmpty;
+				if(_heapSlotCurrent < _heapChunkTop) {
+					_heapMapSlotValue = *_heapMapSlotCurrent;
+				}
+			}
 		}
 	}
 
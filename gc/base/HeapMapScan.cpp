@@ -0,0 +1,269 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+#include "omrport.h"
+
+#include "HeapMapScan.hpp"
+
+#include "Bits.hpp"
+
+#if defined(OMR_ARCH_X86)
+#include <immintrin.h>
+#if defined(__GNUC__) || defined(__clang__)
+#define HEAPMAPSCAN_TARGET(isa) __attribute__((target(isa)))
+#else /* defined(__GNUC__) || defined(__clang__) */
+/* MSVC allows the use of any intrinsic without enabling the instruction set for the whole file */
+#define HEAPMAPSCAN_TARGET(isa)
+#endif /* defined(__GNUC__) || defined(__clang__) */
+#endif /* defined(OMR_ARCH_X86) */
+
+static uintptr_t *
+findNonEmptySlotScalar(uintptr_t *slotCurrent, uintptr_t *slotTop)
+{
+	while ((slotCurrent < slotTop) && (0 == *slotCurrent)) {
+		slotCurrent += 1;
+	}
+	return slotCurrent;
+}
+
+static uintptr_t
+countSetBitsScalar(uintptr_t *slotBase, uintptr_t *slotTop)
+{
+	uintptr_t count = 0;
+	for (uintptr_t *slot = slotBase; slot < slotTop; slot++) {
+		count += MM_Bits::populationCount(*slot);
+	}
+	return count;
+}
+
+#if defined(OMR_ARCH_X86)
+
+/**
+ * Determine whether the operating system saves the given XCR0 state components (the processor may support
+ * AVX/AVX-512 while the OS does not enable the wider registers).
+ */
+static bool
+isExtendedStateEnabled(uint64_t stateMask)
+{
+#if defined(_MSC_VER)
+	uint64_t xcr0 = _xgetbv(0);
+#else /* defined(_MSC_VER) */
+	uint32_t eax = 0;
+	uint32_t edx = 0;
+	__asm__ __volatile__ ("xgetbv" : "=a" (eax), "=d" (edx) : "c" (0));
+	uint64_t xcr0 = ((uint64_t)edx << 32) | eax;
+#endif /* defined(_MSC_VER) */
+	return stateMask == (xcr0 & stateMask);
+}
+
+HEAPMAPSCAN_TARGET("popcnt")
+static uintptr_t
+countSetBitsPopcnt(uintptr_t *slotBase, uintptr_t *slotTop)
+{
+	uintptr_t count = 0;
+	for (uintptr_t *slot = slotBase; slot < slotTop; slot++) {
+#if defined(OMR_ENV_DATA64)
+		count += (uintptr_t)_mm_popcnt_u64(*slot);
+#else /* defined(OMR_ENV_DATA64) */
+		count += (uintptr_t)_mm_popcnt_u32(*slot);
+#endif /* defined(OMR_ENV_DATA64) */
+	}
+	return count;
+}
+
+HEAPMAPSCAN_TARGET("sse4.2")
+static uintptr_t *
+findNonEmptySlotSSE(uintptr_t *slotCurrent, uintptr_t *slotTop)
+{
+	const uintptr_t slotsPerStep = sizeof(__m128i) / sizeof(uintptr_t);
+	while ((slotCurrent + slotsPerStep) <= slotTop) {
+		__m128i bits = _mm_loadu_si128((const __m128i *)slotCurrent);
+		if (!_mm_testz_si128(bits, bits)) {
+			break;
+		}
+		slotCurrent += slotsPerStep;
+	}
+	return findNonEmptySlotScalar(slotCurrent, slotTop);
+}
+
+HEAPMAPSCAN_TARGET("avx2")
+static uintptr_t *
+findNonEmptySlotAVX2(uintptr_t *slotCurrent, uintptr_t *slotTop)
+{
+	const uintptr_t slotsPerStep = sizeof(__m256i) / sizeof(uintptr_t);
+	while ((slotCurrent + slotsPerStep) <= slotTop) {
+		__m256i bits = _mm256_loadu_si256((const __m256i *)slotCurrent);
+		if (!_mm256_testz_si256(bits, bits)) {
+			break;
+		}
+		slotCurrent += slotsPerStep;
+	}
+	return findNonEmptySlotScalar(slotCurrent, slotTop);
+}
+
+/**
+ * Population count of 256 bits at a time: nibble lookup through a byte shuffle, summed per 64 bits with sad.
+ */
+HEAPMAPSCAN_TARGET("avx2,popcnt")
+static uintptr_t
+countSetBitsAVX2(uintptr_t *slotBase, uintptr_t *slotTop)
+{
+	const uintptr_t slotsPerStep = sizeof(__m256i) / sizeof(uintptr_t);
+	const __m256i lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4, 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+	const __m256i lowNibbleMask = _mm256_set1_epi8(0x0f);
+	__m256i total = _mm256_setzero_si256();
+	uintptr_t *slot = slotBase;
+
+	while ((slot + slotsPerStep) <= slotTop) {
+		__m256i bits = _mm256_loadu_si256((const __m256i *)slot);
+		__m256i low = _mm256_and_si256(bits, lowNibbleMask);
+		__m256i high = _mm256_and_si256(_mm256_srli_epi16(bits, 4), lowNibbleMask);
+		__m256i byteCounts = _mm256_add_epi8(_mm256_shuffle_epi8(lookup, low), _mm256_shuffle_epi8(lookup, high));
+		total = _mm256_add_epi64(total, _mm256_sad_epu8(byteCounts, _mm256_setzero_si256()));
+		slot += slotsPerStep;
+	}
+
+	uint64_t lanes[4];
+	_mm256_storeu_si256((__m256i *)lanes, total);
+	return (uintptr_t)(lanes[0] + lanes[1] + lanes[2] + lanes[3]) + countSetBitsPopcnt(slot, slotTop);
+}
+
+HEAPMAPSCAN_TARGET("avx512f")
+static uintptr_t *
+findNonEmptySlotAVX512(uintptr_t *slotCurrent, uintptr_t *slotTop)
+{
+	const uintptr_t slotsPerStep = sizeof(__m512i) / sizeof(uintptr_t);
+	while ((slotCurrent + slotsPerStep) <= slotTop) {
+		__m512i bits = _mm512_loadu_si512((const void *)slotCurrent);
+		if (0 != _mm512_test_epi64_mask(bits, bits)) {
+			break;
+		}
+		slotCurrent += slotsPerStep;
+	}
+	return findNonEmptySlotScalar(slotCurrent, slotTop);
+}
+
+HEAPMAPSCAN_TARGET("avx512f,avx512bw,avx2,popcnt")
+static uintptr_t
+countSetBitsAVX512(uintptr_t *slotBase, uintptr_t *slotTop)
+{
+	const uintptr_t slotsPerStep = sizeof(__m512i) / sizeof(uintptr_t);
+	const __m512i lookup = _mm512_broadcast_i32x4(_mm_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4));
+	const __m512i lowNibbleMask = _mm512_set1_epi8(0x0f);
+	__m512i total = _mm512_setzero_si512();
+	uintptr_t *slot = slotBase;
+
+	while ((slot + slotsPerStep) <= slotTop) {
+		__m512i bits = _mm512_loadu_si512((const void *)slot);
+		__m512i low = _mm512_and_si512(bits, lowNibbleMask);
+		__m512i high = _mm512_and_si512(_mm512_srli_epi16(bits, 4), lowNibbleMask);
+		__m512i byteCounts = _mm512_add_epi8(_mm512_shuffle_epi8(lookup, low), _mm512_shuffle_epi8(lookup, high));
+		total = _mm512_add_epi64(total, _mm512_sad_epu8(byteCounts, _mm512_setzero_si512()));
+		slot += slotsPerStep;
+	}
+
+	return (uintptr_t)_mm512_reduce_add_epi64(total) + countSetBitsAVX2(slot, slotTop);
+}
+
+#endif /* defined(OMR_ARCH_X86) */
+
+MM_HeapMapScan::Implementation
+MM_HeapMapScan::selectImplementation(OMRPortLibrary *portLibrary)
+{
+	Implementation implementation = SCALAR;
+#if defined(OMR_ARCH_X86)
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	OMRProcessorDesc processorDescription;
+
+	if (0 == omrsysinfo_get_processor_description(&processorDescription)) {
+		if (omrsysinfo_processor_has_feature(&processorDescription, OMR_FEATURE_X86_SSE4_2)
+			&& omrsysinfo_processor_has_feature(&processorDescription, OMR_FEATURE_X86_POPCNT)
+		) {
+			implementation = SSE4_2;
+			if (omrsysinfo_processor_has_feature(&processorDescription, OMR_FEATURE_X86_OSXSAVE)) {
+				/* XMM and YMM state */
+				if (omrsysinfo_processor_has_feature(&processorDescription, OMR_FEATURE_X86_AVX2) && isExtendedStateEnabled(0x6)) {
+					implementation = AVX2;
+					/* additionally opmask and both halves of ZMM state */
+					if (omrsysinfo_processor_has_feature(&processorDescription, OMR_FEATURE_X86_AVX512F)
+						&& omrsysinfo_processor_has_feature(&processorDescription, OMR_FEATURE_X86_AVX512BW)
+						&& isExtendedStateEnabled(0xe6)
+					) {
+						implementation = AVX512;
+					}
+				}
+			}
+		}
+	}
+#endif /* defined(OMR_ARCH_X86) */
+	return implementation;
+}
+
+const char *
+MM_HeapMapScan::getImplementationName(Implementation implementation)
+{
+	switch (implementation) {
+	case SSE4_2:
+		return "sse4.2";
+	case AVX2:
+		return "avx2";
+	case AVX512:
+		return "avx512";
+	default:
+		return "scalar";
+	}
+}
+
+uintptr_t *
+MM_HeapMapScan::findNonEmptySlot(Implementation implementation, uintptr_t *slotCurrent, uintptr_t *slotTop)
+{
+	switch (implementation) {
+#if defined(OMR_ARCH_X86)
+	case SSE4_2:
+		return findNonEmptySlotSSE(slotCurrent, slotTop);
+	case AVX2:
+		return findNonEmptySlotAVX2(slotCurrent, slotTop);
+	case AVX512:
+		return findNonEmptySlotAVX512(slotCurrent, slotTop);
+#endif /* defined(OMR_ARCH_X86) */
+	default:
+		return findNonEmptySlotScalar(slotCurrent, slotTop);
+	}
+}
+
+uintptr_t
+MM_HeapMapScan::countSetBits(Implementation implementation, uintptr_t *slotBase, uintptr_t *slotTop)
+{
+	switch (implementation) {
+#if defined(OMR_ARCH_X86)
+	case SSE4_2:
+		return countSetBitsPopcnt(slotBase, slotTop);
+	case AVX2:
+		return countSetBitsAVX2(slotBase, slotTop);
+	case AVX512:
+		return countSetBitsAVX512(slotBase, slotTop);
+#endif /* defined(OMR_ARCH_X86) */
+	default:
+		return countSetBitsScalar(slotBase, slotTop);
+	}
+}
@@ -0,0 +1,78 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(HEAPMAPSCAN_HPP_)
+#define HEAPMAPSCAN_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "omrport.h"
+
+/**
+ * Bulk scanning primitives over runs of heap map (mark map) slots.
+ * Each primitive has a scalar version and, on x86, vector versions that process 128, 256 or 512 bits per step.
+ * The version is chosen once at startup from the processor features (see selectImplementation()) and all
+ * versions return identical results.
+ * @ingroup GC_Base_Core
+ */
+class MM_HeapMapScan
+{
+public:
+	enum Implementation {
+		SCALAR = 0, /**< one slot per step */
+		SSE4_2, /**< 128 bits per step, hardware population count */
+		AVX2, /**< 256 bits per step */
+		AVX512 /**< 512 bits per step */
+	};
+
+	/**
+	 * Choose the widest implementation supported by both the processor and the operating system.
+	 * @param portLibrary[in] the port library used to query the processor features
+	 * @return the implementation to pass to the scanning primitives
+	 */
+	static Implementation selectImplementation(OMRPortLibrary *portLibrary);
+
+	/**
+	 * @return a printable name of the implementation
+	 */
+	static const char *getImplementationName(Implementation implementation);
+
+	/**
+	 * Find the first non-empty slot in a range of heap map slots.
+	 * @param implementation[in] the implementation to use
+	 * @param slotCurrent[in] first slot of the range
+	 * @param slotTop[in] end of the range (exclusive)
+	 * @return the first non-zero slot in the range, or slotTop if all slots are empty
+	 */
+	static uintptr_t *findNonEmptySlot(Implementation implementation, uintptr_t *slotCurrent, uintptr_t *slotTop);
+
+	/**
+	 * Count the bits set in a range of heap map slots (that is, the number of marked objects it covers).
+	 * @param implementation[in] the implementation to use
+	 * @param slotBase[in] first slot of the range
+	 * @param slotTop[in] end of the range (exclusive)
+	 * @return the number of bits set
+	 */
+	static uintptr_t countSetBits(Implementation implementation, uintptr_t *slotBase, uintptr_t *slotTop);
+};
+
+#endif /* HEAPMAPSCAN_HPP_ */
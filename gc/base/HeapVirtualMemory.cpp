@@ -204,6 +204,20 @@ MM_HeapVirtualMemory::getPageFlags()
 	return memoryManager->getPageFlags(&_vmemHandle);
 }
 
+void
+MM_HeapVirtualMemory::collapseHugePages(MM_EnvironmentBase *env)
+{
+	MM_MemoryManager* memoryManager = env->getExtensions()->memoryManager;
+	memoryManager->collapseHugePages(&_vmemHandle);
+}
+
+bool
+MM_HeapVirtualMemory::getHugePageCoverage(MM_EnvironmentBase *env, uint64_t *hugePageBytes)
+{
+	MM_MemoryManager* memoryManager = env->getExtensions()->memoryManager;
+	return memoryManager->getHugePageCoverage(&_vmemHandle, hugePageBytes);
+}
+
 /**
  * Answer the largest size the heap will ever consume.
  * The value returned represents the difference between the lowest and highest possible address range
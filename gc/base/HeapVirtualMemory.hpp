@@ -54,6 +54,8 @@ public:
 
 	virtual uintptr_t getPageSize();
 	virtual uintptr_t getPageFlags();
+	virtual void collapseHugePages(MM_EnvironmentBase *env);
+	virtual bool getHugePageCoverage(MM_EnvironmentBase *env, uint64_t *hugePageBytes);
 	virtual int getHeapFileDescriptor();
 	virtual void* getHeapBase();
 	virtual void* getHeapTop();
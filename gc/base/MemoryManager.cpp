@@ -75,6 +75,20 @@ MM_MemoryManager::createVirtualMemoryForHeap(MM_EnvironmentBase* env, MM_MemoryH
 
 	uintptr_t allocateSize = size;
 
+	/*
+	 * Virtual memory starts the heap on a huge page boundary whenever the pages it is granted are smaller than
+	 * heapHugePageSize, which the requested pageSize does not tell: a large page request can be granted small pages.
+	 * Pad for the smallest page the reservation can be granted, so that the heap keeps its size for any grant.
+	 */
+	uintptr_t hugePageAlignmentPadding = 0;
+	if (extensions->heapTransparentHugePages) {
+		OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+		uintptr_t smallestPageSize = omrvmem_supported_page_sizes()[0];
+		if (extensions->heapHugePageSize > OMR_MAX(heapAlignment, smallestPageSize)) {
+			hugePageAlignmentPadding = extensions->heapHugePageSize - smallestPageSize;
+		}
+	}
+
 	uintptr_t concurrentScavengerPageSize = 0;
 	if (extensions->isConcurrentScavengerHWSupported()) {
 		OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
@@ -85,14 +99,16 @@ MM_MemoryManager::createVirtualMemoryForHeap(MM_EnvironmentBase* env, MM_MemoryH
 		 * So to guarantee desired heap size over-allocate it by full Concurrent_Scavenger_page_size
 		 */
 		concurrentScavengerPageSize = extensions->getConcurrentScavengerPageSectionSize() * CONCURRENT_SCAVENGER_PAGE_SECTIONS;
-		allocateSize += concurrentScavengerPageSize;
+		allocateSize += concurrentScavengerPageSize + hugePageAlignmentPadding;
 		if (extensions->isDebugConcurrentScavengerPageAlignment()) {
 			omrtty_printf("Requested heap size 0x%zx has been extended to 0x%zx for guaranteed alignment\n", size, allocateSize);
 		}
 	} else {
+		uintptr_t alignmentPadding = 0;
 		if (heapAlignment > pageSize) {
-			allocateSize += (heapAlignment - pageSize);
+			alignmentPadding = heapAlignment - pageSize;
 		}
+		allocateSize += OMR_MAX(alignmentPadding, hugePageAlignmentPadding);
 	}
 
 #if defined(OMR_GC_DOUBLE_MAP_ARRAYLETS)
@@ -614,6 +630,24 @@ MM_MemoryManager::decommitMemory(MM_MemoryHandle* handle, void* address, uintptr
 	return memory->decommitMemory(address, size, lowValidAddress, highValidAddress);
 }
 
+void
+MM_MemoryManager::collapseHugePages(MM_MemoryHandle* handle)
+{
+	Assert_MM_true(NULL != handle);
+	MM_VirtualMemory* memory = handle->getVirtualMemory();
+	Assert_MM_true(NULL != memory);
+	memory->collapseHugePages();
+}
+
+bool
+MM_MemoryManager::getHugePageCoverage(MM_MemoryHandle* handle, uint64_t *hugePageBytes)
+{
+	Assert_MM_true(NULL != handle);
+	MM_VirtualMemory* memory = handle->getVirtualMemory();
+	Assert_MM_true(NULL != memory);
+	return memory->getHugePageCoverage(hugePageBytes);
+}
+
 bool
 MM_MemoryManager::isLargePage(MM_EnvironmentBase* env, uintptr_t pageSize)
 {
@@ -234,6 +234,22 @@ public:
 	 */
 	bool decommitMemory(MM_MemoryHandle* handle, void* address, uintptr_t size, void* lowValidAddress, void* highValidAddress);
 
+	/**
+	 * Collapse the populated memory of specified virtual memory instance into transparent huge pages
+	 *
+	 * @param pointer to memory handle
+	 */
+	void collapseHugePages(MM_MemoryHandle* handle);
+
+	/**
+	 * Find how much memory of specified virtual memory instance is backed by transparent huge pages
+	 *
+	 * @param pointer to memory handle
+	 * @param[out] hugePageBytes number of bytes backed by huge pages
+	 * @return true if succeed
+	 */
+	bool getHugePageCoverage(MM_MemoryHandle* handle, uint64_t *hugePageBytes);
+
 #if defined(OMR_GC_VLHGC) || defined(OMR_GC_MODRON_SCAVENGER)
 	/*
 	 * Set the NUMA affinity for the specified range within the receiver.
@@ -157,6 +157,9 @@ MM_MemoryPoolAddressOrderedList::initialize(MM_EnvironmentBase *env)
 	}
 	_hintInactive = previousInactiveHint;
 
+	_sizeClassIndexEnabled = ext->freeListSizeClassIndex;
+	clearSizeClassIndex();
+
 	return true;
 }
 
@@ -231,6 +234,8 @@ MM_MemoryPoolAddressOrderedList::clearHints()
 	_hintInactive = inactiveHint;
 	_hintActive = NULL;
 	_hintLru = 1;
+
+	clearSizeClassIndex();
 }
 
 MMINLINE void
@@ -391,6 +396,9 @@ MM_MemoryPoolAddressOrderedList::removeHint(MM_HeapLinkedFreeHeader *freeEntry)
 			hint = hint->next;
 		}
 	}
+
+	/* The previous free entry is not known here, so affected size classes fall back to the head of the list */
+	replaceSizeClassIndexEntry(freeEntry, NULL);
 }
 
 MMINLINE void
@@ -411,6 +419,8 @@ MM_MemoryPoolAddressOrderedList::updateHint(MM_HeapLinkedFreeHeader *oldFreeEntr
 			hint = hint->next;
 		}
 	}
+
+	replaceSizeClassIndexEntry(oldFreeEntry, newFreeEntry);
 }
 
 /**
@@ -431,6 +441,97 @@ MM_MemoryPoolAddressOrderedList::updateHintsBeyondEntry(MM_HeapLinkedFreeHeader
 		/* Move to the next hint */
 		hint = hint->next;
 	}
+
+	updateSizeClassIndexBeyondEntry(freeEntry);
+}
+
+/****************************************
+ * Size Class Index Functionality
+ ****************************************
+ */
+
+/**
+ * Reset every size class to search from the head of the free list.
+ */
+void
+MM_MemoryPoolAddressOrderedList::clearSizeClassIndex()
+{
+	memset(_sizeClassIndex, 0, sizeof(_sizeClassIndex));
+}
+
+/**
+ * Find the free entry after which a search for the given size should start.
+ * All free entries before the returned entry are known to be smaller than the lookup size; the returned
+ * entry itself is not, and is only suitable as the previous entry of the search.
+ * @return the free entry to start searching after, or NULL if the search must start at the head of the list
+ */
+MMINLINE MM_HeapLinkedFreeHeader *
+MM_MemoryPoolAddressOrderedList::findSizeClassIndexEntry(uintptr_t lookupSize)
+{
+	uintptr_t sizeClass = MM_Math::floorLog2(lookupSize);
+	MM_HeapLinkedFreeHeader *freeEntry = _sizeClassIndex[sizeClass];
+
+	/* TLH allocates consume the head of the list without maintaining the index - entries below the head are stale */
+	if ((NULL != freeEntry) && ((NULL == _heapFreeList) || (freeEntry < _heapFreeList))) {
+		_sizeClassIndex[sizeClass] = NULL;
+		freeEntry = NULL;
+	}
+
+	return freeEntry;
+}
+
+/**
+ * Replace all references to a free entry that has moved or left the free list.
+ * @param oldFreeEntry the free entry that has moved or left the list
+ * @param newFreeEntry the replacement, which must not be preceded by any entry larger than oldFreeEntry was (NULL - search from the head)
+ */
+MMINLINE void
+MM_MemoryPoolAddressOrderedList::replaceSizeClassIndexEntry(MM_HeapLinkedFreeHeader *oldFreeEntry, MM_HeapLinkedFreeHeader *newFreeEntry)
+{
+	for (uintptr_t sizeClass = 0; sizeClass < FREE_LIST_SIZE_CLASS_INDEX_COUNT; sizeClass++) {
+		if (oldFreeEntry == _sizeClassIndex[sizeClass]) {
+			_sizeClassIndex[sizeClass] = newFreeEntry;
+		}
+	}
+}
+
+/**
+ * Update all size classes to start searching no further than the given free entry.
+ * Used when free entries are added to the middle of the free list.
+ */
+void
+MM_MemoryPoolAddressOrderedList::updateSizeClassIndexBeyondEntry(MM_HeapLinkedFreeHeader *freeEntry)
+{
+	for (uintptr_t sizeClass = 0; sizeClass < FREE_LIST_SIZE_CLASS_INDEX_COUNT; sizeClass++) {
+		if (_sizeClassIndex[sizeClass] > freeEntry) {
+			_sizeClassIndex[sizeClass] = freeEntry;
+		}
+	}
+}
+
+/**
+ * Move the start of every size class that is strictly larger than the given size up to the given free entry.
+ * @param freeEntry a free entry linked into the free list
+ * @param largestFreeEntrySize upper bound on the size of freeEntry and every free entry before it
+ */
+MMINLINE void
+MM_MemoryPoolAddressOrderedList::advanceSizeClassIndex(MM_HeapLinkedFreeHeader *freeEntry, uintptr_t largestFreeEntrySize)
+{
+	uintptr_t sizeClass = (0 == largestFreeEntrySize) ? 0 : (MM_Math::floorLog2(largestFreeEntrySize) + 1);
+
+	for (; sizeClass < FREE_LIST_SIZE_CLASS_INDEX_COUNT; sizeClass++) {
+		if (_sizeClassIndex[sizeClass] < freeEntry) {
+			_sizeClassIndex[sizeClass] = freeEntry;
+		}
+	}
+}
+
+void
+MM_MemoryPoolAddressOrderedList::updateSizeClassIndex(MM_HeapLinkedFreeHeader *freeEntry, uintptr_t largestFreeEntrySize)
+{
+	if (_sizeClassIndexEnabled) {
+		advanceSizeClassIndex(freeEntry, largestFreeEntrySize);
+	}
 }
 
 /****************************************
@@ -446,6 +547,8 @@ MM_MemoryPoolAddressOrderedList::internalAllocate(MM_EnvironmentBase *env, uintp
 	uintptr_t recycleEntrySize;
 	uintptr_t walkCount;
 	J9ModronAllocateHint *allocateHintUsed;
+	bool sizeClassIndexUsed;
+	bool useSizeClassIndex = _sizeClassIndexEnabled;
 	void *addrBase;
 	uintptr_t largestFreeEntry = 0;
 	
@@ -453,14 +556,12 @@ MM_MemoryPoolAddressOrderedList::internalAllocate(MM_EnvironmentBase *env, uintp
 		_heapLock.acquire();
 	}
 
-#if defined(OMR_GC_CONCURRENT_SWEEP)
 retry:
-#endif /* OMR_GC_CONCURRENT_SWEEP */
-
 	currentFreeEntry = _heapFreeList;
 	previousFreeEntry = NULL;
 	walkCount = 0;
 	allocateHintUsed = NULL;
+	sizeClassIndexUsed = false;
 	candidateHintSize = 0;
 
 	/* Large object - use a hint if it is available */
@@ -470,6 +571,21 @@ retry:
 		candidateHintSize = allocateHintUsed->size;
 	}
 
+	/* Skip further ahead if the size class index knows of a later starting point than the hint */
+	if (useSizeClassIndex) {
+		MM_HeapLinkedFreeHeader *sizeClassEntry = findSizeClassIndexEntry(sizeInBytesRequired);
+		if ((NULL != sizeClassEntry) && (sizeClassEntry >= currentFreeEntry) && !doesNeedCardAlignment(env, sizeClassEntry)) {
+			previousFreeEntry = sizeClassEntry;
+			currentFreeEntry = sizeClassEntry->getNext(compressed);
+			/* Every entry skipped is smaller than the lower bound of the size class */
+			uintptr_t skippedSizeBound = ((uintptr_t)1 << MM_Math::floorLog2(sizeInBytesRequired)) - 1;
+			if (candidateHintSize < skippedSizeBound) {
+				candidateHintSize = skippedSizeBound;
+			}
+			sizeClassIndexUsed = true;
+		}
+	}
+
 
 	while(currentFreeEntry) {
 		if (doesNeedCardAlignment(env, currentFreeEntry)) {
@@ -504,6 +620,12 @@ retry:
 
 	/* Check if an entry was found */
 	if(!currentFreeEntry) {
+		if (sizeClassIndexUsed) {
+			/* The index is conservative but can miss entries that grew in place - search the whole list before giving up */
+			clearSizeClassIndex();
+			useSizeClassIndex = false;
+			goto retry;
+		}
 #if defined(OMR_GC_CONCURRENT_SWEEP)
 		if(_memorySubSpace->replenishPoolForAllocate(env, this, sizeInBytesRequired)) {
 			goto retry;
@@ -516,6 +638,10 @@ retry:
 	if((walkCount >= J9MODRON_ALLOCATION_MANAGER_HINT_MAX_WALK) || ((walkCount > 1) && allocateHintUsed)) {
 		addHint(previousFreeEntry, candidateHintSize);
 	}
+	if (_sizeClassIndexEnabled && (walkCount > 0)) {
+		/* Everything up to the previous entry is no larger than the largest entry walked, so larger size classes can start there */
+		advanceSizeClassIndex(previousFreeEntry, candidateHintSize);
+	}
 
 	/* Adjust the free memory size */
 	_freeMemorySize -= sizeInBytesRequired;
@@ -923,6 +1049,9 @@ MM_MemoryPoolAddressOrderedList::expandWithRange(MM_EnvironmentBase *env, uintpt
 		return ;
 	}
 
+	/* Entries may be inserted or coalesced anywhere in the list */
+	clearSizeClassIndex();
+
 	/* Find the free entries in the list the appear before/after the range being added */
 	previousFreeEntry = NULL;
 	nextFreeEntry = _heapFreeList;
@@ -1029,6 +1158,9 @@ MM_MemoryPoolAddressOrderedList::contractWithRange(MM_EnvironmentBase *env, uint
 		return NULL;
 	}
 
+	/* The contracted entry may be split or leave the list */
+	clearSizeClassIndex();
+
 	/* Find the free entry that encompasses the range to contract */
 	/* TODO: Could we use hints to find a better starting address?  Are hints still valid? */
 	previousFreeEntry = NULL;
@@ -1122,6 +1254,9 @@ MM_MemoryPoolAddressOrderedList::addFreeEntries(MM_EnvironmentBase *env,
 		currentFreeEntry = currentFreeEntry->getNext(compressed);
 	}
 
+	/* Entries may be inserted or coalesced anywhere in the list */
+	clearSizeClassIndex();
+
 	/* Find the first free entry, if any, within specified range */
 	MM_HeapLinkedFreeHeader *previousFreeEntry = NULL;
 	currentFreeEntry = _heapFreeList;
@@ -1215,6 +1350,9 @@ MM_MemoryPoolAddressOrderedList::removeFreeEntriesWithinRange(MM_EnvironmentBase
 	retListMemoryCount = 0;
 	retListMemorySize = 0;
 
+	/* Entries within the range leave the list */
+	clearSizeClassIndex();
+
 	/* Find the first free entry, if any, within specified range */
 	previousFreeEntry = NULL;
 	currentFreeEntry = _heapFreeList;
@@ -1587,6 +1725,9 @@ MM_MemoryPoolAddressOrderedList::moveHeap(MM_EnvironmentBase *env, void *srcBase
 	bool const compressed = compressObjectReferences();
 	MM_HeapLinkedFreeHeader *currentFreeEntry, *previousFreeEntry;
 
+	/* Free entries within the range change address */
+	clearSizeClassIndex();
+
 	previousFreeEntry = NULL;
 	currentFreeEntry = _heapFreeList;
 	while(currentFreeEntry) {
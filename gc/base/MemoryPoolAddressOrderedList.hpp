@@ -41,6 +41,9 @@ class MM_ConcurrentSweepScheme;
 
 #define FREE_ENTRY_END ((MM_HeapLinkedFreeHeader *)OMRPORT_VMEM_MAX_ADDRESS)
 
+/* One size class per power of two free entry size */
+#define FREE_LIST_SIZE_CLASS_INDEX_COUNT (sizeof(uintptr_t) * 8)
+
 /**
  * @todo Provide class documentation
  * @ingroup GC_Base_Core
@@ -60,6 +63,10 @@ private:
 	struct J9ModronAllocateHint* _hintInactive;
 	struct J9ModronAllocateHint _hintStorage[HINT_ELEMENT_COUNT];
 	uintptr_t _hintLru;
+
+	/* Size class index support */
+	MM_HeapLinkedFreeHeader *_sizeClassIndex[FREE_LIST_SIZE_CLASS_INDEX_COUNT]; /**< for size class n, a free entry such that all entries before it are smaller than 2^n (NULL - search from the head of the list) */
+	bool _sizeClassIndexEnabled; /**< true if the size class index is used to skip ahead on large allocates */
 	
 	MM_LargeObjectAllocateStats *_largeObjectCollectorAllocateStats;  /**< Same as _largeObjectAllocateStats except specifically for collector allocates */
 
@@ -81,6 +88,11 @@ private:
 	void updateHint(MM_HeapLinkedFreeHeader *oldFreeEntry, MM_HeapLinkedFreeHeader *newFreeEntry);
 	void clearHints();
 	void updateHintsBeyondEntry(MM_HeapLinkedFreeHeader *freeEntry);
+	void clearSizeClassIndex();
+	MM_HeapLinkedFreeHeader *findSizeClassIndexEntry(uintptr_t lookupSize);
+	void replaceSizeClassIndexEntry(MM_HeapLinkedFreeHeader *oldFreeEntry, MM_HeapLinkedFreeHeader *newFreeEntry);
+	void updateSizeClassIndexBeyondEntry(MM_HeapLinkedFreeHeader *freeEntry);
+	void advanceSizeClassIndex(MM_HeapLinkedFreeHeader *freeEntry, uintptr_t largestFreeEntrySize);
 	void *internalAllocate(MM_EnvironmentBase *env, uintptr_t sizeInBytesRequired, bool lockingRequired, MM_LargeObjectAllocateStats *largeObjectAllocateStats);
 	bool internalAllocateTLH(MM_EnvironmentBase *env, uintptr_t maximumSizeInBytesRequired, void * &addrBase, void * &addrTop, bool lockingRequired, MM_LargeObjectAllocateStats *largeObjectAllocateStats);
 	uintptr_t getConsumedSizeForTLH(MM_EnvironmentBase *env, MM_HeapLinkedFreeHeader *freeEntry, uintptr_t maximumSizeInBytesRequired);
@@ -175,6 +187,8 @@ public:
 	
 	virtual void appendCollectorLargeAllocateStats();
 
+	virtual void updateSizeClassIndex(MM_HeapLinkedFreeHeader *freeEntry, uintptr_t largestFreeEntrySize);
+
 	virtual void mergeFreeEntryAllocateStats() {_largeObjectAllocateStats->getFreeEntrySizeClassStats()->mergeCountForVeryLargeEntries();}
 	
 	virtual bool initializeSweepPool(MM_EnvironmentBase *env);
@@ -253,6 +267,7 @@ public:
 	MM_MemoryPoolAddressOrderedList(MM_EnvironmentBase *env, uintptr_t minimumFreeEntrySize) :
 		MM_MemoryPoolAddressOrderedListBase(env, minimumFreeEntrySize)
 		,_heapFreeList(NULL)
+		,_sizeClassIndexEnabled(false)
 		,_largeObjectCollectorAllocateStats(NULL)
 		,_firstCardUnalignedFreeEntry(FREE_ENTRY_END)
 		,_prevCardUnalignedFreeEntry(FREE_ENTRY_END)
@@ -265,6 +280,7 @@ public:
 	MM_MemoryPoolAddressOrderedList(MM_EnvironmentBase *env, uintptr_t minimumFreeEntrySize, const char *name) :
 		MM_MemoryPoolAddressOrderedListBase(env, minimumFreeEntrySize, name)
 		,_heapFreeList(NULL)
+		,_sizeClassIndexEnabled(false)
 		,_largeObjectCollectorAllocateStats(NULL)
 		,_firstCardUnalignedFreeEntry(FREE_ENTRY_END)
 		,_prevCardUnalignedFreeEntry(FREE_ENTRY_END)
@@ -233,6 +233,15 @@ public:
 	}
 
 	uintptr_t releaseFreeEntryMemoryPages(MM_EnvironmentBase* env, MM_HeapLinkedFreeHeader* freeEntry);
+
+	/**
+	 * Note that every free entry up to and including the given one is no larger than the given size.
+	 * Called by the sweep as free entries are connected in address order; pools that index their free list by size class use it to seed the index.
+	 * @param freeEntry a free entry linked into the free list
+	 * @param largestFreeEntrySize upper bound on the size of freeEntry and every free entry before it
+	 */
+	virtual void updateSizeClassIndex(MM_HeapLinkedFreeHeader *freeEntry, uintptr_t largestFreeEntrySize) {}
+
 	/**
 	 * Create a MemoryPoolAddressOrderedList object.
 	 */
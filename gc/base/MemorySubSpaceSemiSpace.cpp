@@ -911,6 +911,15 @@ MM_MemorySubSpaceSemiSpace::checkSubSpaceMemoryPostCollectResize(MM_EnvironmentB
 			}
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
 
+			/* Size for the load forecast for the next scavenge rather than the one just observed */
+			double loadFactor = extensions->heap->getResizePredictor()->getScavengeLoadFactor();
+			if (1.0 != loadFactor) {
+				timeRatio = timeRatio * loadFactor;
+				if (debug) {
+					omrtty_printf("\tPredicted ratio:%lf (load factor %lf)\n", timeRatio, loadFactor);
+				}
+			}
+
 			if (debug) {
 				omrtty_printf("\tAverage scavenge time ratio: %lf -> ", _averageScavengeTimeRatio);
 			}
@@ -399,6 +399,13 @@ MM_MemorySubSpaceUniSpace::calculateTargetContractSize(MM_EnvironmentBase *env,
 							
 				Trc_MM_MemorySubSpaceUniSpace_calculateTargetContractSize_Event1(env->getLanguageVMThread(), contractionSize);
 				
+				/* Keep the free space the next cycle is predicted to consume */
+				uintptr_t predictedFree = getPredictedFreeDemand(env);
+				if (0 != predictedFree) {
+					uintptr_t contractableFree = (currentFree > predictedFree) ? (currentFree - predictedFree) : 0;
+					contractionSize = OMR_MIN(contractionSize, contractableFree);
+				}
+
 				/* But we don't contract too quickly or by a trivial amount */	
 				uintptr_t maxContract = (uintptr_t)(currentHeapSize * _extensions->globalMaximumContraction);
 				uintptr_t minContract = (uintptr_t)(currentHeapSize * _extensions->globalMinimumContraction);
@@ -491,6 +498,16 @@ MM_MemorySubSpaceUniSpace::calculateExpandSize(MM_EnvironmentBase *env, uintptr_
 		}	
 	}
 
+	/* Expand ahead of the tenure consumption predicted for the next cycle */
+	uintptr_t predictedFree = getPredictedFreeDemand(env);
+	if (predictedFree > currentFree) {
+		uintptr_t predictedExpandSize = MM_Math::roundToCeiling(_extensions->heapAlignment, predictedFree - currentFree);
+		if (predictedExpandSize > expandSize) {
+			expandSize = predictedExpandSize;
+			_extensions->heap->getResizeStats()->setLastExpandReason(PREDICTED_DEMAND);
+		}
+	}
+
 	if (expandToSatisfy) {
 		/* 
 		 * TO DO - If the last free chunk abuts the end of the heap we only need
@@ -735,3 +752,23 @@ MM_MemorySubSpaceUniSpace::getHeapFreeMinimumHeuristicMultiplier(MM_EnvironmentB
 	return freeMinMultiplier;
 }
 
+/**
+ * Determine how much free space the tenure consumption predicted before the next global collection requires.
+ * The prediction is capped at the -Xmaxf amount for the current heap size.
+ * @return the predicted free bytes required, or 0 if there is no prediction
+ */
+uintptr_t
+MM_MemorySubSpaceUniSpace::getPredictedFreeDemand(MM_EnvironmentBase *env)
+{
+	uintptr_t predictedFree = _extensions->heap->getResizePredictor()->getTenureDemand();
+
+	if (0 != predictedFree) {
+		uintptr_t heapFreeMaximumHeuristicMultiplier = getHeapFreeMaximumHeuristicMultiplier(env);
+		if (heapFreeMaximumHeuristicMultiplier < 100) {
+			uintptr_t maxFree = (uintptr_t)(getActiveMemorySize() * heapFreeMaximumHeuristicMultiplier / _extensions->heapFreeMaximumRatioDivisor);
+			predictedFree = OMR_MIN(predictedFree, maxFree);
+		}
+	}
+
+	return predictedFree;
+}
@@ -54,6 +54,7 @@ protected:
 	uintptr_t performContract(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription);
 	uintptr_t getHeapFreeMaximumHeuristicMultiplier(MM_EnvironmentBase *env);
 	uintptr_t getHeapFreeMinimumHeuristicMultiplier(MM_EnvironmentBase *env);
+	uintptr_t getPredictedFreeDemand(MM_EnvironmentBase *env);
 
 public:
 	virtual void checkResize(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription = NULL, bool _systemGC = false);
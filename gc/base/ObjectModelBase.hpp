@@ -828,6 +828,19 @@ public:
 		return _delegate.isIndexable(forwardedHeader);
 	}
 
+	/**
+	 * Returns a key identifying the shape of an object. Objects with the same key have their reference
+	 * slots at the same offsets. Used by the scavenger to learn hot fields (scavengerHotFieldLearning enabled).
+	 *
+	 * @param objectPtr pointer to the object
+	 * @return the shape key of the object, or 0 if hot fields should not be learned for the object
+	 */
+	MMINLINE uintptr_t
+	getObjectShapeKey(omrobjectptr_t objectPtr)
+	{
+		return _delegate.getObjectShapeKey(objectPtr);
+	}
+
 	/**
 	 * Return true if the object holds references to heap objects not reachable from reference graph. For
 	 * example, an object may be associated with a class and the class may have associated meta-objects
@@ -45,6 +45,7 @@ private:
 	uintptr_t *_topPtr;
 	uintptr_t *_currentPtr;
 	uintptr_t _sublistIndex;
+	uintptr_t _packetIndex; /**< index of the packet in the work packets directory, used to link packets in lock-free packet lists */
 	MM_EnvironmentBase *_owner;
 protected:
 public:
@@ -212,6 +213,7 @@ public:
 		_topPtr(NULL),
 		_currentPtr(NULL),
 		_sublistIndex(0),
+		_packetIndex(0),
 		_owner(NULL),
 		_next(NULL),
 		_previous(NULL)
@@ -28,11 +28,12 @@
 #include "PacketList.hpp"
 
 bool 
-MM_PacketList::initialize(MM_EnvironmentBase *env)
+MM_PacketList::initialize(MM_EnvironmentBase *env, MM_Packet * const *packetDirectory)
 {
 	MM_GCExtensionsBase *extensions = env->getExtensions();
 	bool result = true;
 	
+	_packetDirectory = packetDirectory;
 	_sublistCount = extensions->packetListSplit;
 	Assert_MM_true(0 < _sublistCount);
 
@@ -66,6 +67,23 @@ MM_PacketList::tearDown(MM_EnvironmentBase *env)
 	}
 }
 
+MM_Packet *
+MM_PacketList::detachLockFree(PacketSublist *list)
+{
+	uint64_t oldTaggedHead = list->_taggedHead;
+
+	while (0 != (uint32_t)oldTaggedHead) {
+		uint64_t observedTaggedHead = MM_AtomicOperations::lockCompareExchangeU64(&list->_taggedHead, oldTaggedHead, nextTaggedHead(oldTaggedHead, NULL));
+		if (observedTaggedHead == oldTaggedHead) {
+			MM_AtomicOperations::readBarrier();
+			return packetFromTaggedHead(oldTaggedHead);
+		}
+		oldTaggedHead = observedTaggedHead;
+	}
+
+	return NULL;
+}
+
 void 
 MM_PacketList::pushList(MM_Packet *head, MM_Packet *tail, uintptr_t count)
 {
@@ -73,6 +91,22 @@ MM_PacketList::pushList(MM_Packet *head, MM_Packet *tail, uintptr_t count)
 	PacketSublist *list = &_sublists[0];
 	MM_Packet *current = head;
 	uintptr_t i;
+
+	if (NULL != _packetDirectory) {
+		for (i = 0; i < count; ++i) {
+			current->setSublistIndex(0);
+			current = current->_next;
+		}
+
+		uint64_t oldTaggedHead = 0;
+		MM_AtomicOperations::add(&_count, count);
+		do {
+			oldTaggedHead = list->_taggedHead;
+			tail->_next = packetFromTaggedHead(oldTaggedHead);
+			MM_AtomicOperations::writeBarrier();
+		} while (oldTaggedHead != MM_AtomicOperations::lockCompareExchangeU64(&list->_taggedHead, oldTaggedHead, nextTaggedHead(oldTaggedHead, head)));
+		return;
+	}
 	
 	list->_lock.acquire();
 	
@@ -101,6 +135,28 @@ MM_PacketList::popList(MM_Packet **head, MM_Packet **tail, uintptr_t *count)
 	*head = NULL;
 	*tail = NULL;
 	*count = 0;
+
+	if (NULL != _packetDirectory) {
+		/* detach each sublist in turn; packets pushed meanwhile are simply left for the next pop */
+		for (uintptr_t i = 0; i < _sublistCount; i++) {
+			MM_Packet *packet = detachLockFree(&_sublists[i]);
+			if (NULL != packet) {
+				didPop = true;
+				if (NULL == *head) {
+					*head = packet;
+				} else {
+					(*tail)->_next = packet;
+				}
+				while (NULL != packet) {
+					*tail = packet;
+					*count += 1;
+					packet = packet->_next;
+				}
+			}
+		}
+		MM_AtomicOperations::subtract(&_count, *count);
+		return didPop;
+	}
 	
 	/* acquire all of our locks */
 	for (uintptr_t i = 0; i < _sublistCount; i++) {
@@ -146,6 +202,9 @@ MM_PacketList::remove(MM_Packet *packetToRemove)
 	PacketSublist *list = &_sublists[packetToRemove->getSublistIndex()];
 	MM_Packet *previous = NULL;
 	MM_Packet *next = NULL;
+
+	/* a packet can only be unlinked from the middle of a lock protected list */
+	Assert_MM_true(NULL == _packetDirectory);
 	
 	list->_lock.acquire();
 	
@@ -188,7 +247,11 @@ MM_PacketList::getHead()
 	
 	if (popList(&head, &tail, &count)) {
 		pushList(head, tail, count);
-		result = _sublists[0]._head;
+		if (NULL != _packetDirectory) {
+			result = packetFromTaggedHead(_sublists[0]._taggedHead);
+		} else {
+			result = _sublists[0]._head;
+		}
 	}
 
 	return result;
@@ -49,6 +49,7 @@ public:
 		MM_Packet * _head;  /**< Head of the list */
 		MM_Packet * _tail;  /**< Tail of the list */
 		MM_LightweightNonReentrantLock _lock;  /**< Lock for getting/putting packets */
+		volatile uint64_t _taggedHead; /**< Head of the list in lock-free mode: modification tag in the high 32 bits, directory index + 1 of the head packet (0 if empty) in the low 32 bits */
 
 		bool
 		initialize(MM_EnvironmentBase *env)
@@ -62,6 +63,7 @@ public:
 		PacketSublist()
 			: _head(NULL)
 			, _tail(NULL)
+			, _taggedHead(0)
 		{
 		}
 	};
@@ -73,6 +75,7 @@ private:
 	
 	uintptr_t _sublistCount; /**< the number of lists (split for parallelism). Must be at least 1 */
 	volatile uintptr_t _count;  /**< Number of items in the list */
+	MM_Packet * const *_packetDirectory; /**< directory of all packets indexed by MM_Packet::_packetIndex, non-NULL if the list is lock-free */
 	
 /* Functionality Section */
 private:
@@ -121,12 +124,103 @@ private:
 	{
 		return env->getEnvironmentId() % _sublistCount;
 	}
+
+	/**
+	 * Build the next value of a lock-free sublist head. The tag is bumped on every update so that
+	 * a compare and swap against a head that was popped and pushed back in the meantime fails (ABA).
+	 *
+	 * @param oldTaggedHead the current value of the sublist head
+	 * @param packet the packet to become the head, or NULL if the sublist becomes empty
+	 *
+	 * @return the new value of the sublist head
+	 */
+	MMINLINE static uint64_t
+	nextTaggedHead(uint64_t oldTaggedHead, MM_Packet *packet)
+	{
+		uint64_t tag = (oldTaggedHead >> 32) + 1;
+		uint64_t index = (NULL == packet) ? 0 : ((uint64_t)packet->_packetIndex + 1);
+		return (tag << 32) | index;
+	}
+
+	/**
+	 * Decode the packet at the head of a lock-free sublist.
+	 *
+	 * @param taggedHead a value of the sublist head
+	 *
+	 * @return the head packet, or NULL if the sublist is empty
+	 */
+	MMINLINE MM_Packet *
+	packetFromTaggedHead(uint64_t taggedHead)
+	{
+		uint32_t index = (uint32_t)taggedHead;
+		return (0 == index) ? NULL : _packetDirectory[index - 1];
+	}
+
+	/**
+	 * Lock-free variant of push().
+	 */
+	MMINLINE void
+	pushLockFree(PacketSublist *list, MM_Packet *packet)
+	{
+		uint64_t oldTaggedHead = 0;
+
+		/* count before publishing, so a concurrent pop never drives the count below zero */
+		MM_AtomicOperations::add(&_count, 1);
+		do {
+			oldTaggedHead = list->_taggedHead;
+			packet->_next = packetFromTaggedHead(oldTaggedHead);
+			/* packet contents and link must be visible before the packet is */
+			MM_AtomicOperations::writeBarrier();
+		} while (oldTaggedHead != MM_AtomicOperations::lockCompareExchangeU64(&list->_taggedHead, oldTaggedHead, nextTaggedHead(oldTaggedHead, packet)));
+	}
+
+	/**
+	 * Lock-free variant of popping from a single sublist.
+	 *
+	 * @return the packet, or NULL if the sublist is empty
+	 */
+	MMINLINE MM_Packet *
+	popLockFree(PacketSublist *list)
+	{
+		uint64_t oldTaggedHead = list->_taggedHead;
+
+		while (0 != (uint32_t)oldTaggedHead) {
+			MM_Packet *packet = packetFromTaggedHead(oldTaggedHead);
+			/* _next may be stale if the packet was popped meanwhile, in which case the tag has moved on and the exchange fails */
+			uint64_t newTaggedHead = nextTaggedHead(oldTaggedHead, packet->_next);
+			uint64_t observedTaggedHead = MM_AtomicOperations::lockCompareExchangeU64(&list->_taggedHead, oldTaggedHead, newTaggedHead);
+			if (observedTaggedHead == oldTaggedHead) {
+				MM_AtomicOperations::readBarrier();
+				MM_AtomicOperations::subtract(&_count, 1);
+				return packet;
+			}
+			oldTaggedHead = observedTaggedHead;
+		}
+
+		return NULL;
+	}
+
+	/**
+	 * Atomically detach the whole chain of a lock-free sublist.
+	 *
+	 * @return the first packet of the detached chain (linked by _next), or NULL if the sublist is empty
+	 */
+	MM_Packet *detachLockFree(PacketSublist *list);
 		
 protected:
 	
 public:
 	
-	bool initialize(MM_EnvironmentBase *env);
+	/**
+	 * Initialize the packet list.
+	 *
+	 * @param env the current environment
+	 * @param packetDirectory if non-NULL, the list is lock-free and links packets through this directory
+	 * (indexed by MM_Packet::_packetIndex); remove() is not supported on a lock-free list
+	 *
+	 * @return true on success, false otherwise
+	 */
+	bool initialize(MM_EnvironmentBase *env, MM_Packet * const *packetDirectory = NULL);
 	void tearDown(MM_EnvironmentBase *env) ;
 	
 	/**
@@ -162,21 +256,27 @@ public:
 	{
 		uintptr_t index = getSublistIndex(env);
 		PacketSublist *list = &_sublists[index];
-	
-		list->_lock.acquire();
 
-		packet->_next = list->_head;
-		packet->_previous = NULL;
-		packet->setSublistIndex(index);
-		if (NULL == list->_head) {
-			list->_tail = packet;
+		if (NULL != _packetDirectory) {
+			packet->_previous = NULL;
+			packet->setSublistIndex(index);
+			pushLockFree(list, packet);
 		} else {
-			list->_head->_previous = packet;
+			list->_lock.acquire();
+
+			packet->_next = list->_head;
+			packet->_previous = NULL;
+			packet->setSublistIndex(index);
+			if (NULL == list->_head) {
+				list->_tail = packet;
+			} else {
+				list->_head->_previous = packet;
+			}
+			list->_head = packet;
+			incrementCount(1);
+
+			list->_lock.release();
 		}
-		list->_head = packet;
-		incrementCount(1);
-		
-		list->_lock.release();
 	}
 	
 	/**
@@ -192,7 +292,12 @@ public:
 		for (uintptr_t i = 0; i < _sublistCount; i++) {
 			PacketSublist *list = &_sublists[index];
 
-			if (NULL != list->_head) {
+			if (NULL != _packetDirectory) {
+				packet = popLockFree(list);
+				if (NULL != packet) {
+					break;
+				}
+			} else if (NULL != list->_head) {
 				list->_lock.acquire();
 				if (NULL != list->_head) {
 					packet = list->_head;
@@ -254,6 +359,7 @@ public:
 		,_sublists(NULL)
 		,_sublistCount(0)
 		,_count(0)
+		,_packetDirectory(NULL)
 	{
 		_typeId = __FUNCTION__;
 	}
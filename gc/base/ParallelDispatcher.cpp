@@ -241,6 +241,10 @@ MM_ParallelDispatcher::kill(MM_EnvironmentBase *env)
 		forge->free(_taskTable);
 		_taskTable = NULL;
 	}
+	if(_threadSampleTable) {
+		forge->free(_threadSampleTable);
+		_threadSampleTable = NULL;
+	}
 	if(_statusTable) {
 		forge->free(_statusTable);
 		_statusTable = NULL;
@@ -286,6 +290,12 @@ MM_ParallelDispatcher::initialize(MM_EnvironmentBase *env)
 	}
 	memset(_taskTable, 0, _threadCountMaximum * sizeof(MM_Task *));
 
+	_threadSampleTable = (MM_DispatcherThreadSample *)forge->allocate(_threadCountMaximum * sizeof(MM_DispatcherThreadSample), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if(!_threadSampleTable) {
+		goto error_no_memory;
+	}
+	memset(_threadSampleTable, 0, _threadCountMaximum * sizeof(MM_DispatcherThreadSample));
+
 	return true;
 
 error_no_memory:
@@ -473,6 +483,15 @@ MM_ParallelDispatcher::recomputeActiveThreadCountForTask(MM_EnvironmentBase *env
 		_activeThreadCount = taskActiveThreadCount;
 
 		Trc_MM_ParallelDispatcher_recomputeActiveThreadCountForTask_useCollectorRecommendedThreads(task->getRecommendedWorkingThreads(), taskActiveThreadCount);
+	} else if (_extensions->dispatcherAdaptiveThreadingEnabled() && !_extensions->isMetronomeGC()) {
+		/* No collector recommendation - size the task from how well the threads were utilized
+		 * the last time a task of the same type ran. The history only ever lowers the count.
+		 */
+		MM_DispatcherTaskHistory *history = findTaskHistory(task->getBaseVirtualTypeId(), false);
+		if ((NULL != history) && (history->recommendedThreads < taskActiveThreadCount)) {
+			taskActiveThreadCount = history->recommendedThreads;
+			Trc_MM_ParallelDispatcher_recomputeActiveThreadCountForTask_useUtilizationHistory(history->utilization, history->stealSuccess, taskActiveThreadCount);
+		}
 	}
 
 	task->setThreadCount(taskActiveThreadCount);
@@ -501,6 +520,8 @@ MM_ParallelDispatcher::adjustThreadCount(uintptr_t maxThreadCount)
 		OMRPORT_ACCESS_FROM_OMRVM(_extensions->getOmrVM());
 		/* No, use the current active CPU count (unless it would overflow our threadtables) */
 		uintptr_t activeCPUs = omrsysinfo_get_number_CPUs_by_type(OMRPORT_CPU_TARGET);
+		/* The target CPU count includes any cgroup CPU quota, so it is re-read here on every dispatch */
+		_cpuLimit = activeCPUs;
 		if (activeCPUs < toReturn) {
 			Trc_MM_ParallelDispatcher_adjustThreadCount_ReducedCPU(activeCPUs);
 			toReturn = activeCPUs;
@@ -546,6 +567,13 @@ MM_ParallelDispatcher::acceptTask(MM_EnvironmentBase *env)
 	_statusTable[workerID] = worker_status_active;
 	env->_currentTask = _taskTable[workerID];
 
+	if (_sampleTask) {
+		OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+		MM_DispatcherThreadSample *sample = &_threadSampleTable[workerID];
+		readThreadStalls(env, sample);
+		sample->startTime = omrtime_hires_clock();
+	}
+
 	env->_currentTask->accept(env);
 }
 
@@ -559,6 +587,18 @@ MM_ParallelDispatcher::completeTask(MM_EnvironmentBase *env)
 	env->_currentTask = NULL;
 	_taskTable[workerID] = NULL;
 
+	if (_sampleTask) {
+		/* Record this thread's share before completing, the main thread folds the samples in once all threads complete */
+		OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+		MM_DispatcherThreadSample *sample = &_threadSampleTable[workerID];
+		MM_DispatcherThreadSample current;
+		readThreadStalls(env, &current);
+		sample->stallTime = current.stallTime - sample->stallTime;
+		sample->workStallCount = current.workStallCount - sample->workStallCount;
+		sample->completeStallCount = current.completeStallCount - sample->completeStallCount;
+		sample->endTime = omrtime_hires_clock();
+	}
+
 	currentTask->complete(env);
 }
 
@@ -581,16 +621,111 @@ MM_ParallelDispatcher::cleanupAfterTask(MM_EnvironmentBase *env)
 void
 MM_ParallelDispatcher::run(MM_EnvironmentBase *env, MM_Task *task, uintptr_t newThreadCount)
 {
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
 	uintptr_t activeThreads = recomputeActiveThreadCountForTask(env, task, newThreadCount);
 	task->mainSetup(env);
+	_sampleTask = _extensions->dispatcherAdaptiveThreadingEnabled() && !_extensions->isMetronomeGC();
+	uint64_t startTime = omrtime_hires_clock();
 	prepareThreadsForTask(env, task, activeThreads);
 	acceptTask(env);
 	task->run(env);
 	completeTask(env);
+	if (_sampleTask) {
+		updateTaskHistory(env, task, startTime);
+		_sampleTask = false;
+	}
 	cleanupAfterTask(env);
 	task->mainCleanup(env);
 }
 
+MM_DispatcherTaskHistory *
+MM_ParallelDispatcher::findTaskHistory(const char *taskId, bool create)
+{
+	for (uintptr_t index = 0; index < PARALLEL_DISPATCHER_TASK_HISTORY_SIZE; index++) {
+		MM_DispatcherTaskHistory *history = &_taskHistory[index];
+		if (taskId == history->taskId) {
+			return history;
+		}
+		if (NULL == history->taskId) {
+			/* Entries are claimed in order, so the type has no history yet */
+			if (create) {
+				history->taskId = taskId;
+				return history;
+			}
+			break;
+		}
+	}
+	return NULL;
+}
+
+void
+MM_ParallelDispatcher::readThreadStalls(MM_EnvironmentBase *env, MM_DispatcherThreadSample *sample)
+{
+	sample->stallTime = env->_taskStallTime;
+	sample->workStallCount = env->_taskWorkStallCount;
+	sample->completeStallCount = env->_taskCompleteStallCount;
+}
+
+void
+MM_ParallelDispatcher::updateTaskHistory(MM_EnvironmentBase *env, MM_Task *task, uint64_t startTime)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	uint64_t endTime = omrtime_hires_clock();
+	uint64_t idleTime = 0;
+	uintptr_t workStallCount = 0;
+	uintptr_t completeStallCount = 0;
+	uintptr_t threads = 0;
+
+	for (uintptr_t index = 0; index < _threadCountMaximum; index++) {
+		MM_DispatcherThreadSample *sample = &_threadSampleTable[index];
+		if (0 != sample->endTime) {
+			/* Waking up late and waiting for the slowest thread at the end are idle time as much as stalls are */
+			idleTime += sample->stallTime;
+			if (sample->startTime > startTime) {
+				idleTime += sample->startTime - startTime;
+			}
+			if (endTime > sample->endTime) {
+				idleTime += endTime - sample->endTime;
+			}
+			workStallCount += sample->workStallCount;
+			completeStallCount += sample->completeStallCount;
+			threads += 1;
+			sample->endTime = 0;
+		}
+	}
+
+	MM_DispatcherTaskHistory *history = findTaskHistory(task->getBaseVirtualTypeId(), true);
+	if ((NULL != history) && (0 < threads) && (endTime > startTime)) {
+		uint64_t threadTime = (endTime - startTime) * threads;
+		uintptr_t utilization = (idleTime >= threadTime) ? 0 : (uintptr_t)(((threadTime - idleTime) * 100) / threadTime);
+		uintptr_t stallCount = workStallCount + completeStallCount;
+		uintptr_t stealSuccess = (0 == stallCount) ? 100 : ((workStallCount * 100) / stallCount);
+
+		if (0 == history->threads) {
+			history->utilization = utilization;
+			history->stealSuccess = stealSuccess;
+		} else {
+			history->utilization = (history->utilization + utilization) / 2;
+			history->stealSuccess = (history->stealSuccess + stealSuccess) / 2;
+		}
+		history->threads = threads;
+
+		/* Shrink to the count that would have kept the threads busy for the target share of the task.
+		 * Grow back one thread at a time, and only while stalled threads mostly went on to find more work.
+		 */
+		uintptr_t targetUtilization = _extensions->dispatcherAdaptiveThreadingTargetUtilization;
+		uintptr_t recommendedThreads = threads;
+		if (history->utilization < targetUtilization) {
+			recommendedThreads = OMR_MAX((uintptr_t)1, ((threads * history->utilization) + targetUtilization - 1) / targetUtilization);
+		} else if (50 <= history->stealSuccess) {
+			recommendedThreads = threads + 1;
+		}
+		history->recommendedThreads = OMR_MIN(recommendedThreads, _threadCount);
+		history->cpuLimit = _cpuLimit;
+		history->lastDispatchTime = endTime;
+	}
+}
+
 /**
  * Return a value indicating the priority at which GC threads should be run.
  */
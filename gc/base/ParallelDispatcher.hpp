@@ -40,6 +40,35 @@
 
 class MM_EnvironmentBase;
 
+/**
+ * Number of task types whose utilization the dispatcher remembers when adaptive threading is enabled.
+ */
+#define PARALLEL_DISPATCHER_TASK_HISTORY_SIZE 32
+
+/**
+ * Utilization of the last dispatch of one type of task, used to size the next dispatch of that type.
+ */
+typedef struct MM_DispatcherTaskHistory {
+	const char *taskId; /**< type id of the task, NULL if the entry is unused */
+	uintptr_t threads; /**< number of threads the last task of this type ran with */
+	uintptr_t recommendedThreads; /**< number of threads to run the next task of this type with */
+	uintptr_t utilization; /**< weighted percentage of thread time spent working rather than stalled or waking up */
+	uintptr_t stealSuccess; /**< weighted percentage of work stalls that ended by acquiring more work */
+	uintptr_t cpuLimit; /**< CPU count, including any cgroup quota, that bounded the thread count */
+	uint64_t lastDispatchTime; /**< hi-res time at which the last task of this type completed */
+} MM_DispatcherTaskHistory;
+
+/**
+ * Per thread measurements taken while a task is sampled for adaptive threading.
+ */
+typedef struct MM_DispatcherThreadSample {
+	uint64_t startTime; /**< hi-res time at which the thread accepted the task */
+	uint64_t endTime; /**< hi-res time at which the thread finished the task, 0 if it did not take part */
+	uint64_t stallTime; /**< stall time recorded by the thread's collector statistics */
+	uintptr_t workStallCount; /**< stalls of the thread that ended by acquiring more work */
+	uintptr_t completeStallCount; /**< stalls of the thread that ended with no work left */
+} MM_DispatcherThreadSample;
+
 class MM_ParallelDispatcher : public MM_BaseVirtual
 {
 	/*
@@ -79,6 +108,11 @@ protected:
 	uintptr_t _activeThreadCount; /**< number of threads actively running a task */
 	uintptr_t _threadsToReserve; /**< Indicates number of threads remaining to dispatch tasks upon notify. Must be exactly 0 after tasks are dispatched. */
 
+	bool _sampleTask; /**< true if the task being dispatched is measured for adaptive threading */
+	uintptr_t _cpuLimit; /**< CPU count, including any cgroup quota, read the last time the thread count was adjusted */
+	MM_DispatcherThreadSample *_threadSampleTable; /**< measurements of each thread for the task being dispatched */
+	MM_DispatcherTaskHistory _taskHistory[PARALLEL_DISPATCHER_TASK_HISTORY_SIZE]; /**< utilization history for each task type */
+
 	omrsig_handler_fn _handler;
 	void* _handler_arg;
 	uintptr_t _defaultOSStackSize; /**< default OS stack size */
@@ -115,7 +149,32 @@ protected:
 	virtual void setThreadInitializationComplete(MM_EnvironmentBase *env);
 	
 	uintptr_t adjustThreadCount(uintptr_t maxThreadCount);
-	
+
+	/**
+	 * Find the utilization history of a task type.
+	 * @param taskId type id of the task
+	 * @param create if true, claim an unused entry when the type has no history yet
+	 * @return the history entry, or NULL if none was found or none could be claimed
+	 */
+	MM_DispatcherTaskHistory *findTaskHistory(const char *taskId, bool create);
+
+	/**
+	 * Read the stall statistics a thread has accumulated so far.
+	 * @param env the thread
+	 * @param[out] sample receives the stall time and stall counts
+	 */
+	void readThreadStalls(MM_EnvironmentBase *env, MM_DispatcherThreadSample *sample);
+
+	/**
+	 * Fold the measurements of a completed task into the history of its type and pick the
+	 * thread count for the next task of that type. Called by the main thread once all threads
+	 * have completed the task.
+	 * @param env the main thread
+	 * @param task the completed task
+	 * @param startTime hi-res time at which the task was dispatched
+	 */
+	void updateTaskHistory(MM_EnvironmentBase *env, MM_Task *task, uint64_t startTime);
+
 public:
 	virtual bool startUpThreads();
 	virtual void shutDownThreads();
@@ -138,6 +197,13 @@ public:
 
 	virtual void reinitAfterFork(MM_EnvironmentBase *env, uintptr_t newThreadCount);
 
+	/**
+	 * Return the utilization history of a task type slot, for reporting.
+	 * @param index slot index, less than PARALLEL_DISPATCHER_TASK_HISTORY_SIZE
+	 * @return the history entry; its taskId is NULL if the slot is unused
+	 */
+	MMINLINE MM_DispatcherTaskHistory *getTaskHistory(uintptr_t index) { return &_taskHistory[index]; }
+
 	MM_ParallelDispatcher(MM_EnvironmentBase *env, omrsig_handler_fn handler, void* handler_arg, uintptr_t defaultOSStackSize) :
 		MM_BaseVirtual()
 		,_task(NULL)
@@ -155,11 +221,15 @@ public:
 		,_threadCount(1)
 		,_activeThreadCount(1)
 		,_threadsToReserve(0)		
+		,_sampleTask(false)
+		,_cpuLimit(0)
+		,_threadSampleTable(NULL)
 		,_handler(handler)
 		,_handler_arg(handler_arg)
 		,_defaultOSStackSize(defaultOSStackSize)
 	{
 		_typeId = __FUNCTION__;
+		memset(_taskHistory, 0, sizeof(_taskHistory));
 	}
 
 	/*
@@ -51,6 +51,7 @@ class MM_ParallelObjectDoTask : public MM_ParallelTask
 private:
 	MM_HeapWalkerObjectFunc _function;
 	void *_userData;
+	uintptr_t _userDataStride; /**< if non-zero, each worker gets its own user data at _userData + (workerID * _userDataStride) */
 	uintptr_t _walkFlags;
 
 	MM_ParallelHeapWalker *_heapWalker;
@@ -73,6 +74,21 @@ public:
 		: MM_ParallelTask(env, env->getExtensions()->dispatcher)
 		, _function(function)
 		, _userData(userData)
+		, _userDataStride(0)
+		, _walkFlags(walkFlags)
+		, _heapWalker(heapWalker)
+	{
+		_typeId = __FUNCTION__;
+	}
+
+	/*
+	 * Create a ParallelObjectDoTask object that hands each worker its own user data.
+	 */
+	MM_ParallelObjectDoTask(MM_EnvironmentBase *env, MM_ParallelHeapWalker *heapWalker, MM_HeapWalkerObjectFunc function, void *workerUserData, uintptr_t workerUserDataSize, uintptr_t walkFlags)
+		: MM_ParallelTask(env, env->getExtensions()->dispatcher)
+		, _function(function)
+		, _userData(workerUserData)
+		, _userDataStride(workerUserDataSize)
 		, _walkFlags(walkFlags)
 		, _heapWalker(heapWalker)
 	{
@@ -153,20 +169,53 @@ MM_ParallelHeapWalker::allObjectsDo(MM_EnvironmentBase *env, MM_HeapWalkerObject
 		GC_OMRVMInterface::flushCachesForWalk(env->getOmrVM());
 		if (prepareHeapForWalk) {
 			_globalCollector->prepareHeapForWalk(env);
+			/* The mark map describes every live object only until the mutators run again */
+			_markMap->setMarkMapValid(true);
 		}
 
 		MM_ParallelObjectDoTask objectDoTask(env, this, function, userData, walkFlags, parallel);
 		env->getExtensions()->dispatcher->run(env, &objectDoTask);
+
+		if (prepareHeapForWalk) {
+			_markMap->setMarkMapValid(false);
+		}
 	} else {
 		MM_HeapWalker::allObjectsDo(env, function, userData, walkFlags, parallel, prepareHeapForWalk);
 	}
 }
 
+/**
+ * Walk through all live objects of the heap in parallel, handing each worker its own user data.
+ */
+uintptr_t
+MM_ParallelHeapWalker::allObjectsDoPerWorker(MM_EnvironmentBase *env, MM_HeapWalkerObjectFunc function, void *workerUserData, uintptr_t workerUserDataSize, uintptr_t walkFlags, uintptr_t workerCount, bool prepareHeapForWalk)
+{
+	GC_OMRVMInterface::flushCachesForWalk(env->getOmrVM());
+	if (prepareHeapForWalk) {
+		_globalCollector->prepareHeapForWalk(env);
+		/* The mark map describes every live object only until the mutators run again */
+		_markMap->setMarkMapValid(true);
+	}
+
+	MM_ParallelObjectDoTask objectDoTask(env, this, function, workerUserData, workerUserDataSize, walkFlags);
+	env->getExtensions()->dispatcher->run(env, &objectDoTask, workerCount);
+
+	if (prepareHeapForWalk) {
+		_markMap->setMarkMapValid(false);
+	}
+
+	return objectDoTask.getThreadCount();
+}
+
 /**
  * gets the heap walker and calls the actual objectSlotsDo function
  */
 void
 MM_ParallelObjectDoTask::run(MM_EnvironmentBase *env)
 {
-	_heapWalker->allObjectsDoParallel(env, _function, _userData, _walkFlags);
+	void *userData = _userData;
+	if (0 != _userDataStride) {
+		userData = (void *)((uintptr_t)_userData + (env->getWorkerID() * _userDataStride));
+	}
+	_heapWalker->allObjectsDoParallel(env, _function, userData, _walkFlags);
 }
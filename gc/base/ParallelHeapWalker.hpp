@@ -61,6 +61,15 @@ public:
 	 */
 	virtual void allObjectsDo(MM_EnvironmentBase *env, MM_HeapWalkerObjectFunc function, void *userData, uintptr_t walkFlags, bool parallel, bool prepareHeapForWalk);
 
+	/**
+	 * Walk through all live objects of the heap in parallel, handing each worker its own user data.
+	 * The worker with ID N is passed (workerUserData + N * workerUserDataSize), so workerUserData must
+	 * provide room for as many workers as the dispatcher may start.
+	 * @param workerCount maximum number of GC threads to use (UDATA_MAX for all of them)
+	 * @return the number of workers that took part in the walk
+	 */
+	uintptr_t allObjectsDoPerWorker(MM_EnvironmentBase *env, MM_HeapWalkerObjectFunc function, void *workerUserData, uintptr_t workerUserDataSize, uintptr_t walkFlags, uintptr_t workerCount, bool prepareHeapForWalk);
+
 	MM_MarkMap *getMarkMap() {
 		return _markMap;
 	}
@@ -72,6 +72,7 @@ MM_ParallelTask::handleNextWorkUnit(MM_EnvironmentBase *env)
 void
 MM_ParallelTask::synchronizeGCThreads(MM_EnvironmentBase *env, const char *id)
 {
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
 	Trc_MM_SynchronizeGCThreads_Entry(env->getLanguageVMThread(), id);
 	env->_lastSyncPointReached = id;
 	
@@ -97,10 +98,12 @@ MM_ParallelTask::synchronizeGCThreads(MM_EnvironmentBase *env, const char *id)
 			omrthread_monitor_notify_all(_synchronizeMutex);
 		} else {
 			volatile uintptr_t index = _synchronizeIndex;
+			uint64_t stallStartTime = omrtime_hires_clock();
 
 			do {
 				omrthread_monitor_wait(_synchronizeMutex);
 			} while(index == _synchronizeIndex);
+			env->addToTaskStallTime(stallStartTime, omrtime_hires_clock());
 		}
 		omrthread_monitor_exit(_synchronizeMutex);
 
@@ -113,6 +116,7 @@ bool
 MM_ParallelTask::synchronizeGCThreadsAndReleaseMain(MM_EnvironmentBase *env, const char *id)
 {
 	bool isMainThread = false;
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
 
 	Trc_MM_SynchronizeGCThreadsAndReleaseMain_Entry(env->getLanguageVMThread(), id);
 	env->_lastSyncPointReached = id;
@@ -151,7 +155,9 @@ MM_ParallelTask::synchronizeGCThreadsAndReleaseMain(MM_EnvironmentBase *env, con
 				_synchronized = true;
 				goto done;
 			}
+			uint64_t stallStartTime = omrtime_hires_clock();
 			omrthread_monitor_wait(_synchronizeMutex);
+			env->addToTaskStallTime(stallStartTime, omrtime_hires_clock());
 		}
 		omrthread_monitor_exit(_synchronizeMutex);
 	} else {
@@ -168,6 +174,7 @@ bool
 MM_ParallelTask::synchronizeGCThreadsAndReleaseSingleThread(MM_EnvironmentBase *env, const char *id)
 {
 	bool isReleasedThread = false;
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
 
 	Trc_MM_SynchronizeGCThreadsAndReleaseSingleThread_Entry(env->getLanguageVMThread(), id);
 	env->_lastSyncPointReached = id;
@@ -197,9 +204,11 @@ MM_ParallelTask::synchronizeGCThreadsAndReleaseSingleThread(MM_EnvironmentBase *
 			goto done;
 		}
 
+		uint64_t stallStartTime = omrtime_hires_clock();
 		do {
 			omrthread_monitor_wait(_synchronizeMutex);
 		} while(index == _synchronizeIndex);
+		env->addToTaskStallTime(stallStartTime, omrtime_hires_clock());
 		omrthread_monitor_exit(_synchronizeMutex);
 	} else {
 		_synchronized = true;
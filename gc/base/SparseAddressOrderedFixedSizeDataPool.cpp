@@ -253,7 +253,6 @@ MM_SparseAddressOrderedFixedSizeDataPool::createNewSparseHeapFreeListNode(void *
 void *
 MM_SparseAddressOrderedFixedSizeDataPool::findFreeListEntry(uintptr_t size)
 {
-	Assert_MM_true(_freeListPoolFreeNodesCount > 0);
 	MM_SparseHeapLinkedFreeHeader *previous = NULL;
 	MM_SparseHeapLinkedFreeHeader *current = _heapFreeList;
 	void *returnAddr = NULL;
@@ -268,7 +267,7 @@ MM_SparseAddressOrderedFixedSizeDataPool::findFreeListEntry(uintptr_t size)
 		current = current->_next;
 	}
 
-	/* Should be impossible for current to be NULL since sparse heap will always have available space, however this case should still be checked */
+	/* current is NULL when the sparse heap has no contiguous free region big enough, the caller must handle it */
 	if (NULL != current) {
 		currSize = current->_size;
 		returnAddr = current->_address;
@@ -24,6 +24,7 @@
 #if !defined(SparseAddressOrderedFixedSizeDataPool_HPP_)
 #define SparseAddressOrderedFixedSizeDataPool_HPP_
 
+#include "hashtable_api.h"
 #include "omrpool.h"
 #include "BaseVirtual.hpp"
 #include "EnvironmentBase.hpp"
@@ -225,6 +226,22 @@ public:
 		return _freeListPoolAllocBytes;
 	}
 
+	/**
+	 * Get the number of in-heap proxy objects that have data in the sparse heap
+	 */
+	MMINLINE uintptr_t getSparseDataEntryCount()
+	{
+		return hashTableGetCount(_objectToSparseDataTable);
+	}
+
+	/**
+	 * Get the table of sparse data entries, keyed by data pointer
+	 */
+	MMINLINE J9HashTable *getObjectToSparseDataTable()
+	{
+		return _objectToSparseDataTable;
+	}
+
 	/**
 	 * Update the proxyObjPtr after an object has moved for the sparse data entry associated with the given dataPtr.
 	 *
@@ -34,6 +34,7 @@
 #include "Forge.hpp"
 #include "GCExtensionsBase.hpp"
 #include "Math.hpp"
+#include "HashTableIterator.hpp"
 #include "Heap.hpp"
 #include "HeapRegionManager.hpp"
 #include "ModronAssertions.h"
@@ -127,38 +128,79 @@ MM_SparseVirtualMemory::updateSparseDataEntryAfterObjectHasMoved(void *dataPtr,
 
 void *
 MM_SparseVirtualMemory::allocateSparseFreeEntryAndMapToHeapObject(void *proxyObjPtr, uintptr_t size)
+{
+	void *sparseHeapAddr = reserveSparseFreeEntry(size);
+
+	if (NULL != sparseHeapAddr) {
+		mapReservedSparseFreeEntryToHeapObject(sparseHeapAddr, proxyObjPtr, size);
+	}
+
+	return sparseHeapAddr;
+}
+
+void *
+MM_SparseVirtualMemory::reserveSparseFreeEntry(uintptr_t size)
 {
 	/* Commiting and decommiting memory sizes must be multiple of pagesize */
 	uintptr_t adjustedSize = MM_Math::roundToCeiling(_pageSize, size);
 
 	omrthread_monitor_enter(_largeObjectVirtualMemoryMutex);
 	void *sparseHeapAddr = _sparseDataPool->findFreeListEntry(adjustedSize);
-	bool success = MM_VirtualMemory::commitMemory(sparseHeapAddr, adjustedSize);
+	bool success = false;
 
-	/* We can likely significantly reduce the list of platforms requiring zeroing after commit - however initially we will take an ultra safe approach */
+	if (NULL != sparseHeapAddr) {
+		success = MM_VirtualMemory::commitMemory(sparseHeapAddr, adjustedSize);
+		if (success) {
+			/* We can likely significantly reduce the list of platforms requiring zeroing after commit - however initially we will take an ultra safe approach */
 #if !(defined(LINUX) && defined(J9VM_ARCH_X86))
-	OMRZeroMemory(sparseHeapAddr, adjustedSize);
+			OMRZeroMemory(sparseHeapAddr, adjustedSize);
 #endif /* !(defined(LINUX) && defined(J9VM_ARCH_X86)) */
-
-	if (NULL != sparseHeapAddr) {
-		_sparseDataPool->mapSparseDataPtrToHeapProxyObjectPtr(sparseHeapAddr, proxyObjPtr, adjustedSize);
-	} else {
-		/* Impossible to get here, there should always be free space at sparse heap */
-		Assert_MM_unreachable();
+		} else {
+			_sparseDataPool->returnFreeListEntry(sparseHeapAddr, adjustedSize);
+		}
 	}
 
 	omrthread_monitor_exit(_largeObjectVirtualMemoryMutex);
 
 	if (success) {
-		Trc_MM_SparseVirtualMemory_commitMemory_success(sparseHeapAddr, (void*)adjustedSize, proxyObjPtr);
+		Trc_MM_SparseVirtualMemory_commitMemory_success(sparseHeapAddr, (void*)adjustedSize, NULL);
 	} else {
-		Trc_MM_SparseVirtualMemory_commitMemory_failure(sparseHeapAddr, (void*)adjustedSize, proxyObjPtr);
+		Trc_MM_SparseVirtualMemory_commitMemory_failure(sparseHeapAddr, (void*)adjustedSize, NULL);
 		sparseHeapAddr = NULL;
 	}
 
 	return sparseHeapAddr;
 }
 
+bool
+MM_SparseVirtualMemory::mapReservedSparseFreeEntryToHeapObject(void *dataPtr, void *proxyObjPtr, uintptr_t size)
+{
+	uintptr_t adjustedSize = MM_Math::roundToCeiling(_pageSize, size);
+
+	omrthread_monitor_enter(_largeObjectVirtualMemoryMutex);
+	bool ret = _sparseDataPool->mapSparseDataPtrToHeapProxyObjectPtr(dataPtr, proxyObjPtr, adjustedSize);
+	omrthread_monitor_exit(_largeObjectVirtualMemoryMutex);
+
+	return ret;
+}
+
+void
+MM_SparseVirtualMemory::releaseReservedSparseFreeEntry(MM_EnvironmentBase* env, void *dataPtr, uintptr_t size)
+{
+	uintptr_t adjustedSize = MM_Math::roundToCeiling(_pageSize, size);
+
+	if (decommitMemory(env, dataPtr, adjustedSize)) {
+		Trc_MM_SparseVirtualMemory_decommitMemory_success(dataPtr, (void*)adjustedSize);
+	} else {
+		Trc_MM_SparseVirtualMemory_decommitMemory_failure(dataPtr, (void*)adjustedSize);
+		Assert_MM_true(false);
+	}
+
+	omrthread_monitor_enter(_largeObjectVirtualMemoryMutex);
+	_sparseDataPool->returnFreeListEntry(dataPtr, adjustedSize);
+	omrthread_monitor_exit(_largeObjectVirtualMemoryMutex);
+}
+
 bool
 MM_SparseVirtualMemory::freeSparseRegionAndUnmapFromHeapObject(MM_EnvironmentBase* env, void *dataPtr)
 {
@@ -182,6 +224,38 @@ MM_SparseVirtualMemory::freeSparseRegionAndUnmapFromHeapObject(MM_EnvironmentBas
 
 	return ret;
 }
+uintptr_t
+MM_SparseVirtualMemory::updateOrFreeSparseRegions(MM_EnvironmentBase* env, MM_SparseProxyObjectFunc function, void *userData)
+{
+	uintptr_t freedCount = 0;
+
+	omrthread_monitor_enter(_largeObjectVirtualMemoryMutex);
+	GC_HashTableIterator iterator(_sparseDataPool->getObjectToSparseDataTable());
+	MM_SparseDataTableEntry *entry = NULL;
+	while (NULL != (entry = (MM_SparseDataTableEntry *)iterator.nextSlot())) {
+		void *proxyObjPtr = function(env, entry->_proxyObjPtr, userData);
+		if (NULL != proxyObjPtr) {
+			entry->_proxyObjPtr = proxyObjPtr;
+		} else {
+			void *dataPtr = entry->_dataPtr;
+			uintptr_t dataSize = entry->_size;
+			Assert_MM_true(0 == (dataSize % _pageSize));
+			if (decommitMemory(env, dataPtr, dataSize)) {
+				Trc_MM_SparseVirtualMemory_decommitMemory_success(dataPtr, (void*)dataSize);
+			} else {
+				Trc_MM_SparseVirtualMemory_decommitMemory_failure(dataPtr, (void*)dataSize);
+				Assert_MM_true(false);
+			}
+			_sparseDataPool->returnFreeListEntry(dataPtr, dataSize);
+			iterator.removeSlot();
+			freedCount += 1;
+		}
+	}
+	omrthread_monitor_exit(_largeObjectVirtualMemoryMutex);
+
+	return freedCount;
+}
+
 bool
 MM_SparseVirtualMemory::decommitMemory(MM_EnvironmentBase* env, void* address, uintptr_t size)
 {
@@ -42,6 +42,12 @@ class MM_Heap;
 class MM_SparseAddressOrderedFixedSizeDataPool;
 struct J9PortVmemParams;
 
+/**
+ * Called for each in-heap proxy object that has data in sparse virtual memory.
+ * Returns the current location of the proxy object, or NULL if the proxy object is dead and its data can be freed.
+ */
+typedef void *(*MM_SparseProxyObjectFunc)(MM_EnvironmentBase *env, void *proxyObjPtr, void *userData);
+
 /**
  * Large virtual memory for allocation of large objects (their data portion). It's sparsely
  * committed only for live objects (memory is eagerly committed/de-committed on allocate/free).
@@ -127,6 +133,38 @@ public:
 	 */
 	void *allocateSparseFreeEntryAndMapToHeapObject(void *proxyObjPtr, uintptr_t size);
 
+	/**
+	 * Find free space at sparse heap address space that satisfies the given size and commit it, without
+	 * associating it to a proxy object yet. The region is neither in the free list nor in the sparse data
+	 * table until it is mapped with mapReservedSparseFreeEntryToHeapObject() or released with
+	 * releaseReservedSparseFreeEntry(), so collections in between do not see it.
+	 *
+	 * @param size		uintptr_t	size requested by object pointer to be allocated at sparse heap
+	 *
+	 * @return data pointer at sparse heap that satisfies the requested size, or NULL if there is no room
+	 */
+	void *reserveSparseFreeEntry(uintptr_t size);
+
+	/**
+	 * Associate a region returned by reserveSparseFreeEntry() to its proxy object.
+	 *
+	 * @param dataPtr	void*	Data pointer returned by reserveSparseFreeEntry()
+	 * @param proxyObjPtr	void*	Proxy object that will be associated to the data at sparse heap
+	 * @param size		uintptr_t	size that was passed to reserveSparseFreeEntry()
+	 *
+	 * @return true if the region was mapped to the proxy object, false otherwise
+	 */
+	bool mapReservedSparseFreeEntryToHeapObject(void *dataPtr, void *proxyObjPtr, uintptr_t size);
+
+	/**
+	 * Decommit a region returned by reserveSparseFreeEntry() that was never mapped to a proxy object,
+	 * and return it to the sparse free region pool.
+	 *
+	 * @param dataPtr	void*	Data pointer returned by reserveSparseFreeEntry()
+	 * @param size		uintptr_t	size that was passed to reserveSparseFreeEntry()
+	 */
+	void releaseReservedSparseFreeEntry(MM_EnvironmentBase* env, void *dataPtr, uintptr_t size);
+
 	/**
 	 * Once object is collected by GC, we need to free the sparse region associated
 	 * with the object pointer. Therefore we decommit sparse region and return free
@@ -138,6 +176,18 @@ public:
 	 */
 	bool freeSparseRegionAndUnmapFromHeapObject(MM_EnvironmentBase* env, void *dataPtr);
 
+	/**
+	 * Once a collection has moved or discarded proxy objects, walk all sparse data entries. Entries whose proxy
+	 * object moved are updated to the new location, and the sparse regions of dead proxy objects are decommitted
+	 * and returned to the sparse free region pool. Must be called while the mutator threads are stopped.
+	 *
+	 * @param function	MM_SparseProxyObjectFunc	Returns the new location of a proxy object or NULL if it is dead
+	 * @param userData	void*	Passed through to function
+	 *
+	 * @return the number of sparse regions that were freed
+	 */
+	uintptr_t updateOrFreeSparseRegions(MM_EnvironmentBase* env, MM_SparseProxyObjectFunc function, void *userData);
+
 	/**
 	 * Decommits/Releases memory, returning the associated pages to the OS
 	 *
@@ -343,6 +343,11 @@ MM_SweepPoolManagerAddressOrderedListBase::connectChunk(MM_EnvironmentBase *env,
 #endif
 	}
 
+	/* The old tail is now linked to its successor, and it and every entry before it are no larger than the largest free entry connected so far */
+	if ((NULL != sweepState->_connectPreviousFreeEntry) && (sweepState->_connectPreviousFreeEntry != previousFreeEntry)) {
+		memoryPool->updateSizeClassIndex(sweepState->_connectPreviousFreeEntry, sweepState->_largestFreeEntry);
+	}
+
 	/* Update the allocate profile with the previous free entry and previous chunk */
 	sweepState->_connectPreviousFreeEntry = previousFreeEntry;
 	sweepState->_connectPreviousPreviousFreeEntry = previousPreviousFreeEntry;
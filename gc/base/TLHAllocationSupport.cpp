@@ -110,7 +110,54 @@ MM_TLHAllocationSupport::restart(MM_EnvironmentBase *env)
 	/* Clear current information accumulated */
 	setAllZeroes();
 
-	_tlh->refreshSize = MM_Math::roundToCeiling(extensions->tlhInitialSize, refreshSize / 2);
+	if (extensions->tlhAdaptiveSizing) {
+		/* The rate was resampled when the cache was flushed, so idle threads restart with a small TLH */
+		_tlh->refreshSize = getAdaptiveRefreshSize(env);
+	} else {
+		_tlh->refreshSize = MM_Math::roundToCeiling(extensions->tlhInitialSize, refreshSize / 2);
+	}
+}
+
+void
+MM_TLHAllocationSupport::updateAllocationRate(MM_EnvironmentBase *env, uintptr_t bytesAllocated)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	uint64_t now = omrtime_hires_clock();
+
+	if (0 != _lastRefreshTime) {
+		uint64_t elapsedMicros = omrtime_hires_delta(_lastRefreshTime, now, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		if (0 == elapsedMicros) {
+			elapsedMicros = 1;
+		}
+		uintptr_t sampleRate = (uintptr_t)(((uint64_t)bytesAllocated * 1000) / elapsedMicros);
+		if (0 == _allocationRate) {
+			_allocationRate = sampleRate;
+		} else {
+			/* exponentially weighted, so a single burst or pause does not swing the TLH size */
+			_allocationRate = (uintptr_t)((((uint64_t)_allocationRate * 3) + sampleRate) / 4);
+		}
+	}
+	_lastRefreshTime = now;
+}
+
+uintptr_t
+MM_TLHAllocationSupport::getAdaptiveRefreshSize(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	uint64_t size = ((uint64_t)_allocationRate * extensions->tlhAdaptiveRefreshInterval) / 1000;
+
+	if (0 == size) {
+		/* No rate sampled yet (or the thread has gone fully idle) */
+		size = extensions->tlhInitialSize;
+	}
+
+	if (size < extensions->tlhMinimumSize) {
+		size = extensions->tlhMinimumSize;
+	} else if (size > extensions->tlhMaximumSize) {
+		size = extensions->tlhMaximumSize;
+	}
+
+	return MM_Math::roundToCeiling(sizeof(uintptr_t), (uintptr_t)size);
 }
 
 bool
@@ -147,6 +194,10 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 	uintptr_t usedSize = getUsedSize();
 	stats->_tlhAllocatedUsed += usedSize;
 
+	if (extensions->tlhAdaptiveSizing) {
+		updateAllocationRate(env, usedSize);
+	}
+
 	/* Try to cache the current TLH */
 	if ((NULL != getRealTop()) && (getRemainingSize() >= tlhMinimumSize)) {
 		/* Cache the current TLH because it is bigger than the minimum size */
@@ -254,9 +305,12 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 			stats->_tlhRequestedBytes += getRefreshSize();
 			/* TODO VMDESIGN 1322: adjust the amount consumed by the TLH refresh since a TLH refresh
 			 * may not give you the size requested */
-			/* Increase thread hungriness */
-			/* TODO: TLH values (max/min/inc) should be per tlh, or somewhere else? */
-			if (getRefreshSize() < tlhMaximumSize) {
+			if (extensions->tlhAdaptiveSizing) {
+				/* Size the next refresh to last about tlhAdaptiveRefreshInterval at the current allocation rate */
+				setRefreshSize(getAdaptiveRefreshSize(env));
+			} else if (getRefreshSize() < tlhMaximumSize) {
+				/* Increase thread hungriness */
+				/* TODO: TLH values (max/min/inc) should be per tlh, or somewhere else? */
 				setRefreshSize(getRefreshSize() + extensions->tlhIncrementSize);
 			}
 			reserveTLHTopForGC(env);
@@ -324,6 +378,31 @@ MM_TLHAllocationSupport::flushCache(MM_EnvironmentBase *env)
 		env->getExtensions()->getGlobalCollector()->preAllocCacheFlush(env, getBase(), lastTLHobj);
 	}
 
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	MM_AllocationStats *stats = _objectAllocationInterface->getAllocationStats();
+	bool const compressed = extensions->compressObjectReferences();
+
+	/* Whatever is left in the current and the abandoned TLHs is handed back to the heap */
+	uintptr_t wastedBytes = getRemainingSize();
+	for (MM_HeapLinkedFreeHeaderTLH *cache = _abandonedList; NULL != cache; cache = (MM_HeapLinkedFreeHeaderTLH *)cache->getNext(compressed)) {
+		wastedBytes += cache->getSize();
+	}
+	stats->_tlhWastedBytes += wastedBytes;
+
+	if (extensions->tlhAdaptiveSizing) {
+		/* Close the current sample; a thread that went idle since its last refresh will see its rate drop */
+		updateAllocationRate(env, getUsedSize());
+		setRefreshSize(getAdaptiveRefreshSize(env));
+		if (0 != _allocationRate) {
+			/* Only threads that have sampled a rate size their TLH from it */
+			stats->_tlhAllocationRate += _allocationRate;
+			stats->_tlhRefreshSize += getRefreshSize();
+			stats->_tlhRateSampleCount += 1;
+		}
+		/* Do not let the collection pause count against the next sample */
+		_lastRefreshTime = 0;
+	}
+
 	/* Since AllocationStats have been reset, reset the base as well*/
 	_abandonedList = NULL;
 	_abandonedListSize = 0;
@@ -84,6 +84,9 @@ private:
 	const bool _zeroTLH; /**< if true this TLH is primary (might be cleared by batchClearTLH), if false this is secondary TLH (and it would not be cleared ever) */
 
 	uintptr_t _reservedBytesForGC; /**< Number of bytes reserved in the TLH by collector. If set, we are guaranteed to have this remaining size available when we flush/clear TLH. */
+
+	uint64_t _lastRefreshTime; /**< hires clock value of the last TLH refresh, or 0 if the next refresh should only start a new sample (adaptive sizing only) */
+	uintptr_t _allocationRate; /**< smoothed allocation rate of the owning thread into this TLH, in bytes per millisecond (adaptive sizing only) */
 public:
 protected:
 private:
@@ -237,6 +240,18 @@ private:
 
 	void updateFrequentObjectsStats(MM_EnvironmentBase *env);
 
+	/**
+	 * Fold the bytes allocated from the TLH since the previous refresh into the smoothed allocation rate.
+	 * @param bytesAllocated bytes consumed from the TLH being retired
+	 */
+	void updateAllocationRate(MM_EnvironmentBase *env, uintptr_t bytesAllocated);
+
+	/**
+	 * Determine the refresh size that the current allocation rate would consume in tlhAdaptiveRefreshInterval.
+	 * @return the refresh size, bounded by tlhMinimumSize and tlhMaximumSize
+	 */
+	uintptr_t getAdaptiveRefreshSize(MM_EnvironmentBase *env);
+
 	/**
 	 * Create a ThreadLocalHeap object.
 	 */
@@ -251,7 +266,9 @@ private:
 		_abandonedList(NULL),
 		_abandonedListSize(0),
 		_zeroTLH(zeroTLH),
-		_reservedBytesForGC(0)
+		_reservedBytesForGC(0),
+		_lastRefreshTime(0),
+		_allocationRate(0)
 	{};
 
 	/*
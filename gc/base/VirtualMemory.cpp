@@ -156,7 +156,18 @@ MM_VirtualMemory::reserveMemory(J9PortVmemParams* params)
 		_pageSize = omrvmem_get_page_size(&_identifier);
 		_pageFlags = omrvmem_get_page_flags(&_identifier);
 		Assert_MM_true(0 != _pageSize);
-		addressToReturn = (void*)MM_Math::roundToCeiling(_heapAlignment, (uintptr_t)_baseAddress);
+		uintptr_t baseAlignment = _heapAlignment;
+		if ((OMRMEM_CATEGORY_MM_RUNTIME_HEAP == params->category) && _extensions->heapTransparentHugePages && (_extensions->heapHugePageSize > _pageSize)) {
+			/*
+			 * Start the heap on a huge page boundary and commit/decommit whole huge pages only, so that
+			 * expansion and contraction never leave the kernel a partial huge page to split or fail to promote.
+			 * The caller pads the reservation to absorb the extra alignment.
+			 */
+			_commitAlignment = _extensions->heapHugePageSize;
+			_adviseHugePages = true;
+			baseAlignment = OMR_MAX(_heapAlignment, _commitAlignment);
+		}
+		addressToReturn = (void*)MM_Math::roundToCeiling(baseAlignment, (uintptr_t)_baseAddress);
 	}
 	return addressToReturn;
 }
@@ -205,12 +216,21 @@ MM_VirtualMemory::commitMemory(void* address, uintptr_t size)
 	Assert_MM_true(0 != _pageSize);
 
 	bool success = true;
+	uintptr_t commitAlignment = OMR_MAX(_pageSize, _commitAlignment);
 
 	/* port library takes page aligned addresses and sizes only */
-	void* commitBase = (void*)MM_Math::roundToFloor(_pageSize, (uintptr_t)address);
-	void* commitTop = (void*)MM_Math::roundToCeiling(_pageSize, (uintptr_t)address + size + _tailPadding);
+	void* commitBase = (void*)MM_Math::roundToFloor(commitAlignment, (uintptr_t)address);
+	void* commitTop = (void*)MM_Math::roundToCeiling(commitAlignment, (uintptr_t)address + size + _tailPadding);
 	uintptr_t commitSize;
 
+	if (commitAlignment > _pageSize) {
+		/* a partial huge page at the top of the reservation can only be committed up to the end of the reservation */
+		void* reserveTop = (void*)((uintptr_t)_baseAddress + _reserveSize);
+		if (commitTop > reserveTop) {
+			commitTop = reserveTop;
+		}
+	}
+
 	if (commitBase <= commitTop) {
 		commitSize = (uintptr_t)commitTop - (uintptr_t)commitBase;
 	} else {
@@ -220,6 +240,10 @@ MM_VirtualMemory::commitMemory(void* address, uintptr_t size)
 
 	if (0 < commitSize) {
 		success = omrvmem_commit_memory(commitBase, commitSize, &_identifier) != 0;
+		if (success && _adviseHugePages) {
+			/* advice only - the memory is usable whether or not the kernel honours it */
+			omrvmem_advise_hugepages(commitBase, commitSize, OMRPORT_VMEM_HUGEPAGE_ADVISE);
+		}
 	}
 
 	if (success) {
@@ -246,6 +270,7 @@ MM_VirtualMemory::decommitMemory(void* address, uintptr_t size, void* lowValidAd
 	void* decommitBase = address;
 	void* decommitTop = (void*)((uintptr_t)decommitBase + size + _tailPadding);
 	Assert_MM_true(0 != _pageSize);
+	uintptr_t decommitAlignment = OMR_MAX(_pageSize, _commitAlignment);
 
 	OMRPORT_ACCESS_FROM_OMRVM(_extensions->getOmrVM());
 
@@ -265,9 +290,9 @@ MM_VirtualMemory::decommitMemory(void* address, uintptr_t size, void* lowValidAd
 		}
 	}
 
-	/* port library takes page aligned addresses and sizes only */
-	decommitBase = (void*)MM_Math::roundToCeiling(_pageSize, (uintptr_t)decommitBase);
-	decommitTop = (void*)MM_Math::roundToFloor(_pageSize, (uintptr_t)decommitTop);
+	/* port library takes page aligned addresses and sizes only; partial huge pages stay committed */
+	decommitBase = (void*)MM_Math::roundToCeiling(decommitAlignment, (uintptr_t)decommitBase);
+	decommitTop = (void*)MM_Math::roundToFloor(decommitAlignment, (uintptr_t)decommitTop);
 
 	if (decommitBase < decommitTop) {
 		/* There is still memory to decommit, calculate size */
@@ -278,6 +303,27 @@ MM_VirtualMemory::decommitMemory(void* address, uintptr_t size, void* lowValidAd
 	return result;
 }
 
+void
+MM_VirtualMemory::collapseHugePages()
+{
+	if (_adviseHugePages) {
+		OMRPORT_ACCESS_FROM_OMRVM(_extensions->getOmrVM());
+		uintptr_t heapSize = (uintptr_t)_heapTop - (uintptr_t)_heapBase;
+
+		/* best effort - ranges which are not committed or can not be collapsed are skipped by the kernel */
+		omrvmem_advise_hugepages(_heapBase, heapSize, OMRPORT_VMEM_HUGEPAGE_COLLAPSE);
+	}
+}
+
+bool
+MM_VirtualMemory::getHugePageCoverage(uint64_t *hugePageBytes)
+{
+	OMRPORT_ACCESS_FROM_OMRVM(_extensions->getOmrVM());
+	uintptr_t heapSize = (uintptr_t)_heapTop - (uintptr_t)_heapBase;
+
+	return 0 == omrvmem_get_hugepage_coverage(_heapBase, heapSize, hugePageBytes);
+}
+
 void
 MM_VirtualMemory::tearDown(MM_EnvironmentBase* env)
 {
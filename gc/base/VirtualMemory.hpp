@@ -55,6 +55,8 @@ private:
 	void* _heapTop; /**< One byte past the highest usable address in the reserved block, once alignment and padding are taken into account */
 	uintptr_t _mode; /**< requested memory mode (memory flags combination) */
 	uintptr_t _consumerCount; /**< number of memory consumers attached to this virtual memory instance */
+	uintptr_t _commitAlignment; /**< Granularity of commit and decommit operations if larger than the page size, 0 otherwise */
+	bool _adviseHugePages; /**< true if committed ranges are advised to be backed by transparent huge pages */
 	J9PortVmemIdentifier _identifier;
 
 protected:
@@ -94,6 +96,8 @@ protected:
 		, _heapTop(0)
 		, _mode(mode)
 		, _consumerCount(0)
+		, _commitAlignment(0)
+		, _adviseHugePages(false)
 		, _identifier()
 		, _extensions(env->getExtensions())
 		, _baseAddress(NULL)
@@ -110,6 +114,21 @@ protected:
 	virtual bool decommitMemory(void* address, uintptr_t size, void* lowValidAddress, void* highValidAddress);
 	void roundDownTop(uintptr_t rounding);
 
+	/**
+	 * Synchronously collapse the populated part of the heap range of the receiver into transparent huge pages.
+	 * Has no effect unless the receiver commits in huge page units.
+	 */
+	void collapseHugePages();
+
+	/**
+	 * Find how much of the heap range of the receiver is backed by transparent huge pages.
+	 *
+	 * @param[out] hugePageBytes the number of bytes backed by huge pages
+	 *
+	 * @return true on success, false if the platform can not report huge page coverage
+	 */
+	bool getHugePageCoverage(uint64_t *hugePageBytes);
+
 	/*
 	 * Set the NUMA affinity for the specified range within the receiver.
 	 * 
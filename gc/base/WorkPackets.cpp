@@ -87,26 +87,6 @@ MM_WorkPackets::initialize(MM_EnvironmentBase *env)
 
 	heapSize = _extensions->heap->getMaximumMemorySize();
 
-	if (!_emptyPacketList.initialize(env)) {
-		return false;
-	}
-	if (!_fullPacketList.initialize(env)) {
-		return false;
-	}
-	if (!_nonEmptyPacketList.initialize(env)) {
-		return false;
-	}
-	if (!_relativelyFullPacketList.initialize(env)) {
-		return false;
-	}
-	if (!_deferredPacketList.initialize(env)) {
-		return false;
-	}
-	
-	if (!_deferredFullPacketList.initialize(env)) {
-		return false;
-	}
-
 	if(omrthread_monitor_init_with_name(&_inputListMonitor, 0, "MM_WorkPackets::inputList")) {
 		return false;
 	}
@@ -143,6 +123,33 @@ MM_WorkPackets::initialize(MM_EnvironmentBase *env)
 
 	/* If -Xgcworkpackets was specified  we don't allow later allocation of more packets */
 	_maxPackets = (0 != _extensions->workpacketCount) ? initialPacketCount : initialPacketCount * _increaseFactor;
+
+	if (_extensions->packetListLockFree) {
+		/* lock-free lists link packets by directory index, so that list heads can carry an ABA tag in a single 64-bit word */
+		_packetDirectory = (MM_Packet **)env->getForge()->allocate(sizeof(MM_Packet *) * _maxPackets, OMR::GC::AllocationCategory::WORK_PACKETS, OMR_GET_CALLSITE());
+		if (NULL == _packetDirectory) {
+			return false;
+		}
+	}
+
+	if (!_emptyPacketList.initialize(env, _packetDirectory)) {
+		return false;
+	}
+	if (!_fullPacketList.initialize(env, _packetDirectory)) {
+		return false;
+	}
+	if (!_nonEmptyPacketList.initialize(env, _packetDirectory)) {
+		return false;
+	}
+	if (!_relativelyFullPacketList.initialize(env, _packetDirectory)) {
+		return false;
+	}
+	if (!_deferredPacketList.initialize(env, _packetDirectory)) {
+		return false;
+	}
+	if (!_deferredFullPacketList.initialize(env, _packetDirectory)) {
+		return false;
+	}
 	
 	/* NULL out the packetsBlocks array to begin with */
 	for(uintptr_t i = 0; i < _maxPacketsBlocks; i++) {    
@@ -191,9 +198,14 @@ MM_WorkPackets::initWorkPacketsBlock(MM_EnvironmentBase *env)
 	uintptr_t dataSize = _slotsInPacket * sizeof(uintptr_t);
 	uintptr_t *baseAddress = NULL;
 
+	Assert_MM_true((_activePackets + _packetsPerBlock) <= _maxPackets);
 	for(uintptr_t i = 0; i < _packetsPerBlock; i++) {
 		baseAddress = (uintptr_t *) (dataStart + (i * dataSize));
 		currentPtr->initialize(env, nextPtr, previousPtr, baseAddress, _slotsInPacket);
+		currentPtr->_packetIndex = _activePackets + i;
+		if (NULL != _packetDirectory) {
+			_packetDirectory[_activePackets + i] = currentPtr;
+		}
 
 		previousPtr = currentPtr;
 		currentPtr += 1;
@@ -247,6 +259,11 @@ MM_WorkPackets::tearDown(MM_EnvironmentBase *env)
 	_relativelyFullPacketList.tearDown(env);
 	_deferredPacketList.tearDown(env);
 	_deferredFullPacketList.tearDown(env);
+
+	if (NULL != _packetDirectory) {
+		env->getForge()->free(_packetDirectory);
+		_packetDirectory = NULL;
+	}
 }
 
 void
@@ -469,9 +486,12 @@ MM_WorkPackets::getInputPacket(MM_EnvironmentBase *env)
 
 					if (_inputListDoneIndex != doneIndex) {
 						env->_workPacketStats.addToCompleteStallTime(waitStartTime, waitEndTime);
+						env->_taskCompleteStallCount += 1;
 					} else {
 						env->_workPacketStats.addToWorkStallTime(waitStartTime, waitEndTime);
+						env->_taskWorkStallCount += 1;
 					}
+					env->addToTaskStallTime(waitStartTime, waitEndTime);
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 
 #if defined(OMR_GC_VLHGC)
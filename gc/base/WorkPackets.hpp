@@ -73,6 +73,7 @@ protected:
 	uintptr_t _packetsBlocksTop;
 	omrthread_monitor_t _allocatingPackets;
 	MM_Packet *_packetsStart[_maxPacketsBlocks];
+	MM_Packet **_packetDirectory; /**< all packets indexed by MM_Packet::_packetIndex (_maxPackets entries), allocated only if packetListLockFree */
 	MM_PacketList _emptyPacketList;  /**< List for empty packets */
 	MM_PacketList _fullPacketList;  /**< List for full packets */
 	MM_PacketList _relativelyFullPacketList;  /**< List for relatively full packets */
@@ -226,6 +227,7 @@ public:
 		_activePackets(0),
 		_packetsBlocksTop(0),
 		_allocatingPackets(NULL),
+		_packetDirectory(NULL),
 		_emptyPacketList(env),
 		_fullPacketList(env),
 		_relativelyFullPacketList(env),
@@ -227,6 +227,8 @@ getExpandReasonAsString(ExpandReason reason)
 		return "forced nursery expand";
 	case HINT_PREVIOUS_RUNS:
 		return "hint from previous runs";
+	case PREDICTED_DEMAND:
+		return "predicted allocation demand";
 	default:
 		return "unknown";
 	}
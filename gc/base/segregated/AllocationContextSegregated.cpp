@@ -247,7 +247,8 @@ MM_AllocationContextSegregated::tryAllocateFromRegionPool(MM_EnvironmentBase *en
 bool
 MM_AllocationContextSegregated::shouldPreMarkSmallCells(MM_EnvironmentBase *env)
 {
-	return true;
+	/* In nursery mode an unmarked cell is a young object, so new cells must not be allocated black */
+	return !env->getExtensions()->segregatedNursery;
 }
 
 /*
@@ -299,16 +300,22 @@ MM_AllocationContextSegregated::preAllocateSmall(MM_EnvironmentBase *env, uintpt
 
 			flushSmall(env, sizeClass);
 
-			/* Attempt to get a region of this size class which may already have some allocated cells */
-			if (!tryAllocateRegionFromSmallSizeClass(env, sizeClass)) {
-				/* Attempt to get a region by sweeping */
-				if (!trySweepAndAllocateRegionFromSmallSizeClass(env, sizeClass, &sweepCount, &sweepStartTime)) {
-					/* Attempt to get an unused region */
-					if (!tryAllocateFromRegionPool(env, sizeClass)) {
-						/* Really out of regions */
-						done = true;
+			/* Stop handing out regions once the nursery is full so that a nursery collection runs */
+			if (_regionPool->reserveNurseryRegions(1)) {
+				/* Attempt to get a region of this size class which may already have some allocated cells */
+				if (!tryAllocateRegionFromSmallSizeClass(env, sizeClass)) {
+					/* Attempt to get a region by sweeping */
+					if (!trySweepAndAllocateRegionFromSmallSizeClass(env, sizeClass, &sweepCount, &sweepStartTime)) {
+						/* Attempt to get an unused region */
+						if (!tryAllocateFromRegionPool(env, sizeClass)) {
+							/* Really out of regions */
+							_regionPool->releaseNurseryRegions(1);
+							done = true;
+						}
 					}
 				}
+			} else {
+				done = true;
 			}
 		}
 
@@ -364,11 +371,20 @@ MM_AllocationContextSegregated::allocateLarge(MM_EnvironmentBase *env, uintptr_t
 	MM_HeapRegionDescriptorSegregated *region = NULL;
 	uintptr_t excess = 0;
 
+	if (!_regionPool->reserveNurseryRegions(neededRegions)) {
+		/* The nursery is full, fail the allocation so that a nursery collection runs */
+		return NULL;
+	}
+
 	while (region == NULL && excess < MAX_UINT) {
 		region = _regionPool->allocateFromRegionPool(env, neededRegions, OMR_SIZECLASSES_LARGE, excess);
 		excess = (2 * excess) + 1;
 	}
 
+	if (NULL == region) {
+		_regionPool->releaseNurseryRegions(neededRegions);
+	}
+
 	uintptr_t *result = (region == NULL) ? NULL : (uintptr_t *)region->getLowAddress();
 
 	/* Flush the large page right away. */
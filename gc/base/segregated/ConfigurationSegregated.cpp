@@ -79,12 +79,13 @@ MM_ConfigurationSegregated::initialize(MM_EnvironmentBase *env)
 {
 
 	bool success = false;
-
-	/* OMRTODO investigate why these must be equal or it segfaults. */
 	MM_GCExtensionsBase *extensions = env->getExtensions();
-	extensions->splitAvailableListSplitAmount = extensions->gcThreadCount;
 
 	if (MM_Configuration::initialize(env)) {
+		/* OMRTODO investigate why these must be equal or it segfaults.
+		 * The gc thread count is only known once the base configuration has initialized.
+		 */
+		extensions->splitAvailableListSplitAmount = extensions->gcThreadCount;
 		env->getOmrVM()->_sizeClasses = _delegate.getSegregatedSizeClasses(env);
 		if (NULL != env->getOmrVM()->_sizeClasses) {
 			extensions->setSegregatedHeap(true);
@@ -93,6 +94,15 @@ MM_ConfigurationSegregated::initialize(MM_EnvironmentBase *env)
 			success = true;
 		}
 	}
+
+	/* the segregated heap resizes through MM_MemorySubSpaceUniSpace, which needs the same thresholds as the standard collectors */
+	if (!extensions->heapExpansionGCRatioThreshold._wasSpecified) {
+		extensions->heapExpansionGCRatioThreshold._valueSpecified = 13;
+	}
+
+	if (!extensions->heapContractionGCRatioThreshold._wasSpecified) {
+		extensions->heapContractionGCRatioThreshold._valueSpecified = 5;
+	}
 	return success;
 }
 
@@ -134,6 +144,14 @@ MM_ConfigurationSegregated::createDefaultMemorySpace(MM_EnvironmentBase *env, MM
 		return NULL;
 	}
 
+	if (extensions->segregatedNursery) {
+		/* by default a quarter of the heap is handed out for allocation between nursery collections */
+		if (0 == extensions->segregatedNurserySize) {
+			extensions->segregatedNurserySize = extensions->memoryMax / 4;
+		}
+		regionPool->setNurseryRegionLimit(OMR_MAX(1, regionPool->divideUpRegion(extensions->segregatedNurserySize)));
+	}
+
 	extensions->globalAllocationManager = MM_GlobalAllocationManagerSegregated::newInstance(env, regionPool);
 	if(NULL == extensions->globalAllocationManager) {
 		return NULL;
@@ -123,6 +123,8 @@ private:
 	MM_HeapRegionQueue *_largeSweepRegions; /**< Large object regions that are waiting to be swept during this GC cycle. */
 
 	volatile uintptr_t _regionsInUse; /**< Number of regions that are in use (not on a free list). */
+	volatile uintptr_t _nurseryRegionCount; /**< Number of regions handed out for allocation since the last collection. */
+	uintptr_t _nurseryRegionLimit; /**< Number of regions that may be handed out for allocation between collections (0 means unlimited). */
 	
 	/**	
 	 * @note Maintain average occupancy (used cells/total cells), calculated after sweep
@@ -193,6 +195,43 @@ public:
 	
 	uintptr_t getRegionsInuse() { return _regionsInUse; }	
 
+	/**
+	 * Account for regions about to be handed out to an allocation context.
+	 * In nursery mode the number of regions handed out between collections is bounded, so
+	 * that allocation fails (and a nursery collection runs) once the nursery is full. A request
+	 * larger than the whole nursery is still granted while the nursery is empty.
+	 * @param count the number of regions requested
+	 * @return true if the regions fit in the nursery, false if a collection is required first
+	 */
+	MMINLINE bool
+	reserveNurseryRegions(uintptr_t count)
+	{
+		bool result = true;
+		if (0 != _nurseryRegionLimit) {
+			uintptr_t nurseryRegionCount = MM_AtomicOperations::add(&_nurseryRegionCount, count);
+			if ((nurseryRegionCount > _nurseryRegionLimit) && (nurseryRegionCount != count)) {
+				MM_AtomicOperations::subtract(&_nurseryRegionCount, count);
+				result = false;
+			}
+		}
+		return result;
+	}
+
+	/**
+	 * Return regions reserved by reserveNurseryRegions() which could not be allocated.
+	 */
+	MMINLINE void
+	releaseNurseryRegions(uintptr_t count)
+	{
+		if (0 != _nurseryRegionLimit) {
+			MM_AtomicOperations::subtract(&_nurseryRegionCount, count);
+		}
+	}
+
+	MMINLINE void resetNurseryRegions() { _nurseryRegionCount = 0; }
+	MMINLINE uintptr_t getNurseryRegionCount() const { return _nurseryRegionCount; }
+	MMINLINE void setNurseryRegionLimit(uintptr_t limit) { _nurseryRegionLimit = limit; }
+
 	MMINLINE uintptr_t getInitialCountOfSweepRegions(uintptr_t sizeClass) const
 	{
 		assume(sizeClass >= OMR_SIZECLASSES_MIN_SMALL && sizeClass <= OMR_SIZECLASSES_MAX_SMALL, "getOccupancy: invalid sizeclass");
@@ -276,6 +315,8 @@ public:
 		, _largeFullRegions(NULL)
 		, _largeSweepRegions(NULL)
 		, _regionsInUse(0)
+		, _nurseryRegionCount(0)
+		, _nurseryRegionLimit(0)
 		, _isSweepingSmall(false)
 	{
 		_typeId = __FUNCTION__;
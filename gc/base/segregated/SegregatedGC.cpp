@@ -25,14 +25,22 @@
 #include "EnvironmentBase.hpp"
 #include "GlobalAllocationManagerSegregated.hpp"
 #include "Heap.hpp"
+#include "HeapMapIterator.hpp"
+#include "HeapRegionDescriptor.hpp"
+#include "HeapRegionIterator.hpp"
 #include "MarkMap.hpp"
 #include "modronapicore.hpp"
 #include "MemoryPoolSegregated.hpp"
 #include "ParallelDispatcher.hpp"
 #include "ParallelMarkTask.hpp"
+#include "RegionPoolSegregated.hpp"
 #include "SegregatedAllocationInterface.hpp"
 #include "SegregatedMarkingScheme.hpp"
+#include "SegregatedNurseryMarkTask.hpp"
 #include "SegregatedSweepTask.hpp"
+#include "SublistIterator.hpp"
+#include "SublistPuddle.hpp"
+#include "SublistSlotIterator.hpp"
 #include "SweepSchemeSegregated.hpp"
 #include "SweepStats.hpp"
 #include "WorkPackets.hpp"
@@ -94,6 +102,10 @@ MM_SegregatedGC::initialize(MM_EnvironmentBase *env)
 	}
 
 	_sweepScheme->setClearMarkMapAfterSweep(false);
+
+	if (0 != omrthread_monitor_init_with_name(&_rememberedSetMonitor, 0, "MM_SegregatedGC remembered set monitor")) {
+		return false;
+	}
 	return true;
 }
 
@@ -112,6 +124,11 @@ MM_SegregatedGC::tearDown(MM_EnvironmentBase *env)
 		_sweepScheme->kill(env);
 		_sweepScheme = NULL;
 	}
+
+	if (NULL != _rememberedSetMonitor) {
+		omrthread_monitor_destroy(_rememberedSetMonitor);
+		_rememberedSetMonitor = NULL;
+	}
 }
 
 bool
@@ -204,12 +221,24 @@ MM_SegregatedGC::internalGarbageCollect(MM_EnvironmentBase *env, MM_MemorySubSpa
 //	}
 
 	/* run the mark */
-	bool initMarkMap = true; // reset the markmap?
-	MM_ParallelMarkTask markTask(env, _dispatcher, _markingScheme, initMarkMap, env->_cycleState);
-	_dispatcher->run(env, &markTask);
+	if (shouldCollectNursery(env)) {
+		/* only objects allocated since the previous collection are traced */
+		_extensions->globalGCStats.nurseryCollect = true;
+		MM_SegregatedNurseryMarkTask markTask(env, _dispatcher, _markingScheme, &_extensions->rememberedSet, env->_cycleState);
+		_dispatcher->run(env, &markTask);
+	} else {
+		bool initMarkMap = true; // reset the markmap?
+		MM_ParallelMarkTask markTask(env, _dispatcher, _markingScheme, initMarkMap, env->_cycleState);
+		_dispatcher->run(env, &markTask);
+	}
 
 	Assert_MM_true(_markingScheme->getWorkPackets()->isAllPacketsEmpty());
 
+	/* every object reachable after marking is old, so nothing needs to stay remembered */
+	if (_extensions->segregatedNursery) {
+		clearRememberedSet(env);
+	}
+
 	/* Do any post mark checks */
 	/* OMRTODO we need to implement this function for segregated marking scheme */
 //	_markingScheme->mainCleanupAfterGC(env);
@@ -244,9 +273,66 @@ MM_SegregatedGC::internalGarbageCollect(MM_EnvironmentBase *env, MM_MemorySubSpa
 		((MM_SegregatedAllocationInterface *)(walkEnv->_objectAllocationInterface))->restartCache(walkEnv);
 	}
 
+	/* Open a new nursery */
+	((MM_MemoryPoolSegregated *) env->getDefaultMemorySubSpace()->getMemoryPool())->getRegionPool()->resetNurseryRegions();
+
 	return true;
 }
 
+bool
+MM_SegregatedGC::shouldCollectNursery(MM_EnvironmentBase *env)
+{
+	bool result = false;
+	if (_extensions->segregatedNursery) {
+		MM_GCCode gcCode = env->_cycleState->_gcCode;
+		result = !gcCode.isExplicitGC() && !gcCode.isAggressiveGC() && !gcCode.isOutOfMemoryGC() && !_rememberedSetOverflow;
+	}
+	return result;
+}
+
+void
+MM_SegregatedGC::addToRememberedSet(MM_EnvironmentBase *env, omrobjectptr_t objectPtr)
+{
+	omrthread_monitor_enter(_rememberedSetMonitor);
+	uintptr_t *rememberedSetEntry = _extensions->rememberedSet.allocateElementNoContention(env);
+	if (NULL != rememberedSetEntry) {
+		*rememberedSetEntry = (uintptr_t)objectPtr;
+	} else {
+		/* the object stays flagged as remembered, the next collection marks the whole heap instead */
+		_rememberedSetOverflow = true;
+	}
+	omrthread_monitor_exit(_rememberedSetMonitor);
+}
+
+void
+MM_SegregatedGC::clearRememberedSet(MM_EnvironmentBase *env)
+{
+	MM_SublistPuddle *puddle = NULL;
+	GC_SublistIterator rememberedSetIterator(&_extensions->rememberedSet);
+	while (NULL != (puddle = rememberedSetIterator.nextList())) {
+		GC_SublistSlotIterator rememberedSetSlotIterator(puddle);
+		omrobjectptr_t *slotPtr = NULL;
+		while (NULL != (slotPtr = (omrobjectptr_t *)rememberedSetSlotIterator.nextSlot())) {
+			_extensions->objectModel.clearRemembered(*slotPtr);
+		}
+	}
+	_extensions->rememberedSet.clear(env);
+
+	if (_rememberedSetOverflow) {
+		/* overflowed objects were never recorded, find them by walking the marked objects */
+		MM_HeapRegionDescriptor *region = NULL;
+		GC_HeapRegionIterator regionIterator(_extensions->heap->getHeapRegionManager());
+		while (NULL != (region = regionIterator.nextRegion())) {
+			MM_HeapMapIterator markedObjectIterator(_extensions, _markingScheme->getMarkMap(), (uintptr_t *)region->getLowAddress(), (uintptr_t *)region->getHighAddress());
+			omrobjectptr_t objectPtr = NULL;
+			while (NULL != (objectPtr = markedObjectIterator.nextObject())) {
+				_extensions->objectModel.clearRemembered(objectPtr);
+			}
+		}
+		_rememberedSetOverflow = false;
+	}
+}
+
 void
 MM_SegregatedGC::internalPreCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *subSpace, MM_AllocateDescription *allocDescription, uint32_t gcCode)
 {
@@ -48,6 +48,9 @@ protected:
 
 	MM_CycleState _cycleState;  /**< Embedded cycle state to be used as the main cycle state for GC activity */
 	MM_CollectionStatisticsStandard _collectionStatistics; /** Common collect stats (memory, time etc.) */
+
+	omrthread_monitor_t _rememberedSetMonitor; /**< Serializes additions to the nursery remembered set */
+	volatile bool _rememberedSetOverflow; /**< Set when an old object could not be remembered, forcing the next collection to be a full one */
 private:
 public:
 	/* OMRTODO Remove _objectsMarked and _scanBytes, they are used to fake marking to create more interesting verbose output */
@@ -73,6 +76,21 @@ protected:
 	void reportSweepStart(MM_EnvironmentBase *env);
 	void reportSweepEnd(MM_EnvironmentBase *env);
 
+	/**
+	 * Decide whether the current collection can be restricted to the nursery.
+	 * Explicit, aggressive and out of memory collections, and any collection following a
+	 * remembered set overflow, mark the whole heap.
+	 */
+	bool shouldCollectNursery(MM_EnvironmentBase *env);
+
+	/**
+	 * Clear the remembered state of every remembered object and empty the remembered set.
+	 * Must be called after marking and before sweeping, while all remembered objects are still intact.
+	 */
+	void clearRememberedSet(MM_EnvironmentBase *env);
+
+	void addToRememberedSet(MM_EnvironmentBase *env, omrobjectptr_t objectPtr);
+
 public:
 	static MM_SegregatedGC *newInstance(MM_EnvironmentBase *env);
 	virtual void kill(MM_EnvironmentBase *env);
@@ -99,6 +117,25 @@ public:
 
 	virtual bool isMarked(void *objectPtr) { return _markingScheme->isMarked(static_cast<omrobjectptr_t>(objectPtr)); }
 
+	/**
+	 * Nursery write barrier. Mark bits survive a collection, so in nursery mode a marked object is old and an
+	 * unmarked one was allocated since the previous collection. Storing a young child into an old parent
+	 * remembers the parent so that the next nursery collection scans it.
+	 *
+	 * @param env the mutator thread making the assignment
+	 * @param parentObject the object being stored into
+	 * @param childObject the reference being stored
+	 */
+	virtual void
+	nurseryWriteBarrier(MM_EnvironmentBase *env, omrobjectptr_t parentObject, omrobjectptr_t childObject)
+	{
+		if ((NULL != childObject) && _markingScheme->isMarked(parentObject) && !_markingScheme->isMarked(childObject)) {
+			if (_extensions->objectModel.atomicSetRememberedState(parentObject, STATE_REMEMBERED)) {
+				addToRememberedSet(env, parentObject);
+			}
+		}
+	}
+
 	/**
 	 * Return reference to Marking Scheme
 	 */
@@ -119,6 +156,8 @@ public:
 		, _markingScheme(NULL)
 		, _sweepScheme(NULL)
 		, _dispatcher(_extensions->dispatcher)
+		, _rememberedSetMonitor(NULL)
+		, _rememberedSetOverflow(false)
 		, _scanBytes(0)
 		, _objectsMarked(0)
 	{
@@ -0,0 +1,99 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "AtomicOperations.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "ModronAssertions.h"
+#include "SegregatedMarkingScheme.hpp"
+#include "SublistIterator.hpp"
+#include "SublistPool.hpp"
+#include "SublistPuddle.hpp"
+#include "SublistSlotIterator.hpp"
+#include "WorkPackets.hpp"
+#include "WorkStack.hpp"
+
+#include "SegregatedNurseryMarkTask.hpp"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+void
+MM_SegregatedNurseryMarkTask::run(MM_EnvironmentBase *env)
+{
+	env->_workStack.prepareForWork(env, (MM_WorkPackets *)(_markingScheme->getWorkPackets()));
+
+	/* keep the mark map: marked objects are old and implicitly live */
+	_markingScheme->markLiveObjectsInit(env, false);
+	_markingScheme->markLiveObjectsRoots(env, true);
+	scanRememberedSet(env);
+	_markingScheme->markLiveObjectsScan(env);
+	_markingScheme->markLiveObjectsComplete(env);
+
+	env->_workStack.flush(env);
+}
+
+void
+MM_SegregatedNurseryMarkTask::scanRememberedSet(MM_EnvironmentBase *env)
+{
+	uintptr_t rememberedCount = 0;
+	MM_SublistPuddle *puddle = NULL;
+	GC_SublistIterator rememberedSetIterator(_rememberedSet);
+	while (NULL != (puddle = rememberedSetIterator.nextList())) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			GC_SublistSlotIterator rememberedSetSlotIterator(puddle);
+			omrobjectptr_t *slotPtr = NULL;
+			while (NULL != (slotPtr = (omrobjectptr_t *)rememberedSetSlotIterator.nextSlot())) {
+				_markingScheme->scanObject(env, *slotPtr, SCAN_REASON_REMEMBERED_SET_SCAN);
+				rememberedCount += 1;
+			}
+		}
+	}
+
+	if (0 != rememberedCount) {
+		MM_AtomicOperations::add(&env->getExtensions()->globalGCStats.nurseryRememberedCount, rememberedCount);
+	}
+}
+
+void
+MM_SegregatedNurseryMarkTask::setup(MM_EnvironmentBase *env)
+{
+	if (env->isMainThread()) {
+		Assert_MM_true(_cycleState == env->_cycleState);
+	} else {
+		Assert_MM_true(NULL == env->_cycleState);
+		env->_cycleState = _cycleState;
+	}
+}
+
+void
+MM_SegregatedNurseryMarkTask::cleanup(MM_EnvironmentBase *env)
+{
+	_markingScheme->workerCleanupAfterGC(env);
+
+	if (env->isMainThread()) {
+		Assert_MM_true(_cycleState == env->_cycleState);
+	} else {
+		env->_cycleState = NULL;
+	}
+}
+
+#endif /* OMR_GC_SEGREGATED_HEAP */
@@ -0,0 +1,79 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(SEGREGATEDNURSERYMARKTASK_HPP_)
+#define SEGREGATEDNURSERYMARKTASK_HPP_
+
+#include "omrmodroncore.h"
+
+#include "CycleState.hpp"
+#include "ParallelTask.hpp"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+class MM_EnvironmentBase;
+class MM_ParallelDispatcher;
+class MM_SegregatedMarkingScheme;
+class MM_SublistPool;
+
+/**
+ * Marks the objects allocated since the previous collection.
+ * The mark map is not cleared, so objects which survived an earlier collection are still marked and
+ * tracing stops at them. Old objects holding references to young ones are found through the remembered set.
+ */
+class MM_SegregatedNurseryMarkTask : public MM_ParallelTask
+{
+/* Data members / types */
+public:
+protected:
+private:
+	MM_SegregatedMarkingScheme *_markingScheme;
+	MM_SublistPool *_rememberedSet; /**< Old objects which had a young object stored into them */
+	MM_CycleState *_cycleState; /**< Collection cycle state active for the task */
+
+/* Methods */
+public:
+	virtual uintptr_t getVMStateID() { return OMRVMSTATE_GC_MARK; };
+
+	virtual void run(MM_EnvironmentBase *env);
+	virtual void setup(MM_EnvironmentBase *env);
+	virtual void cleanup(MM_EnvironmentBase *env);
+
+	MM_SegregatedNurseryMarkTask(MM_EnvironmentBase *env, MM_ParallelDispatcher *dispatcher, MM_SegregatedMarkingScheme *markingScheme, MM_SublistPool *rememberedSet, MM_CycleState *cycleState)
+		: MM_ParallelTask(env, dispatcher)
+		, _markingScheme(markingScheme)
+		, _rememberedSet(rememberedSet)
+		, _cycleState(cycleState)
+	{
+		_typeId = __FUNCTION__;
+	}
+protected:
+private:
+	/**
+	 * Scan every remembered object, marking (and queuing) the young objects it references.
+	 */
+	void scanRememberedSet(MM_EnvironmentBase *env);
+};
+
+#endif /* OMR_GC_SEGREGATED_HEAP */
+
+#endif /* SEGREGATEDNURSERYMARKTASK_HPP_ */
@@ -429,7 +429,8 @@ MM_CompactScheme::createSubAreaTable(MM_EnvironmentStandard *env, bool singleThr
 			MM_MemorySubSpace *memorySubSpace = region->getSubSpace();
 			intptr_t state = SubAreaEntry::init;
 
-			if (singleThreaded) {
+			/* an incremental compaction needs several sub areas to choose its window from */
+			if (singleThreaded && !_incremental) {
 				size = areaSize;
 			}
 			_subAreaTable[i].firstObject = (omrobjectptr_t)lowAddress;
@@ -441,6 +442,7 @@ MM_CompactScheme::createSubAreaTable(MM_EnvironmentStandard *env, bool singleThr
 				uint8_t *p = (uint8_t*)(((uintptr_t)lowAddress) + (subAreaNum * size));
 
 				_subAreaTable[i].freeChunk = (omrobjectptr_t)p;
+				_subAreaTable[i].liveBytes = 0;
 				_subAreaTable[i].memoryPool = memorySubSpace->getMemoryPool(p);
 				_subAreaTable[i].state = state;
 				_subAreaTable[i++].currentAction = SubAreaEntry::none;
@@ -448,6 +450,7 @@ MM_CompactScheme::createSubAreaTable(MM_EnvironmentStandard *env, bool singleThr
 			_subAreaTable[i].freeChunk = (omrobjectptr_t)highAddress;
 			_subAreaTable[i].memoryPool = NULL;
 			_subAreaTable[i].firstObject = (omrobjectptr_t)highAddress;
+			_subAreaTable[i].liveBytes = 0;
 			_subAreaTable[i].state = SubAreaEntry::end_segment;
 			_subAreaTable[i++].currentAction = SubAreaEntry::none;
 		}
@@ -464,12 +467,15 @@ void
 MM_CompactScheme::setRealLimitsSubAreas(MM_EnvironmentStandard *env)
 {
 	/* multi threaded pass to find real regions limits - where an object is found */
-	for (uintptr_t i = 1; _subAreaTable[i].state != SubAreaEntry::end_heap; i++) {
-		/* i=1 because first region starts with heapAlloc thus we don't need to find its first object */
-		if ((SubAreaEntry::end_segment == _subAreaTable[i].state)
-		|| (SubAreaEntry::end_segment == _subAreaTable[i - 1].state)
-		) {
-			/* skip the end_segment and its successor */
+	for (uintptr_t i = 0; _subAreaTable[i].state != SubAreaEntry::end_heap; i++) {
+		if (SubAreaEntry::end_segment == _subAreaTable[i].state) {
+			continue;
+		}
+		/* the first sub area of a segment starts with heapAlloc thus we don't need to find its first object,
+		 * but an incremental compaction still needs its live bytes
+		 */
+		bool firstInSegment = (0 == i) || (SubAreaEntry::end_segment == _subAreaTable[i - 1].state);
+		if (firstInSegment && !_incremental) {
 			continue;
 		}
 
@@ -479,8 +485,19 @@ MM_CompactScheme::setRealLimitsSubAreas(MM_EnvironmentStandard *env)
 			MM_HeapMapIterator markedObjectIterator(_extensions, _markMap, start, end);
 			omrobjectptr_t objectPtr = markedObjectIterator.nextObject();
 
-			_subAreaTable[i].firstObject = objectPtr;
-			Assert_MM_true(objectPtr == 0 || _markMap->isBitSet(objectPtr));
+			if (!firstInSegment) {
+				_subAreaTable[i].firstObject = objectPtr;
+				Assert_MM_true(objectPtr == 0 || _markMap->isBitSet(objectPtr));
+			}
+
+			if (_incremental) {
+				uintptr_t liveBytes = 0;
+				while (NULL != objectPtr) {
+					liveBytes += _extensions->objectModel.getConsumedSizeInBytesWithHeader(objectPtr);
+					objectPtr = markedObjectIterator.nextObject();
+				}
+				_subAreaTable[i].liveBytes = liveBytes;
+			}
 		}
 	}
 }
@@ -493,26 +510,86 @@ MM_CompactScheme::removeNullSubAreas(MM_EnvironmentStandard *env)
 {
 	/*single threaded pass to eliminate null sub areas */
 	if (env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
-		_compactFrom = (omrobjectptr_t)_heap->getHeapTop();
-		_compactTo   = (omrobjectptr_t)_heap->getHeapBase();
 		uintptr_t j = 0;
 		for (uintptr_t i = 0; _subAreaTable[i].state != SubAreaEntry::end_heap; i++) {
 			if (NULL != _subAreaTable[i].firstObject) {
 				_subAreaTable[j].firstObject = _subAreaTable[i].firstObject;
 				_subAreaTable[j].memoryPool = _subAreaTable[i].memoryPool;
+				_subAreaTable[j].liveBytes = _subAreaTable[i].liveBytes;
 				_subAreaTable[j].state = _subAreaTable[i].state;
-				if ((j > 0) && (_subAreaTable[j-1].state == SubAreaEntry::init)) {
-					_compactFrom = (_compactFrom < _subAreaTable[j-1].firstObject) ? _compactFrom : _subAreaTable[j-1].firstObject;
-					_compactTo = (_compactTo > _subAreaTable[j].firstObject) ? _compactTo : _subAreaTable[j].firstObject;
-				}
 				_subAreaTable[j].freeChunk = 0;
 				j++;
 			}
 		}
+
+		if (_incremental) {
+			selectIncrementalWindow(env, j);
+		}
+
+		/* objects outside of the sub areas being compacted are never forwarded */
+		_compactFrom = (omrobjectptr_t)_heap->getHeapTop();
+		_compactTo   = (omrobjectptr_t)_heap->getHeapBase();
+		for (uintptr_t i = 1; i < j; i++) {
+			if (_subAreaTable[i-1].state == SubAreaEntry::init) {
+				_compactFrom = (_compactFrom < _subAreaTable[i-1].firstObject) ? _compactFrom : _subAreaTable[i-1].firstObject;
+				_compactTo = (_compactTo > _subAreaTable[i].firstObject) ? _compactTo : _subAreaTable[i].firstObject;
+			}
+		}
 		env->_currentTask->releaseSynchronizedGCThreads(env);
 	}
 }
 
+void
+MM_CompactScheme::selectIncrementalWindow(MM_EnvironmentStandard *env, uintptr_t subAreaCount)
+{
+	uintptr_t maxLiveBytes = _extensions->incrementalCompactMaxLiveBytes;
+	uintptr_t bestStart = 0;
+	uintptr_t bestEnd = 0;
+	uintptr_t bestFreeBytes = 0;
+	uintptr_t windowStart = 0;
+	uintptr_t windowLiveBytes = 0;
+	uintptr_t windowFreeBytes = 0;
+
+	/* Slide a window over each segment, shrinking it from the front whenever its live bytes exceed the
+	 * budget. The window must not span a segment end, so that [_compactFrom, _compactTo) covers no
+	 * fixup_only sub area whose mark bits are still needed.
+	 */
+	for (uintptr_t i = 0; i < subAreaCount; i++) {
+		if (SubAreaEntry::end_segment == _subAreaTable[i].state) {
+			windowStart = i + 1;
+			windowLiveBytes = 0;
+			windowFreeBytes = 0;
+			continue;
+		}
+		windowLiveBytes += _subAreaTable[i].liveBytes;
+		windowFreeBytes += subAreaFreeBytes(i);
+		while (windowLiveBytes > maxLiveBytes) {
+			windowLiveBytes -= _subAreaTable[windowStart].liveBytes;
+			windowFreeBytes -= subAreaFreeBytes(windowStart);
+			windowStart += 1;
+		}
+		if (windowFreeBytes > bestFreeBytes) {
+			bestFreeBytes = windowFreeBytes;
+			bestStart = windowStart;
+			bestEnd = i + 1;
+		}
+	}
+
+	MM_CompactStats *compactStats = &env->_compactStats;
+	for (uintptr_t i = 0; i < subAreaCount; i++) {
+		if (SubAreaEntry::init == _subAreaTable[i].state) {
+			if ((i >= bestStart) && (i < bestEnd)) {
+				compactStats->_evacuatedSubAreas += 1;
+				compactStats->_evacuatedLiveBytes += _subAreaTable[i].liveBytes;
+			} else {
+				_subAreaTable[i].state = SubAreaEntry::fixup_only;
+				compactStats->_deferredSubAreas += 1;
+				compactStats->_deferredLiveBytes += _subAreaTable[i].liveBytes;
+			}
+		}
+	}
+}
+
 /**
  *  Complete setup for each sub area.
  */
@@ -556,6 +633,8 @@ MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, boo
 		 * done at a synchronize point?
 		 */
 		mainSetupForGC(env);
+		/* an aggressive compaction has to recover as much as possible, so it always compacts the whole heap */
+		_incremental = _extensions->incrementalCompact && !aggressive;
 #if defined(DEBUG)
 		_delegate.verifyHeap(env, _markMap);
 #endif /* DEBUG */
@@ -713,6 +792,11 @@ void MM_CompactScheme::rebuildFreelist(MM_EnvironmentStandard *env)
 
 				currentFreeBase = NULL;
 				currentFreeSize = 0;
+
+				if (SubAreaEntry::fixup_only == subAreaTable[i].state) {
+					/* objects were left in place so the holes between them are still free */
+					currentFreeBase = rebuildFreelistInFixupOnlySubArea(env, memorySubSpace, poolState, subAreaTable[i].firstObject, subAreaTable[i + 1].firstObject);
+				}
 			}
         } while (subAreaTable[i++].state != SubAreaEntry::end_segment);
 
@@ -814,6 +898,26 @@ MM_CompactScheme::addFreeEntry(MM_EnvironmentStandard *env, MM_MemorySubSpace *m
 	}
 }
 
+void *
+MM_CompactScheme::rebuildFreelistInFixupOnlySubArea(MM_EnvironmentStandard *env, MM_MemorySubSpace *memorySubSpace, MM_CompactMemoryPoolState *poolState, omrobjectptr_t start, omrobjectptr_t end)
+{
+	void *currentFreeBase = (void *)start;
+
+	/* the marked objects of a sub area all start before the page of the next sub area's first object */
+	MM_HeapMapIterator markedObjectIterator(_extensions, _markMap, (uintptr_t *)start, (uintptr_t *)pageStart(pageIndex(end)));
+	omrobjectptr_t objectPtr = NULL;
+	while (NULL != (objectPtr = markedObjectIterator.nextObject())) {
+		if ((void *)objectPtr > currentFreeBase) {
+#if defined(DEBUG_PAINT_FREE)
+			memset(currentFreeBase, 0xDD, (uintptr_t)objectPtr - (uintptr_t)currentFreeBase);
+#endif /* DEBUG_PAINT_FREE */
+			addFreeEntry(env, memorySubSpace, poolState, currentFreeBase, (uintptr_t)objectPtr - (uintptr_t)currentFreeBase);
+		}
+		currentFreeBase = (void *)((uintptr_t)objectPtr + _extensions->objectModel.getConsumedSizeInBytesWithHeader(objectPtr));
+	}
+
+	return (currentFreeBase < (void *)end) ? currentFreeBase : NULL;
+}
 
 void
 MM_CompactScheme::moveObjects(MM_EnvironmentStandard *env, uintptr_t &objectCount, uintptr_t &byteCount, uintptr_t &skippedObjectCount)
@@ -1417,7 +1521,7 @@ MM_CompactScheme::rebuildMarkbits(MM_EnvironmentStandard *env)
 		intptr_t i;
         for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
         	/* We only have to rebuild the markbits for sub areas which contain moved objects */
-        	if (subAreaTable->state != SubAreaEntry::fixup_only) {
+        	if (subAreaTable[i].state != SubAreaEntry::fixup_only) {
 	        	if (changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::rebuilding_mark_bits)) {
 	        		rebuildMarkbitsInSubArea(env, region, subAreaTable, i);
 				}
@@ -1492,7 +1596,7 @@ MM_CompactScheme::parallelFixHeapForWalk(MM_EnvironmentBase *env)
         	if (subAreaTable[i].state == SubAreaEntry::fixup_only) {
 	        	if (changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::fixing_heap_for_walk)) {
 	        		omrobjectptr_t start = subAreaTable[i].firstObject;
-					omrobjectptr_t end   = subAreaTable[i].firstObject;
+					omrobjectptr_t end   = subAreaTable[i + 1].firstObject;
 					omrobjectptr_t alignedEnd = pageStart(pageIndex(end));
 
 					GC_ObjectHeapIteratorAddressOrderedList objectIterator(_extensions, start, end, false);
@@ -90,6 +90,7 @@ private:
 		MM_MemoryPool *memoryPool;
 		omrobjectptr_t firstObject;
 		omrobjectptr_t freeChunk;
+		uintptr_t liveBytes; /**< bytes of marked objects starting in the sub area (only gathered for incremental compaction) */
 		volatile uintptr_t state;
 		volatile uintptr_t currentAction; /**< record the status of the subarea for parallelization */
         
@@ -137,6 +138,7 @@ protected:
 	SubAreaEntry           *_subAreaTable;  /**< Reference to the subAreaTable which is shared data from the SweepHeapSectioning */
 	omrobjectptr_t         _compactFrom;
 	omrobjectptr_t         _compactTo;
+	bool                   _incremental; /**< True if this compaction evacuates only a window of sub areas (see selectIncrementalWindow) */
 	MM_CompactDelegate     _delegate;
 
 public:
@@ -168,6 +170,24 @@ protected:
 	 */
 	void setRealLimitsSubAreas(MM_EnvironmentStandard *env);
 	void removeNullSubAreas(MM_EnvironmentStandard *env);
+	/**
+	 * Choose the run of consecutive sub areas within a segment that frees the most bytes while its live
+	 * bytes stay within incrementalCompactMaxLiveBytes. All other sub areas become fixup_only, so their
+	 * objects stay in place and only have their slots updated.
+	 *
+	 * @param env[in] the current thread
+	 * @param subAreaCount[in] the number of entries in the (null-removed) sub area table
+	 */
+	void selectIncrementalWindow(MM_EnvironmentStandard *env, uintptr_t subAreaCount);
+
+	/**
+	 * Return the bytes in sub area i (up to the first object of the next sub area) not occupied by marked objects
+	 */
+	MMINLINE uintptr_t subAreaFreeBytes(uintptr_t i) const
+	{
+		uintptr_t span = (uintptr_t)_subAreaTable[i + 1].firstObject - (uintptr_t)_subAreaTable[i].firstObject;
+		return (span > _subAreaTable[i].liveBytes) ? (span - _subAreaTable[i].liveBytes) : 0;
+	}
 	void completeSubAreaTable(MM_EnvironmentStandard *env);
 
 	void saveForwardingPtr(class CompactTableEntry&,
@@ -226,6 +246,22 @@ protected:
 					void *currentFreeBase,
 					uintptr_t currentFreeSize);
 
+	/**
+	 * Add the holes between the marked objects of a fixup_only sub area to the free list, as a sweep would.
+	 *
+	 * @param env[in] the current thread
+	 * @param[in] memorySubSpace the subspace which owns the sub area
+	 * @param[in] poolState the free list being rebuilt
+	 * @param[in] start the first object of the sub area
+	 * @param[in] end the first object of the following sub area
+	 * @return the base of the trailing hole running up to end, or NULL if the last object ends at end
+	 */
+	void *rebuildFreelistInFixupOnlySubArea(MM_EnvironmentStandard *env,
+					MM_MemorySubSpace *memorySubSpace,
+					MM_CompactMemoryPoolState *poolState,
+					omrobjectptr_t start,
+					omrobjectptr_t end);
+
 	/**
 	 * Return the page index for an object.
 	 * long int, always positive (in particular, -1 is an invalid value)
@@ -335,6 +371,7 @@ public:
 		, _markMap(markingScheme->getMarkMap())
 		, _subAreaTableSize(0)
 		, _subAreaTable(NULL)
+		, _incremental(false)
 		, _delegate()
 	{
 		_typeId = __FUNCTION__;
@@ -36,6 +36,7 @@
 #include "EnvironmentStandard.hpp"
 #include "Heap.hpp"
 #include "HeapMapIterator.hpp"
+#include "HeapMapScan.hpp"
 #include "HeapRegionDescriptor.hpp"
 #include "HeapRegionIterator.hpp"
 #include "MarkingScheme.hpp"
@@ -1042,7 +1043,12 @@ MM_ConcurrentCardTable::initializeFinalCardCleaning(MM_EnvironmentBase *env)
 bool
 MM_ConcurrentCardTable::finalCleanCards(MM_EnvironmentBase *env, uintptr_t *bytesTraced)
 {
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	uint64_t cleanStartTime = omrtime_hires_clock();
 	uintptr_t traceCount = 0;
+	Card *dirtyCards[FINAL_CARD_CLEAN_BATCH_MAXIMUM];
+	uintptr_t dirtyCardCount = 0;
+	uintptr_t batchSize = OMR_MIN(OMR_MAX(_extensions->finalCardCleaningBatchSize, 1), FINAL_CARD_CLEAN_BATCH_MAXIMUM);
 	Card * nextDirtyCard;
 	omrobjectptr_t objectPtr;
 	uintptr_t cards = 0;
@@ -1057,35 +1063,40 @@ MM_ConcurrentCardTable::finalCleanCards(MM_EnvironmentBase *env, uintptr_t *byte
 	MM_MarkMap *markMap = _markingScheme->getMarkMap();
 	
 	for ( ;
-		(nextDirtyCard= getNextDirtyCard(env, _finalCardCleanMask, false)) != NULL;
+		(nextDirtyCard = getNextDirtyCards(env, _finalCardCleanMask, false, dirtyCards, batchSize, &dirtyCardCount)) != NULL;
 		) {
 
 		/* Should never get EXCLUSIVE_VMACCESS_REQUESTED in final clean cards phase */
 		assume0(nextDirtyCard != (Card *)EXCLUSIVE_VMACCESS_REQUESTED);
 
-		/* Reset counters if we are now cleaning phase 2 cards */
-		if(!phase2 && nextDirtyCard >= _firstCardInPhase2) {
-			incFinalCleanedCards(cards, phase2);
-			cards = 0;
-			phase2 = true;
-		}
+		/* The whole batch has been claimed so it must be cleaned before we return */
+		for (uintptr_t i = 0; i < dirtyCardCount; i++) {
+			Card *dirtyCard = dirtyCards[i];
 
-		/* Clean the card before we trace into it */
-		finalCleanCard(nextDirtyCard);
-		cards += 1;
+			/* Reset counters if we are now cleaning phase 2 cards */
+			if(!phase2 && dirtyCard >= _firstCardInPhase2) {
+				incFinalCleanedCards(cards, phase2);
+				cards = 0;
+				phase2 = true;
+			}
 
-		/* Calculate address of first slot heap for the card to be cleaned... */
-		uintptr_t *heapBase = (uintptr_t *)cardAddrToHeapAddr(env,nextDirtyCard);
-		/* ..and address of last slot N.B Range is EXCLUSIVE */
-		uintptr_t *heapTop = (uintptr_t *)((uint8_t *)heapBase + CARD_SIZE);
+			/* Clean the card before we trace into it */
+			finalCleanCard(dirtyCard);
+			cards += 1;
 
-		/* prevent loading mark bits prematurely */
-		MM_AtomicOperations::readBarrier();
+			/* Calculate address of first slot heap for the card to be cleaned... */
+			uintptr_t *heapBase = (uintptr_t *)cardAddrToHeapAddr(env,dirtyCard);
+			/* ..and address of last slot N.B Range is EXCLUSIVE */
+			uintptr_t *heapTop = (uintptr_t *)((uint8_t *)heapBase + CARD_SIZE);
 
-		/* Then iterate over all marked objects in the heap between the two addresses */
-		MM_HeapMapIterator markedObjectIterator(_extensions, markMap, heapBase, heapTop);
-		while (NULL != (objectPtr = markedObjectIterator.nextObject())) {
-			traceCount += _markingScheme->scanObject(env, objectPtr, SCAN_REASON_DIRTY_CARD);
+			/* prevent loading mark bits prematurely */
+			MM_AtomicOperations::readBarrier();
+
+			/* Then iterate over all marked objects in the heap between the two addresses */
+			MM_HeapMapIterator markedObjectIterator(_extensions, markMap, heapBase, heapTop);
+			while (NULL != (objectPtr = markedObjectIterator.nextObject())) {
+				traceCount += _markingScheme->scanObject(env, objectPtr, SCAN_REASON_DIRTY_CARD);
+			}
 		}
 
 		/* Have we pushed enough new refs ?*/
@@ -1100,6 +1111,8 @@ MM_ConcurrentCardTable::finalCleanCards(MM_EnvironmentBase *env, uintptr_t *byte
 	 * First update number of dirty cards cleaned
 	 */
 	incFinalCleanedCards(cards, phase2);
+	env->_cardCleaningStats._cardsCleaned += cards;
+	env->_cardCleaningStats.addToCardCleaningTime(cleanStartTime, omrtime_hires_clock());
 
 	/* ..tell caller how many bytes we traced */
 	*bytesTraced = traceCount;
@@ -1603,6 +1616,35 @@ MM_ConcurrentCardTable::resetCleaningRanges(MM_EnvironmentBase *env)
 Card*
 MM_ConcurrentCardTable::getNextDirtyCard(MM_EnvironmentBase *env, Card cardMask, bool concurrentCardClean)
 {
+	Card *dirtyCard = NULL;
+	uintptr_t dirtyCardCount = 0;
+	return getNextDirtyCards(env, cardMask, concurrentCardClean, &dirtyCard, 1, &dirtyCardCount);
+}
+
+/**
+ * Claim the next batch of dirty cards in card table.
+ *
+ * Find up to maxCards dirty cards (as defined by cardmask) in the current cleaning
+ * range and claim them, and the clean cards between them, with a single update of
+ * the range's next card. A batch is a fixed number of dirty cards rather than a
+ * fixed span of the card table, so threads claim short spans where the card table
+ * is densely dirty and long spans where it is sparse.
+ *
+ * @param cardMask - mask to apply to cards to identify those cards the caller
+ * 					 is interested in
+ * @param dirtyCards - array receiving the claimed dirty cards
+ * @param maxCards - the maximum number of dirty cards to claim
+ * @param dirtyCardCount - returns the number of dirty cards claimed
+ *
+ * @return Routine either returns address of first claimed dirty card, NULL if no
+ * more dirty cards, EXCLUSIVE_VMACCESS_REQUESTED if another thread waiting
+ * for exclusive VM access.
+ */
+Card*
+MM_ConcurrentCardTable::getNextDirtyCards(MM_EnvironmentBase *env, Card cardMask, bool concurrentCardClean, Card **dirtyCards, uintptr_t maxCards, uintptr_t *dirtyCardCount)
+{
+	*dirtyCardCount = 0;
+
 	/* Get a local copy of next current range being cleaned */
 	CleaningRange *currentRange = (CleaningRange *)_currentCleaningRange;
 
@@ -1623,29 +1665,26 @@ MM_ConcurrentCardTable::getNextDirtyCard(MM_EnvironmentBase *env, Card cardMask,
 		/* CMVC 132231 - cache _lastCardInPhase since it's volatile and min reads its arguments twice */
 		Card *lastCardInPhase = _lastCardInPhase;
 		Card *lastCardToClean = OMR_MIN(lastCardInPhase, currentRange->topCard);
-		Card *nextDirtyCard, *currentCard;
+		Card *currentCard;
+		uintptr_t found = 0;
 
 		for (currentCard = firstCard; currentCard < lastCardToClean; currentCard++) {
 
-			/* Are we are on an uintptr_t boundary? If so scan the card table a uintptr_t
-	 		 * at a time until we find a slot which is non-zero or the end of card table
-	 		 * found. This is based on the premise that the card table will be mostly
-	 		 * empty and scanning an uintptr_t at a time will reduce the time taken to
-	 		 * scan the card table.
+			/* Are we are on an uintptr_t boundary? If so scan the card table a slot
+	 		 * at a time, as many slots per step as the vector unit allows, until we find
+	 		 * a slot which is non-zero or the end of card table found. This is based on
+	 		 * the premise that the card table will be mostly empty and scanning many
+	 		 * cards at a time will reduce the time taken to scan the card table.
 	 		 */
 			if (((Card)CARD_CLEAN == *currentCard) && (0 == (uintptr_t)currentCard % sizeof(uintptr_t))) {
-				uintptr_t *nextSlot = (uintptr_t *)currentCard;
 				/* Last card may be in middle of a slot so only scan up to an including last
 				 * complete slots worth of cards; then go card at a time
 				 **/
 				uintptr_t *lastSlot = (uintptr_t *)MM_Math::roundToFloor(sizeof(uintptr_t), (uintptr_t)lastCardToClean);
-				while ((nextSlot < lastSlot) && (SLOT_ALL_CLEAN == *nextSlot)) {
-					nextSlot += 1;
-				}
 				/*
 			     * Either end of scan or a slot which contains a dirty card found. Reset scan ptr
 				 */
-				currentCard = (Card *)nextSlot;
+				currentCard = (Card *)MM_HeapMapScan::findNonEmptySlot(_extensions->heapMapScanImplementation, (uintptr_t *)currentCard, lastSlot);
 
 				if (currentCard >= lastCardToClean) {
 					break;
@@ -1661,28 +1700,39 @@ MM_ConcurrentCardTable::getNextDirtyCard(MM_EnvironmentBase *env, Card cardMask,
 			/* Yes..so check to see if another thread got to next dirty card before us ? */
 			if (firstCard != (Card *)currentRange->nextCard) {
 				/* Yes..so re-sync with race winner and start scan again */
+				found = 0;
 				break;
-			} else {
-				/* No .. so attempt to grab this card*/
-				nextDirtyCard = currentCard;
-				currentCard += 1;
-				if (concurrentCardClean && env->isExclusiveAccessRequestWaiting()) {
-					return (Card *)EXCLUSIVE_VMACCESS_REQUESTED;
-				}
+			}
 
-				/* Update next card to clean for next caller of getNextDirtyCard. If we fail
-				 * then someone beat us to it so re-sync with race winner and start again
-				 */
-				if (firstCard != (Card *)MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&currentRange->nextCard,
-											  							  (uintptr_t)firstCard,
-											  							  (uintptr_t)currentCard)) {
-					break;
-				}
-				
-				return nextDirtyCard;
+			/* No .. so add it to the batch */
+			dirtyCards[found] = currentCard;
+			found += 1;
+			if (found == maxCards) {
+				break;
 			}
 		} /* of currentCard < lastCardToClean */
 
+		if (0 < found) {
+			if (concurrentCardClean && env->isExclusiveAccessRequestWaiting()) {
+				return (Card *)EXCLUSIVE_VMACCESS_REQUESTED;
+			}
+
+			/* Attempt to grab the batch by updating next card to clean for next caller.
+			 * If we fail then someone beat us to it so re-sync with race winner and start again
+			 */
+			Card *claimTop = dirtyCards[found - 1] + 1;
+			if (firstCard == (Card *)MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&currentRange->nextCard,
+										  							  (uintptr_t)firstCard,
+										  							  (uintptr_t)claimTop)) {
+				env->_cardCleaningStats._cardsScanned += (uintptr_t)(claimTop - firstCard);
+				*dirtyCardCount = found;
+				return dirtyCards[0];
+			}
+
+			firstCard = (Card *)currentRange->nextCard;
+			continue;
+		}
+
 		/* We get here if we break out of FOR loop when another thread beat us to next
 		 * dirty card or we reach then end of the card table.
 		 *
@@ -1699,6 +1749,7 @@ MM_ConcurrentCardTable::getNextDirtyCard(MM_EnvironmentBase *env, Card cardMask,
 			firstCard = (Card *)currentRange->nextCard;
 		} else if (currentCard >= currentRange->topCard) {
 			assume0(currentCard == currentRange->topCard);
+			env->_cardCleaningStats._cardsScanned += (uintptr_t)(currentCard - firstCard);
 			/* Range complete so set nextCard of cleaning range to top card to show cleaning range finsished */
 			MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&currentRange->nextCard, (uintptr_t)currentRange->nextCard, (uintptr_t)currentRange->topCard);
 			
@@ -67,6 +67,7 @@
 
 #define SLOT_ALL_CLEAN (uintptr_t)CARD_CLEAN
 #define EXCLUSIVE_VMACCESS_REQUESTED ((uintptr_t)-1)
+#define FINAL_CARD_CLEAN_BATCH_MAXIMUM 64
  
 /**
  * @}
@@ -231,6 +232,7 @@ protected:
 	
 	bool cleanSingleCard(MM_EnvironmentBase *env, Card *card, uintptr_t bytesToClean, uintptr_t *totalBytesCleaned);
 	Card* getNextDirtyCard(MM_EnvironmentBase *env, Card cardMask, bool concurrentCardClean);
+	Card* getNextDirtyCards(MM_EnvironmentBase *env, Card cardMask, bool concurrentCardClean, Card **dirtyCards, uintptr_t maxCards, uintptr_t *dirtyCardCount);
 	
 	bool cardHasMarkedObjects(MM_EnvironmentBase *env, Card *card);
 	
@@ -384,7 +386,8 @@ public:
 	 * Do final card cleaning.
 	 *
 	 * To be called by a STW parallel mark task to clean enough cards such that we
-	 * push a packet worth of references.  Loops calling getNextDirtyCard() until
+	 * push a packet worth of references.  Loops claiming batches of up to
+	 * finalCardCleaningBatchSize dirty cards with getNextDirtyCards() until
 	 * we have pushed enough references or end of card table reached.
 	 *
 	 * @param bytesTraced  - reference to counter to pass back count of bytes traced
@@ -36,6 +36,7 @@
 #include "ConcurrentGC.hpp"
 #include "ConcurrentPrepareCardTableTask.hpp"
 #include "Debug.hpp"
+#include "HeapMapScan.hpp"
 #include "MemorySubSpace.hpp"
 #include "WorkPackets.hpp"
 #include "ParallelDispatcher.hpp"
@@ -351,23 +352,21 @@ MM_ConcurrentCardTableForWC::prepareCardTableChunk(MM_EnvironmentBase *env, Card
 				endCard = prepareAddress + currentPrepareSize;
 				
 				for (Card *currentCard = firstCard; currentCard < endCard; currentCard++) {
-					/* Are we are on an uintptr_t boundary ?. If so scan the card table a uintptr_t
-					 * at a time until we find a slot which is non-zero or the end of card table
-					 * found. This is based on the premise that the card table will be mostly
-					 * empty and scanning an uintptr_t at a time will reduce the time taken to
-					 * scan the card table.
+					/* Are we are on an uintptr_t boundary ?. If so scan the card table a slot
+					 * at a time, as many slots per step as the vector unit allows, until we find
+					 * a slot which is non-zero or the end of card table found. This is based on
+					 * the premise that the card table will be mostly empty and scanning many
+					 * cards at a time will reduce the time taken to scan the card table.
 					 */
 					if (((Card)CARD_CLEAN == *currentCard) &&
 						((uintptr_t)currentCard % sizeof(uintptr_t) == 0)) {
-						 uintptr_t *nextSlot= (uintptr_t *)currentCard;
-						while ( ((Card *)nextSlot < endCard) && (*nextSlot == SLOT_ALL_CLEAN) ) {
-							nextSlot++;
-						}
+						/* only complete slots are skipped; a partial slot at the end is scanned card at a time */
+						uintptr_t *lastSlot = (uintptr_t *)MM_Math::roundToFloor(sizeof(uintptr_t), (uintptr_t)endCard);
 						
 						/*
 						 * Either end of scan or a slot which contains a dirty card found. Reset scan ptr
 						 */
-						currentCard= (Card *)nextSlot; 
+						currentCard = (Card *)MM_HeapMapScan::findNonEmptySlot(_extensions->heapMapScanImplementation, (uintptr_t *)currentCard, lastSlot);
 
 						/* End of card table reached ? */
 						if (currentCard >= endCard) {
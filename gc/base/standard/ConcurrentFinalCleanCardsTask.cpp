@@ -38,6 +38,7 @@ MM_ConcurrentFinalCleanCardsTask::run(MM_EnvironmentBase *envBase)
 void
 MM_ConcurrentFinalCleanCardsTask::setup(MM_EnvironmentBase *env)
 {
+	env->_cardCleaningStats.clear();
 	if (env->isMainThread()) {
 		Assert_MM_true(_cycleState == env->_cycleState);
 	} else {
@@ -49,6 +50,7 @@ MM_ConcurrentFinalCleanCardsTask::setup(MM_EnvironmentBase *env)
 void
 MM_ConcurrentFinalCleanCardsTask::cleanup(MM_EnvironmentBase *env)
 {
+	_collector->getFinalCardCleaningStats()->merge(&env->_cardCleaningStats);
 	if (env->isMainThread()) {
 		Assert_MM_true(_cycleState == env->_cycleState);
 	} else {
@@ -293,6 +293,7 @@ protected:
 	ConHelperRequest getConHelperRequest(MM_EnvironmentBase *env);
 	virtual void conHelperDoWorkInternal(MM_EnvironmentBase *env, ConHelperRequest *request, MM_SpinLimiter *spinLimiter, uintptr_t *totalScanned) {};
 	void resumeConHelperThreads(MM_EnvironmentBase *env);
+	MMINLINE uintptr_t getTuningUpdateInterval() { return _tuningUpdateInterval; }
 
 	virtual uintptr_t doConcurrentTrace(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, uintptr_t sizeToTrace, MM_MemorySubSpace *subspace, bool tlhAllocation) = 0;
 	void concurrentMark(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace,  MM_AllocateDescription *allocDescription);
@@ -233,7 +233,9 @@ MM_ConcurrentGCIncrementalUpdate::reportConcurrentFinalCardCleaningEnd(MM_Enviro
 		cardTable->getCardTableStats()->getCardCleaningPhase1Kickoff(),
 		cardTable->getCardTableStats()->getCardCleaningPhase2Kickoff(),
 		cardTable->getCardTableStats()->getCardCleaningPhase3Kickoff(),
-		_stats.getConcurrentWorkStackOverflowCount()
+		_stats.getConcurrentWorkStackOverflowCount(),
+		_finalCardCleaningStats._cardsScanned,
+		_finalCardCleaningStats.getCardsScannedPerMicrosecond(omrtime_hires_delta(0, _finalCardCleaningStats._cardCleaningTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS))
 	);
 }
 
@@ -468,6 +470,7 @@ MM_ConcurrentGCIncrementalUpdate::finalConcurrentPrecollect(MM_EnvironmentBase *
 
 	reportConcurrentFinalCardCleaningStart(env);
 	uint64_t startTime = omrtime_hires_clock();
+	_finalCardCleaningStats.clear();
 
 	bool overflow = false; /* assume the worst case*/
 
@@ -113,6 +113,8 @@ private:
 	bool _pass2Started;
 	bool  _secondCardCleanPass;
 
+	MM_CardCleaningStats _finalCardCleaningStats; /**< Card cleaning statistics of the final card cleaning, merged from the cleaning threads */
+
 	/*
 	 * Function members
 	 */
@@ -122,6 +124,11 @@ public:
 	 */
 	MMINLINE MM_ConcurrentCardTable *getCardTable() { return _cardTable; };
 
+	/**
+	 * Return the statistics of the final card cleaning of the current cycle
+	 */
+	MMINLINE MM_CardCleaningStats *getFinalCardCleaningStats() { return &_finalCardCleaningStats; };
+
 private:
 	/**
 	 * Creates Concurrent Card Table
@@ -228,6 +235,7 @@ public:
 		,_traceTargetPass2(0)
 		,_pass2Started(false)
 		,_secondCardCleanPass(false)
+		,_finalCardCleaningStats()
 		{
 			_typeId = __FUNCTION__;
 		}
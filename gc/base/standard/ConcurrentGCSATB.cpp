@@ -46,6 +46,7 @@
 #include "OMRVMInterface.hpp"
 #include "ParallelDispatcher.hpp"
 #include "RememberedSetSATB.hpp"
+#include "SpinLimiter.hpp"
 #include "WorkPacketsConcurrent.hpp"
 
 /**
@@ -329,6 +330,7 @@ MM_ConcurrentGCSATB::setupForConcurrent(MM_EnvironmentBase *env)
 {
 	GC_OMRVMInterface::flushCachesForGC(env);
 
+	((MM_WorkPacketsSATB *)_markingScheme->getWorkPackets())->getSATBStats()->clear();
 	enableSATB(env);
 
 	_extensions->newThreadAllocationColor = GC_MARK;
@@ -502,6 +504,59 @@ MM_ConcurrentGCSATB::completeConcurrentTracing(MM_EnvironmentBase *env, uintptr_
 	Assert_MM_true(_markingScheme->getWorkPackets()->isAllPacketsEmpty());
 }
 
+void
+MM_ConcurrentGCSATB::drainBarrierPackets(MM_EnvironmentBase *env)
+{
+	if ((CONCURRENT_TRACE_ONLY == _stats.getExecutionMode()) && !env->isExclusiveAccessRequestWaiting()) {
+		((MM_WorkPacketsSATB *)_markingScheme->getWorkPackets())->getSATBStats()->incDrainerWakeups(1);
+		resumeConHelperThreads(env);
+	}
+}
+
+void
+MM_ConcurrentGCSATB::conHelperDoWorkInternal(MM_EnvironmentBase *env, ConHelperRequest *request, MM_SpinLimiter *spinLimiter, uintptr_t *totalScanned)
+{
+	if (!_extensions->sATBConcurrentDrain) {
+		return;
+	}
+
+	MM_WorkPacketsSATB *workPackets = (MM_WorkPacketsSATB *)_markingScheme->getWorkPackets();
+
+	spinLimiter->reset();
+
+	/* Stay around while mutators are still publishing barrier packets and trace them as they arrive,
+	 * so that they are not left for the final pause.
+	 */
+	while ((CONCURRENT_HELPER_MARK == *request)
+			&& (CONCURRENT_TRACE_ONLY == _stats.getExecutionMode())
+			&& spinLimiter->spin()) {
+		if (workPackets->inputPacketAvailable(env)) {
+			uintptr_t sizeTraced = localMark(env, getTuningUpdateInterval());
+			if (sizeTraced > 0) {
+				_stats.incConHelperTraceSizeCount(sizeTraced);
+				workPackets->getSATBStats()->incBytesDrained(sizeTraced);
+				*totalScanned += sizeTraced;
+				spinLimiter->reset();
+			}
+		} else {
+			omrthread_yield();
+		}
+		*request = getConHelperRequest(env);
+	}
+}
+
+void
+MM_ConcurrentGCSATB::postConcurrentUpdateStatsAndReport(MM_EnvironmentBase *env, MM_ConcurrentPhaseStatsBase *stats, UDATA bytesConcurrentlyScanned)
+{
+	MM_WorkPacketsSATB *workPackets = (MM_WorkPacketsSATB *)_markingScheme->getWorkPackets();
+	MM_ConcurrentSATBStats *sATBStats = workPackets->getSATBStats();
+
+	/* Packets still held by mutators are the barrier work left for the final pause */
+	sATBStats->setPendingPackets(workPackets->getBarrierPacketCount());
+	_concurrentPhaseStats._sATBStats = sATBStats;
+	MM_ConcurrentGC::postConcurrentUpdateStatsAndReport(env);
+}
+
 void
 MM_ConcurrentGCSATB::setThreadsScanned(MM_EnvironmentBase *env)
 {
@@ -66,6 +66,7 @@ protected:
 	virtual void completeConcurrentTracing(MM_EnvironmentBase *env, uintptr_t executionModeAtGC);
 	virtual void adjustTraceTarget();
 	virtual uintptr_t getTraceTarget() { return _traceTarget; };
+	virtual void conHelperDoWorkInternal(MM_EnvironmentBase *env, ConHelperRequest *request, MM_SpinLimiter *spinLimiter, uintptr_t *totalScanned);
 #if defined(OMR_GC_MODRON_SCAVENGER)
 	/**
 	 * Process event from an external GC (Scavenger) when old-to-old reference is created.
@@ -93,6 +94,14 @@ public:
 
 	virtual void preAllocCacheFlush(MM_EnvironmentBase *env, void *base, void *top);
 
+	virtual void postConcurrentUpdateStatsAndReport(MM_EnvironmentBase *env, MM_ConcurrentPhaseStatsBase *stats = NULL, UDATA bytesConcurrentlyScanned = 0);
+
+	/**
+	 * Wake the concurrent helpers to trace the full barrier packets mutators have published.
+	 * Called from the barrier once sATBConcurrentDrainThreshold packets have been published.
+	 */
+	virtual void drainBarrierPackets(MM_EnvironmentBase *env);
+
 	/* Refer to preAllocCacheFlush implementation for reasoning behind this. */
 	virtual uintptr_t reservedForGCAllocCacheSize() { return (_extensions->isSATBBarrierActive() ? OMR_MINIMUM_OBJECT_SIZE : 0); }
 
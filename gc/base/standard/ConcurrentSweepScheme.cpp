@@ -80,8 +80,10 @@ private:
 	MM_ParallelSweepChunk *_currentSweepChunk;  /**< Next chunk to concurrent sweep in the given memory pool */
 	MM_ParallelSweepChunk *_currentSweepChunkReverse; /**< Next chunk to sweep when sweeping high to low in a given memory pool */
 	MM_LightweightNonReentrantLock _sweepChunkIteratorLock;  /**< Lock for the next chunk to concurrent sweep list */
+	MM_ParallelSweepChunk *_skippedSweepChunk;  /**< Chunk next to be connected that _currentSweepChunk was left on for the connecting thread (lazy sweep) */
+	MM_ParallelSweepChunk *_sweepChunkAfterSkipped;  /**< Next chunk to look at once _skippedSweepChunk has been stepped over again (lazy sweep) */
 
-	MM_ParallelSweepChunk *_connectCurrentChunk;  /**< Next chunk to concurrent connect in the given memory pool */
+	MM_ParallelSweepChunk *_connectCurrentChunk;  /**< Next chunk to concurrent connect in the given memory pool, written under both the allocation lock and _sweepChunkIteratorLock */
 	MM_HeapLinkedFreeHeader *_connectNextFreeEntry;  /**< Existing free list entry immediately following the connect range */
 	UDATA _connectNextFreeEntrySize;	/**< Existing free list entry size immediately following the connect range */
 
@@ -168,6 +170,8 @@ public:
 		_currentSweepChunk(NULL),
 		_currentSweepChunkReverse(NULL),
 		_sweepChunkIteratorLock(),
+		_skippedSweepChunk(NULL),
+		_sweepChunkAfterSkipped(NULL),
 		_connectCurrentChunk(NULL),
 		_connectNextFreeEntry(NULL),
 		_connectNextFreeEntrySize(0),
@@ -237,6 +241,8 @@ MM_ConcurrentSweepPoolState::initializeForSweep(MM_EnvironmentBase *env)
 	 }	 
 	 
 	_currentSweepChunk = NULL;
+	_skippedSweepChunk = NULL;
+	_sweepChunkAfterSkipped = NULL;
 	_connectPreviousChunk = NULL;
 	_connectCurrentChunk = NULL;
 	_connectNextFreeEntry = NULL;
@@ -440,7 +446,9 @@ MM_ConcurrentSweepScheme::reportCompletedConcurrentSweep(MM_EnvironmentBase *env
 		_stats._completeSweepPhaseBytesSwept,
 		omrtime_hires_delta(_stats._completeConnectPhaseTimeStart, _stats._completeConnectPhaseTimeEnd, OMRPORT_TIME_DELTA_IN_MICROSECONDS),
 		_stats._completeConnectPhaseBytesConnected,
-		reason);
+		reason,
+		_stats._lazySweepBytesSwept,
+		_stats._backgroundSweepBytesSwept);
 }
 
 /**
@@ -742,28 +750,47 @@ MM_ConcurrentSweepScheme::verifyFreeList(MM_EnvironmentStandard *env, MM_HeapLin
 /**
  * Find the next chunk in sequence to be swept.
  * @todo We should consider a compare and swap operation for pulling the next sweep chunk from the list.
+ * @param skipConnectChunk leave the chunk next to be connected for the connecting thread to sweep
  * @return chunk that may be eligible for sweeping.
  */
 MM_ParallelSweepChunk *
-MM_ConcurrentSweepScheme::getNextSweepChunk(MM_EnvironmentStandard *env, MM_ConcurrentSweepPoolState *sweepState)
+MM_ConcurrentSweepScheme::getNextSweepChunk(MM_EnvironmentStandard *env, MM_ConcurrentSweepPoolState *sweepState, bool skipConnectChunk)
 {
 	MM_ParallelSweepChunk *chunk;
+	MM_ParallelSweepChunk *skippedChunk = NULL;
 
 	sweepState->_sweepChunkIteratorLock.acquire();
 
+	/* _connectCurrentChunk is only changed with the iterator lock held, so it can not move while the chunks are scanned */
+	MM_ParallelSweepChunk *reservedChunk = skipConnectChunk ? sweepState->_connectCurrentChunk : NULL;
+
 	chunk = sweepState->_currentSweepChunk;
+	if ((NULL != chunk) && (chunk == reservedChunk) && (chunk == sweepState->_skippedSweepChunk) && (modron_concurrentsweep_state_unprocessed == chunk->_concurrentSweepState)) {
+		/* The chunks between the reserved chunk and the resume point were all handed out by earlier calls */
+		skippedChunk = chunk;
+		chunk = sweepState->_sweepChunkAfterSkipped;
+	}
 	while (chunk != NULL) {
 		/* ensure that this chunk actually should be associated with the given sweepState */
 		Assert_MM_true(sweepState == (MM_ConcurrentSweepPoolState *)getPoolState(chunk->memoryPool));
 		/* Check chunk has not already been processed */
 		if (chunk->_concurrentSweepState == modron_concurrentsweep_state_unprocessed) {
-			break;
+			if (chunk != reservedChunk) {
+				break;
+			}
+			/* Step over the reserved chunk */
+			skippedChunk = chunk;
 		}	
 		/* get next chunk, if any */
 		chunk = chunk->_nextChunk;	
 	}	
 	
-	if(NULL != chunk) {
+	if(NULL != skippedChunk) {
+		/* Keep the cursor on the reserved chunk so that it is still found later, and resume past it next time */
+		sweepState->_currentSweepChunk = skippedChunk;
+		sweepState->_skippedSweepChunk = skippedChunk;
+		sweepState->_sweepChunkAfterSkipped = (NULL != chunk) ? chunk->_nextChunk : NULL;
+	} else if(NULL != chunk) {
 		sweepState->_currentSweepChunk = chunk->_nextChunk;
 	} else {
 		sweepState->_currentSweepChunk = NULL;
@@ -817,10 +844,23 @@ MM_ConcurrentSweepScheme::incrementalSweepChunk(
 	MM_EnvironmentStandard *env,
 	MM_ParallelSweepChunk *chunk)
 {
-	bool liveObjectFound;
 	Assert_MM_true(modron_concurrentsweep_state_unprocessed == chunk->_concurrentSweepState);
 
 	chunk->_concurrentSweepState = modron_concurrentsweep_state_busy_sweep;
+
+	return sweepClaimedChunk(env, chunk);
+}
+
+/**
+ * Sweep the given chunk, which the caller has moved to the busy sweep state.
+ * @return TRUE if at least one live object in chunk; FALSE otherwise
+ */
+bool
+MM_ConcurrentSweepScheme::sweepClaimedChunk(MM_EnvironmentStandard *env, MM_ParallelSweepChunk *chunk)
+{
+	bool liveObjectFound;
+	Assert_MM_true(modron_concurrentsweep_state_busy_sweep == chunk->_concurrentSweepState);
+
 	liveObjectFound = sweepChunk(env, chunk);	
 
 	MM_AtomicOperations::add((UDATA *)&_stats._totalChunkSweptCount, 1);
@@ -841,14 +881,16 @@ MM_ConcurrentSweepScheme::incrementalSweepChunk(
 /**
  * Find the next available chunk and attempt to sweep it.
  * @note sweep work is self contained, but we do need to be cautious concurrently setting that statistics.
+ * @param bytesSwept attribution statistic to add the size of the swept chunk to (NULL if none)
+ * @param skipConnectChunk leave the chunk next to be connected for the connecting thread to sweep
  * @return true if a chunk was found and swept by the caller, false otherwise.
  */
 bool
-MM_ConcurrentSweepScheme::sweepNextAvailableChunk(MM_EnvironmentStandard *env, MM_ConcurrentSweepPoolState *sweepState)
+MM_ConcurrentSweepScheme::sweepNextAvailableChunk(MM_EnvironmentStandard *env, MM_ConcurrentSweepPoolState *sweepState, volatile UDATA *bytesSwept, bool skipConnectChunk)
 {
 	MM_ParallelSweepChunk *chunk;
 
-	if(NULL != (chunk = getNextSweepChunk(env, sweepState))) {
+	if(NULL != (chunk = getNextSweepChunk(env, sweepState, skipConnectChunk))) {
 		Assert_MM_true(!_stats.hasCompletedSweepConcurrently());
 		incrementalSweepChunk(env, chunk);
 		if(concurrentsweep_mode_completing_sweep_phase_concurrently == _stats._mode) {
@@ -856,6 +898,9 @@ MM_ConcurrentSweepScheme::sweepNextAvailableChunk(MM_EnvironmentStandard *env, M
 		} else if (concurrentsweep_mode_stw_complete_sweep == _stats._mode) {
 			MM_AtomicOperations::add((UDATA *)&_stats._completeSweepPhaseBytesSwept, chunk->size());
 		}
+		if(NULL != bytesSwept) {
+			MM_AtomicOperations::add((UDATA *)bytesSwept, chunk->size());
+		}
 		return true;
 	}
 	
@@ -888,20 +933,58 @@ MM_ConcurrentSweepScheme::sweepPreviousAvailableChunk(MM_EnvironmentStandard *en
 /**
  * Find the next available chunk and attempt to sweep it.
  * @note This call is made by java threads participating regular work (e.g., allocation tax, replenishing, etc).
+ * @param bytesSwept attribution statistic to add the size of the swept chunk to
+ * @param skipConnectChunk leave the chunk next to be connected for the connecting thread to sweep
  * @return true if a chunk was found and swept by the caller, false otherwise.
  */
 bool
-MM_ConcurrentSweepScheme::concurrentSweepNextAvailableChunk(MM_EnvironmentStandard *env, MM_ConcurrentSweepPoolState *sweepState)
+MM_ConcurrentSweepScheme::concurrentSweepNextAvailableChunk(MM_EnvironmentStandard *env, MM_ConcurrentSweepPoolState *sweepState, volatile UDATA *bytesSwept, bool skipConnectChunk)
 {
 	bool result = false;
 
 	increaseActiveSweepingThreadCount(env, false);
-	result = sweepNextAvailableChunk(env, sweepState);
+	result = sweepNextAvailableChunk(env, sweepState, bytesSwept, skipConnectChunk);
 	decreaseActiveSweepingThreadCount(env, false);
 
 	return result;
 }
 
+/**
+ * Sweep the given chunk if no other thread has started sweeping it (lazy sweep).
+ * Unlike concurrentSweepNextAvailableChunk(), no chunk other than the one about to be connected is swept,
+ * so an allocating thread does no more sweep work than its allocation needs.
+ * @note This call is made by java threads replenishing a pool, under the pool allocation lock.
+ * @return true if the chunk was swept by the caller, false if it was already claimed by another thread.
+ */
+bool
+MM_ConcurrentSweepScheme::concurrentSweepConnectChunk(MM_EnvironmentStandard *env, MM_ConcurrentSweepPoolState *sweepState, MM_ParallelSweepChunk *chunk)
+{
+	bool claimed = false;
+
+	increaseActiveSweepingThreadCount(env, false);
+
+	/* Claim the chunk under the iterator lock so that getNextSweepChunk() skips it */
+	sweepState->_sweepChunkIteratorLock.acquire();
+	if(modron_concurrentsweep_state_unprocessed == chunk->_concurrentSweepState) {
+		chunk->_concurrentSweepState = modron_concurrentsweep_state_busy_sweep;
+		if(sweepState->_currentSweepChunk == chunk) {
+			/* Chunks up to the resume point were handed out while the cursor was left on this one */
+			sweepState->_currentSweepChunk = (sweepState->_skippedSweepChunk == chunk) ? sweepState->_sweepChunkAfterSkipped : chunk->_nextChunk;
+		}
+		claimed = true;
+	}
+	sweepState->_sweepChunkIteratorLock.release();
+
+	if(claimed) {
+		sweepClaimedChunk(env, chunk);
+		MM_AtomicOperations::add((UDATA *)&_stats._lazySweepBytesSwept, chunk->size());
+	}
+
+	decreaseActiveSweepingThreadCount(env, false);
+
+	return claimed;
+}
+
 /**
  * Find the next chunk in sequence to be connected.
  * @note the sweep states associated memory pool allocation lock (or equivalent) is expected to be held.
@@ -914,7 +997,10 @@ MM_ConcurrentSweepScheme::getNextConnectChunk(MM_EnvironmentStandard *env, MM_Co
 
 	chunk = sweepState->_connectCurrentChunk;
 	if(NULL != chunk) {
+		/* Sweeping threads read the connect chunk under the iterator lock to leave it to this thread (lazy sweep) */
+		sweepState->_sweepChunkIteratorLock.acquire();
 		sweepState->_connectCurrentChunk = chunk->_nextChunk;
+		sweepState->_sweepChunkIteratorLock.release();
 	}	
 	
 	return chunk;
@@ -1036,8 +1122,14 @@ MM_ConcurrentSweepScheme::replenishPoolForAllocate(MM_EnvironmentBase *env, MM_M
 #endif /* CONCURRENT_SWEEP_TRACE */
 			/* Loop until the next chunk to connect has at least reached the swept stage */
 			while(chunk->_concurrentSweepState < modron_concurrentsweep_state_swept) {
-				/* The chunk hasn't been swept yet - move the sweeping work along for the state */
-				if(!concurrentSweepNextAvailableChunk(envStandard, sweepState)) {
+				/* The chunk hasn't been swept yet - in lazy mode sweep only this chunk, otherwise move the sweeping work along for the state */
+				bool swept = false;
+				if(_extensions->concurrentSweepLazy) {
+					swept = concurrentSweepConnectChunk(envStandard, sweepState, chunk);
+				} else {
+					swept = concurrentSweepNextAvailableChunk(envStandard, sweepState, &_stats._lazySweepBytesSwept);
+				}
+				if(!swept) {
 					/* No work was done, yield (someone else was trying to sweep our chunk) */
 					omrthread_yield();
 				}
@@ -1168,10 +1260,13 @@ MM_ConcurrentSweepScheme::sweepPool(MM_EnvironmentBase *envModron, MM_MemoryPool
 	UDATA taxPaid = 0;
 	MM_ConcurrentSweepPoolState *sweepState = (MM_ConcurrentSweepPoolState *)getPoolState(memoryPool);
 				
+	/* In lazy mode the chunk next in line to be connected is left for the allocating thread that connects it */
+	bool skipConnectChunk = _extensions->concurrentSweepLazy;
+
 	/* If there any work to do on this pool ? */
 	if(!sweepState->_finalFlushed) {
 		while(taxPaid < chunkTax) {
-			if(!concurrentSweepNextAvailableChunk(MM_EnvironmentStandard::getEnvironment(envModron), sweepState)) {
+			if(!concurrentSweepNextAvailableChunk(MM_EnvironmentStandard::getEnvironment(envModron), sweepState, &_stats._backgroundSweepBytesSwept, skipConnectChunk)) {
 				break;
 			}
 			
@@ -1400,8 +1495,8 @@ MM_ConcurrentSweepScheme::workThreadFindMinimumSizeFreeEntry(MM_EnvironmentBase
 	}
 
 	/* Do we actually need to connect any free chunks to satisfy an AF ? */	
-	if (0 == minimumFreeSize) {
-		/* No ..we are done then. All sweep/connect work will be done by mutators */
+	if ((0 == minimumFreeSize) || _extensions->concurrentSweepLazy) {
+		/* No (or the allocation will sweep for itself in lazy mode) ..we are done then. All sweep/connect work will be done by mutators */
 		return;
 	}	
 	
@@ -1471,6 +1566,7 @@ MM_ConcurrentSweepScheme::sweep(MM_EnvironmentBase *env)
  * @note Expects to have exclusive access
  * @note Expects to have control over the parallel GC threads (ie: able to dispatch tasks)
  * @note This only sweeps spaces that are concurrent sweepable
+ * @note With concurrentSweepLazy no entry is searched for; the failed allocation sweeps for itself when retried.
  * @return true if a free entry of at least the requested size was found, false otherwise.
  */
 bool
@@ -1553,7 +1649,7 @@ MM_ConcurrentSweepScheme::completeSweepingConcurrently(MM_EnvironmentBase *envMo
 	while(NULL != (memoryPool = (MM_MemoryPoolAddressOrderedList *)poolIterator.nextPool())) {
 		MM_ConcurrentSweepPoolState *sweepState = (MM_ConcurrentSweepPoolState *)getPoolState(memoryPool);
 
-		while(sweepNextAvailableChunk(env, sweepState)) {
+		while(sweepNextAvailableChunk(env, sweepState, &_stats._backgroundSweepBytesSwept)) {
 #if defined(CONCURRENT_SWEEP_TRACE)
 			OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
 			omrtty_printf("C");
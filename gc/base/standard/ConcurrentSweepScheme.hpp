@@ -90,13 +90,15 @@ private:
 
 	void checkRestrictions(MM_EnvironmentBase *env);
 
-	MM_ParallelSweepChunk *getNextSweepChunk(MM_EnvironmentStandard *env, MM_ConcurrentSweepPoolState *sweepPoolState);
+	MM_ParallelSweepChunk *getNextSweepChunk(MM_EnvironmentStandard *env, MM_ConcurrentSweepPoolState *sweepPoolState, bool skipConnectChunk = false);
 	MM_ParallelSweepChunk *getPreviousSweepChunk(MM_EnvironmentStandard *env, MM_ConcurrentSweepPoolState *sweepState);
 	bool incrementalSweepChunk(MM_EnvironmentStandard *env, MM_ParallelSweepChunk *chunk);
+	bool sweepClaimedChunk(MM_EnvironmentStandard *env, MM_ParallelSweepChunk *chunk);
 	UDATA sweepPool(MM_EnvironmentBase *envModron, MM_MemoryPool *memoryPool, UDATA chunkTax);
-	bool sweepNextAvailableChunk(MM_EnvironmentStandard *env, MM_ConcurrentSweepPoolState *sweepPoolState);
+	bool sweepNextAvailableChunk(MM_EnvironmentStandard *env, MM_ConcurrentSweepPoolState *sweepPoolState, volatile UDATA *bytesSwept = NULL, bool skipConnectChunk = false);
 	bool sweepPreviousAvailableChunk(MM_EnvironmentStandard *env, MM_ConcurrentSweepPoolState *sweepPoolState);
-	bool concurrentSweepNextAvailableChunk(MM_EnvironmentStandard *env, MM_ConcurrentSweepPoolState *sweepState);
+	bool concurrentSweepNextAvailableChunk(MM_EnvironmentStandard *env, MM_ConcurrentSweepPoolState *sweepState, volatile UDATA *bytesSwept, bool skipConnectChunk = false);
+	bool concurrentSweepConnectChunk(MM_EnvironmentStandard *env, MM_ConcurrentSweepPoolState *sweepState, MM_ParallelSweepChunk *chunk);
 	void propagateChunkProjections(MM_EnvironmentBase *envModron, MM_ParallelSweepChunk *startingChunkToPropagate);
 	void abandonOverlappedChunks(MM_EnvironmentBase *envModron, MM_ParallelSweepChunk *startingChunk, bool isFirstChunkInSubpool);
 	void walkChunkForOverlappingDeadSpace(MM_EnvironmentBase *envModron, MM_ParallelSweepChunk *currentChunk, void *walkStart);
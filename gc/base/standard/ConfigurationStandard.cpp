@@ -35,9 +35,6 @@
 #include "ConcurrentGCSATB.hpp"
 #endif /* OMR_GC_REALTIME */
 #endif /* OMR_GC_MODRON_CONCURRENT_MARK */
-#if defined(OMR_GC_CONCURRENT_SWEEP)
-#include "ConcurrentSweepGC.hpp"
-#endif /* OMR_GC_CONCURRENT_SWEEP */
 #include "EnvironmentStandard.hpp"
 #include "GlobalCollector.hpp"
 #include "GCExtensionsBase.hpp"
@@ -50,6 +47,7 @@
 #include "MemoryPoolHybrid.hpp"
 #include "MemoryPoolLargeObjects.hpp"
 #include "ParallelGlobalGC.hpp"
+#include "SparseVirtualMemory.hpp"
 #include "SweepPoolManagerAddressOrderedList.hpp"
 #include "SweepPoolManagerSplitAddressOrderedList.hpp"
 #include "SweepPoolManagerHybrid.hpp"
@@ -74,6 +72,11 @@ MM_ConfigurationStandard::tearDown(MM_EnvironmentBase* env)
 
 	extensions->freeEntrySizeClassStatsSimulated.tearDown(env);
 
+	if (NULL != extensions->largeObjectVirtualMemory) {
+		extensions->largeObjectVirtualMemory->kill(env);
+		extensions->largeObjectVirtualMemory = NULL;
+	}
+
 	MM_Configuration::tearDown(env);
 }
 
@@ -83,6 +86,10 @@ MM_ConfigurationStandard::initialize(MM_EnvironmentBase* env)
 	MM_GCExtensionsBase* extensions = env->getExtensions();
 	bool result = MM_Configuration::initialize(env);
 	if (result) {
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+		/* Concurrent sweep is paced by the allocation tax of the concurrent mark collector, there is no sweep-only collector */
+		extensions->concurrentSweep = extensions->concurrentSweep && extensions->isConcurrentMarkEnabled();
+#endif /* OMR_GC_CONCURRENT_SWEEP */
 		extensions->payAllocationTax = extensions->isConcurrentMarkEnabled() || extensions->isConcurrentSweepEnabled();
 		extensions->setStandardGC(true);
 	}
@@ -124,9 +131,9 @@ MM_ConfigurationStandard::initializeGCThreadCount(MM_EnvironmentBase* env)
 MM_GlobalCollector*
 MM_ConfigurationStandard::createGlobalCollector(MM_EnvironmentBase* env)
 {
-#if defined(OMR_GC_MODRON_CONCURRENT_MARK) || defined(OMR_GC_MODRON_CONCCURENT_SWEEP)
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
 	MM_GCExtensionsBase *extensions = env->getExtensions();
-#endif /* OMR_GC_MODRON_CONCURRENT_MARK || OMR_GC_CONCURRENT_SWEEP */
+#endif /* OMR_GC_MODRON_CONCURRENT_MARK */
 
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
 	if (extensions->concurrentMark) {
@@ -140,11 +147,6 @@ MM_ConfigurationStandard::createGlobalCollector(MM_EnvironmentBase* env)
 		}
 	}
 #endif /* OMR_GC_MODRON_CONCURRENT_MARK */
-#if defined(OMR_GC_CONCURRENT_SWEEP)
-	if (extensions->concurrentSweep) {
-		return MM_ConcurrentSweepGC::newInstance(env);
-	}
-#endif /* OMR_GC_CONCURRENT_SWEEP */
 	return MM_ParallelGlobalGC::newInstance(env);
 }
 
@@ -154,7 +156,18 @@ MM_ConfigurationStandard::createGlobalCollector(MM_EnvironmentBase* env)
 MM_Heap*
 MM_ConfigurationStandard::createHeapWithManager(MM_EnvironmentBase* env, uintptr_t heapBytesRequested, MM_HeapRegionManager* regionManager)
 {
-	return MM_HeapVirtualMemory::newInstance(env, env->getExtensions()->heapAlignment, heapBytesRequested, regionManager);
+	MM_GCExtensionsBase* extensions = env->getExtensions();
+	MM_Heap* heap = MM_HeapVirtualMemory::newInstance(env, extensions->heapAlignment, heapBytesRequested, regionManager);
+
+	if ((NULL != heap) && extensions->isVirtualLargeObjectHeapRequested) {
+		/* Large objects keep their data in a sparse reservation beside the heap, so the collectors only ever move their
+		 * in-heap proxies. The sparse memory is not heap memory and is never committed in huge page units.
+		 */
+		extensions->largeObjectVirtualMemory = MM_SparseVirtualMemory::newInstance(env, OMRMEM_CATEGORY_MM, heap);
+		extensions->isVirtualLargeObjectHeapEnabled = (NULL != extensions->largeObjectVirtualMemory);
+	}
+
+	return heap;
 }
 
 /**
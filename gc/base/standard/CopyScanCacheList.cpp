@@ -36,13 +36,16 @@
 #if defined(OMR_GC_MODRON_SCAVENGER)
 
 bool
-MM_CopyScanCacheList::initialize(MM_EnvironmentBase *env, volatile uintptr_t *cachedEntryCount)
+MM_CopyScanCacheList::initialize(MM_EnvironmentBase *env, volatile uintptr_t *cachedEntryCount, uintptr_t nodeCount)
 {
 	MM_GCExtensionsBase *extensions = env->getExtensions();
 	bool result = true;
 	
-	_sublistCount = extensions->cacheListSplit;
-	Assert_MM_true(0 < _sublistCount);
+	Assert_MM_true(0 < nodeCount);
+	_nodeCount = nodeCount;
+	_sublistsPerNode = extensions->cacheListSplit;
+	Assert_MM_true(0 < _sublistsPerNode);
+	_sublistCount = _sublistsPerNode * _nodeCount;
 
 	_sublists = (struct CopyScanCacheSublist *)extensions->getForge()->allocate(sizeof(struct CopyScanCacheSublist) * _sublistCount, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
 	if (NULL == _sublists) {
@@ -202,17 +205,32 @@ MM_CopyScanCacheList::appendCacheEntries(MM_EnvironmentBase *env, uintptr_t cach
 	MM_CopyScanCacheStandard *sublistTail = NULL;
 	MM_CopyScanCacheChunk *chunk = MM_CopyScanCacheChunk::newInstance(env, cacheEntryCount, _chunkHead, &sublistTail);
 	if(NULL != chunk) {
-		uintptr_t index = getSublistIndex(env);
-
 		Assert_MM_true(NULL != sublistTail);
 		Assert_MM_true(NULL == sublistTail->next);
 
-		_sublists[index]._cacheLock.acquire();
-		/* attach sublist of caches in chunk to main list */
-		sublistTail->next = _sublists[index]._cacheHead;
-		_sublists[index]._cacheHead = chunk->getBase();
-		_sublists[index]._entryCount += cacheEntryCount;
-		_sublists[index]._cacheLock.release();
+		if (1 == _nodeCount) {
+			uintptr_t index = getSublistIndex(env);
+			_sublists[index]._cacheLock.acquire();
+			/* attach sublist of caches in chunk to main list */
+			sublistTail->next = _sublists[index]._cacheHead;
+			_sublists[index]._cacheHead = chunk->getBase();
+			_sublists[index]._entryCount += cacheEntryCount;
+			_sublists[index]._cacheLock.release();
+		} else {
+			/* deal the caches out to all nodes, so that each node starts popping from its own sublists */
+			uintptr_t offsetInNode = env->getEnvironmentId() % _sublistsPerNode;
+			MM_CopyScanCacheStandard *cache = chunk->getBase();
+			for (uintptr_t i = 0; NULL != cache; i++) {
+				MM_CopyScanCacheStandard *nextCache = (MM_CopyScanCacheStandard *)cache->next;
+				CopyScanCacheSublist *list = &_sublists[((i % _nodeCount) * _sublistsPerNode) + offsetInNode];
+				list->_cacheLock.acquire();
+				cache->next = list->_cacheHead;
+				list->_cacheHead = cache;
+				list->_entryCount += 1;
+				list->_cacheLock.release();
+				cache = nextCache;
+			}
+		}
 
 		_chunkHead = chunk;
 		_totalAllocatedEntryCount += cacheEntryCount;
@@ -320,32 +338,42 @@ MM_CopyScanCacheList::pushCache(MM_EnvironmentBase *env, MM_CopyScanCacheStandar
 MM_CopyScanCacheStandard *
 MM_CopyScanCacheList::popCache(MM_EnvironmentBase *env)
 {
-	uintptr_t index = getSublistIndex(env);
+	uintptr_t homeIndex = getSublistIndex(env);
+	uintptr_t nodeIndex = homeIndex / _sublistsPerNode;
+	uintptr_t offsetInNode = homeIndex % _sublistsPerNode;
 	MM_CopyScanCacheStandard *cache = NULL;
 
-	for (uintptr_t i = 0; i < _sublistCount; i++) {
-		MM_CopyScanCacheList::CopyScanCacheSublist *list = &_sublists[index];
-
-		if (NULL != list->_cacheHead) {
-			env->_scavengerStats._acquireListLockCount += 1;
-			list->_cacheLock.acquire();
-			cache = list->_cacheHead;
-			if (NULL != cache) {
-				decrementCount(list, 1);
-				list->_cacheHead = (MM_CopyScanCacheStandard *)cache->next;
-
-				if (NULL == list->_cacheHead) {
-					Assert_MM_true(0 == list->_entryCount);
+	/* exhaust the sublists of the home node before stealing from other nodes */
+	for (uintptr_t n = 0; (NULL == cache) && (n < _nodeCount); n++) {
+		uintptr_t nodeBase = nodeIndex * _sublistsPerNode;
+		uintptr_t offset = offsetInNode;
+
+		for (uintptr_t i = 0; i < _sublistsPerNode; i++) {
+			MM_CopyScanCacheList::CopyScanCacheSublist *list = &_sublists[nodeBase + offset];
+
+			if (NULL != list->_cacheHead) {
+				env->_scavengerStats._acquireListLockCount += 1;
+				list->_cacheLock.acquire();
+				cache = list->_cacheHead;
+				if (NULL != cache) {
+					decrementCount(list, 1);
+					list->_cacheHead = (MM_CopyScanCacheStandard *)cache->next;
+
+					if (NULL == list->_cacheHead) {
+						Assert_MM_true(0 == list->_entryCount);
+					}
 				}
-			}
-			list->_cacheLock.release();
+				list->_cacheLock.release();
 
-			if (NULL != cache) {
-				break;
+				if (NULL != cache) {
+					break;
+				}
 			}
+
+			offset = (offset + 1) % _sublistsPerNode;
 		}
 
-		index = (index + 1) % _sublistCount;
+		nodeIndex = (nodeIndex + 1) % _nodeCount;
 	}
 
 	return cache;
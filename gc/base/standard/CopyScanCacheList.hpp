@@ -73,8 +73,10 @@ private:
 		}
 	};
 	
-	struct CopyScanCacheSublist *_sublists;	/**< An array of CopyScanCacheSublist structures which is _sublistCount elements long */
+	struct CopyScanCacheSublist *_sublists;	/**< An array of CopyScanCacheSublist structures which is _sublistCount elements long, grouped by NUMA node */
 	uintptr_t _sublistCount; /**< the number of lists (split for parallelism). Must be at least 1 */
+	uintptr_t _nodeCount; /**< the number of NUMA nodes the lists are partitioned by. Must be at least 1 */
+	uintptr_t _sublistsPerNode; /**< the number of lists owned by each NUMA node (_sublistCount / _nodeCount) */
 	
 	MM_CopyScanCacheChunk *_chunkHead; 
 	uintptr_t _incrementEntryCount;
@@ -93,7 +95,10 @@ private:
 
 	/**
 	 * Hash the specified environment to determine what sublist index
-	 * it should use
+	 * it should use. The index is always within the range of sublists
+	 * owned by the NUMA node the environment is assigned to.
+	 * @note the node is only consulted if the lists are partitioned, since the lists are also
+	 * resized at startup with a plain MM_EnvironmentBase which has no node assignment
 	 * 
 	 * @param env the current environment
 	 * 
@@ -101,7 +106,8 @@ private:
 	 */
 	uintptr_t getSublistIndex(MM_EnvironmentBase *env)
 	{
-		return env->getEnvironmentId() % _sublistCount;
+		uintptr_t nodeIndex = (1 < _nodeCount) ? MM_EnvironmentStandard::getEnvironment(env)->_scavengerNUMANode : 0;
+		return (nodeIndex * _sublistsPerNode) + (env->getEnvironmentId() % _sublistsPerNode);
 	}
 	
 	/**
@@ -126,7 +132,14 @@ private:
 
 protected:
 public:
-	bool initialize(MM_EnvironmentBase *env, volatile uintptr_t *cachedEntryCount);
+	/**
+	 * Initialize the list.
+	 * @param env[in] the current thread
+	 * @param cachedEntryCount[in] optional pointer to the counter of non-empty sublists, shared among lists
+	 * @param nodeCount[in] the number of NUMA nodes to partition the sublists by (1 if not NUMA aware)
+	 * @return true on success
+	 */
+	bool initialize(MM_EnvironmentBase *env, volatile uintptr_t *cachedEntryCount, uintptr_t nodeCount = 1);
 	virtual void tearDown(MM_EnvironmentBase *env);
 
 	/**
@@ -189,6 +202,8 @@ public:
 
 	/**
 	 * Pop a cache entry from this list.
+	 * Sublists owned by the NUMA node of the thread are searched first, sublists of other nodes are only
+	 * searched (in order of node index, starting after the thread's own node) if those are empty.
 	 * @param env[in] the current GC thread
 	 * @return the cache entry, or NULL if the list is empty
 	 */
@@ -202,6 +217,8 @@ public:
 		, _allocationInHeap(false)
 		, _sublists(NULL)
 		, _sublistCount(0)
+		, _nodeCount(1)
+		, _sublistsPerNode(0)
 		, _chunkHead(NULL)
 		, _incrementEntryCount(0)
 		, _totalAllocatedEntryCount(0)
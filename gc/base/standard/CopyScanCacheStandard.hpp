@@ -52,6 +52,7 @@ public:
 	uintptr_t _arraySplitIndex; /**< The index within a split array to start scanning from (meaningful if OMR_SCAVENGER_CACHE_TYPE_SPLIT_ARRAY is set) */
 	uintptr_t _arraySplitAmountToScan; /**< The amount of elements that should be scanned by split array scanning. */
 	omrobjectptr_t* _arraySplitRememberedSlot; /**< A pointer to the remembered set slot a split array came from if applicable. */
+	uintptr_t _numaNode; /**< Index of the NUMA node of the thread that released the cache to the scan list (meaningful only with scavengerNUMAAware) */
 
 	/* Members Function */
 private:
@@ -100,6 +101,7 @@ public:
 		, _arraySplitIndex(0)
 		, _arraySplitAmountToScan(0)
 		, _arraySplitRememberedSlot(NULL)
+		, _numaNode(0)
 	{}
 };
 
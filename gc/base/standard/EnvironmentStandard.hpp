@@ -60,6 +60,13 @@ public:
 	
 #if defined(OMR_GC_MODRON_SCAVENGER)
 	J9VMGC_SublistFragment _scavengerRememberedSet;
+	fomrobject_t *_scavengerPrefetchRing[SCAVENGER_PREFETCH_RING_SIZE]; /**< slots of the object being scanned whose referents have been prefetched but not yet copied and forwarded */
+	uintptr_t _scavengerNUMANode; /**< index (starting from 0) of the NUMA node whose scavenger cache sublists this thread uses (always 0 if scavengerNUMAAware is disabled) */
+	bool _scavengerNUMANodeAssigned; /**< true once the thread has been assigned (and possibly bound) to its NUMA node */
+	uintptr_t _hotFieldSampleCountdown; /**< number of scalar objects left to scan before the next one has its slots sampled (scavengerHotFieldLearning enabled) */
+	uintptr_t _hotFieldSampleCount; /**< number of valid entries in _hotFieldSampleShapeKeys and _hotFieldSampleOffsets */
+	uintptr_t _hotFieldSampleShapeKeys[SCAVENGER_HOT_FIELD_SAMPLE_BUFFER_SIZE]; /**< shape keys of the samples not yet flushed to the scavenger's hot field learner */
+	uint8_t _hotFieldSampleOffsets[SCAVENGER_HOT_FIELD_SAMPLE_BUFFER_SIZE]; /**< slot offsets of the samples not yet flushed to the scavenger's hot field learner */
 #endif
 	void *_tenureTLHRemainderBase;  /**< base and top pointers of the last unused tenure TLH copy cache, that might be reused  on next copy refresh */
 	void *_tenureTLHRemainderTop;
@@ -93,6 +100,12 @@ public:
 		,_inactiveDeferredCopyCache(NULL)
 		,_inactiveTenureCopyScanCache(NULL)
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
+#if defined(OMR_GC_MODRON_SCAVENGER)
+		,_scavengerNUMANode(0)
+		,_scavengerNUMANodeAssigned(false)
+		,_hotFieldSampleCountdown(1)
+		,_hotFieldSampleCount(0)
+#endif /* OMR_GC_MODRON_SCAVENGER */
 		,_tenureTLHRemainderBase(NULL)
 		,_tenureTLHRemainderTop(NULL)
 		,_loaAllocation(false)
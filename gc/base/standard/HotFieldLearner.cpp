@@ -0,0 +1,220 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include <string.h>
+
+#include "HotFieldLearner.hpp"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+#include "EnvironmentBase.hpp"
+#include "Forge.hpp"
+#include "GCExtensionsBase.hpp"
+
+/* The number of object shapes hot fields can be sampled and learned for (a power of 2). At most 3/4 of the entries are used. */
+#define HOT_FIELD_LEARNER_SHAPES 256
+
+/* The number of distinct (shape, slot offset) samples counted between learn() calls. */
+#define HOT_FIELD_LEARNER_TRACKED_SAMPLES 1024
+
+/* Returned by findOrAddSampledShape() when the shape can not be sampled. */
+#define HOT_FIELD_LEARNER_NO_SHAPE UDATA_MAX
+
+MM_HotFieldLearner *
+MM_HotFieldLearner::newInstance(MM_EnvironmentBase *env)
+{
+	MM_HotFieldLearner *hotFieldLearner = (MM_HotFieldLearner *)env->getForge()->allocate(sizeof(MM_HotFieldLearner), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != hotFieldLearner) {
+		new(hotFieldLearner) MM_HotFieldLearner(env);
+		if (!hotFieldLearner->initialize(env)) {
+			hotFieldLearner->kill(env);
+			hotFieldLearner = NULL;
+		}
+	}
+	return hotFieldLearner;
+}
+
+void
+MM_HotFieldLearner::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_HotFieldLearner::initialize(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	_samplingRate = extensions->scavengerHotFieldSamplingRate;
+	_minimumSamples = OMR_MAX(1, extensions->scavengerHotFieldMinimumSamples);
+
+	_samples = spaceSavingNew(env->getPortLibrary(), HOT_FIELD_LEARNER_TRACKED_SAMPLES);
+	if (NULL == _samples) {
+		return false;
+	}
+
+	if (0 != omrthread_monitor_init_with_name(&_samplesMonitor, 0, "MM_HotFieldLearner::samplesMonitor")) {
+		return false;
+	}
+
+	_learnedShapesSize = HOT_FIELD_LEARNER_SHAPES;
+	_learnedShapes = (LearnedShape *)env->getForge()->allocate(sizeof(LearnedShape) * _learnedShapesSize, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL == _learnedShapes) {
+		return false;
+	}
+	memset(_learnedShapes, 0, sizeof(LearnedShape) * _learnedShapesSize);
+
+	_sampledShapeKeys = (uintptr_t *)env->getForge()->allocate(sizeof(uintptr_t) * _learnedShapesSize, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL == _sampledShapeKeys) {
+		return false;
+	}
+	memset(_sampledShapeKeys, 0, sizeof(uintptr_t) * _learnedShapesSize);
+
+	return true;
+}
+
+void
+MM_HotFieldLearner::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _sampledShapeKeys) {
+		env->getForge()->free(_sampledShapeKeys);
+		_sampledShapeKeys = NULL;
+	}
+
+	if (NULL != _learnedShapes) {
+		env->getForge()->free(_learnedShapes);
+		_learnedShapes = NULL;
+	}
+
+	if (NULL != _samplesMonitor) {
+		omrthread_monitor_destroy(_samplesMonitor);
+		_samplesMonitor = NULL;
+	}
+
+	if (NULL != _samples) {
+		spaceSavingFree(_samples);
+		_samples = NULL;
+	}
+}
+
+void
+MM_HotFieldLearner::flushSamples(MM_EnvironmentStandard *env)
+{
+	if (0 != env->_hotFieldSampleCount) {
+		omrthread_monitor_enter(_samplesMonitor);
+		for (uintptr_t i = 0; i < env->_hotFieldSampleCount; i++) {
+			uintptr_t shapeIndex = findOrAddSampledShape(env->_hotFieldSampleShapeKeys[i]);
+			if (HOT_FIELD_LEARNER_NO_SHAPE != shapeIndex) {
+				/* the shape index is biased by one so that no sample key is 0 */
+				uintptr_t key = ((shapeIndex + 1) << 8) | env->_hotFieldSampleOffsets[i];
+				spaceSavingUpdate(_samples, (void *)key, 1);
+			}
+		}
+		omrthread_monitor_exit(_samplesMonitor);
+		env->_hotFieldSampleCount = 0;
+	}
+}
+
+uintptr_t
+MM_HotFieldLearner::learn(MM_EnvironmentBase *env)
+{
+	uintptr_t sampledKeys = spaceSavingGetCurSize(_samples);
+
+	/* keep what was learned before if nothing was sampled (e.g. no scalar objects survived) */
+	if (0 != sampledKeys) {
+		memset(_learnedShapes, 0, sizeof(LearnedShape) * _learnedShapesSize);
+		_learnedShapeCount = 0;
+
+		/* samples are ranked most frequent first, so the hot fields of each shape are added hottest first */
+		for (uintptr_t k = 1; k <= sampledKeys; k++) {
+			if (spaceSavingGetKthMostFreqCount(_samples, k) < _minimumSamples) {
+				break;
+			}
+			uintptr_t key = (uintptr_t)spaceSavingGetKthMostFreq(_samples, k);
+			LearnedShape *entry = findOrAddLearnedShape(_sampledShapeKeys[(key >> 8) - 1]);
+			if (NULL != entry) {
+				for (uintptr_t i = 0; i < HOT_FIELD_LEARNER_OFFSETS; i++) {
+					if (U_8_MAX == entry->_hotFieldOffsets[i]) {
+						entry->_hotFieldOffsets[i] = (uint8_t)(key & U_8_MAX);
+						break;
+					}
+				}
+			}
+		}
+
+		spaceSavingClear(_samples);
+		memset(_sampledShapeKeys, 0, sizeof(uintptr_t) * _learnedShapesSize);
+		_sampledShapeCount = 0;
+	}
+
+	return _learnedShapeCount;
+}
+
+/**
+ * Find the index of a shape in the table of sampled shapes, adding the shape if it is not there yet.
+ * Must be called with _samplesMonitor held.
+ * @return the index of the shape, or HOT_FIELD_LEARNER_NO_SHAPE if the shape key is 0 or the table is full
+ */
+uintptr_t
+MM_HotFieldLearner::findOrAddSampledShape(uintptr_t shapeKey)
+{
+	if (0 != shapeKey) {
+		uintptr_t mask = _learnedShapesSize - 1;
+		for (uintptr_t index = hashIndex(shapeKey); ; index = (index + 1) & mask) {
+			if (shapeKey == _sampledShapeKeys[index]) {
+				return index;
+			} else if (0 == _sampledShapeKeys[index]) {
+				if ((_sampledShapeCount * 4) < (_learnedShapesSize * 3)) {
+					_sampledShapeKeys[index] = shapeKey;
+					_sampledShapeCount += 1;
+					return index;
+				}
+				break;
+			}
+		}
+	}
+	return HOT_FIELD_LEARNER_NO_SHAPE;
+}
+
+MM_HotFieldLearner::LearnedShape *
+MM_HotFieldLearner::findOrAddLearnedShape(uintptr_t shapeKey)
+{
+	uintptr_t mask = _learnedShapesSize - 1;
+	for (uintptr_t index = hashIndex(shapeKey); ; index = (index + 1) & mask) {
+		LearnedShape *entry = &_learnedShapes[index];
+		if (shapeKey == entry->_shapeKey) {
+			return entry;
+		} else if (0 == entry->_shapeKey) {
+			/* leave unused entries so lookups of unknown shapes terminate quickly */
+			if ((_learnedShapeCount * 4) >= (_learnedShapesSize * 3)) {
+				return NULL;
+			}
+			entry->_shapeKey = shapeKey;
+			memset(entry->_hotFieldOffsets, U_8_MAX, sizeof(entry->_hotFieldOffsets));
+			_learnedShapeCount += 1;
+			return entry;
+		}
+	}
+}
+
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
@@ -0,0 +1,183 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(HOTFIELDLEARNER_HPP_)
+#define HOTFIELDLEARNER_HPP_
+
+#include "omrcfg.h"
+#include "omrthread.h"
+#include "spacesaving.h"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+#include "BaseVirtual.hpp"
+#include "EnvironmentStandard.hpp"
+
+/* The maximum number of hot fields learned per object shape (matches the hot fields provided by the object model). */
+#define HOT_FIELD_LEARNER_OFFSETS 3
+
+/**
+ * Learns the hot fields of object shapes from the slots the scavenger traverses, for languages that
+ * do not provide them through the object model (getHotFieldOffset()). Scavenger threads sample the slots
+ * of one in scavengerHotFieldSamplingRate scanned objects that lead to objects in evacuate space. Samples
+ * are counted with a space saving top-K and, after each scavenge, the most frequent slots of each shape
+ * become the hot fields depth copied in the next scavenge.
+ *
+ * @ingroup GC_Modron_Standard
+ */
+class MM_HotFieldLearner : public MM_BaseVirtual
+{
+/* Data Section */
+public:
+protected:
+private:
+	/**
+	 * Hot fields learned for one object shape, as an entry in an open addressing table.
+	 */
+	struct LearnedShape {
+		uintptr_t _shapeKey; /**< shape key of the object shape, 0 if the entry is unused */
+		uint8_t _hotFieldOffsets[HOT_FIELD_LEARNER_OFFSETS]; /**< slot offsets of the hot fields, hottest first, U_8_MAX for unused offsets */
+	};
+
+	OMRSpaceSaving *_samples; /**< sampled (shape index, slot offset) keys counted since the last learn() */
+	omrthread_monitor_t _samplesMonitor; /**< protects _samples and _sampledShapeKeys while GC threads flush their sample buffers */
+	uintptr_t *_sampledShapeKeys; /**< open addressing table of the shape keys sampled since the last learn(), 0 for unused entries; samples refer to shapes by their index in this table */
+	uintptr_t _sampledShapeCount; /**< number of entries in use in _sampledShapeKeys */
+	LearnedShape *_learnedShapes; /**< table of learned shapes, _learnedShapesSize entries */
+	uintptr_t _learnedShapesSize; /**< number of entries in _learnedShapes (a power of 2) */
+	uintptr_t _learnedShapeCount; /**< number of entries in use in _learnedShapes */
+	uintptr_t _samplingRate; /**< one in this many scanned objects is sampled */
+	uintptr_t _minimumSamples; /**< number of times a slot must be sampled to be learned */
+
+/* Functionality Section */
+public:
+	static MM_HotFieldLearner *newInstance(MM_EnvironmentBase *env);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Determine if the next object scanned by the thread should have its slots sampled.
+	 * @param env[in] the current thread
+	 * @return true if the object should be sampled
+	 */
+	MMINLINE bool
+	shouldSampleObject(MM_EnvironmentStandard *env)
+	{
+		env->_hotFieldSampleCountdown -= 1;
+		if (0 == env->_hotFieldSampleCountdown) {
+			env->_hotFieldSampleCountdown = _samplingRate;
+			return true;
+		}
+		return false;
+	}
+
+	/**
+	 * Record that a slot of a sampled object leads to an object in evacuate space.
+	 * @param env[in] the current thread
+	 * @param shapeKey[in] the shape key of the sampled object (non zero)
+	 * @param slotOffset[in] the offset of the slot from the start of the object, in slots
+	 */
+	MMINLINE void
+	sample(MM_EnvironmentStandard *env, uintptr_t shapeKey, uintptr_t slotOffset)
+	{
+		/* offsets are learned as uint8_t, with U_8_MAX reserved for no hot field */
+		if (slotOffset < U_8_MAX) {
+			env->_hotFieldSampleShapeKeys[env->_hotFieldSampleCount] = shapeKey;
+			env->_hotFieldSampleOffsets[env->_hotFieldSampleCount] = (uint8_t)slotOffset;
+			env->_hotFieldSampleCount += 1;
+			env->_scavengerStats._hotFieldSampleCount += 1;
+			if (SCAVENGER_HOT_FIELD_SAMPLE_BUFFER_SIZE == env->_hotFieldSampleCount) {
+				flushSamples(env);
+			}
+		}
+	}
+
+	/**
+	 * Flush the samples buffered by the thread into the shared sample counts.
+	 * @param env[in] the current thread
+	 */
+	void flushSamples(MM_EnvironmentStandard *env);
+
+	/**
+	 * Rebuild the learned hot fields from the samples counted since the previous call, then discard the samples.
+	 * Must be called by the main GC thread while no other GC thread is sampling or copying.
+	 * @param env[in] the main GC thread
+	 * @return the number of object shapes with learned hot fields
+	 */
+	uintptr_t learn(MM_EnvironmentBase *env);
+
+	/**
+	 * Returns the learned hot field offsets for an object shape.
+	 * @param shapeKey[in] the shape key of the object
+	 * @return HOT_FIELD_LEARNER_OFFSETS slot offsets, hottest first and padded with U_8_MAX, or NULL if none were learned
+	 */
+	MMINLINE const uint8_t *
+	getHotFieldOffsets(uintptr_t shapeKey)
+	{
+		if ((0 != _learnedShapeCount) && (0 != shapeKey)) {
+			uintptr_t mask = _learnedShapesSize - 1;
+			for (uintptr_t index = hashIndex(shapeKey); ; index = (index + 1) & mask) {
+				LearnedShape *entry = &_learnedShapes[index];
+				if (shapeKey == entry->_shapeKey) {
+					return entry->_hotFieldOffsets;
+				} else if (0 == entry->_shapeKey) {
+					/* the table is never full, so every probe sequence ends in an unused entry */
+					break;
+				}
+			}
+		}
+		return NULL;
+	}
+
+	MM_HotFieldLearner(MM_EnvironmentBase *env)
+		: MM_BaseVirtual()
+		, _samples(NULL)
+		, _samplesMonitor(NULL)
+		, _sampledShapeKeys(NULL)
+		, _sampledShapeCount(0)
+		, _learnedShapes(NULL)
+		, _learnedShapesSize(0)
+		, _learnedShapeCount(0)
+		, _samplingRate(1)
+		, _minimumSamples(1)
+	{
+		_typeId = __FUNCTION__;
+	}
+
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+private:
+	MMINLINE uintptr_t
+	hashIndex(uintptr_t shapeKey)
+	{
+		/* shape keys are often aligned addresses or sizes, so take the index from the middle bits of the product */
+		uintptr_t hash = shapeKey * (uintptr_t)0x9E3779B1;
+		return (hash >> 12) & (_learnedShapesSize - 1);
+	}
+
+	uintptr_t findOrAddSampledShape(uintptr_t shapeKey);
+	LearnedShape *findOrAddLearnedShape(uintptr_t shapeKey);
+};
+
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+#endif /* HOTFIELDLEARNER_HPP_ */
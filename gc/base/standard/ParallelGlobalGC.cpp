@@ -65,6 +65,7 @@
 #if defined(OMR_GC_MODRON_SCAVENGER)
 #include "Scavenger.hpp"
 #endif /* OMR_GC_MODRON_SCAVENGER */
+#include "SparseVirtualMemory.hpp"
 #include "WorkPackets.hpp"
 
 /* OMRTODO temporary workaround to allow both ut_j9mm.h and ut_omrmm.h to be included.
@@ -243,6 +244,16 @@ hookGlobalGcSweepEndAbortedCSFixHeap(J9HookInterface** hook, UDATA eventNum, voi
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
 #endif /* OMR_GC_MODRON_SCAVENGER */
 
+/**
+ * Keep the sparse data of large object proxies that were marked, free it for the others.
+ */
+static void *
+sparseProxyObjectAfterMark(MM_EnvironmentBase *env, void *proxyObjPtr, void *userData)
+{
+	MM_MarkingScheme *markingScheme = (MM_MarkingScheme *)userData;
+	return markingScheme->isMarked((omrobjectptr_t)proxyObjPtr) ? proxyObjPtr : NULL;
+}
+
 /**
  * Initialization
  */
@@ -395,6 +406,9 @@ MM_ParallelGlobalGC::cleanupAfterGC(MM_EnvironmentBase *env, MM_AllocateDescript
 {
 	updateTuningStatistics(env);
 
+	MM_Heap *heap = _extensions->heap;
+	heap->getResizePredictor()->recordGlobalEnd(env, heap->getActiveMemorySize(MEMORY_TYPE_OLD) - heap->getApproximateActiveFreeMemorySize(MEMORY_TYPE_OLD));
+
 	/* Perform the resize now. The decision was earlier */
 	env->_cycleState->_activeSubSpace->performResize(env, allocDescription);
 
@@ -461,6 +475,11 @@ MM_ParallelGlobalGC::mainThreadGarbageCollect(MM_EnvironmentBase *env, MM_Alloca
 	markAll(env, initMarkMap);
 
 	_delegate.postMarkProcessing(env);
+
+	if (NULL != _extensions->largeObjectVirtualMemory) {
+		/* Release the off-heap data of large objects that did not survive marking */
+		_extensions->largeObjectVirtualMemory->updateOrFreeSparseRegions(env, sparseProxyObjectAfterMark, _markingScheme);
+	}
 	
 	sweep(env, allocDescription, rebuildMarkBits);
 
@@ -720,7 +739,7 @@ MM_ParallelGlobalGC::shouldCompactThisCycle(MM_EnvironmentBase *env, MM_Allocate
 		uintptr_t totalSize = memorySubSpace->getActiveMemorySize();
 		MM_MemoryPool *memoryPool= memorySubSpace->getMemoryPool();
 		uintptr_t darkMatterBytes = 0;
-		if (!_extensions->concurrentSweep) {
+		if (!_extensions->isConcurrentSweepEnabled()) {
 			darkMatterBytes = memoryPool->getDarkMatterBytes();
 		}
 		uintptr_t freeMemorySize = memoryPool->getActualFreeMemorySize();
@@ -992,6 +1011,12 @@ MM_ParallelGlobalGC::mainThreadCompact(MM_EnvironmentBase *env, MM_AllocateDescr
 	MM_ParallelCompactTask compactTask(env, _dispatcher, _compactScheme, rebuildMarkBits, env->_cycleState->_gcCode.shouldAggressivelyCompact());
 	_dispatcher->run(env, &compactTask);
 	compactStats->_endTime = omrtime_hires_clock();
+
+	if ((0 != compactStats->_deferredLiveBytes) && (0 != compactStats->_evacuatedLiveBytes)) {
+		/* move time scales with the live bytes evacuated, so estimate the time deferred sub areas would have added */
+		uint64_t moveTime = compactStats->_moveEndTime - compactStats->_moveStartTime;
+		compactStats->_estimatedPauseReduction = (uint64_t)((double)moveTime * ((double)compactStats->_deferredLiveBytes / (double)compactStats->_evacuatedLiveBytes));
+	}
 	reportCompactEnd(env);
 	
 	/* Remember the gc count of the last compaction */ 
@@ -1061,6 +1086,9 @@ MM_ParallelGlobalGC::internalPreCollect(MM_EnvironmentBase *env, MM_MemorySubSpa
 		processLargeAllocateStatsBeforeGC(env);
 	}
 
+	MM_Heap *heap = _extensions->heap;
+	heap->getResizePredictor()->recordGlobalStart(env, heap->getActiveMemorySize(MEMORY_TYPE_OLD) - heap->getApproximateActiveFreeMemorySize(MEMORY_TYPE_OLD));
+
 	reportGCCycleStart(env);
 	reportGCStart(env);
 	reportGCIncrementStart(env);
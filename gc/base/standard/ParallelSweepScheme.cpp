@@ -32,6 +32,7 @@
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
 #include "Heap.hpp"
+#include "HeapMapScan.hpp"
 #include "HeapMemoryPoolIterator.hpp"
 #include "HeapLinkedFreeHeader.hpp"
 #include "MemoryPool.hpp"
@@ -341,14 +342,7 @@ MM_ParallelSweepScheme::sweepMarkMapBody(
 		markMapFreeHead = markMapCurrent;
 		heapSlotFreeHead = heapSlotFreeCurrent;
 
-		markMapCurrent += 1;
-
-		while(markMapCurrent < markMapChunkTop) {
-			if(*markMapCurrent != J9MODRON_OBM_SLOT_EMPTY) {
-				break;
-			}
-			markMapCurrent += 1;
-		}
+		markMapCurrent = MM_HeapMapScan::findNonEmptySlot(_extensions->heapMapScanImplementation, markMapCurrent + 1, markMapChunkTop);
 
 		/* Find the number of slots we've walked
 		 * (pointer math makes this the number of slots)
@@ -482,6 +476,12 @@ MM_ParallelSweepScheme::sweepChunk(MM_EnvironmentBase *env, MM_ParallelSweepChun
 	/* Be sure that chunk is just initialized */
 	Assert_MM_true(NULL == sweepChunk->freeListTail);
 
+	/* The live object count is only reported at the end of the sweep, so only pay for the extra pass over the map if someone listens */
+	if (J9_EVENT_IS_HOOKED(_extensions->privateHookInterface, J9HOOK_MM_PRIVATE_SWEEP_END)) {
+		/* Count the live objects of the whole chunk in bulk rather than one at a time while walking the map */
+		env->_sweepStats._liveObjectCount += MM_HeapMapScan::countSetBits(_extensions->heapMapScanImplementation, markMapChunkBase, markMapChunkTop);
+	}
+
 	/* Process the leading free entry */
 	heapSlotFreeHead = NULL;
 	heapSlotFreeCount = 0;
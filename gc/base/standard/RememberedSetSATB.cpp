@@ -26,6 +26,8 @@
 #if defined(OMR_GC_REALTIME)
 
 #include "Debug.hpp"
+#include "GCExtensionsBase.hpp"
+#include "GlobalCollector.hpp"
 #include "RememberedSetSATB.hpp"
 #include "WorkPackets.hpp"
 
@@ -44,7 +46,7 @@ MM_RememberedSetSATB::newInstance(MM_EnvironmentBase *env, MM_WorkPacketsSATB *w
 {
 	MM_RememberedSetSATB *rememberedSet;
 	
-	rememberedSet = (MM_RememberedSetSATB *)env->getForge()->allocate(sizeof(MM_RememberedSetSATB), MM_AllocationCategory::WORK_PACKETS, J9_GET_CALLSITE());
+	rememberedSet = (MM_RememberedSetSATB *)env->getForge()->allocate(sizeof(MM_RememberedSetSATB), MM_AllocationCategory::WORK_PACKETS, OMR_GET_CALLSITE());
 	if (NULL != rememberedSet) {
 		new(rememberedSet) MM_RememberedSetSATB(env, workPackets);
 		if (!rememberedSet->initialize(env)) {
@@ -263,6 +265,35 @@ MM_RememberedSetSATB::setGlobalIndex(MM_EnvironmentBase* env, UDATA indexValue)
 	} 
 }
 
+/**
+ * Take an empty barrier packet from the thread's reserve. An exhausted reserve is refilled
+ * with up to sATBBarrierPacketBatch packets claimed under a single in-use list operation.
+ * Reserved packets are already on the in-use list, so a reserve left over from before the
+ * in-use packets were last flushed is stale and is dropped.
+ *
+ * @return an empty packet on the in-use list, or NULL if none could be obtained
+ */
+MM_Packet *
+MM_RememberedSetSATB::getReservedBarrierPacket(MM_EnvironmentBase* env)
+{
+	uintptr_t epoch = _workPackets->getBarrierPacketEpoch();
+	if (epoch != env->_sATBBarrierPacketReserveEpoch) {
+		env->_sATBBarrierPacketReserveCount = 0;
+		env->_sATBBarrierPacketReserveEpoch = epoch;
+	}
+
+	if (0 == env->_sATBBarrierPacketReserveCount) {
+		uintptr_t batch = OMR_MIN(OMR_MAX(env->getExtensions()->sATBBarrierPacketBatch, 1), SATB_BARRIER_PACKET_RESERVE_MAXIMUM);
+		env->_sATBBarrierPacketReserveCount = _workPackets->getBarrierPackets(env, env->_sATBBarrierPacketReserve, batch);
+		if (0 == env->_sATBBarrierPacketReserveCount) {
+			return NULL;
+		}
+	}
+
+	env->_sATBBarrierPacketReserveCount -= 1;
+	return env->_sATBBarrierPacketReserve[env->_sATBBarrierPacketReserveCount];
+}
+
 /**
  * Refresh the fragment.
  * 
@@ -276,12 +307,13 @@ MM_RememberedSetSATB::refreshFragment(MM_EnvironmentBase *env, MM_GCRememberedSe
 	MM_Packet *packet = NULL;
 	bool result = false;
 	
-	packet = _workPackets->getBarrierPacket(env);
+	packet = getReservedBarrierPacket(env);
 	MM_Packet *oldPacket = (MM_Packet *)fragment->fragmentStorage;
 		
 	if ((NULL != oldPacket) && (getLocalFragmentIndex(env, fragment) == getGlobalFragmentIndex(env)) && (*fragment->fragmentTop == *fragment->fragmentAlloc)) {
-		_workPackets->removePacketFromInUseList(env, oldPacket);
-		_workPackets->putFullPacket(env, oldPacket);
+		if (_workPackets->publishFullBarrierPacket(env, oldPacket)) {
+			env->getExtensions()->getGlobalCollector()->drainBarrierPackets(env);
+		}
 	}
 	
 	if (J9GC_REMEMBERED_SET_RESERVED_INDEX == fragment->localFragmentIndex) {
@@ -296,8 +328,6 @@ MM_RememberedSetSATB::refreshFragment(MM_EnvironmentBase *env, MM_GCRememberedSe
 		fragment->fragmentTop = packet->getTopAddr(env);
 		fragment->fragmentStorage = (void *)packet;
 	    
-	    _workPackets->putInUsePacket(env, packet);
-	    
 	    result = true;
 	} else {
 		fragment->fragmentAlloc = NULL;
@@ -86,6 +86,7 @@ protected:
 
 private:
 	void setGlobalIndex(MM_EnvironmentBase* env, UDATA indexValue); /* Increments the appropriate global index (global or preserved). */
+	MM_Packet *getReservedBarrierPacket(MM_EnvironmentBase* env); /* Takes the next empty packet from the thread's reserve, refilling it in a batch when exhausted. */
 };
 #endif /* defined(OMR_GC_REALTIME) */
 #endif /* REMEMBEREDSETSATB_HPP_ */
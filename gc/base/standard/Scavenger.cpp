@@ -61,6 +61,10 @@
 #include "HeapRegionIterator.hpp"
 #include "HeapRegionManager.hpp"
 #include "HeapStats.hpp"
+#include "HeapVirtualMemory.hpp"
+#include "HotFieldLearner.hpp"
+#include "Math.hpp"
+#include "MemoryManager.hpp"
 #include "MemoryPool.hpp"
 #include "MemorySpace.hpp"
 #include "MemorySubSpace.hpp"
@@ -82,6 +86,7 @@
 #include "ScavengerRootScanner.hpp"
 #include "ScavengerStats.hpp"
 #include "SlotObject.hpp"
+#include "SparseVirtualMemory.hpp"
 #include "SublistFragment.hpp"
 #include "SublistIterator.hpp"
 #include "SublistPool.hpp"
@@ -226,11 +231,16 @@ MM_Scavenger::initialize(MM_EnvironmentBase *env)
 	/* initialize the global scavenger gcCount */
 	_extensions->scavengerStats._gcCount = 0;
 
-	if (!_scavengeCacheFreeList.initialize(env, NULL)) {
+	if (_extensions->scavengerNUMAAware) {
+		/* no affinity leaders are reported if NUMA is disabled or not available */
+		_numaNodeCount = OMR_MAX(1, OMR_MIN(_extensions->_numaManager.getAffinityLeaderCount(), OMR_SCAVENGER_NUMA_NODE_MAX));
+	}
+
+	if (!_scavengeCacheFreeList.initialize(env, NULL, _numaNodeCount)) {
 		return false;
 	}
 
-	if (!_scavengeCacheScanList.initialize(env, &_cachedEntryCount)) {
+	if (!_scavengeCacheScanList.initialize(env, &_cachedEntryCount, _numaNodeCount)) {
 		return false;
 	}
 
@@ -294,6 +304,13 @@ MM_Scavenger::initialize(MM_EnvironmentBase *env)
 	}
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
 
+	if (_extensions->scavengerHotFieldLearning) {
+		_hotFieldLearner = MM_HotFieldLearner::newInstance(env);
+		if (NULL == _hotFieldLearner) {
+			return false;
+		}
+	}
+
 	if (!_delegate.initialize(env)) {
 		return false;
 	}
@@ -306,6 +323,11 @@ MM_Scavenger::tearDown(MM_EnvironmentBase *env)
 {
 	_delegate.tearDown(env);
 
+	if (NULL != _hotFieldLearner) {
+		_hotFieldLearner->kill(env);
+		_hotFieldLearner = NULL;
+	}
+
 	_scavengeCacheFreeList.tearDown(env);
 	_scavengeCacheScanList.tearDown(env);
 
@@ -442,11 +464,144 @@ MM_Scavenger::mainSetupForGC(MM_EnvironmentStandard *env)
 	_activeSubSpace->cacheRanges(_evacuateMemorySubSpace, &_evacuateSpaceBase, &_evacuateSpaceTop);
 	_activeSubSpace->cacheRanges(_survivorMemorySubSpace, &_survivorSpaceBase, &_survivorSpaceTop);
 
+	if ((1 < _numaNodeCount) && !_extensions->isConcurrentScavengerEnabled()) {
+		reserveNUMASurvivorMemory(env);
+	}
+
 	/* assume that value of RS Overflow flag will not be changed until scavengeRememberedSet() call, so handle it first */
 	_isRememberedSetInOverflowAtTheBeginning = isRememberedSetInOverflowState();
 	_extensions->rememberedSet.startProcessingSublist();
 }
 
+void
+MM_Scavenger::assignNUMANode(MM_EnvironmentStandard *env)
+{
+	MM_NUMAManager *numaManager = &_extensions->_numaManager;
+
+	if (env->_scavengerNUMANodeAssigned) {
+		/* threads keep their node (and binding) from one scavenge to the next */
+		return;
+	}
+	env->_scavengerNUMANodeAssigned = true;
+
+	if (env->isMainThread()) {
+		/* don't rebind the main thread, just find which affinity leader (if any) it already runs on */
+		uintptr_t j9NodeNumber = env->getNumaAffinity();
+		env->_scavengerNUMANode = 0;
+		if (0 != j9NodeNumber) {
+			for (uintptr_t nodeIndex = 0; nodeIndex < _numaNodeCount; nodeIndex++) {
+				if (j9NodeNumber == numaManager->getJ9NodeNumber(nodeIndex + 1)) {
+					env->_scavengerNUMANode = nodeIndex;
+					break;
+				}
+			}
+		}
+	} else {
+		env->_scavengerNUMANode = env->getWorkerID() % _numaNodeCount;
+		/* 0 is returned for simulated NUMA, in which case only the logical partitioning is done */
+		uintptr_t j9NodeNumber = numaManager->getJ9NodeNumber(env->_scavengerNUMANode + 1);
+		if ((0 != j9NodeNumber) && (j9NodeNumber != env->getNumaAffinity())) {
+			env->setNumaAffinity(&j9NodeNumber, 1);
+		}
+	}
+}
+
+void
+MM_Scavenger::reserveNUMASurvivorMemory(MM_EnvironmentStandard *env)
+{
+	MM_NUMAManager *numaManager = &_extensions->_numaManager;
+	uintptr_t freeSize = _survivorMemorySubSpace->getMemoryPool()->getActualFreeMemorySize();
+	uintptr_t nodeSize = MM_Math::roundToFloor(_extensions->getObjectAlignmentInBytes(), freeSize / _numaNodeCount);
+
+	/* 0 is returned for simulated NUMA, in which case the survivor memory is only split logically */
+	if (0 != numaManager->getJ9NodeNumber(1)) {
+		/* the semi spaces take turns being survivor, so only a resized survivor range has to be bound again */
+		bool isBound = false;
+		for (uintptr_t i = 0; i < 2; i++) {
+			if ((_survivorSpaceBase == _numaBoundSurvivorRanges[i][0]) && (_survivorSpaceTop == _numaBoundSurvivorRanges[i][1])) {
+				isBound = true;
+			}
+		}
+		if (!isBound) {
+			uintptr_t rangeNodeSize = ((uintptr_t)_survivorSpaceTop - (uintptr_t)_survivorSpaceBase) / _numaNodeCount;
+			const MM_MemoryHandle *heapHandle = ((MM_HeapVirtualMemory *)_extensions->heap)->getVmemHandle();
+			for (uintptr_t nodeIndex = 0; nodeIndex < _numaNodeCount; nodeIndex++) {
+				void *rangeNodeBase = (void *)((uintptr_t)_survivorSpaceBase + (nodeIndex * rangeNodeSize));
+				_extensions->memoryManager->setNumaAffinity(heapHandle, numaManager->getJ9NodeNumber(nodeIndex + 1), rangeNodeBase, rangeNodeSize);
+			}
+			_numaBoundSurvivorRanges[0][0] = _numaBoundSurvivorRanges[1][0];
+			_numaBoundSurvivorRanges[0][1] = _numaBoundSurvivorRanges[1][1];
+			_numaBoundSurvivorRanges[1][0] = _survivorSpaceBase;
+			_numaBoundSurvivorRanges[1][1] = _survivorSpaceTop;
+		}
+	}
+
+	/* survivor space is empty, so the reservoirs are carved in address order and line up with the bound parts of the range */
+	for (uintptr_t nodeIndex = 0; nodeIndex < _numaNodeCount; nodeIndex++) {
+		NUMASurvivorReservoir *reservoir = &_numaSurvivorReservoirs[nodeIndex];
+		void *base = NULL;
+		if (0 != nodeSize) {
+			MM_AllocateDescription allocDescription(nodeSize, 0, false, true);
+			base = _survivorMemorySubSpace->collectorAllocate(env, this, &allocDescription);
+		}
+		/* a node gets no reservoir if the free memory is fragmented; its threads take survivor memory from the other nodes then */
+		reservoir->_alloc = base;
+		reservoir->_top = (NULL == base) ? NULL : (void *)((uintptr_t)base + nodeSize);
+	}
+	_numaSurvivorReserved = true;
+}
+
+bool
+MM_Scavenger::allocateNUMASurvivorMemory(MM_EnvironmentStandard *env, uintptr_t minimumSize, uintptr_t maximumSize, void* &addrBase, void* &addrTop)
+{
+	MM_ScavengerStats::NUMANodeStats *nodeStats = &env->_scavengerStats._numaNodeStats[env->_scavengerNUMANode];
+
+	for (uintptr_t i = 0; i < _numaNodeCount; i++) {
+		/* start with the thread's own node */
+		NUMASurvivorReservoir *reservoir = &_numaSurvivorReservoirs[(env->_scavengerNUMANode + i) % _numaNodeCount];
+		void *base = reservoir->_alloc;
+		while (((uintptr_t)reservoir->_top - (uintptr_t)base) >= minimumSize) {
+			uintptr_t size = OMR_MIN(maximumSize, (uintptr_t)reservoir->_top - (uintptr_t)base);
+			void *top = (void *)((uintptr_t)base + size);
+			void *oldBase = (void *)MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&reservoir->_alloc, (uintptr_t)base, (uintptr_t)top);
+			if (oldBase == base) {
+				addrBase = base;
+				addrTop = top;
+				if (0 == i) {
+					nodeStats->_localSurvivorBytes += size;
+				} else {
+					nodeStats->_remoteSurvivorBytes += size;
+				}
+				return true;
+			}
+			base = oldBase;
+		}
+	}
+
+	return false;
+}
+
+void
+MM_Scavenger::releaseNUMASurvivorMemory(MM_EnvironmentStandard *env)
+{
+	MM_MemoryPool *survivorPool = _survivorMemorySubSpace->getMemoryPool();
+
+	for (uintptr_t nodeIndex = 0; nodeIndex < _numaNodeCount; nodeIndex++) {
+		NUMASurvivorReservoir *reservoir = &_numaSurvivorReservoirs[nodeIndex];
+		void *base = reservoir->_alloc;
+		void *top = reservoir->_top;
+		if (base < top) {
+			/* survivor becomes allocate space without its free list being rebuilt, so the memory must go back to the pool */
+			if ((((uintptr_t)top - (uintptr_t)base) < survivorPool->getMinimumFreeEntrySize()) || !survivorPool->recycleHeapChunk(env, base, top)) {
+				_survivorMemorySubSpace->abandonHeapChunk(base, top);
+			}
+		}
+		reservoir->_alloc = NULL;
+		reservoir->_top = NULL;
+	}
+	_numaSurvivorReserved = false;
+}
+
 void
 MM_Scavenger::workerSetupForGC(MM_EnvironmentStandard *env)
 {
@@ -464,6 +619,10 @@ MM_Scavenger::workerSetupForGC(MM_EnvironmentStandard *env)
 	/* record that this thread is participating in this cycle */
 	env->_scavengerStats._gcCount = _extensions->scavengerStats._gcCount;
 
+	if (1 < _numaNodeCount) {
+		assignNUMANode(env);
+	}
+
 	/* Reset the local remembered set fragment */
 	env->_scavengerRememberedSet.count = 0;
 	env->_scavengerRememberedSet.fragmentCurrent = NULL;
@@ -834,6 +993,19 @@ MM_Scavenger::mergeGCStatsBase(MM_EnvironmentBase *env, MM_ScavengerStats *final
 		finalGCStats->_copy_cachesize_counts[i] += scavStats->_copy_cachesize_counts[i];
 	}
 	finalGCStats->_leafObjectCount += scavStats->_leafObjectCount;
+	finalGCStats->_slotPrefetchCount += scavStats->_slotPrefetchCount;
+	finalGCStats->_slotPrefetchHitCount += scavStats->_slotPrefetchHitCount;
+	finalGCStats->_slotPrefetchRingOccupancySum += scavStats->_slotPrefetchRingOccupancySum;
+	finalGCStats->_rememberedSetBatchCount += scavStats->_rememberedSetBatchCount;
+	finalGCStats->_rememberedSetBatchSlotCount += scavStats->_rememberedSetBatchSlotCount;
+	finalGCStats->_hotFieldSampleCount += scavStats->_hotFieldSampleCount;
+	for (uintptr_t i = 0; i < _numaNodeCount; i++) {
+		finalGCStats->_numaNodeStats[i]._copiedBytes += scavStats->_numaNodeStats[i]._copiedBytes;
+		finalGCStats->_numaNodeStats[i]._localScanCacheCount += scavStats->_numaNodeStats[i]._localScanCacheCount;
+		finalGCStats->_numaNodeStats[i]._remoteScanCacheCount += scavStats->_numaNodeStats[i]._remoteScanCacheCount;
+		finalGCStats->_numaNodeStats[i]._localSurvivorBytes += scavStats->_numaNodeStats[i]._localSurvivorBytes;
+		finalGCStats->_numaNodeStats[i]._remoteSurvivorBytes += scavStats->_numaNodeStats[i]._remoteSurvivorBytes;
+	}
 	finalGCStats->_copy_cachesize_sum += scavStats->_copy_cachesize_sum;
 	finalGCStats->_workStallTime += scavStats->_workStallTime;
 	finalGCStats->_completeStallTime += scavStats->_completeStallTime;
@@ -860,9 +1032,17 @@ MM_Scavenger::mergeThreadGCStats(MM_EnvironmentBase *env)
 
 	MM_ScavengerStats *scavStats = &env->_scavengerStats;
 
+	if (NULL != _hotFieldLearner) {
+		_hotFieldLearner->flushSamples(MM_EnvironmentStandard::getEnvironment(env));
+	}
+
 	/* This thread is just about to complete the scavenge task, record the timestamp.
 	 * This must be done before mergeGCStatsBase or else the timestamp won't be mereged as needed by adaptive threading. */
 	env->_scavengerStats._endTime = omrtime_hires_clock();
+	if (1 < _numaNodeCount) {
+		uintptr_t nodeIndex = MM_EnvironmentStandard::getEnvironment(env)->_scavengerNUMANode;
+		scavStats->_numaNodeStats[nodeIndex]._copiedBytes = scavStats->_flipBytes + scavStats->_tenureAggregateBytes;
+	}
 	mergeGCStatsBase(env, &_extensions->incrementScavengerStats, scavStats);
 
 	/* Merge language specific statistics. No known interesting data per increment - they are merged directly to aggregate cycle stats */
@@ -1172,19 +1352,29 @@ retry:
 			} else if (_extensions->tlhSurvivorDiscardThreshold < cacheSize) {
 				MM_AllocateDescription allocDescription(cacheSize, 0, false, true);
 
-				addrBase = _survivorMemorySubSpace->collectorAllocate(env, this, &allocDescription);
-				if(NULL != addrBase) {
-					addrTop = (void *)(((uint8_t *)addrBase) + cacheSize);
-					/* Check that there is no overflow */
-					Assert_MM_true(addrTop >= addrBase);
-					allocateResult = true;
+				if (_numaSurvivorReserved) {
+					allocateResult = allocateNUMASurvivorMemory(env, cacheSize, cacheSize, addrBase, addrTop);
+				}
+				if (!allocateResult) {
+					addrBase = _survivorMemorySubSpace->collectorAllocate(env, this, &allocDescription);
+					if(NULL != addrBase) {
+						addrTop = (void *)(((uint8_t *)addrBase) + cacheSize);
+						/* Check that there is no overflow */
+						Assert_MM_true(addrTop >= addrBase);
+						allocateResult = true;
+					}
 				}
 				env->_scavengerStats._semiSpaceAllocationCountLarge += 1;
 			} else {
 				MM_AllocateDescription allocDescription(0, 0, false, true);
 				/* Update the optimum scan cache size */
 				uintptr_t scanCacheSize = calculateOptimumCopyScanCacheSize(env);
-				allocateResult = (NULL != _survivorMemorySubSpace->collectorAllocateTLH(env, this, &allocDescription, scanCacheSize, addrBase, addrTop));
+				if (_numaSurvivorReserved) {
+					allocateResult = allocateNUMASurvivorMemory(env, cacheSize, OMR_MAX(cacheSize, scanCacheSize), addrBase, addrTop);
+				}
+				if (!allocateResult) {
+					allocateResult = (NULL != _survivorMemorySubSpace->collectorAllocateTLH(env, this, &allocDescription, scanCacheSize, addrBase, addrTop));
+				}
 				env->_scavengerStats._semiSpaceAllocationCountSmall += 1;
 			}
 		}
@@ -1842,12 +2032,27 @@ MM_Scavenger::depthCopyHotFields(MM_EnvironmentStandard *env, MM_ForwardedHeader
 					copyHotField(env, destinationObjectPtr, hotFieldOffset3);
 				}
 			}
-		} else if (_extensions->alwaysDepthCopyFirstOffset && !_extensions->objectModel.isIndexable(forwardedHeader)) {
-			copyHotField(env, destinationObjectPtr, DEFAULT_HOT_FIELD_OFFSET);
+		} else if (((NULL != _hotFieldLearner) || _extensions->alwaysDepthCopyFirstOffset) && !_extensions->objectModel.isIndexable(forwardedHeader)) {
+			/* fall back to learned hot fields if the object model does not provide any */
+			if (((NULL == _hotFieldLearner) || !copyLearnedHotFields(env, destinationObjectPtr)) && _extensions->alwaysDepthCopyFirstOffset) {
+				copyHotField(env, destinationObjectPtr, DEFAULT_HOT_FIELD_OFFSET);
+			}
 		}
 	}
 }
 
+MMINLINE bool
+MM_Scavenger::copyLearnedHotFields(MM_EnvironmentStandard *env, omrobjectptr_t destinationObjectPtr) {
+	const uint8_t *hotFieldOffsets = _hotFieldLearner->getHotFieldOffsets(_extensions->objectModel.getObjectShapeKey(destinationObjectPtr));
+	if (NULL == hotFieldOffsets) {
+		return false;
+	}
+	for (uintptr_t i = 0; (i < HOT_FIELD_LEARNER_OFFSETS) && (U_8_MAX != hotFieldOffsets[i]); i++) {
+		copyHotField(env, destinationObjectPtr, hotFieldOffsets[i]);
+	}
+	return true;
+}
+
 MMINLINE void
 MM_Scavenger::copyHotField(MM_EnvironmentStandard *env, omrobjectptr_t destinationObjectPtr, uint8_t offset) {
 	bool const compressed = _extensions->compressObjectReferences();
@@ -1967,6 +2172,75 @@ MM_Scavenger::flushCopyScanCounts(MM_EnvironmentBase* env, bool majorFlush)
 	}
 }
 
+MMINLINE void
+MM_Scavenger::sampleHotField(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr, uintptr_t hotFieldShapeKey, GC_SlotObject *slotObject)
+{
+	/* sample before copyAndForward() updates the slot; referents already depth copied are still counted */
+	intptr_t slotOffset = GC_SlotObject::subtractSlotAddresses(slotObject->readAddressFromSlot(), (fomrobject_t *)objectPtr, _extensions->compressObjectReferences());
+	_hotFieldLearner->sample(env, hotFieldShapeKey, (uintptr_t)slotOffset);
+}
+
+MMINLINE bool
+MM_Scavenger::copyAndForwardPrefetchedSlot(MM_EnvironmentStandard *env, GC_SlotObject *slotObject, uintptr_t ringOccupancy, uint64_t *slotsCopied)
+{
+	bool isSlotObjectInNewSpace = copyAndForward(env, slotObject);
+	env->_scavengerStats._slotPrefetchRingOccupancySum += ringOccupancy;
+	if (NULL != env->_effectiveCopyScanCache) {
+		/* this thread copied the referent, so the prefetched cache line was put to use (rather than only its forwarded header) */
+		env->_scavengerStats._slotPrefetchHitCount += 1;
+		*slotsCopied += 1;
+	}
+	return isSlotObjectInNewSpace;
+}
+
+MMINLINE bool
+MM_Scavenger::copyAndForwardSlotsWithPrefetch(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr, GC_ObjectScanner *objectScanner, uintptr_t hotFieldShapeKey, uint64_t *slotsScanned, uint64_t *slotsCopied)
+{
+	uintptr_t const prefetchDistance = _extensions->scavengerPrefetchDistance;
+	fomrobject_t **ring = env->_scavengerPrefetchRing;
+	uintptr_t ringHead = 0;
+	uintptr_t ringCount = 0;
+	bool shouldRemember = false;
+	GC_SlotObject *slotObject = NULL;
+	GC_SlotObject ringSlotObject(_omrVM, NULL);
+
+	Assert_MM_true((0 < prefetchDistance) && (SCAVENGER_PREFETCH_RING_SIZE >= prefetchDistance));
+
+	while (NULL != (slotObject = objectScanner->getNextSlot())) {
+		omrobjectptr_t referentPtr = slotObject->readReferenceFromSlot();
+		if ((NULL != referentPtr) && isObjectInEvacuateMemory(referentPtr)) {
+			if (0 != hotFieldShapeKey) {
+				sampleHotField(env, objectPtr, hotFieldShapeKey, slotObject);
+			}
+			if (prefetchDistance == ringCount) {
+				/* ring is full - copy the oldest referent, which has had the longest time to arrive in cache */
+				ringSlotObject.writeAddressToSlot(ring[ringHead]);
+				shouldRemember |= copyAndForwardPrefetchedSlot(env, &ringSlotObject, ringCount, slotsCopied);
+				ringHead = (ringHead + 1) % SCAVENGER_PREFETCH_RING_SIZE;
+				ringCount -= 1;
+			}
+			MM_AtomicOperations::prefetchForRead(referentPtr);
+			ring[(ringHead + ringCount) % SCAVENGER_PREFETCH_RING_SIZE] = slotObject->readAddressFromSlot();
+			ringCount += 1;
+			env->_scavengerStats._slotPrefetchCount += 1;
+		} else {
+			/* NULL or not in evacuate space: nothing will be copied, so take the regular path right away */
+			shouldRemember |= copyAndForward(env, slotObject);
+		}
+		*slotsScanned += 1;
+	}
+
+	/* drain the slots still waiting in the ring */
+	while (0 < ringCount) {
+		ringSlotObject.writeAddressToSlot(ring[ringHead]);
+		shouldRemember |= copyAndForwardPrefetchedSlot(env, &ringSlotObject, ringCount, slotsCopied);
+		ringHead = (ringHead + 1) % SCAVENGER_PREFETCH_RING_SIZE;
+		ringCount -= 1;
+	}
+
+	return shouldRemember;
+}
+
 MMINLINE bool
 MM_Scavenger::scavengeObjectSlots(MM_EnvironmentStandard *env, MM_CopyScanCacheStandard *scanCache, omrobjectptr_t objectPtr, uintptr_t flags, omrobjectptr_t *rememberedSetSlot)
 {
@@ -2010,16 +2284,28 @@ MM_Scavenger::scavengeObjectSlots(MM_EnvironmentStandard *env, MM_CopyScanCacheS
 
 	uint64_t slotsCopied = 0;
 	uint64_t slotsScanned = 0;
-	GC_SlotObject *slotObject = NULL;
 
-	MM_CopyScanCacheStandard **copyCache = &(env->_effectiveCopyScanCache);
-	while (NULL != (slotObject = objectScanner->getNextSlot())) {
-		bool isSlotObjectInNewSpace = copyAndForward(env, slotObject);
-		shouldRemember |= isSlotObjectInNewSpace;
-		if (NULL != *copyCache) {
-			slotsCopied += 1;
+	uintptr_t hotFieldShapeKey = 0;
+	if ((NULL != _hotFieldLearner) && !objectScanner->isIndexableObject() && _hotFieldLearner->shouldSampleObject(env)) {
+		hotFieldShapeKey = _extensions->objectModel.getObjectShapeKey(objectPtr);
+	}
+
+	if (0 != _extensions->scavengerPrefetchDistance) {
+		shouldRemember |= copyAndForwardSlotsWithPrefetch(env, objectPtr, objectScanner, hotFieldShapeKey, &slotsScanned, &slotsCopied);
+	} else {
+		GC_SlotObject *slotObject = NULL;
+		MM_CopyScanCacheStandard **copyCache = &(env->_effectiveCopyScanCache);
+		while (NULL != (slotObject = objectScanner->getNextSlot())) {
+			if ((0 != hotFieldShapeKey) && isObjectInEvacuateMemory(slotObject->readReferenceFromSlot())) {
+				sampleHotField(env, objectPtr, hotFieldShapeKey, slotObject);
+			}
+			bool isSlotObjectInNewSpace = copyAndForward(env, slotObject);
+			shouldRemember |= isSlotObjectInNewSpace;
+			if (NULL != *copyCache) {
+				slotsCopied += 1;
+			}
+			slotsScanned += 1;
 		}
-		slotsScanned += 1;
 	}
 	updateCopyScanCounts(env, slotsScanned, slotsCopied);
 
@@ -2366,9 +2652,12 @@ MM_Scavenger::getNextScanCache(MM_EnvironmentStandard *env)
 					waitEndTime = omrtime_hires_clock();
 					if (doneIndex != _doneIndex) {
 						env->_scavengerStats.addToCompleteStallTime(waitStartTime, waitEndTime);
+						env->_taskCompleteStallCount += 1;
 					} else {
 						env->_scavengerStats.addToWorkStallTime(waitStartTime, waitEndTime);
+						env->_taskWorkStallCount += 1;
 					}
+					env->addToTaskStallTime(waitStartTime, waitEndTime);
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 				}
 			}
@@ -3108,6 +3397,31 @@ MM_Scavenger::scavengeRememberedSetListIndirect(MM_EnvironmentStandard *env)
 
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
 
+MMINLINE void
+MM_Scavenger::scavengeRememberedSlot(MM_EnvironmentStandard *env, omrobjectptr_t *slotPtr)
+{
+	omrobjectptr_t objectPtr = *slotPtr;
+
+	Assert_MM_true(_extensions->objectModel.isRemembered(objectPtr));
+
+	/* First assume the object will not be remembered.
+	 * This is helpful for work completion ordering of split arrays.
+	 * Flag slot for later removal if we complete scavenge OK
+	 */
+	*slotPtr = (omrobjectptr_t)((uintptr_t)*slotPtr | DEFERRED_RS_REMOVE_FLAG);
+	bool shouldBeRemembered = scavengeObjectSlots(env, NULL, objectPtr, GC_ObjectScanner::scanRoots, slotPtr);
+	if (_extensions->objectModel.hasIndirectObjectReferents((CLI_THREAD_TYPE*)env->getLanguageVMThread(), objectPtr)) {
+		shouldBeRemembered |= _delegate.scavengeIndirectObjectSlots(env, objectPtr);
+	}
+
+	shouldBeRemembered |= isRememberedThreadReference(env, objectPtr);
+
+	if (shouldBeRemembered) {
+		/* We want to remember this object after all; clear the flag for removal. */
+		*slotPtr = (omrobjectptr_t)((uintptr_t)*slotPtr & ~(uintptr_t)DEFERRED_RS_REMOVE_FLAG);
+	}
+}
+
 void
 MM_Scavenger::scavengeRememberedSetList(MM_EnvironmentStandard *env)
 {
@@ -3115,42 +3429,46 @@ MM_Scavenger::scavengeRememberedSetList(MM_EnvironmentStandard *env)
 
 	Trc_MM_ParallelScavenger_scavengeRememberedSetList_Entry(env->getLanguageVMThread());
 
-	/* Remembered set walk */
-	MM_SublistPuddle *puddle = NULL;
-	while (NULL != (puddle = _extensions->rememberedSet.popPreviousPuddle(puddle))) {
-		Trc_MM_ParallelScavenger_scavengeRememberedSetList_startPuddle(env->getLanguageVMThread(), puddle);
-		uintptr_t numElements = 0;
-		GC_SublistSlotIterator remSetSlotIterator(puddle);
-		omrobjectptr_t *slotPtr;
-		while((slotPtr = (omrobjectptr_t *)remSetSlotIterator.nextSlot()) != NULL) {
-			omrobjectptr_t objectPtr = *slotPtr;
-
-			if(NULL != objectPtr) {
-				Assert_MM_true(_extensions->objectModel.isRemembered(objectPtr));
-				numElements += 1;
-
-				/* First assume the object will not be remembered.
-				 * This is helpful for work completion ordering of split arrays.
-				 * Flag slot for later removal if we complete scavenge OK
-				 */
-				*slotPtr = (omrobjectptr_t)((uintptr_t)*slotPtr | DEFERRED_RS_REMOVE_FLAG);
-				bool shouldBeRemembered = scavengeObjectSlots(env, NULL, objectPtr, GC_ObjectScanner::scanRoots, slotPtr);
-				if (_extensions->objectModel.hasIndirectObjectReferents((CLI_THREAD_TYPE*)env->getLanguageVMThread(), objectPtr)) {
-					shouldBeRemembered |= _delegate.scavengeIndirectObjectSlots(env, objectPtr);
+	uintptr_t batchSize = _extensions->scavengerRememberedSetScanBatchSize;
+	if (0 != batchSize) {
+		/* Remembered set walk in fixed size batches, so that one large puddle is shared by all threads.
+		 * Another thread may be scanning the same puddle, so NULL slots are left for pruneRememberedSetList() to remove.
+		 * Remembered arrays are split across threads by scavengeObjectSlots() as they are when scanned from the heap.
+		 */
+		uintptr_t *batchBase = NULL;
+		uintptr_t *batchTop = NULL;
+		while (NULL != (batchBase = _extensions->rememberedSet.popPreviousBatch(batchSize, &batchTop))) {
+			uintptr_t numElements = 0;
+			for (omrobjectptr_t *slotPtr = (omrobjectptr_t *)batchBase; slotPtr < (omrobjectptr_t *)batchTop; slotPtr++) {
+				if (NULL != *slotPtr) {
+					numElements += 1;
+					scavengeRememberedSlot(env, slotPtr);
 				}
+			}
+			env->_scavengerStats._rememberedSetBatchCount += 1;
+			env->_scavengerStats._rememberedSetBatchSlotCount += numElements;
 
-				shouldBeRemembered |= isRememberedThreadReference(env, objectPtr);
-
-				if (shouldBeRemembered) {
-					/* We want to remember this object after all; clear the flag for removal. */
-					*slotPtr = (omrobjectptr_t)((uintptr_t)*slotPtr & ~(uintptr_t)DEFERRED_RS_REMOVE_FLAG);
+			Trc_MM_ParallelScavenger_scavengeRememberedSetList_doneBatch(env->getLanguageVMThread(), batchBase, numElements);
+		}
+	} else {
+		/* Remembered set walk */
+		MM_SublistPuddle *puddle = NULL;
+		while (NULL != (puddle = _extensions->rememberedSet.popPreviousPuddle(puddle))) {
+			Trc_MM_ParallelScavenger_scavengeRememberedSetList_startPuddle(env->getLanguageVMThread(), puddle);
+			uintptr_t numElements = 0;
+			GC_SublistSlotIterator remSetSlotIterator(puddle);
+			omrobjectptr_t *slotPtr;
+			while((slotPtr = (omrobjectptr_t *)remSetSlotIterator.nextSlot()) != NULL) {
+				if(NULL != *slotPtr) {
+					numElements += 1;
+					scavengeRememberedSlot(env, slotPtr);
+				} else {
+					remSetSlotIterator.removeSlot();
 				}
-			} else {
-				remSetSlotIterator.removeSlot();
 			}
-		}
 
-		Trc_MM_ParallelScavenger_scavengeRememberedSetList_donePuddle(env->getLanguageVMThread(), puddle, numElements);
+			Trc_MM_ParallelScavenger_scavengeRememberedSetList_donePuddle(env->getLanguageVMThread(), puddle, numElements);
+		}
 	}
 
 	Trc_MM_ParallelScavenger_scavengeRememberedSetList_Exit(env->getLanguageVMThread());
@@ -3588,6 +3906,7 @@ MM_Scavenger::returnEmptyCopyCachesToFreeList(MM_EnvironmentStandard *env)
 MMINLINE void
 MM_Scavenger::addCacheEntryToScanListAndNotify(MM_EnvironmentStandard *env, MM_CopyScanCacheStandard *newCacheEntry)
 {
+	newCacheEntry->_numaNode = env->_scavengerNUMANode;
 	_scavengeCacheScanList.pushCache(env, newCacheEntry);
 	if (0 != _waitingCount) {
 		/* Added an entry to the list - notify any other threads that a new entry has appeared on the list */
@@ -3667,7 +3986,16 @@ MM_Scavenger::aliasToCopyCache(MM_EnvironmentStandard *env, GC_SlotObject *scann
 MMINLINE MM_CopyScanCacheStandard *
 MM_Scavenger::getNextScanCacheFromList(MM_EnvironmentStandard *env)
 {
-	return _scavengeCacheScanList.popCache(env);
+	MM_CopyScanCacheStandard *cache = _scavengeCacheScanList.popCache(env);
+	if ((NULL != cache) && (1 < _numaNodeCount)) {
+		MM_ScavengerStats::NUMANodeStats *nodeStats = &env->_scavengerStats._numaNodeStats[env->_scavengerNUMANode];
+		if (cache->_numaNode == env->_scavengerNUMANode) {
+			nodeStats->_localScanCacheCount += 1;
+		} else {
+			nodeStats->_remoteScanCacheCount += 1;
+		}
+	}
+	return cache;
 }
 
 /**
@@ -4187,6 +4515,21 @@ MM_Scavenger::completeBackOut(MM_EnvironmentStandard *env)
 	}
 }
 
+/**
+ * Follow large object proxies that were copied out of evacuate space, free the sparse data of the ones left behind.
+ */
+static void *
+sparseProxyObjectAfterScavenge(MM_EnvironmentBase *env, void *proxyObjPtr, void *userData)
+{
+	MM_Scavenger *scavenger = (MM_Scavenger *)userData;
+	omrobjectptr_t objectPtr = (omrobjectptr_t)proxyObjPtr;
+	if (scavenger->isObjectInEvacuateMemory(objectPtr)) {
+		MM_ForwardedHeader forwardedHeader(objectPtr, env->compressObjectReferences());
+		objectPtr = forwardedHeader.getForwardedObject();
+	}
+	return objectPtr;
+}
+
 /**
  * Setup, execute and complete a scavenge.
  */
@@ -4237,6 +4580,10 @@ MM_Scavenger::mainThreadGarbageCollect(MM_EnvironmentBase *envBase, MM_AllocateD
 		scavenge(env);
 	}
 
+	if (_numaSurvivorReserved) {
+		releaseNUMASurvivorMemory(env);
+	}
+
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 	bool lastIncrement = !isConcurrentCycleInProgress();
 #else
@@ -4247,6 +4594,15 @@ MM_Scavenger::mainThreadGarbageCollect(MM_EnvironmentBase *envBase, MM_AllocateD
 
 	/* merge stats from this increment/phase to aggregate cycle stats */
 	mergeIncrementGCStats(env, lastIncrement);
+	if (lastIncrement && (NULL != _hotFieldLearner)) {
+		/* all GC threads have flushed their samples, learn the hot fields to depth copy in the next cycle */
+		_extensions->scavengerStats._hotFieldLearnedShapeCount = _hotFieldLearner->learn(env);
+	}
+	if (lastIncrement && !isBackOutFlagRaised()) {
+		/* age 0 of the previous flip history holds the bytes allocated in the nursery ahead of this scavenge */
+		MM_ScavengerStats *scavengerStats = &_extensions->scavengerStats;
+		_extensions->heap->getResizePredictor()->recordScavenge(env, scavengerStats->getFlipHistory(1)->_flipBytes[0], scavengerStats->_flipBytes, _cycleTimes.incrementEnd);
+	}
 	reportScavengeEnd(env, lastIncrement);
 
 	if (lastIncrement) {
@@ -4267,6 +4623,11 @@ MM_Scavenger::mainThreadGarbageCollect(MM_EnvironmentBase *envBase, MM_AllocateD
 			/* Merge sublists in the remembered set (if necessary) */
 			_extensions->rememberedSet.compact(env);
 
+			if (NULL != _extensions->largeObjectVirtualMemory) {
+				/* Evacuate space still holds the forwarding pointers of the large object proxies that survived */
+				_extensions->largeObjectVirtualMemory->updateOrFreeSparseRegions(env, sparseProxyObjectAfterScavenge, this);
+			}
+
 			/* If -Xgc:fvtest=forcePoisonEvacuate has been specified, poison(fill poison pattern) evacuate space */
 			if(_extensions->fvtest_forcePoisonEvacuate) {
 				_activeSubSpace->poisonEvacuateSpace();
@@ -5481,6 +5842,7 @@ MM_Scavenger::threadReleaseCaches(MM_EnvironmentBase *currentEnvBase, MM_Environ
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 			targetEnv->_scavengerStats._releaseScanListCount += 1;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+			targetEnv->_deferredScanCache->_numaNode = targetEnv->_scavengerNUMANode;
 			_scavengeCacheScanList.pushCache(targetEnv, targetEnv->_deferredScanCache);
 			targetEnv->_deferredScanCache = NULL;
 		}
@@ -49,6 +49,7 @@ class MM_AllocateDescription;
 class MM_CollectorLanguageInterface;
 class MM_EnvironmentBase;
 class MM_HeapRegionManager;
+class MM_HotFieldLearner;
 class MM_MemoryPool;
 class MM_MemorySubSpace;
 class MM_MemorySubSpaceSemiSpace;
@@ -117,6 +118,14 @@ private:
 	MM_CopyScanCacheList _scavengeCacheFreeList; /**< pool of unused copy-scan caches */
 	MM_CopyScanCacheList _scavengeCacheScanList; /**< scan lists */
 	volatile uintptr_t _cachedEntryCount; /**< non-empty scanCacheList count (not the total count of caches in the lists) */
+	uintptr_t _numaNodeCount; /**< number of NUMA nodes the cache lists are partitioned by (1 if scavengerNUMAAware is disabled or NUMA is not available) */
+	struct NUMASurvivorReservoir {
+		void *volatile _alloc; /**< next free byte of the survivor memory set aside for the node */
+		void *_top; /**< top of the survivor memory set aside for the node */
+	} _numaSurvivorReservoirs[OMR_SCAVENGER_NUMA_NODE_MAX]; /**< survivor memory set aside for the GC threads of each NUMA node for the current scavenge, indexed by node index */
+	bool _numaSurvivorReserved; /**< true if survivor memory has been set aside per NUMA node for the current scavenge */
+	void *_numaBoundSurvivorRanges[2][2]; /**< base and top of the last two survivor ranges bound to NUMA nodes (one per semi space) */
+	MM_HotFieldLearner *_hotFieldLearner; /**< learns hot fields from sampled slots (NULL if scavengerHotFieldLearning is disabled) */
 	uintptr_t _cachesPerThread; /**< maximum number of copy and scan caches required per thread at any one time */
 	omrthread_monitor_t _scanCacheMonitor; /**< monitor to synchronize threads on scan lists */
 	omrthread_monitor_t _freeCacheMonitor; /**< monitor to synchronize threads on free list */
@@ -306,6 +315,12 @@ public:
 	 */ 
 	MMINLINE void copyHotField(MM_EnvironmentStandard *env, omrobjectptr_t destinationObjectPtr, uint8_t offset);
 
+	/* Copy the hot fields learned for the shape of an object (scavengerHotFieldLearning enabled).
+	 * @param destinationObjectPtr The object who's hot fields will be copied
+	 * @return true if hot fields were learned for the shape of the object
+	 */
+	MMINLINE bool copyLearnedHotFields(MM_EnvironmentStandard *env, omrobjectptr_t destinationObjectPtr);
+
 	MMINLINE void updateCopyScanCounts(MM_EnvironmentBase* env, uint64_t slotsScanned, uint64_t slotsCopied);
 	bool splitIndexableObjectScanner(MM_EnvironmentStandard *env, GC_ObjectScanner *objectScanner, uintptr_t startIndex, omrobjectptr_t *rememberedSetSlot);
 
@@ -318,6 +333,39 @@ public:
 	 * @return Whether or not objectPtr should be remembered.
 	 */
 	MMINLINE bool scavengeObjectSlots(MM_EnvironmentStandard *env, MM_CopyScanCacheStandard *scanCache, omrobjectptr_t objectPtr, uintptr_t flags, omrobjectptr_t *rememberedSetSlot);
+
+	/**
+	 * Copy and forward the referents of all remaining slots of an object scanner. Slots whose referent is in
+	 * evacuate space are queued in the thread's prefetch ring and their referent is prefetched, so that it is
+	 * (hopefully) in cache by the time it is copied, up to scavengerPrefetchDistance slots later.
+	 * @param env The environment.
+	 * @param objectPtr The object being scavenged.
+	 * @param objectScanner The scanner for the object being scavenged, with scanning bounds already set.
+	 * @param hotFieldShapeKey The shape key of the object if its slots are sampled for hot field learning, 0 otherwise.
+	 * @param[out] slotsScanned Incremented by the number of slots scanned.
+	 * @param[out] slotsCopied Incremented by the number of slots whose referent was copied by this thread.
+	 * @return Whether or not any scanned slot refers to an object in new space.
+	 */
+	MMINLINE bool copyAndForwardSlotsWithPrefetch(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr, GC_ObjectScanner *objectScanner, uintptr_t hotFieldShapeKey, uint64_t *slotsScanned, uint64_t *slotsCopied);
+
+	/**
+	 * Record a slot of a sampled object whose referent is in evacuate space, for hot field learning.
+	 * @param env The environment.
+	 * @param objectPtr The sampled object.
+	 * @param hotFieldShapeKey The shape key of the sampled object.
+	 * @param slotObject The slot, before its referent is copied.
+	 */
+	MMINLINE void sampleHotField(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr, uintptr_t hotFieldShapeKey, GC_SlotObject *slotObject);
+
+	/**
+	 * Copy and forward a slot taken from the prefetch ring, and account for it in prefetch statistics.
+	 * @param env The environment.
+	 * @param slotObject The slot to copy and forward.
+	 * @param ringOccupancy The number of slots in the prefetch ring, including this one.
+	 * @param[out] slotsCopied Incremented if the referent was copied by this thread.
+	 * @return Whether or not the slot refers to an object in new space.
+	 */
+	MMINLINE bool copyAndForwardPrefetchedSlot(MM_EnvironmentStandard *env, GC_SlotObject *slotObject, uintptr_t ringOccupancy, uint64_t *slotsCopied);
 	MMINLINE MM_CopyScanCacheStandard *incrementalScavengeObjectSlots(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr, MM_CopyScanCacheStandard* scanCache);	
 	
 	/**
@@ -357,6 +405,7 @@ public:
 	void deepScanOutline(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr, uintptr_t priorityFieldOffset1, uintptr_t priorityFieldOffset2);
 
 	MMINLINE bool scavengeRememberedObject(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr);
+	MMINLINE void scavengeRememberedSlot(MM_EnvironmentStandard *env, omrobjectptr_t *slotPtr);
 	void scavengeRememberedSetList(MM_EnvironmentStandard *env);
 	void scavengeRememberedSetOverflow(MM_EnvironmentStandard *env);
 	MMINLINE void flushRememberedSet(MM_EnvironmentStandard *env);
@@ -681,6 +730,40 @@ public:
 protected:
 	virtual void setupForGC(MM_EnvironmentBase *env);
 	virtual void mainSetupForGC(MM_EnvironmentStandard *env);
+	/**
+	 * Assign the thread to the NUMA node whose cache sublists it will use for this scavenge.
+	 * The main thread (typically a mutator) keeps its current affinity and uses the node it is bound to, if any.
+	 * Other GC threads are spread round-robin across nodes by worker ID and, with physical NUMA, bound to the node.
+	 * @param env[in] the current GC thread
+	 */
+	void assignNUMANode(MM_EnvironmentStandard *env);
+
+	/**
+	 * Split the free survivor memory into one reservoir per NUMA node, from which the GC threads of the node
+	 * take their survivor copy caches. With physical NUMA, each node's part of the survivor range is bound to
+	 * the node the first time the range is used, so that its pages are placed there when they are populated.
+	 * @param env[in] the main GC thread
+	 */
+	void reserveNUMASurvivorMemory(MM_EnvironmentStandard *env);
+
+	/**
+	 * Take survivor memory for a copy cache from the reservoir of the thread's NUMA node, or from the reservoir
+	 * of another node if the thread's own is exhausted.
+	 * @param env[in] the current GC thread
+	 * @param minimumSize the smallest amount of memory that satisfies the request
+	 * @param maximumSize the largest amount of memory to take
+	 * @param addrBase[out] base of the memory taken
+	 * @param addrTop[out] top of the memory taken
+	 * @return true if memory was taken, false if every reservoir is exhausted
+	 */
+	bool allocateNUMASurvivorMemory(MM_EnvironmentStandard *env, uintptr_t minimumSize, uintptr_t maximumSize, void* &addrBase, void* &addrTop);
+
+	/**
+	 * Return the survivor memory left in the NUMA node reservoirs to the survivor memory pool.
+	 * @param env[in] the main GC thread
+	 */
+	void releaseNUMASurvivorMemory(MM_EnvironmentStandard *env);
+
 	virtual void workerSetupForGC(MM_EnvironmentStandard *env);
 
 	virtual bool initialize(MM_EnvironmentBase *env);
@@ -946,6 +1029,9 @@ public:
 		, _cycleState()
 		, _collectionStatistics()
 		, _cachedEntryCount(0)
+		, _numaNodeCount(1)
+		, _numaSurvivorReserved(false)
+		, _hotFieldLearner(NULL)
 		, _cachesPerThread(0)
 		, _scanCacheMonitor(NULL)
 		, _freeCacheMonitor(NULL)
@@ -972,6 +1058,8 @@ public:
 	{
 		_typeId = __FUNCTION__;
 		_cycleType = OMR_GC_CYCLE_TYPE_SCAVENGE;
+		memset(_numaSurvivorReservoirs, 0, sizeof(_numaSurvivorReservoirs));
+		memset(_numaBoundSurvivorRanges, 0, sizeof(_numaBoundSurvivorRanges));
 	}
 };
 
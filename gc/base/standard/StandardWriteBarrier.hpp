@@ -29,7 +29,11 @@
 #include "Configuration.hpp"
 #include "EnvironmentStandard.hpp"
 #include "GCExtensionsBase.hpp"
+#include "GlobalCollector.hpp"
 #include "ObjectModel.hpp"
+#if defined(OMR_GC_REALTIME)
+#include "RememberedSetSATB.hpp"
+#endif /* defined(OMR_GC_REALTIME) */
 #include "Scavenger.hpp"
 #include "SlotObject.hpp"
 
@@ -39,8 +43,8 @@ struct OMR_VMThread;
  * Out-of-line write barrier. In the absence of other (equivalent inline) write barrier, this method must
  * be called whenever a child reference is assigned to a parent slot.
  *
- * To support OMR concurrent marking and/or generational collectors, this method calls the necessary
- * concurrent and generational write barriers.
+ * To support OMR concurrent marking and/or generational collectors (including the segregated nursery),
+ * this method calls the necessary concurrent and generational write barriers.
  *
  * @param omrThread The thread making the assignment of child reference into parent slot
  * @param parentObject the parent object
@@ -49,7 +53,7 @@ struct OMR_VMThread;
 MMINLINE void
 standardWriteBarrier(OMR_VMThread *omrThread, omrobjectptr_t parentObject, omrobjectptr_t childObject)
 {
-#if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_MODRON_CONCURRENT_MARK)
+#if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_MODRON_CONCURRENT_MARK) || defined(OMR_GC_SEGREGATED_HEAP)
 	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrThread);
 	MM_GCExtensionsBase *extensions = env->getExtensions();
 #if defined(OMR_GC_MODRON_SCAVENGER)
@@ -67,22 +71,60 @@ standardWriteBarrier(OMR_VMThread *omrThread, omrobjectptr_t parentObject, omrob
 		extensions->cardTable->dirtyCard(env, parentObject);
 	}
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
-#endif /* defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	if (extensions->isSegregatedHeap() && extensions->segregatedNursery) {
+		extensions->getGlobalCollector()->nurseryWriteBarrier(env, parentObject, childObject);
+	}
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_MODRON_CONCURRENT_MARK) || defined(OMR_GC_SEGREGATED_HEAP) */
+}
+
+/**
+ * Out-of-line pre-store barrier. In the absence of other (equivalent inline) barrier, this method must
+ * be called before a reference slot is overwritten.
+ *
+ * While a snapshot at the beginning concurrent cycle is in progress, the reference about to be overwritten
+ * is remembered so that every object reachable when the cycle started is traced.
+ *
+ * @param omrThread The thread making the assignment
+ * @param parentSlot Points to the slot about to be overwritten
+ */
+MMINLINE void
+standardPreWriteBarrier(OMR_VMThread *omrThread, fomrobject_t *parentSlot)
+{
+#if defined(OMR_GC_REALTIME)
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrThread);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	if (extensions->isSATBBarrierActive()) {
+		GC_SlotObject slotObject(omrThread->_vm, parentSlot);
+		omrobjectptr_t oldObject = slotObject.readReferenceFromSlot();
+		if (NULL != oldObject) {
+			MM_GCRememberedSetFragment *fragment = &env->_sATBBarrierRememberedSetFragment;
+			if (NULL == fragment->fragmentParent) {
+				extensions->sATBBarrierRememberedSet->initializeFragment(env, fragment);
+			}
+			extensions->sATBBarrierRememberedSet->storeInFragment(env, fragment, (uintptr_t *)oldObject);
+		}
+	}
+#endif /* defined(OMR_GC_REALTIME) */
 }
 
 /**
  * Convenience method to effect the assignment of a child reference to a parent slot and call
- * out-of-line write barrier.
+ * out-of-line pre-store and write barriers.
  *
  * @param omrThread The thread making the assignment of child reference to parent slot
  * @param parentObject the parent object
  * @param parentSlot Points to the slot in the parent object that will receive the child reference
  * @param childObject THe child object reference
+ * @see standardPreWriteBarrier(OMR_VMThread *, fomrobject_t *)
  * @see standardWriteBarrier(OMR_VMThread *, omrobjectptr_t, omrobjectptr_t)
  */
 MMINLINE void
 standardWriteBarrierStore(OMR_VMThread *omrThread, omrobjectptr_t parentObject, fomrobject_t *parentSlot, omrobjectptr_t childObject)
 {
+	standardPreWriteBarrier(omrThread, parentSlot);
+
 	GC_SlotObject slotObject(omrThread->_vm, parentSlot);
 	slotObject.writeReferenceToSlot(childObject);
 
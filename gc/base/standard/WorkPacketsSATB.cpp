@@ -26,6 +26,7 @@
 
 #include "WorkPacketsSATB.hpp"
 
+#include "AtomicOperations.hpp"
 #include "Debug.hpp"
 #include "GCExtensionsBase.hpp"
 #include "OverflowStandard.hpp"
@@ -40,7 +41,7 @@ MM_WorkPacketsSATB::newInstance(MM_EnvironmentBase *env)
 {
 	MM_WorkPacketsSATB *workPackets;
 
-	workPackets = (MM_WorkPacketsSATB *)env->getForge()->allocate(sizeof(MM_WorkPacketsSATB), MM_AllocationCategory::WORK_PACKETS, J9_GET_CALLSITE());
+	workPackets = (MM_WorkPacketsSATB *)env->getForge()->allocate(sizeof(MM_WorkPacketsSATB), MM_AllocationCategory::WORK_PACKETS, OMR_GET_CALLSITE());
 	if (workPackets) {
 		new(workPackets) MM_WorkPacketsSATB(env);
 		if (!workPackets->initialize(env)) {
@@ -114,6 +115,49 @@ MM_WorkPacketsSATB::getBarrierPacket(MM_EnvironmentBase *env)
 	return getPacketByOverflowing(env);
 }
 
+/**
+ * Claim up to count empty packets for barrier processing and put them all on the
+ * inUseBarrierPacket list under a single list operation.
+ * Only the first packet may be obtained by overflowing; the rest are taken only if
+ * empty packets are readily available.
+ *
+ * @param packets array receiving the claimed packets
+ * @param count maximum number of packets to claim
+ * @return the number of packets claimed
+ */
+uintptr_t
+MM_WorkPacketsSATB::getBarrierPackets(MM_EnvironmentBase *env, MM_Packet **packets, uintptr_t count)
+{
+	MM_Packet *head = getBarrierPacket(env);
+	MM_Packet *tail = head;
+	uintptr_t claimed = 0;
+
+	if (NULL != head) {
+		head->_previous = NULL;
+		head->_next = NULL;
+		packets[claimed++] = head;
+
+		while (claimed < count) {
+			MM_Packet *packet = getPacket(env, &_emptyPacketList);
+			if (NULL == packet) {
+				break;
+			}
+			packet->_previous = tail;
+			packet->_next = NULL;
+			tail->_next = packet;
+			tail = packet;
+			packets[claimed++] = packet;
+		}
+
+		_inUseBarrierPacketList.pushList(head, tail, claimed);
+		if (1 < claimed) {
+			_sATBStats.incBatchRefills(1);
+		}
+	}
+
+	return claimed;
+}
+
 /**
  * Get a packet by overflowing a full packet or a barrierPacket
  *
@@ -169,6 +213,34 @@ MM_WorkPacketsSATB::putFullPacket(MM_EnvironmentBase *env, MM_Packet *packet)
 	_fullPacketList.push(env, packet);
 }
 
+/**
+ * Move a full barrier packet from the inUseBarrierPacket list to the full list, where it
+ * is available to be traced concurrently.
+ *
+ * @param packet the full barrier packet
+ * @return true if enough packets have been published since the last call to return true
+ * that the concurrent drainers should be woken
+ */
+bool
+MM_WorkPacketsSATB::publishFullBarrierPacket(MM_EnvironmentBase *env, MM_Packet *packet)
+{
+	removePacketFromInUseList(env, packet);
+	putFullPacket(env, packet);
+	_sATBStats.incPacketsPublished(1);
+
+	bool wakeDrainers = false;
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	if (extensions->sATBConcurrentDrain) {
+		uintptr_t published = MM_AtomicOperations::add(&_publishedSinceDrain, 1);
+		if (published >= extensions->sATBConcurrentDrainThreshold) {
+			/* only the thread that resets the counter wakes the drainers */
+			wakeDrainers = (published == MM_AtomicOperations::lockCompareExchange(&_publishedSinceDrain, published, 0));
+		}
+	}
+
+	return wakeDrainers;
+}
+
 /**
  * Move all of the packets from the inUse list to the processing list
  * so they are available for processing.
@@ -182,6 +254,8 @@ MM_WorkPacketsSATB::moveInUseToNonEmpty(MM_EnvironmentBase *env)
 
 	/* pop the inUseList */
 	didPop = _inUseBarrierPacketList.popList(&head, &tail, &count);
+	/* packets reserved by mutators are now on the processing list */
+	MM_AtomicOperations::add(&_barrierPacketEpoch, 1);
 	/* push the values from the inUseList onto the processingList */
 	if (didPop) {
 		_nonEmptyPacketList.pushList(head, tail, count);
@@ -241,6 +315,8 @@ MM_WorkPacketsSATB::resetAllPackets(MM_EnvironmentBase *env)
 		packet->resetData(env);
 		putPacket(env, packet);
 	}
+	MM_AtomicOperations::add(&_barrierPacketEpoch, 1);
+	_publishedSinceDrain = 0;
 
 	MM_WorkPackets::resetAllPackets(env);
 }
@@ -26,6 +26,7 @@
 
 #if defined(OMR_GC_REALTIME)
 
+#include "ConcurrentSATBStats.hpp"
 #include "EnvironmentBase.hpp"
 #include "WorkPackets.hpp"
 
@@ -35,6 +36,9 @@ class MM_WorkPacketsSATB : public MM_WorkPackets
 {
 protected:
 	MM_PacketList _inUseBarrierPacketList;  /**< List for packets currently being used for the remembered set*/
+	volatile uintptr_t _barrierPacketEpoch; /**< Bumped whenever the in-use barrier packets are flushed or reset, invalidating packets reserved by mutators */
+	volatile uintptr_t _publishedSinceDrain; /**< Full barrier packets published since the concurrent drainers were last woken */
+	MM_ConcurrentSATBStats _sATBStats; /**< Barrier packet statistics for the current concurrent cycle */
 
 public:
 	static MM_WorkPacketsSATB *newInstance(MM_EnvironmentBase *env);
@@ -50,7 +54,13 @@ public:
 
 	MMINLINE bool inUsePacketsAvailable(MM_EnvironmentBase *env) { return !_inUseBarrierPacketList.isEmpty();}
 
+	MMINLINE uintptr_t getBarrierPacketEpoch() { return _barrierPacketEpoch; };
+
+	MMINLINE MM_ConcurrentSATBStats *getSATBStats() { return &_sATBStats; };
+
 	virtual MM_Packet *getBarrierPacket(MM_EnvironmentBase *env);
+	uintptr_t getBarrierPackets(MM_EnvironmentBase *env, MM_Packet **packets, uintptr_t count);
+	bool publishFullBarrierPacket(MM_EnvironmentBase *env, MM_Packet *packet);
 	virtual void putInUsePacket(MM_EnvironmentBase *env, MM_Packet *packet);
 	virtual void removePacketFromInUseList(MM_EnvironmentBase *env, MM_Packet *packet);
 	virtual void putFullPacket(MM_EnvironmentBase *env, MM_Packet *packet);
@@ -65,6 +75,9 @@ public:
 	MM_WorkPacketsSATB(MM_EnvironmentBase *env) :
 		MM_WorkPackets(env)
 		, _inUseBarrierPacketList(NULL)
+		, _barrierPacketEpoch(1)
+		, _publishedSinceDrain(0)
+		, _sATBStats()
 	{
 		_typeId = __FUNCTION__;
 	};
@@ -0,0 +1,95 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#ifndef OMRGCALLOCATIONSAMPLING_H_
+#define OMRGCALLOCATIONSAMPLING_H_
+
+/*
+ * @ddr_namespace: default
+ */
+
+#include "omr.h"
+#include "objectdescription.h"
+#include "omrcomp.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Called on the allocating thread for each sampled allocation, to identify the allocation site.
+ * The thread holds VM access and must not allocate or release VM access in the callback.
+ * @param omrVMThread the allocating thread
+ * @param object the sampled object, fully initialized
+ * @param frames receives the frame identifiers (typically return addresses), innermost first
+ * @param maxFrames capacity of frames
+ * @param userData the userData of the sampling parameters
+ * @return the number of frames stored; 0 attributes the sample to the allocation category
+ */
+typedef uintptr_t (*OMR_GC_AllocationSiteWalkFunction)(OMR_VMThread *omrVMThread, omrobjectptr_t object, uintptr_t *frames, uintptr_t maxFrames, void *userData);
+
+typedef struct OMR_GC_AllocationSamplingParameters {
+	uintptr_t samplingBytes; /**< mean number of bytes a thread allocates between two samples, 0 for 512KB */
+	uintptr_t siteCount; /**< number of allocation sites tracked, 0 for 256 */
+	uintptr_t maxFrames; /**< maximum number of frames per allocation site, at most 64, 0 for 32 */
+	OMR_GC_AllocationSiteWalkFunction walkFunction; /**< identifies the site of a sampled allocation, may be NULL */
+	void *userData; /**< passed through to walkFunction */
+} OMR_GC_AllocationSamplingParameters;
+
+/**
+ * Start sampling allocations by allocation site. Every thread samples the allocation that ends a randomized
+ * interval of samplingBytes allocated bytes on average; the heaviest sites are kept in a space-saving sketch.
+ * Exclusive VM access is acquired to install the sampler.
+ *
+ * @param omrVMThread the calling thread
+ * @param parameters the sampling interval, the sketch size and the site walk
+ * @return OMR_ERROR_NONE on success, OMR_ERROR_ILLEGAL_ARGUMENT if maxFrames is too large,
+ * OMR_ERROR_NOT_AVAILABLE if sampling is already started, or OMR_ERROR_OUT_OF_NATIVE_MEMORY
+ */
+omr_error_t OMR_GC_StartAllocationSampling(OMR_VMThread *omrVMThread, OMR_GC_AllocationSamplingParameters *parameters);
+
+/**
+ * Stop sampling allocations and discard the samples. Exclusive VM access is acquired to remove the sampler.
+ *
+ * @param omrVMThread the calling thread
+ * @return OMR_ERROR_NONE on success, or OMR_ERROR_NOT_AVAILABLE if sampling is not started
+ */
+omr_error_t OMR_GC_StopAllocationSampling(OMR_VMThread *omrVMThread);
+
+/**
+ * Write the allocation sites sampled so far, heaviest first, in the legacy text heap profile format read by
+ * pprof (for instance "pprof -sample_index=alloc_space <binary> <file>"). Only allocation columns are filled in,
+ * the sampled objects are not followed to report the in-use columns. VM access is held while the profile is
+ * written, so sampling cannot be stopped under it.
+ *
+ * @param omrVMThread the calling thread
+ * @param fileName the file to write, replaced if it exists
+ * @return OMR_ERROR_NONE on success, OMR_ERROR_NOT_AVAILABLE if sampling is not started, or
+ * OMR_ERROR_FILE_UNAVAILABLE if the file could not be written
+ */
+omr_error_t OMR_GC_WriteAllocationProfile(OMR_VMThread *omrVMThread, const char *fileName);
+
+#ifdef __cplusplus
+} /* extern "C" { */
+#endif
+
+#endif /* OMRGCALLOCATIONSAMPLING_H_ */
@@ -0,0 +1,94 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#ifndef OMRGCHEAPWALK_H_
+#define OMRGCHEAPWALK_H_
+
+/*
+ * @ddr_namespace: default
+ */
+
+#include "omr.h"
+#include "objectdescription.h"
+#include "omrcomp.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Called once for every live object, on the GC thread that owns the heap chunk holding the object.
+ * @param omrVMThread the GC thread performing the walk
+ * @param object the live object
+ * @param workerState the state private to the calling worker
+ */
+typedef void (*OMR_GC_HeapWalkObjectFunction)(OMR_VMThread *omrVMThread, omrobjectptr_t object, void *workerState);
+
+/**
+ * Called once for every reference slot of every live object. The slot holds the decoded field value;
+ * any value stored back through it is written to the object field when the callback returns.
+ * @param omrVMThread the GC thread performing the walk
+ * @param object the object holding the slot
+ * @param slot the decoded field value
+ * @param workerState the state private to the calling worker
+ */
+typedef void (*OMR_GC_HeapWalkSlotFunction)(OMR_VMThread *omrVMThread, omrobjectptr_t object, omrobjectptr_t *slot, void *workerState);
+
+/**
+ * Called on the requesting thread, once per worker and in worker order, after all workers have finished.
+ * @param omrVMThread the thread that requested the walk
+ * @param workerState the state filled in by one worker
+ * @param userData the userData of the walk parameters
+ */
+typedef void (*OMR_GC_HeapWalkMergeFunction)(OMR_VMThread *omrVMThread, void *workerState, void *userData);
+
+typedef struct OMR_GC_HeapWalkParameters {
+	OMR_GC_HeapWalkObjectFunction objectFunction; /**< called for each live object, may be NULL */
+	OMR_GC_HeapWalkSlotFunction slotFunction; /**< called for each reference slot of each live object, may be NULL */
+	OMR_GC_HeapWalkMergeFunction mergeFunction; /**< called for each worker state once the walk is complete, may be NULL */
+	uintptr_t workerStateSize; /**< size in bytes of the zero-initialized state handed to each worker */
+	uintptr_t workerCount; /**< maximum number of GC threads to walk with, 0 to use all of them */
+	void *userData; /**< passed through to mergeFunction */
+} OMR_GC_HeapWalkParameters;
+
+/**
+ * Walk every live object of the heap using the GC dispatcher threads.
+ *
+ * The calling thread must be attached to the VM and must not hold VM access on behalf of other
+ * threads; exclusive VM access is acquired for the duration of the walk. Any concurrent collection
+ * in progress is aborted, live objects are marked, and the heap is split into chunks that the GC
+ * threads claim in parallel. Each worker sees only its own state until the merge function runs.
+ *
+ * @param omrVMThread the calling thread
+ * @param parameters the callbacks and state sizes for the walk
+ * @param[out] workersUsed if not NULL, receives the number of workers that took part in the walk
+ * @return OMR_ERROR_NONE on success, OMR_ERROR_ILLEGAL_ARGUMENT if no callback was provided,
+ * OMR_ERROR_NOT_AVAILABLE if the active collector cannot walk the heap in parallel, or
+ * OMR_ERROR_OUT_OF_NATIVE_MEMORY if the worker states could not be allocated
+ */
+omr_error_t OMR_GC_ParallelHeapWalk(OMR_VMThread *omrVMThread, OMR_GC_HeapWalkParameters *parameters, uintptr_t *workersUsed);
+
+#ifdef __cplusplus
+} /* extern "C" { */
+#endif
+
+#endif /* OMRGCHEAPWALK_H_ */
@@ -0,0 +1,99 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omr.h"
+#include "omrgcallocationsampling.h"
+
+#include "AllocationSiteSampler.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+
+omr_error_t
+OMR_GC_StartAllocationSampling(OMR_VMThread *omrVMThread, OMR_GC_AllocationSamplingParameters *parameters)
+{
+	if ((NULL == parameters) || (ALLOCATION_SITE_SAMPLER_MAX_FRAMES < parameters->maxFrames)) {
+		return OMR_ERROR_ILLEGAL_ARGUMENT;
+	}
+
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrVMThread);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	uintptr_t samplingBytes = (0 != parameters->samplingBytes) ? parameters->samplingBytes : ALLOCATION_SITE_SAMPLER_DEFAULT_SAMPLING_BYTES;
+	uintptr_t siteCount = (0 != parameters->siteCount) ? parameters->siteCount : ALLOCATION_SITE_SAMPLER_DEFAULT_SITE_COUNT;
+	uintptr_t maxFrames = (0 != parameters->maxFrames) ? parameters->maxFrames : ALLOCATION_SITE_SAMPLER_DEFAULT_FRAME_COUNT;
+
+	MM_AllocationSiteSampler *sampler = MM_AllocationSiteSampler::newInstance(env, samplingBytes, siteCount, maxFrames, parameters->walkFunction, parameters->userData);
+	if (NULL == sampler) {
+		return OMR_ERROR_OUT_OF_NATIVE_MEMORY;
+	}
+
+	omr_error_t rc = OMR_ERROR_NONE;
+	env->acquireExclusiveVMAccess();
+	if (NULL == extensions->allocationSiteSampler) {
+		extensions->allocationSiteSamplerEpoch += 1;
+		extensions->allocationSiteSampler = sampler;
+		sampler = NULL;
+	} else {
+		rc = OMR_ERROR_NOT_AVAILABLE;
+	}
+	env->releaseExclusiveVMAccess();
+
+	if (NULL != sampler) {
+		sampler->kill(env);
+	}
+	return rc;
+}
+
+omr_error_t
+OMR_GC_StopAllocationSampling(OMR_VMThread *omrVMThread)
+{
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrVMThread);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	/* no thread can be sampling while exclusive VM access is held */
+	env->acquireExclusiveVMAccess();
+	MM_AllocationSiteSampler *sampler = extensions->allocationSiteSampler;
+	extensions->allocationSiteSampler = NULL;
+	env->releaseExclusiveVMAccess();
+
+	if (NULL == sampler) {
+		return OMR_ERROR_NOT_AVAILABLE;
+	}
+	sampler->kill(env);
+	return OMR_ERROR_NONE;
+}
+
+omr_error_t
+OMR_GC_WriteAllocationProfile(OMR_VMThread *omrVMThread, const char *fileName)
+{
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrVMThread);
+
+	/* stopping takes exclusive VM access, so the sampler is not killed while it is written */
+	omr_error_t rc = OMR_ERROR_NOT_AVAILABLE;
+	env->acquireVMAccess();
+	MM_AllocationSiteSampler *sampler = env->getExtensions()->allocationSiteSampler;
+	if (NULL != sampler) {
+		rc = sampler->writeProfile(env, fileName) ? OMR_ERROR_NONE : OMR_ERROR_FILE_UNAVAILABLE;
+	}
+	env->releaseVMAccess();
+
+	return rc;
+}
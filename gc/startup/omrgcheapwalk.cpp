@@ -0,0 +1,140 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include <string.h>
+
+#include "omr.h"
+#include "omrgcheapwalk.h"
+#include "objectdescription.h"
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "GlobalCollector.hpp"
+#include "MarkMap.hpp"
+#include "Math.hpp"
+#include "ObjectIterator.hpp"
+#include "ParallelDispatcher.hpp"
+#include "SlotObject.hpp"
+#if defined(OMR_GC_MODRON_STANDARD)
+#include "ParallelGlobalGC.hpp"
+#include "ParallelHeapWalker.hpp"
+#endif /* defined(OMR_GC_MODRON_STANDARD) */
+
+#if defined(OMR_GC_MODRON_STANDARD)
+/**
+ * Per worker bookkeeping, laid out in front of the caller's state.
+ */
+typedef struct HeapWalkWorkerData {
+	OMR_GC_HeapWalkParameters *parameters;
+	MM_MarkMap *markMap;
+	void *workerState;
+} HeapWalkWorkerData;
+
+static void
+heapWalkObjectDo(OMR_VMThread *omrVMThread, MM_HeapRegionDescriptor *region, omrobjectptr_t object, void *userData)
+{
+	HeapWalkWorkerData *workerData = (HeapWalkWorkerData *)userData;
+	OMR_GC_HeapWalkParameters *parameters = workerData->parameters;
+
+	/* The heap iterator also returns unreachable objects that have not been swept yet */
+	if (!workerData->markMap->isBitSet(object)) {
+		return;
+	}
+
+	if (NULL != parameters->objectFunction) {
+		parameters->objectFunction(omrVMThread, object, workerData->workerState);
+	}
+
+	if (NULL != parameters->slotFunction) {
+		GC_ObjectIterator objectIterator(omrVMThread->_vm, object);
+		GC_SlotObject *slotObject = NULL;
+		while (NULL != (slotObject = objectIterator.nextSlot())) {
+			omrobjectptr_t fieldValue = slotObject->readReferenceFromSlot();
+			parameters->slotFunction(omrVMThread, object, &fieldValue, workerData->workerState);
+			/* write the value back into the field in case the callback changed it */
+			slotObject->writeReferenceToSlot(fieldValue);
+		}
+	}
+}
+#endif /* defined(OMR_GC_MODRON_STANDARD) */
+
+omr_error_t
+OMR_GC_ParallelHeapWalk(OMR_VMThread *omrVMThread, OMR_GC_HeapWalkParameters *parameters, uintptr_t *workersUsed)
+{
+	if ((NULL == parameters) || ((NULL == parameters->objectFunction) && (NULL == parameters->slotFunction))) {
+		return OMR_ERROR_ILLEGAL_ARGUMENT;
+	}
+
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrVMThread);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	if ((NULL == extensions->getGlobalCollector()) || !extensions->isStandardGC()) {
+		return OMR_ERROR_NOT_AVAILABLE;
+	}
+
+#if defined(OMR_GC_MODRON_STANDARD)
+	MM_ParallelDispatcher *dispatcher = extensions->dispatcher;
+	uintptr_t maximumWorkers = dispatcher->threadCountMaximum();
+	uintptr_t workerCount = UDATA_MAX;
+	if ((0 != parameters->workerCount) && (parameters->workerCount < maximumWorkers)) {
+		workerCount = parameters->workerCount;
+	}
+
+	/* Each worker gets its bookkeeping immediately followed by its own state */
+	uintptr_t stateSize = MM_Math::roundToCeiling(sizeof(uint64_t), parameters->workerStateSize);
+	uintptr_t stride = sizeof(HeapWalkWorkerData) + stateSize;
+	void *workerData = env->getForge()->allocate(stride * maximumWorkers, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL == workerData) {
+		return OMR_ERROR_OUT_OF_NATIVE_MEMORY;
+	}
+	MM_GlobalCollector *globalCollector = extensions->getGlobalCollector();
+	MM_ParallelHeapWalker *heapWalker = (MM_ParallelHeapWalker *)((MM_ParallelGlobalGC *)globalCollector)->getHeapWalker();
+
+	memset(workerData, 0, stride * maximumWorkers);
+	for (uintptr_t worker = 0; worker < maximumWorkers; worker++) {
+		HeapWalkWorkerData *data = (HeapWalkWorkerData *)((uintptr_t)workerData + (worker * stride));
+		data->parameters = parameters;
+		data->markMap = heapWalker->getMarkMap();
+		data->workerState = (void *)(data + 1);
+	}
+
+
+	env->acquireExclusiveVMAccess();
+	/* The walk marks the heap itself, which would corrupt an in-flight concurrent cycle */
+	globalCollector->abortCollection(env, ABORT_COLLECTION_PREPARE_HEAP_FOR_WALK);
+	uintptr_t workersWalked = heapWalker->allObjectsDoPerWorker(env, heapWalkObjectDo, workerData, stride, 0, workerCount, true);
+	env->releaseExclusiveVMAccess();
+
+	if (NULL != parameters->mergeFunction) {
+		for (uintptr_t worker = 0; worker < workersWalked; worker++) {
+			HeapWalkWorkerData *data = (HeapWalkWorkerData *)((uintptr_t)workerData + (worker * stride));
+			parameters->mergeFunction(omrVMThread, data->workerState, parameters->userData);
+		}
+	}
+	env->getForge()->free(workerData);
+
+	if (NULL != workersUsed) {
+		*workersUsed = workersWalked;
+	}
+#endif /* defined(OMR_GC_MODRON_STANDARD) */
+
+	return OMR_ERROR_NONE;
+}
@@ -0,0 +1,328 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include <math.h>
+#include <string.h>
+
+#include "omrport.h"
+#include "ut_j9mm.h"
+
+#include "AllocationSiteSampler.hpp"
+
+#include "EnvironmentBase.hpp"
+#include "Forge.hpp"
+#include "GCExtensionsBase.hpp"
+#include "ModronAssertions.h"
+
+/* Room for the counts and one frame in a profile line */
+#define ALLOCATION_SITE_SAMPLER_LINE_SIZE ((ALLOCATION_SITE_SAMPLER_MAX_FRAMES + 4) * 24)
+
+MM_AllocationSiteSampler *
+MM_AllocationSiteSampler::newInstance(MM_EnvironmentBase *env, uintptr_t samplingBytes, uintptr_t siteCount, uintptr_t frameCount, MM_AllocationSiteWalkFunction walkFunction, void *userData)
+{
+	MM_AllocationSiteSampler *sampler = (MM_AllocationSiteSampler *)env->getForge()->allocate(sizeof(MM_AllocationSiteSampler), OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if (NULL != sampler) {
+		new(sampler) MM_AllocationSiteSampler(samplingBytes, siteCount, frameCount, walkFunction, userData);
+		if (!sampler->initialize(env)) {
+			sampler->kill(env);
+			sampler = NULL;
+		}
+	}
+	return sampler;
+}
+
+void
+MM_AllocationSiteSampler::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_AllocationSiteSampler::initialize(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	MM_Forge *forge = env->getForge();
+
+	Assert_MM_true((0 < _samplingBytes) && (0 < _siteCount) && (0 < _frameCount));
+	Assert_MM_true(ALLOCATION_SITE_SAMPLER_MAX_FRAMES >= _frameCount);
+
+	if (!_lock.initialize(env, &env->getExtensions()->lnrlOptions, "MM_AllocationSiteSampler:_lock")) {
+		return false;
+	}
+
+	_sites = (Site *)forge->allocate(_siteCount * sizeof(Site), OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	_framePool = (uintptr_t *)forge->allocate(_siteCount * _frameCount * sizeof(uintptr_t), OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	_siteTable = hashTableNew(OMRPORTLIB, OMR_GET_CALLSITE(), (uint32_t)(_siteCount * 2), sizeof(Site *), sizeof(uintptr_t), 0, OMRMEM_CATEGORY_MM, siteHash, siteEquals, NULL, NULL);
+	_sketch = spaceSavingNew(OMRPORTLIB, (uint32_t)_siteCount);
+
+	if ((NULL == _sites) || (NULL == _framePool) || (NULL == _siteTable) || (NULL == _sketch)) {
+		Trc_MM_AllocationSiteSampler_initialize_failure(env->getLanguageVMThread(), _siteCount, _frameCount);
+		return false;
+	}
+
+	Trc_MM_AllocationSiteSampler_initialize_success(env->getLanguageVMThread(), _samplingBytes, _siteCount, _frameCount);
+	return true;
+}
+
+void
+MM_AllocationSiteSampler::tearDown(MM_EnvironmentBase *env)
+{
+	MM_Forge *forge = env->getForge();
+
+	if (NULL != _sketch) {
+		spaceSavingFree(_sketch);
+		_sketch = NULL;
+	}
+	if (NULL != _siteTable) {
+		hashTableFree(_siteTable);
+		_siteTable = NULL;
+	}
+	if (NULL != _framePool) {
+		forge->free(_framePool);
+		_framePool = NULL;
+	}
+	if (NULL != _sites) {
+		forge->free(_sites);
+		_sites = NULL;
+	}
+	_lock.tearDown();
+}
+
+uintptr_t
+MM_AllocationSiteSampler::siteHash(void *entry, void *userData)
+{
+	return (*(Site **)entry)->_hash;
+}
+
+uintptr_t
+MM_AllocationSiteSampler::siteEquals(void *leftEntry, void *rightEntry, void *userData)
+{
+	Site *left = *(Site **)leftEntry;
+	Site *right = *(Site **)rightEntry;
+
+	if ((left->_hash != right->_hash) || (left->_frameCount != right->_frameCount)) {
+		return FALSE;
+	}
+	for (uintptr_t i = 0; i < left->_frameCount; i++) {
+		if (left->_frames[i] != right->_frames[i]) {
+			return FALSE;
+		}
+	}
+	return TRUE;
+}
+
+/**
+ * Find the record of a site, assigning one to it if the site is new. Once every record is in use, the record
+ * of the site with the fewest sampled bytes is taken over; the sketch keeps its count, which becomes the
+ * over-estimation bound of the new site.
+ * Caller must hold _lock.
+ * @return the site record, or NULL if the site table could not grow
+ */
+MM_AllocationSiteSampler::Site *
+MM_AllocationSiteSampler::findOrAddSite(MM_EnvironmentBase *env, uintptr_t hash, uintptr_t *frames, uintptr_t frameCount)
+{
+	Site probe = {hash, frameCount, frames, 0, 0};
+	Site *site = &probe;
+	Site **entry = (Site **)hashTableFind(_siteTable, &site);
+	if (NULL != entry) {
+		return *entry;
+	}
+
+	if (_sitesUsed < _siteCount) {
+		site = &_sites[_sitesUsed];
+		site->_frames = _framePool + (_sitesUsed * _frameCount);
+		_sitesUsed += 1;
+	} else {
+		site = getSite(getSiteCount());
+		hashTableRemove(_siteTable, &site);
+	}
+
+	site->_hash = hash;
+	site->_frameCount = frameCount;
+	for (uintptr_t i = 0; i < frameCount; i++) {
+		site->_frames[i] = frames[i];
+	}
+	site->_sampleCount = 0;
+	site->_sampleBytes = 0;
+
+	if (NULL == hashTableAdd(_siteTable, &site)) {
+		/* the record can not be found again; leave it unmatchable so its sketch entry ages out */
+		site->_frameCount = 0;
+		site = NULL;
+	}
+	return site;
+}
+
+void
+MM_AllocationSiteSampler::recordSample(MM_EnvironmentBase *env, omrobjectptr_t objectPtr, uintptr_t allocationCategory, uintptr_t allocatedBytes)
+{
+	uintptr_t frames[ALLOCATION_SITE_SAMPLER_MAX_FRAMES];
+	uintptr_t frameCount = 0;
+
+	/* the stack is walked outside of the lock, it is the expensive part of a sample */
+	if (NULL != _walkFunction) {
+		frameCount = _walkFunction(env->getOmrVMThread(), objectPtr, frames, _frameCount, _userData);
+		if (frameCount > _frameCount) {
+			frameCount = _frameCount;
+		}
+	}
+	if (0 == frameCount) {
+		/* no stack to report, the allocation category stands in for the site */
+		frames[0] = allocationCategory;
+		frameCount = 1;
+	}
+
+	/* FNV-1a over the frames */
+	uintptr_t hash = (uintptr_t)2166136261U;
+	for (uintptr_t i = 0; i < frameCount; i++) {
+		hash = (hash ^ frames[i]) * (uintptr_t)16777619U;
+	}
+
+	_lock.acquire();
+	Site *site = findOrAddSite(env, hash, frames, frameCount);
+	if (NULL != site) {
+		site->_sampleCount += 1;
+		site->_sampleBytes += allocatedBytes;
+		spaceSavingUpdate(_sketch, site, allocatedBytes);
+	}
+	_totalSampleCount += 1;
+	_totalSampleBytes += allocatedBytes;
+	_lock.release();
+}
+
+/**
+ * Draw the number of bytes the thread allocates before its next sample from an exponential distribution with
+ * mean _samplingBytes, which makes the probability of sampling an allocation depend only on its size, as the
+ * heap_v2 scaling in pprof assumes.
+ */
+uintptr_t
+MM_AllocationSiteSampler::nextSampleInterval(MM_EnvironmentBase *env)
+{
+	uint64_t seed = env->_allocationSiteSampleSeed;
+	if (0 == seed) {
+		OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+		seed = ((uint64_t)(uintptr_t)env ^ omrtime_hires_clock()) | 1;
+	}
+	/* xorshift64 */
+	seed ^= seed << 13;
+	seed ^= seed >> 7;
+	seed ^= seed << 17;
+	env->_allocationSiteSampleSeed = seed;
+
+	/* uniform in (0, 1] from the top 53 bits */
+	double uniform = (double)((seed >> 11) + 1) / 9007199254740992.0;
+	double interval = -log(uniform) * (double)_samplingBytes;
+	if (interval < 1.0) {
+		interval = 1.0;
+	} else if (interval > (double)(UDATA_MAX / 2)) {
+		interval = (double)(UDATA_MAX / 2);
+	}
+	return (uintptr_t)interval;
+}
+
+void
+MM_AllocationSiteSampler::sampleAllocation(MM_EnvironmentBase *env, omrobjectptr_t objectPtr, uintptr_t allocationCategory, uintptr_t allocatedBytes)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	/* the sampler is only installed and removed under exclusive VM access, which this thread can not be holding out */
+	MM_AllocationSiteSampler *sampler = extensions->allocationSiteSampler;
+
+	if (NULL == sampler) {
+		env->_allocationSiteSampleBytesRemaining = ALLOCATION_SITE_SAMPLER_IDLE_BYTES;
+	} else {
+		if (env->_allocationSiteSamplerEpoch == extensions->allocationSiteSamplerEpoch) {
+			sampler->recordSample(env, objectPtr, allocationCategory, allocatedBytes);
+		} else {
+			/* the interval that just ended was drawn before this sampler started */
+			env->_allocationSiteSamplerEpoch = extensions->allocationSiteSamplerEpoch;
+		}
+		env->_allocationSiteSampleBytesRemaining = sampler->nextSampleInterval(env);
+	}
+}
+
+bool
+MM_AllocationSiteSampler::writeProfile(MM_EnvironmentBase *env, const char *fileName)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	MM_Forge *forge = env->getForge();
+	char line[ALLOCATION_SITE_SAMPLER_LINE_SIZE];
+	uintptr_t totalSampleCount = 0;
+	uintptr_t totalSampleBytes = 0;
+	uintptr_t siteCount = 0;
+	bool result = true;
+
+	intptr_t fd = omrfile_open(fileName, EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+	if (-1 == fd) {
+		Trc_MM_AllocationSiteSampler_writeProfile_openFailed(env->getLanguageVMThread(), fileName);
+		return false;
+	}
+
+	/* the sites are copied under the lock and written once it is released, so sampling threads never wait on the file */
+	Site *sites = (Site *)forge->allocate(_siteCount * sizeof(Site), OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	uintptr_t *frames = (uintptr_t *)forge->allocate(_siteCount * _frameCount * sizeof(uintptr_t), OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if ((NULL == sites) || (NULL == frames)) {
+		result = false;
+	} else {
+		_lock.acquire();
+		totalSampleCount = _totalSampleCount;
+		totalSampleBytes = _totalSampleBytes;
+		uintptr_t rankCount = getSiteCount();
+		for (uintptr_t rank = 1; rank <= rankCount; rank++) {
+			Site *site = getSite(rank);
+			if (0 == site->_frameCount) {
+				continue;
+			}
+			Site *copy = &sites[siteCount];
+			*copy = *site;
+			copy->_frames = frames + (siteCount * _frameCount);
+			memcpy(copy->_frames, site->_frames, site->_frameCount * sizeof(uintptr_t));
+			siteCount += 1;
+		}
+		_lock.release();
+
+		uintptr_t length = omrstr_printf(line, sizeof(line), "heap profile: 0: 0 [%zu: %zu] @ heap_v2/%zu\n", totalSampleCount, totalSampleBytes, _samplingBytes);
+		result = (0 == omrfile_write_text(fd, line, length));
+
+		for (uintptr_t i = 0; result && (i < siteCount); i++) {
+			Site *site = &sites[i];
+			length = omrstr_printf(line, sizeof(line), "0: 0 [%zu: %zu] @", site->_sampleCount, site->_sampleBytes);
+			for (uintptr_t frame = 0; frame < site->_frameCount; frame++) {
+				length += omrstr_printf(line + length, sizeof(line) - length, " 0x%zx", site->_frames[frame]);
+			}
+			length += omrstr_printf(line + length, sizeof(line) - length, "\n");
+			result = (0 == omrfile_write_text(fd, line, length));
+		}
+	}
+
+	if (NULL != frames) {
+		forge->free(frames);
+	}
+	if (NULL != sites) {
+		forge->free(sites);
+	}
+	if (0 != omrfile_close(fd)) {
+		result = false;
+	}
+	Trc_MM_AllocationSiteSampler_writeProfile(env->getLanguageVMThread(), fileName, siteCount, totalSampleCount, result ? "true" : "false");
+	return result;
+}
@@ -0,0 +1,171 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(ALLOCATIONSITESAMPLER_HPP_)
+#define ALLOCATIONSITESAMPLER_HPP_
+
+#include "omr.h"
+#include "omrcomp.h"
+#include "objectdescription.h"
+#include "hashtable_api.h"
+#include "spacesaving.h"
+
+#include "BaseVirtual.hpp"
+#include "LightweightNonReentrantLock.hpp"
+
+class MM_EnvironmentBase;
+
+/* Most frames recorded for one allocation site */
+#define ALLOCATION_SITE_SAMPLER_MAX_FRAMES 64
+/* Defaults for the sampler parameters left 0 by the caller */
+#define ALLOCATION_SITE_SAMPLER_DEFAULT_SAMPLING_BYTES ((uintptr_t)512 * 1024)
+#define ALLOCATION_SITE_SAMPLER_DEFAULT_SITE_COUNT 256
+#define ALLOCATION_SITE_SAMPLER_DEFAULT_FRAME_COUNT 32
+/* Bytes a thread allocates between two checks for a newly started sampler while sampling is off */
+#define ALLOCATION_SITE_SAMPLER_IDLE_BYTES ((uintptr_t)1024 * 1024)
+
+/**
+ * Language supplied walk of the allocating thread's stack.
+ * @param omrVMThread the allocating thread
+ * @param object the sampled object, fully initialized
+ * @param frames receives the frame identifiers (typically return addresses), innermost first
+ * @param maxFrames capacity of frames
+ * @param userData the userData the sampler was started with
+ * @return the number of frames stored
+ */
+typedef uintptr_t (*MM_AllocationSiteWalkFunction)(OMR_VMThread *omrVMThread, omrobjectptr_t object, uintptr_t *frames, uintptr_t maxFrames, void *userData);
+
+/**
+ * Samples allocations every samplingBytes allocated by a thread, on average, and aggregates the samples by allocation
+ * site. Each thread counts down a randomized (exponentially distributed) number of bytes in its environment, so the
+ * allocation path pays one compare per object; the allocation that crosses the end of the interval is sampled.
+ * A site is the stack reported by the language walk function. At most siteCount sites are kept: they are ranked
+ * by sampled bytes in a space-saving sketch, which recycles the record of the lightest site for a new one.
+ * @ingroup GC_Stats
+ */
+class MM_AllocationSiteSampler : public MM_BaseVirtual
+{
+	/*
+	 * Data members
+	 */
+public:
+	struct Site {
+		uintptr_t _hash; /**< hash of the frames */
+		uintptr_t _frameCount; /**< number of valid entries in _frames */
+		uintptr_t *_frames; /**< frames identifying the site, innermost first */
+		uintptr_t _sampleCount; /**< allocations sampled at the site since the record was (re)assigned to it */
+		uintptr_t _sampleBytes; /**< bytes of the allocations sampled at the site since the record was (re)assigned to it */
+	};
+
+private:
+	uintptr_t _samplingBytes; /**< mean number of bytes allocated by a thread between two samples */
+	uintptr_t _siteCount; /**< number of site records */
+	uintptr_t _frameCount; /**< maximum number of frames per site */
+	MM_AllocationSiteWalkFunction _walkFunction; /**< language stack walk, NULL to attribute samples to their allocation category */
+	void *_userData; /**< passed through to _walkFunction */
+
+	Site *_sites; /**< site records */
+	uintptr_t *_framePool; /**< _frameCount frames for each site record */
+	uintptr_t _sitesUsed; /**< number of site records handed out so far */
+	J9HashTable *_siteTable; /**< site record pointers hashed by frames */
+	OMRSpaceSaving *_sketch; /**< site records ranked by sampled bytes */
+	MM_LightweightNonReentrantLock _lock; /**< protects the site records, the table and the sketch */
+
+	uintptr_t _totalSampleCount; /**< allocations sampled */
+	uintptr_t _totalSampleBytes; /**< bytes of the allocations sampled */
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+	static uintptr_t siteHash(void *entry, void *userData);
+	static uintptr_t siteEquals(void *leftEntry, void *rightEntry, void *userData);
+
+	Site *findOrAddSite(MM_EnvironmentBase *env, uintptr_t hash, uintptr_t *frames, uintptr_t frameCount);
+	void recordSample(MM_EnvironmentBase *env, omrobjectptr_t objectPtr, uintptr_t allocationCategory, uintptr_t allocatedBytes);
+	uintptr_t nextSampleInterval(MM_EnvironmentBase *env);
+
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+public:
+	static MM_AllocationSiteSampler *newInstance(MM_EnvironmentBase *env, uintptr_t samplingBytes, uintptr_t siteCount, uintptr_t frameCount, MM_AllocationSiteWalkFunction walkFunction, void *userData);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Called by the allocation path once the thread has allocated the bytes remaining in its sampling interval.
+	 * Samples the allocation if the interval was drawn for the active sampler, then draws the next interval.
+	 * @param objectPtr the object that ended the interval
+	 * @param allocationCategory the language allocation category of the object
+	 * @param allocatedBytes the size of the object
+	 */
+	static void sampleAllocation(MM_EnvironmentBase *env, omrobjectptr_t objectPtr, uintptr_t allocationCategory, uintptr_t allocatedBytes);
+
+	/**
+	 * Write the sampled sites in the legacy text heap profile format read by pprof (heap_v2 sampling), heaviest first.
+	 * The in-use columns are always 0 as the sampler does not follow the sampled objects; use the alloc_space or
+	 * alloc_objects sample index.
+	 * @param fileName the file to write, replaced if it exists
+	 * @return true on success, false if the file could not be written
+	 */
+	bool writeProfile(MM_EnvironmentBase *env, const char *fileName);
+
+	MMINLINE uintptr_t getSamplingBytes() { return _samplingBytes; }
+	MMINLINE uintptr_t getTotalSampleCount() { return _totalSampleCount; }
+	MMINLINE uintptr_t getTotalSampleBytes() { return _totalSampleBytes; }
+
+	/**
+	 * @return the number of sites being tracked
+	 */
+	MMINLINE uintptr_t getSiteCount() { return spaceSavingGetCurSize(_sketch); }
+
+	/**
+	 * @param rank the rank of the site by sampled bytes, 1 for the heaviest
+	 * @return the site at that rank, or NULL
+	 */
+	MMINLINE Site *getSite(uintptr_t rank) { return (Site *)spaceSavingGetKthMostFreq(_sketch, rank); }
+
+	MM_AllocationSiteSampler(uintptr_t samplingBytes, uintptr_t siteCount, uintptr_t frameCount, MM_AllocationSiteWalkFunction walkFunction, void *userData)
+		: MM_BaseVirtual()
+		, _samplingBytes(samplingBytes)
+		, _siteCount(siteCount)
+		, _frameCount(frameCount)
+		, _walkFunction(walkFunction)
+		, _userData(userData)
+		, _sites(NULL)
+		, _framePool(NULL)
+		, _sitesUsed(0)
+		, _siteTable(NULL)
+		, _sketch(NULL)
+		, _lock()
+		, _totalSampleCount(0)
+		, _totalSampleBytes(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* ALLOCATIONSITESAMPLER_HPP_ */
@@ -35,6 +35,10 @@ MM_AllocationStats::clear()
 	_tlhRequestedBytes = 0;
 	_tlhDiscardedBytes = 0;
 	_tlhMaxAbandonedListSize = 0;
+	_tlhWastedBytes = 0;
+	_tlhAllocationRate = 0;
+	_tlhRefreshSize = 0;
+	_tlhRateSampleCount = 0;
 #endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
 
 	_arrayletLeafAllocationCount = 0;
@@ -60,6 +64,10 @@ MM_AllocationStats::merge(MM_AllocationStats *stats)
 	MM_AtomicOperations::add(&_tlhRequestedBytes, stats->_tlhRequestedBytes);
 	MM_AtomicOperations::add(&_tlhDiscardedBytes, stats->_tlhDiscardedBytes);
 	MM_AtomicOperations::add(&_tlhAllocatedReused, stats->_tlhAllocatedReused);
+	MM_AtomicOperations::add(&_tlhWastedBytes, stats->_tlhWastedBytes);
+	MM_AtomicOperations::add(&_tlhAllocationRate, stats->_tlhAllocationRate);
+	MM_AtomicOperations::add(&_tlhRefreshSize, stats->_tlhRefreshSize);
+	MM_AtomicOperations::add(&_tlhRateSampleCount, stats->_tlhRateSampleCount);
 	/* looping to set a maximum value in _tlhMaxAbandonedListSize */
 	for (
 			uintptr_t prevMax = _tlhMaxAbandonedListSize;
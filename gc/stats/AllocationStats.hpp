@@ -42,6 +42,10 @@ public:
 	uintptr_t _tlhRequestedBytes; 		/**< The amount of memory requested for refreshes. */
 	uintptr_t _tlhDiscardedBytes; 		/**< The amount of memory from discarded TLHs. */
 	uintptr_t _tlhMaxAbandonedListSize; /**< The maximum size of the abandoned list. */
+	uintptr_t _tlhWastedBytes; 			/**< The amount of unused TLH memory given back to the heap when caches were flushed. */
+	uintptr_t _tlhAllocationRate; 		/**< Allocation rate (bytes per millisecond) observed by adaptive TLH sizing, summed over flushed threads. */
+	uintptr_t _tlhRefreshSize; 			/**< Next refresh size chosen by adaptive TLH sizing from that rate, summed over flushed threads. */
+	uintptr_t _tlhRateSampleCount; 		/**< Number of flushes summed into _tlhAllocationRate and _tlhRefreshSize. */
 #endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
 
 	uintptr_t _arrayletLeafAllocationCount;	/**< Number of arraylet leaf allocations */
@@ -63,6 +67,7 @@ public:
 #if defined(OMR_GC_THREAD_LOCAL_HEAP)
 	uintptr_t tlhBytesAllocated() { return _tlhAllocatedFresh - _tlhDiscardedBytes; }
 	uintptr_t tlhBytesAllocatedUsed() { return _tlhAllocatedUsed; }
+	uintptr_t tlhRefreshCount() { return _tlhRefreshCountFresh + _tlhRefreshCountReused; }
 	uintptr_t nontlhBytesAllocated() { return _allocationBytes; }
 #endif
 
@@ -96,6 +101,10 @@ public:
 		_tlhRequestedBytes(0),
 		_tlhDiscardedBytes(0),
 		_tlhMaxAbandonedListSize(0),
+		_tlhWastedBytes(0),
+		_tlhAllocationRate(0),
+		_tlhRefreshSize(0),
+		_tlhRateSampleCount(0),
 #endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
 		_arrayletLeafAllocationCount(0),
 		_arrayletLeafAllocationBytes(0),
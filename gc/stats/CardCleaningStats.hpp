@@ -34,6 +34,7 @@ class MM_CardCleaningStats : public MM_Base
 public:
 	uint64_t _cardCleaningTime; /**< Time spent cleaning cards in hi-res clock resolution. */
 	uintptr_t _cardsCleaned; /**< The number of cards cleaned */
+	uintptr_t _cardsScanned; /**< The number of cards examined (clean or not) while looking for cards to clean */
 	
 /* Function Members */
 public:
@@ -49,6 +50,16 @@ public:
 	 * @param endTime The time scanning ended, measured by omrtime_hires_clock()
 	 */
 	MMINLINE void addToCardCleaningTime(uint64_t startTime, uint64_t endTime) { _cardCleaningTime += (endTime - startTime);	}
+
+	/**
+	 * Rate at which the card table was traversed while cleaning.
+	 * @param cardCleaningTimeMicros _cardCleaningTime converted to microseconds
+	 * @return the number of cards scanned per microsecond of card cleaning time
+	 */
+	MMINLINE uintptr_t getCardsScannedPerMicrosecond(uint64_t cardCleaningTimeMicros)
+	{
+		return (0 == cardCleaningTimeMicros) ? _cardsScanned : (uintptr_t)(_cardsScanned / cardCleaningTimeMicros);
+	}
 	
 	/**
 	 * Merges the results from the input MM_CardCleaningStats with the statistics contained within the receiver.
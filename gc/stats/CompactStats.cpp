@@ -48,6 +48,12 @@ MM_CompactStats::clear()
 	_fixupEndTime = 0;
 	_rootFixupStartTime = 0;
 	_rootFixupEndTime = 0;
+
+	_evacuatedSubAreas = 0;
+	_evacuatedLiveBytes = 0;
+	_deferredSubAreas = 0;
+	_deferredLiveBytes = 0;
+	_estimatedPauseReduction = 0;
 };
 
 void
@@ -65,6 +71,11 @@ MM_CompactStats::merge(MM_CompactStats *statsToMerge)
 	_fixupEndTime = OMR_MAX(_fixupEndTime, statsToMerge->_fixupEndTime);
 	_rootFixupStartTime = (0 == _rootFixupStartTime) ? statsToMerge->_rootFixupStartTime : OMR_MIN(_rootFixupStartTime, statsToMerge->_rootFixupStartTime);
 	_rootFixupEndTime = OMR_MAX(_rootFixupEndTime, statsToMerge->_rootFixupEndTime);
+	_evacuatedSubAreas += statsToMerge->_evacuatedSubAreas;
+	_evacuatedLiveBytes += statsToMerge->_evacuatedLiveBytes;
+	_deferredSubAreas += statsToMerge->_deferredSubAreas;
+	_deferredLiveBytes += statsToMerge->_deferredLiveBytes;
+	_estimatedPauseReduction += statsToMerge->_estimatedPauseReduction;
 };
 
 #endif /* OMR_GC_MODRON_COMPACTION */
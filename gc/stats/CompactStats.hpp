@@ -58,6 +58,12 @@ public:
 	uint64_t _fixupEndTime;
 	uint64_t _rootFixupStartTime;
 	uint64_t _rootFixupEndTime;
+
+	uintptr_t _evacuatedSubAreas; /**< Sub areas in the window chosen by an incremental compaction */
+	uintptr_t _evacuatedLiveBytes; /**< Live bytes found in the evacuated window */
+	uintptr_t _deferredSubAreas; /**< Sub areas left in place (fixup only) by an incremental compaction */
+	uintptr_t _deferredLiveBytes; /**< Live bytes found in the deferred sub areas */
+	uint64_t _estimatedPauseReduction; /**< Estimated move time avoided by deferring sub areas, in hi-res clock ticks */
 		
 	/* Remember gc count on last compaction of heap */
 	uintptr_t _lastHeapCompaction;
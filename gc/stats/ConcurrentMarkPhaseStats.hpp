@@ -30,6 +30,7 @@
 #include "ConcurrentCardTableStats.hpp"
 #include "ConcurrentGCStats.hpp"
 #include "ConcurrentPhaseStatsBase.hpp"
+#include "ConcurrentSATBStats.hpp"
 
 /**
   * @ingroup GC_Stats ConcurrentMarkPhaseStats
@@ -42,6 +43,7 @@ protected:
 public:
 	MM_ConcurrentCardTableStats *_cardTableStats;
 	MM_ConcurrentGCStats *_collectionStats;
+	MM_ConcurrentSATBStats *_sATBStats; /**< SATB barrier packet stats, set only by the SATB collector */
 
 	/* Member Functions */
 private:
@@ -51,12 +53,14 @@ public:
 		MM_ConcurrentPhaseStatsBase::clear();
 		_cardTableStats = NULL;
 		_collectionStats = NULL;
+		_sATBStats = NULL;
 	}
 
 	MM_ConcurrentMarkPhaseStats()
 		: MM_ConcurrentPhaseStatsBase(OMR_GC_CYCLE_TYPE_GLOBAL)
 		, _cardTableStats(NULL)
 		, _collectionStats(NULL)
+		, _sATBStats(NULL)
 		{}
 }; 
 
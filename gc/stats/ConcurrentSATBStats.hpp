@@ -0,0 +1,88 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(CONCURRENTSATBSTATS_HPP_)
+#define CONCURRENTSATBSTATS_HPP_
+
+#include "omrcomp.h"
+#include "modronbase.h"
+
+#include "AtomicOperations.hpp"
+#include "Base.hpp"
+
+/**
+ * Statistics on the SATB barrier packets of a concurrent mark cycle, used to report how much
+ * of the barrier work was drained while mutators ran rather than in the final pause.
+ * @ingroup GC_Stats
+ */
+class MM_ConcurrentSATBStats : public MM_Base
+{
+public:
+	volatile uintptr_t _packetsPublished; /**< Full barrier packets published by mutators during the concurrent phase */
+	volatile uintptr_t _batchRefills; /**< Fragment refreshes that claimed more than one empty barrier packet */
+	volatile uintptr_t _drainerWakeups; /**< Times concurrent helpers were woken to drain published barrier packets */
+	volatile uintptr_t _bytesDrained; /**< Bytes traced by concurrent helpers while draining barrier packets */
+	uintptr_t _pendingPackets; /**< Barrier packets still in use by mutators when the concurrent phase ended, left for the final pause */
+
+	MMINLINE void incrementCount(volatile uintptr_t &counter, uintptr_t count)
+	{
+		MM_AtomicOperations::add((uintptr_t *)&counter, count);
+	};
+
+	MMINLINE void clear()
+	{
+		MM_AtomicOperations::set((uintptr_t *)&_packetsPublished, 0);
+		MM_AtomicOperations::set((uintptr_t *)&_batchRefills, 0);
+		MM_AtomicOperations::set((uintptr_t *)&_drainerWakeups, 0);
+		MM_AtomicOperations::set((uintptr_t *)&_bytesDrained, 0);
+		_pendingPackets = 0;
+	};
+
+	MMINLINE uintptr_t getPacketsPublished() { return _packetsPublished; };
+	MMINLINE void incPacketsPublished(uintptr_t count) { incrementCount(_packetsPublished, count); };
+
+	MMINLINE uintptr_t getBatchRefills() { return _batchRefills; };
+	MMINLINE void incBatchRefills(uintptr_t count) { incrementCount(_batchRefills, count); };
+
+	MMINLINE uintptr_t getDrainerWakeups() { return _drainerWakeups; };
+	MMINLINE void incDrainerWakeups(uintptr_t count) { incrementCount(_drainerWakeups, count); };
+
+	MMINLINE uintptr_t getBytesDrained() { return _bytesDrained; };
+	MMINLINE void incBytesDrained(uintptr_t bytes) { incrementCount(_bytesDrained, bytes); };
+
+	MMINLINE uintptr_t getPendingPackets() { return _pendingPackets; };
+	MMINLINE void setPendingPackets(uintptr_t count) { _pendingPackets = count; };
+
+	/**
+	 * Create a ConcurrentSATBStats object.
+	 */
+	MM_ConcurrentSATBStats() :
+		MM_Base(),
+		_packetsPublished(0),
+		_batchRefills(0),
+		_drainerWakeups(0),
+		_bytesDrained(0),
+		_pendingPackets(0)
+	{};
+};
+
+#endif /* CONCURRENTSATBSTATS_HPP_ */
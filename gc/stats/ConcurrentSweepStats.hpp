@@ -96,6 +96,16 @@ public:
 	 * @}
 	 */
 
+	/**
+	 * Concurrent sweep attribution statistics.
+	 * @{
+	 */
+	volatile uintptr_t _lazySweepBytesSwept;  /**< Bytes swept by allocating threads replenishing an empty pool */
+	volatile uintptr_t _backgroundSweepBytesSwept;  /**< Bytes swept as allocation tax or while completing the sweep phase concurrently */
+	/**
+	 * @}
+	 */
+
 	/**
 	 * Force the concurrent sweep mode into a particular state.
 	 * @note This routine should only be used for initialization or clearing.
@@ -154,6 +164,8 @@ public:
 		_completeConnectPhaseTimeStart = 0;
 		_completeConnectPhaseTimeEnd = 0;
 		_completeConnectPhaseBytesConnected = 0;
+		_lazySweepBytesSwept = 0;
+		_backgroundSweepBytesSwept = 0;
 	}
 
 	MM_ConcurrentSweepStats() :
@@ -171,7 +183,9 @@ public:
 		_completeSweepPhaseBytesSwept(0),
 		_completeConnectPhaseTimeStart(0),
 		_completeConnectPhaseTimeEnd(0),
-		_completeConnectPhaseBytesConnected(0)
+		_completeConnectPhaseBytesConnected(0),
+		_lazySweepBytesSwept(0),
+		_backgroundSweepBytesSwept(0)
 	{}
 };
 
@@ -55,6 +55,10 @@ public:
 	MM_MarkStats markStats;
 	MM_ClassUnloadStats classUnloadStats;
 	MM_MetronomeStats metronomeStats; /**< Stats collected during one GC increment (quantum) */
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	bool nurseryCollect; /**< True if the current segregated collection only traced objects allocated since the previous collection */
+	uintptr_t nurseryRememberedCount; /**< Number of remembered old objects scanned by the current nursery collection */
+#endif /* OMR_GC_SEGREGATED_HEAP */
 
 	MMINLINE void clear()
 	{
@@ -73,6 +77,10 @@ public:
 		markStats.clear();
 		classUnloadStats.clear();
 		metronomeStats.clearStart();
+#if defined(OMR_GC_SEGREGATED_HEAP)
+		nurseryCollect = false;
+		nurseryRememberedCount = 0;
+#endif /* OMR_GC_SEGREGATED_HEAP */
 	};
 
 	/**
@@ -98,6 +106,10 @@ public:
 		markStats(),
 		classUnloadStats(),
 		metronomeStats()
+#if defined(OMR_GC_SEGREGATED_HEAP)
+		, nurseryCollect(false)
+		, nurseryRememberedCount(0)
+#endif /* OMR_GC_SEGREGATED_HEAP */
 	{}
 };
 
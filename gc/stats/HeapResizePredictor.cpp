@@ -0,0 +1,68 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "HeapResizePredictor.hpp"
+
+#include "EnvironmentBase.hpp"
+
+/**
+ * Allocate and initialize the default predictor, which sizes for the last cycle only.
+ * @return a new instance of the receiver, or NULL on failure.
+ */
+MM_HeapResizePredictor *
+MM_HeapResizePredictor::newInstance(MM_EnvironmentBase *env)
+{
+	MM_HeapResizePredictor *predictor = (MM_HeapResizePredictor *)env->getForge()->allocate(sizeof(MM_HeapResizePredictor), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != predictor) {
+		new(predictor) MM_HeapResizePredictor();
+		if (!predictor->initialize(env)) {
+			predictor->kill(env);
+			predictor = NULL;
+		}
+	}
+
+	return predictor;
+}
+
+void
+MM_HeapResizePredictor::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+void
+MM_HeapResizePredictor::Forecast::update(uintptr_t actual, double weight)
+{
+	_lastPredicted = predict();
+	_lastActual = actual;
+
+	if (0 == _samples) {
+		_level = (double)actual;
+		_trend = 0.0;
+	} else {
+		double previousLevel = _level;
+		_level = (weight * (double)actual) + ((1.0 - weight) * (_level + _trend));
+		_trend = (weight * (_level - previousLevel)) + ((1.0 - weight) * _trend);
+	}
+	_samples += 1;
+}
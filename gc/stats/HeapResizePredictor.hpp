@@ -0,0 +1,123 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(HEAPRESIZEPREDICTOR_HPP_)
+#define HEAPRESIZEPREDICTOR_HPP_
+
+#include "omrcomp.h"
+#include "modronbase.h"
+
+#include "BaseVirtual.hpp"
+
+class MM_EnvironmentBase;
+
+/**
+ * Tells nursery and tenure resizing what allocation demand to size for. The heap is given one predictor at
+ * startup; the default one sizes for the demand of the last cycle only, which the resize heuristics already
+ * measure themselves, so it records nothing and has no forecast to offer.
+ * @ingroup GC_Stats
+ */
+class MM_HeapResizePredictor : public MM_BaseVirtual
+{
+	/*
+	 * Data members
+	 */
+public:
+	struct Forecast {
+		double _level; /**< smoothed value of the series */
+		double _trend; /**< smoothed change of the series per cycle */
+		uintptr_t _samples; /**< number of cycles observed */
+		uintptr_t _lastActual; /**< value observed in the most recent cycle */
+		uintptr_t _lastPredicted; /**< value that was forecast for the most recent cycle */
+
+		/**
+		 * @return the value forecast for the next cycle, or 0 if nothing has been observed yet
+		 */
+		MMINLINE uintptr_t predict()
+		{
+			double next = _level + _trend;
+			return ((0 == _samples) || (next <= 0.0)) ? 0 : (uintptr_t)next;
+		}
+
+		void update(uintptr_t actual, double weight);
+	};
+
+private:
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+protected:
+	virtual bool initialize(MM_EnvironmentBase *env) { return true; }
+	virtual void tearDown(MM_EnvironmentBase *env) {}
+
+public:
+	static MM_HeapResizePredictor *newInstance(MM_EnvironmentBase *env);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Record the allocation and survival of a completed scavenge.
+	 * @param allocatedBytes bytes allocated in the nursery since the previous scavenge
+	 * @param survivorBytes bytes copied within the nursery by this scavenge
+	 * @param endTime hi-res time the scavenge completed
+	 */
+	virtual void recordScavenge(MM_EnvironmentBase *env, uintptr_t allocatedBytes, uintptr_t survivorBytes, uint64_t endTime) {}
+
+	/**
+	 * Record the tenure occupancy at the start of a global collection.
+	 */
+	virtual void recordGlobalStart(MM_EnvironmentBase *env, uintptr_t usedBytes) {}
+
+	/**
+	 * Record the tenure occupancy at the end of a global collection.
+	 */
+	virtual void recordGlobalEnd(MM_EnvironmentBase *env, uintptr_t liveBytes) {}
+
+	/**
+	 * @return the predicted ratio of next scavenge load to the last one
+	 */
+	virtual double getScavengeLoadFactor() { return 1.0; }
+
+	/**
+	 * @return the number of tenure bytes expected to be consumed before the next global collection, or 0 if there is no prediction
+	 */
+	virtual uintptr_t getTenureDemand() { return 0; }
+
+	/**
+	 * The series behind the forecasts, for reporting.
+	 * @return the series, or NULL if the predictor does not keep it
+	 */
+	virtual Forecast *getAllocationRate() { return NULL; }
+	virtual Forecast *getSurvivorBytes() { return NULL; }
+	virtual Forecast *getTenureConsumption() { return NULL; }
+
+	MM_HeapResizePredictor() :
+		MM_BaseVirtual()
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* HEAPRESIZEPREDICTOR_HPP_ */
@@ -91,6 +91,13 @@ MM_ScavengerStats::MM_ScavengerStats()
 	,_tenureExpandedTime(0)
 	,_leafObjectCount(0)
 	,_copy_cachesize_sum(0)
+	,_slotPrefetchCount(0)
+	,_slotPrefetchHitCount(0)
+	,_slotPrefetchRingOccupancySum(0)
+	,_hotFieldSampleCount(0)
+	,_hotFieldLearnedShapeCount(0)
+	,_rememberedSetBatchCount(0)
+	,_rememberedSetBatchSlotCount(0)
 	,_slotsCopied(0)
 	,_slotsScanned(0)
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
@@ -102,6 +109,7 @@ MM_ScavengerStats::MM_ScavengerStats()
 	memset(_flipHistory, 0, sizeof(_flipHistory));
 	memset(_copy_distance_counts, 0, sizeof(_copy_distance_counts));
 	memset(_copy_cachesize_counts, 0, sizeof(_copy_cachesize_counts));
+	memset(_numaNodeStats, 0, sizeof(_numaNodeStats));
 }
 
 struct MM_ScavengerStats::FlipHistory*
@@ -209,8 +217,16 @@ MM_ScavengerStats::clear(bool firstIncrement)
 
 	_leafObjectCount = 0;
 	_copy_cachesize_sum = 0;
+	_slotPrefetchCount = 0;
+	_slotPrefetchHitCount = 0;
+	_slotPrefetchRingOccupancySum = 0;
+	_hotFieldSampleCount = 0;
+	_hotFieldLearnedShapeCount = 0;
+	_rememberedSetBatchCount = 0;
+	_rememberedSetBatchSlotCount = 0;
 	memset(_copy_distance_counts, 0, sizeof(_copy_distance_counts));
 	memset(_copy_cachesize_counts, 0, sizeof(_copy_cachesize_counts));
+	memset(_numaNodeStats, 0, sizeof(_numaNodeStats));
 }
 
 bool
@@ -36,6 +36,8 @@ class MM_EnvironmentBase;
 
 #define OMR_SCAVENGER_DISTANCE_BINS 32
 #define OMR_SCAVENGER_CACHESIZE_BINS 16
+/* The maximum number of NUMA nodes the scavenger partitions its scan and free cache lists by. */
+#define OMR_SCAVENGER_NUMA_NODE_MAX 16
 
 #define SCAVENGER_FLIP_HISTORY_SIZE 16
 
@@ -146,6 +148,22 @@ public:
 	uint64_t _copy_cachesize_counts[OMR_SCAVENGER_CACHESIZE_BINS];
 	uint64_t _copy_cachesize_sum;
 
+	uint64_t _slotPrefetchCount; /**< The number of referents prefetched ahead of copyAndForward() (scavengerPrefetchDistance enabled) */
+	uint64_t _slotPrefetchHitCount; /**< The number of prefetched referents that were then copied by the prefetching thread */
+	uint64_t _slotPrefetchRingOccupancySum; /**< Sum of prefetch ring occupancy sampled each time a slot leaves the ring; divide by _slotPrefetchCount for the average */
+	uint64_t _hotFieldSampleCount; /**< The number of slots sampled for hot field learning (scavengerHotFieldLearning enabled) */
+	uintptr_t _hotFieldLearnedShapeCount; /**< The number of object shapes with hot fields learned at the end of the cycle (cycle stats only) */
+	uintptr_t _rememberedSetBatchCount; /**< The number of remembered set slot batches claimed from the remembered set list (scavengerRememberedSetScanBatchSize enabled) */
+	uintptr_t _rememberedSetBatchSlotCount; /**< The number of remembered objects scanned from claimed remembered set slot batches */
+
+	struct NUMANodeStats {
+		uintptr_t _copiedBytes; /**< Bytes copied (flipped and tenured) by the GC threads assigned to the node */
+		uintptr_t _localScanCacheCount; /**< Scan caches taken from the scan list that were released by a thread of the same node */
+		uintptr_t _remoteScanCacheCount; /**< Scan caches taken from the scan list that were released by a thread of another node */
+		uintptr_t _localSurvivorBytes; /**< Survivor memory the GC threads assigned to the node took from the node's own reservoir */
+		uintptr_t _remoteSurvivorBytes; /**< Survivor memory the GC threads assigned to the node took from the reservoirs of other nodes */
+	} _numaNodeStats[OMR_SCAVENGER_NUMA_NODE_MAX]; /**< Per NUMA node statistics (scavengerNUMAAware enabled), indexed by node index */
+
 	uint64_t _slotsCopied; /**< The number of slots copied by the thread since _slotsScanned was last sampled and reset */
 	uint64_t _slotsScanned; /**< The number of slots scanned by the thread since _slotsCopied was last sampled and reset */
 	
@@ -0,0 +1,130 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrport.h"
+
+#include "SmoothedHeapResizePredictor.hpp"
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+
+/**
+ * Allocate and initialize a new instance of the receiver.
+ * @return a new instance of the receiver, or NULL on failure.
+ */
+MM_SmoothedHeapResizePredictor *
+MM_SmoothedHeapResizePredictor::newInstance(MM_EnvironmentBase *env)
+{
+	MM_SmoothedHeapResizePredictor *predictor = (MM_SmoothedHeapResizePredictor *)env->getForge()->allocate(sizeof(MM_SmoothedHeapResizePredictor), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != predictor) {
+		new(predictor) MM_SmoothedHeapResizePredictor();
+		if (!predictor->initialize(env)) {
+			predictor->kill(env);
+			predictor = NULL;
+		}
+	}
+
+	return predictor;
+}
+
+/**
+ * Smoothing weight of the most recent cycle, equivalent to a moving average over heapResizePredictorHistory cycles.
+ */
+double
+MM_SmoothedHeapResizePredictor::getWeight(MM_EnvironmentBase *env)
+{
+	return 2.0 / (double)(env->getExtensions()->heapResizePredictorHistory + 1);
+}
+
+/**
+ * Record the allocation and survival of a completed scavenge.
+ * @param allocatedBytes bytes allocated in the nursery since the previous scavenge
+ * @param survivorBytes bytes copied within the nursery by this scavenge
+ * @param endTime hi-res time the scavenge completed
+ */
+void
+MM_SmoothedHeapResizePredictor::recordScavenge(MM_EnvironmentBase *env, uintptr_t allocatedBytes, uintptr_t survivorBytes, uint64_t endTime)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	double weight = getWeight(env);
+
+	/* the clock may be shifted backwards externally, skip the rate sample rather than record a bogus one */
+	if ((0 != _lastScavengeEndTime) && (endTime > _lastScavengeEndTime)) {
+		uint64_t intervalMicros = omrtime_hires_delta(_lastScavengeEndTime, endTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		if (0 != intervalMicros) {
+			_allocationRate.update((uintptr_t)(((uint64_t)allocatedBytes * 1000) / intervalMicros), weight);
+		}
+	}
+	_lastScavengeEndTime = endTime;
+
+	_survivorBytes.update(survivorBytes, weight);
+}
+
+/**
+ * Record the tenure occupancy at the start of a global collection. The growth since the end of the
+ * previous global collection is the tenure consumption of the cycle.
+ */
+void
+MM_SmoothedHeapResizePredictor::recordGlobalStart(MM_EnvironmentBase *env, uintptr_t usedBytes)
+{
+	if (_tenureLiveBytesValid) {
+		uintptr_t consumedBytes = (usedBytes > _tenureLiveBytes) ? (usedBytes - _tenureLiveBytes) : 0;
+		_tenureConsumption.update(consumedBytes, getWeight(env));
+	}
+}
+
+/**
+ * Record the tenure occupancy at the end of a global collection.
+ */
+void
+MM_SmoothedHeapResizePredictor::recordGlobalEnd(MM_EnvironmentBase *env, uintptr_t liveBytes)
+{
+	_tenureLiveBytes = liveBytes;
+	_tenureLiveBytesValid = true;
+}
+
+/**
+ * The cost of a scavenge relative to the interval between scavenges scales with the survivor volume and,
+ * for a fixed nursery size, with the allocation rate. Compare the forecast for the next scavenge with the
+ * one just observed so that the nursery can be resized for the coming load rather than the past one.
+ * @return the predicted ratio of next scavenge load to the last one, 1.0 until a trend is established
+ */
+double
+MM_SmoothedHeapResizePredictor::getScavengeLoadFactor()
+{
+	double loadFactor = 1.0;
+
+	if ((1 < _allocationRate._samples) && (0 != _allocationRate._lastActual)) {
+		loadFactor *= (double)_allocationRate.predict() / (double)_allocationRate._lastActual;
+	}
+	if ((1 < _survivorBytes._samples) && (0 != _survivorBytes._lastActual)) {
+		loadFactor *= (double)_survivorBytes.predict() / (double)_survivorBytes._lastActual;
+	}
+
+	if (loadFactor < HEAP_RESIZE_PREDICTOR_LOAD_FACTOR_MINIMUM) {
+		loadFactor = HEAP_RESIZE_PREDICTOR_LOAD_FACTOR_MINIMUM;
+	} else if (loadFactor > HEAP_RESIZE_PREDICTOR_LOAD_FACTOR_MAXIMUM) {
+		loadFactor = HEAP_RESIZE_PREDICTOR_LOAD_FACTOR_MAXIMUM;
+	}
+
+	return loadFactor;
+}
@@ -0,0 +1,96 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(SMOOTHEDHEAPRESIZEPREDICTOR_HPP_)
+#define SMOOTHEDHEAPRESIZEPREDICTOR_HPP_
+
+#include "omrcomp.h"
+#include "modronbase.h"
+
+#include "HeapResizePredictor.hpp"
+
+class MM_EnvironmentBase;
+
+/* Bounds on the factor by which the next scavenge is predicted to be more (or less) expensive than the last one */
+#define HEAP_RESIZE_PREDICTOR_LOAD_FACTOR_MINIMUM 0.5
+#define HEAP_RESIZE_PREDICTOR_LOAD_FACTOR_MAXIMUM 2.0
+
+/**
+ * Forecasts the allocation demand of the next collection cycles so that nursery and tenure can be sized ahead of it.
+ * Each series is smoothed with a double exponential (level plus linear trend) average over the last
+ * heapResizePredictorHistory cycles. The value forecast for a cycle is kept next to the value actually observed
+ * so both can be reported. The heap uses it when heapResizePredictor is set.
+ * @ingroup GC_Stats
+ */
+class MM_SmoothedHeapResizePredictor : public MM_HeapResizePredictor
+{
+	/*
+	 * Data members
+	 */
+private:
+	Forecast _allocationRate; /**< nursery allocation rate, in bytes per millisecond of interval between scavenges */
+	Forecast _survivorBytes; /**< bytes copied within the nursery per scavenge */
+	Forecast _tenureConsumption; /**< tenure bytes consumed between two global collections */
+
+	uint64_t _lastScavengeEndTime; /**< hi-res time the previous scavenge completed, 0 if none */
+	uintptr_t _tenureLiveBytes; /**< tenure bytes in use at the end of the previous global collection */
+	bool _tenureLiveBytesValid; /**< true once a global collection has completed */
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+	double getWeight(MM_EnvironmentBase *env);
+
+protected:
+public:
+	static MM_SmoothedHeapResizePredictor *newInstance(MM_EnvironmentBase *env);
+
+	virtual void recordScavenge(MM_EnvironmentBase *env, uintptr_t allocatedBytes, uintptr_t survivorBytes, uint64_t endTime);
+	virtual void recordGlobalStart(MM_EnvironmentBase *env, uintptr_t usedBytes);
+	virtual void recordGlobalEnd(MM_EnvironmentBase *env, uintptr_t liveBytes);
+
+	virtual double getScavengeLoadFactor();
+	virtual uintptr_t getTenureDemand() { return _tenureConsumption.predict(); }
+
+	virtual Forecast *getAllocationRate() { return &_allocationRate; }
+	virtual Forecast *getSurvivorBytes() { return &_survivorBytes; }
+	virtual Forecast *getTenureConsumption() { return &_tenureConsumption; }
+
+	MM_SmoothedHeapResizePredictor() :
+		MM_HeapResizePredictor(),
+		_lastScavengeEndTime(0),
+		_tenureLiveBytes(0),
+		_tenureLiveBytesValid(false)
+	{
+		_typeId = __FUNCTION__;
+		Forecast empty = {0.0, 0.0, 0, 0, 0};
+		_allocationRate = empty;
+		_survivorBytes = empty;
+		_tenureConsumption = empty;
+	}
+};
+
+#endif /* SMOOTHEDHEAPRESIZEPREDICTOR_HPP_ */
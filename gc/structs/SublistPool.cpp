@@ -416,6 +416,7 @@ MM_SublistPool::startProcessingSublist()
 {
 	Assert_MM_true(NULL == _previousList);
 	_previousList = _list;
+	_previousBatchCursor = NULL;
 
 	MM_SublistPuddle* tail = _allocPuddle;
 	if (NULL == tail) {
@@ -438,20 +439,11 @@ MM_SublistPool::popPreviousPuddle(MM_SublistPuddle * returnedPuddle)
 
 	/* return returnedPuddle to the list of used puddles */
 	if (NULL != returnedPuddle) {
-		Assert_MM_true(NULL == returnedPuddle->getNext());
-		returnedPuddle->setNext(_list);
-		_list = returnedPuddle;
-
-		/* It's illegal to have a non-empty list without an _allocPuddle. If 
-		 * this is the only puddle in the pool, make it the _allocPuddle. 
-		 */
-		if (NULL == _allocPuddle) {
-			_allocPuddle = returnedPuddle;
-			Assert_MM_true(NULL == _allocPuddle->getNext());
-		}
+		returnPreviousPuddle(returnedPuddle);
 	}
 
-	/* pop an element from the previous list */
+	/* pop an element from the previous list; batches and whole puddles must not be handed out from the same list */
+	Assert_MM_true(NULL == _previousBatchCursor);
 	MM_SublistPuddle *result = _previousList;
 	if (NULL != result) {
 		_previousList = result->getNext();
@@ -462,3 +454,55 @@ MM_SublistPool::popPreviousPuddle(MM_SublistPuddle * returnedPuddle)
 	
 	return result;
 }
+
+uintptr_t *
+MM_SublistPool::popPreviousBatch(uintptr_t batchSize, uintptr_t **batchTop)
+{
+	uintptr_t *result = NULL;
+
+	Assert_MM_true(0 < batchSize);
+
+	omrthread_monitor_enter(_mutex);
+
+	MM_SublistPuddle *puddle = NULL;
+	while ((NULL == result) && (NULL != (puddle = _previousList))) {
+		uintptr_t *puddleTop = puddle->_listCurrent;
+		if (NULL == _previousBatchCursor) {
+			_previousBatchCursor = puddle->_listBase;
+		}
+
+		if (_previousBatchCursor < puddleTop) {
+			result = _previousBatchCursor;
+			*batchTop = (batchSize < (uintptr_t)(puddleTop - result)) ? (result + batchSize) : puddleTop;
+			_previousBatchCursor = *batchTop;
+		}
+
+		if (puddleTop == _previousBatchCursor) {
+			/* every element of the puddle is claimed, the claiming threads only touch elements below puddleTop */
+			_previousList = puddle->getNext();
+			puddle->setNext(NULL);
+			_previousBatchCursor = NULL;
+			returnPreviousPuddle(puddle);
+		}
+	}
+
+	omrthread_monitor_exit(_mutex);
+
+	return result;
+}
+
+void
+MM_SublistPool::returnPreviousPuddle(MM_SublistPuddle *returnedPuddle)
+{
+	Assert_MM_true(NULL == returnedPuddle->getNext());
+	returnedPuddle->setNext(_list);
+	_list = returnedPuddle;
+
+	/* It's illegal to have a non-empty list without an _allocPuddle. If 
+	 * this is the only puddle in the pool, make it the _allocPuddle. 
+	 */
+	if (NULL == _allocPuddle) {
+		_allocPuddle = returnedPuddle;
+		Assert_MM_true(NULL == _allocPuddle->getNext());
+	}
+}
@@ -65,6 +65,7 @@ private:
 	OMR::GC::AllocationCategory::Enum _allocCategory;
 	
 	MM_SublistPuddle *_previousList; /**< A list of the non-empty puddles when #startProcessingSublist() was called */
+	uintptr_t *_previousBatchCursor; /**< First element of the head of _previousList not yet claimed by #popPreviousBatch(), or NULL if none of it is claimed */
 	
 protected:
 public:
@@ -76,6 +77,13 @@ private:
 	MM_SublistPuddle *createNewPuddle(MM_EnvironmentBase *env);
 	void freePuddles(MM_EnvironmentBase *env, MM_SublistPuddle *list);
 
+	/**
+	 * Return a puddle taken from the list of previous puddles to the list of used puddles.
+	 * The caller must hold _mutex.
+	 * @param returnedPuddle[in] the puddle, which must no longer be linked to another puddle
+	 */
+	void returnPreviousPuddle(MM_SublistPuddle *returnedPuddle);
+
 protected:
 public:
 	bool initialize(MM_EnvironmentBase *env, OMR::GC::AllocationCategory::Enum category);
@@ -125,6 +133,18 @@ public:
 	 * @return a puddle to process, or NULL if the list is empty
 	 */
 	MM_SublistPuddle *popPreviousPuddle(MM_SublistPuddle * returnedPuddle);
+
+	/**
+	 * Claim a batch of up to batchSize elements from the puddles which were active when #startProcessingSublist() was called.
+	 * Batches of one puddle may be claimed by several threads, so elements must not be removed while batches are processed.
+	 * A puddle is returned to the list of puddles once its last batch is claimed; elements added to it afterwards
+	 * are outside every batch. This is protected by a lock, so may safely be called by multiple threads.
+	 *
+	 * @param batchSize[in] the maximum number of elements to claim
+	 * @param batchTop[out] set to the element following the last element of the batch
+	 * @return the first element of the batch, or NULL if every element has been claimed
+	 */
+	uintptr_t *popPreviousBatch(uintptr_t batchSize, uintptr_t **batchTop);
 	
 	MM_SublistPool() 
 		: _list(NULL)
@@ -136,6 +156,7 @@ public:
 		, _count(0)
 		, _allocCategory(OMR::GC::AllocationCategory::OTHER)
 		, _previousList(NULL)
+		, _previousBatchCursor(NULL)
 	{}
 
 	friend class GC_SublistIterator;
@@ -98,6 +98,7 @@ public:
 
 	friend class GC_SublistIterator;
 	friend class GC_SublistSlotIterator;
+	friend class MM_SublistPool;
 };
 
 #endif /* SUBLISTPUDDLE_HPP_ */
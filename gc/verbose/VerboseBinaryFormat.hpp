@@ -0,0 +1,158 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(VERBOSEBINARYFORMAT_HPP_)
+#define VERBOSEBINARYFORMAT_HPP_
+
+#include <stdint.h>
+
+/**
+ * @file
+ * Layout of the binary verbose GC stream written by MM_VerboseWriterFileLoggingBinary
+ * and read by MM_VerboseBinaryReader.
+ *
+ * The verbose handlers produce each line with a printf style format and its arguments.  The
+ * stream records the format once per file and then, for each line, only the format id, the
+ * indentation and the raw argument values, so no text is formatted while the GC is running.
+ *
+ * The stream starts with a 9 byte file header: magic, a major and minor version byte and the
+ * size in bytes of a pointer in the writing process (pointers are printed with that many hex
+ * digit pairs).  It is then a sequence of records, each introduced by a one byte tag.
+ * Integers are unsigned LEB128 varints; signed arguments are zigzag encoded first.
+ *
+ *   FORMAT   id, length, bytes (a format string; ids are assigned in order from 0)
+ *   LINE     format id, indent, { argument }* (one value per conversion of the format)
+ *   TEXT     length, bytes (text that did not come from a format, reproduced verbatim)
+ *
+ * Arguments are encoded according to their conversion in the format:
+ *   d i      signed varint
+ *   u x X o  varint
+ *   p        varint
+ *   s        length, bytes
+ *
+ * A line expands to two spaces per indent level, the formatted text and a line break.  Each
+ * file repeats the formats it uses, so rotated files can be read independently.
+ *
+ * A reader must reject a stream whose major version it does not know; minor versions only add
+ * record kinds that older readers report as errors.
+ */
+
+#define VERBOSEGC_BINARY_MAGIC "OMRVGC"
+#define VERBOSEGC_BINARY_MAGIC_LENGTH 6
+#define VERBOSEGC_BINARY_HEADER_LENGTH 9
+#define VERBOSEGC_BINARY_VERSION_MAJOR 2
+#define VERBOSEGC_BINARY_VERSION_MINOR 0
+
+#define VERBOSEGC_BINARY_RECORD_FORMAT 1
+#define VERBOSEGC_BINARY_RECORD_LINE 2
+#define VERBOSEGC_BINARY_RECORD_TEXT 3
+
+/* The most conversions a format may have to be recorded as a LINE */
+#define VERBOSEGC_BINARY_MAXIMUM_ARGUMENTS 32
+
+/* The C type of the argument consumed by a conversion */
+#define VERBOSEGC_BINARY_ARGUMENT_NONE 0 /* %% */
+#define VERBOSEGC_BINARY_ARGUMENT_INT 1
+#define VERBOSEGC_BINARY_ARGUMENT_UNSIGNED_INT 2
+#define VERBOSEGC_BINARY_ARGUMENT_LONG 3
+#define VERBOSEGC_BINARY_ARGUMENT_UNSIGNED_LONG 4
+#define VERBOSEGC_BINARY_ARGUMENT_LONG_LONG 5
+#define VERBOSEGC_BINARY_ARGUMENT_UNSIGNED_LONG_LONG 6
+#define VERBOSEGC_BINARY_ARGUMENT_SIZE 7
+#define VERBOSEGC_BINARY_ARGUMENT_UNSIGNED_SIZE 8
+#define VERBOSEGC_BINARY_ARGUMENT_POINTER 9
+#define VERBOSEGC_BINARY_ARGUMENT_STRING 10
+#define VERBOSEGC_BINARY_ARGUMENT_UNSUPPORTED 0xFF
+
+/**
+ * Parse the conversion specification that starts at the '%' at conversion.  Flags, a decimal
+ * width and a decimal precision are accepted; a '*' width or precision, the h and hh length
+ * modifiers and floating point or character conversions are reported as unsupported.
+ * @param[out] kind one of the VERBOSEGC_BINARY_ARGUMENT_* kinds
+ * @return the character following the specification
+ */
+inline const char *
+verboseBinaryParseConversion(const char *conversion, uint8_t *kind)
+{
+	const char *cursor = conversion + 1;
+	*kind = VERBOSEGC_BINARY_ARGUMENT_UNSUPPORTED;
+
+	if ('%' == *cursor) {
+		*kind = VERBOSEGC_BINARY_ARGUMENT_NONE;
+		return cursor + 1;
+	}
+	while (('-' == *cursor) || ('+' == *cursor) || (' ' == *cursor) || ('#' == *cursor) || ('0' == *cursor)) {
+		cursor += 1;
+	}
+	while (('0' <= *cursor) && ('9' >= *cursor)) {
+		cursor += 1;
+	}
+	if ('.' == *cursor) {
+		cursor += 1;
+		while (('0' <= *cursor) && ('9' >= *cursor)) {
+			cursor += 1;
+		}
+	}
+
+	uintptr_t length = 0; /* 0 none, 1 l, 2 ll, 3 z */
+	if ('l' == *cursor) {
+		cursor += 1;
+		length = 1;
+		if ('l' == *cursor) {
+			cursor += 1;
+			length = 2;
+		}
+	} else if ('z' == *cursor) {
+		cursor += 1;
+		length = 3;
+	}
+
+	static const uint8_t signedKinds[] = { VERBOSEGC_BINARY_ARGUMENT_INT, VERBOSEGC_BINARY_ARGUMENT_LONG, VERBOSEGC_BINARY_ARGUMENT_LONG_LONG, VERBOSEGC_BINARY_ARGUMENT_SIZE };
+	static const uint8_t unsignedKinds[] = { VERBOSEGC_BINARY_ARGUMENT_UNSIGNED_INT, VERBOSEGC_BINARY_ARGUMENT_UNSIGNED_LONG, VERBOSEGC_BINARY_ARGUMENT_UNSIGNED_LONG_LONG, VERBOSEGC_BINARY_ARGUMENT_UNSIGNED_SIZE };
+	switch (*cursor) {
+	case 'd':
+	case 'i':
+		*kind = signedKinds[length];
+		break;
+	case 'u':
+	case 'x':
+	case 'X':
+	case 'o':
+		*kind = unsignedKinds[length];
+		break;
+	case 'p':
+		if (0 == length) {
+			*kind = VERBOSEGC_BINARY_ARGUMENT_POINTER;
+		}
+		break;
+	case 's':
+		if (0 == length) {
+			*kind = VERBOSEGC_BINARY_ARGUMENT_STRING;
+		}
+		break;
+	default:
+		return cursor;
+	}
+	return cursor + 1;
+}
+
+#endif /* VERBOSEBINARYFORMAT_HPP_ */
@@ -0,0 +1,479 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "VerboseBinaryReader.hpp"
+
+#include <stdlib.h>
+#include <string.h>
+
+MM_VerboseBinaryReader::MM_VerboseBinaryReader()
+	: _file(NULL)
+	, _inputCursor(0)
+	, _inputTop(0)
+	, _majorVersion(0)
+	, _minorVersion(0)
+	, _pointerSize(0)
+	, _error(NULL)
+	, _formatText(NULL)
+	, _formatTextUsed(0)
+	, _formatTextSize(0)
+	, _formats(NULL)
+	, _formatCount(0)
+	, _formatCapacity(0)
+	, _scratch(NULL)
+	, _scratchUsed(0)
+	, _scratchSize(0)
+{
+}
+
+MM_VerboseBinaryReader::~MM_VerboseBinaryReader()
+{
+	close();
+	free(_formatText);
+	free(_formats);
+	free(_scratch);
+}
+
+bool
+MM_VerboseBinaryReader::open(const char *filename)
+{
+	close();
+	_file = fopen(filename, "rb");
+	if (NULL == _file) {
+		_error = "unable to open file";
+		return false;
+	}
+
+	uint8_t header[VERBOSEGC_BINARY_HEADER_LENGTH];
+	for (size_t i = 0; i < VERBOSEGC_BINARY_HEADER_LENGTH; i++) {
+		if (!readByte(&header[i])) {
+			_error = "missing file header";
+			return false;
+		}
+	}
+	if (0 != memcmp(header, VERBOSEGC_BINARY_MAGIC, VERBOSEGC_BINARY_MAGIC_LENGTH)) {
+		_error = "not a binary verbose GC file";
+		return false;
+	}
+	_majorVersion = header[VERBOSEGC_BINARY_MAGIC_LENGTH];
+	_minorVersion = header[VERBOSEGC_BINARY_MAGIC_LENGTH + 1];
+	_pointerSize = header[VERBOSEGC_BINARY_MAGIC_LENGTH + 2];
+	if (VERBOSEGC_BINARY_VERSION_MAJOR != _majorVersion) {
+		_error = "unsupported format version";
+		return false;
+	}
+	if ((4 != _pointerSize) && (8 != _pointerSize)) {
+		_error = "unsupported pointer size";
+		return false;
+	}
+	return true;
+}
+
+void
+MM_VerboseBinaryReader::close()
+{
+	if (NULL != _file) {
+		fclose(_file);
+		_file = NULL;
+	}
+	_inputCursor = 0;
+	_inputTop = 0;
+	_formatTextUsed = 0;
+	_formatCount = 0;
+	_error = NULL;
+}
+
+MM_VerboseBinaryReader::RecordType
+MM_VerboseBinaryReader::next(Record *record)
+{
+	memset(record, 0, sizeof(*record));
+	record->type = RECORD_ERROR;
+	if (NULL == _file) {
+		return fail("no file open");
+	}
+
+	while (true) {
+		uint8_t tag = 0;
+		if (!readByte(&tag)) {
+			/* a stream may end between any two records */
+			record->type = RECORD_END_OF_STREAM;
+			return record->type;
+		}
+		_scratchUsed = 0;
+
+		switch (tag) {
+		case VERBOSEGC_BINARY_RECORD_FORMAT:
+			if (!readFormat()) {
+				return fail("malformed format definition");
+			}
+			break;
+		case VERBOSEGC_BINARY_RECORD_LINE:
+			if (!readLine(record)) {
+				return fail("malformed line");
+			}
+			record->type = RECORD_LINE;
+			return record->type;
+		case VERBOSEGC_BINARY_RECORD_TEXT:
+		{
+			uint64_t length = 0;
+			if (!readVarint(&length) || (length > VERBOSEGC_BINARY_READER_INPUT_SIZE * 1024) || !reserveScratch((size_t)length) || !readBytes(_scratch, (size_t)length)) {
+				return fail("malformed text");
+			}
+			record->type = RECORD_TEXT;
+			record->text = _scratch;
+			record->textLength = (size_t)length;
+			return record->type;
+		}
+		default:
+			return fail("unknown record");
+		}
+	}
+}
+
+bool
+MM_VerboseBinaryReader::writeXML(FILE *output)
+{
+	Record record;
+	while (true) {
+		switch (next(&record)) {
+		case RECORD_LINE:
+		case RECORD_TEXT:
+			fwrite(record.text, 1, record.textLength, output);
+			break;
+		case RECORD_END_OF_STREAM:
+			return 0 == ferror(output);
+		case RECORD_ERROR:
+		default:
+			return false;
+		}
+	}
+}
+
+bool
+MM_VerboseBinaryReader::convertToXML(const char *binaryFilename, const char *xmlFilename, const char **error)
+{
+	MM_VerboseBinaryReader reader;
+	bool result = false;
+
+	if (reader.open(binaryFilename)) {
+		FILE *output = fopen(xmlFilename, "wb");
+		if (NULL == output) {
+			reader._error = "unable to create output file";
+		} else {
+			result = reader.writeXML(output);
+			if ((0 != fclose(output)) && result) {
+				reader._error = "unable to write output file";
+				result = false;
+			}
+		}
+	}
+	if (NULL != error) {
+		*error = reader.getError();
+	}
+	return result;
+}
+
+bool
+MM_VerboseBinaryReader::fill()
+{
+	_inputCursor = 0;
+	_inputTop = fread(_input, 1, sizeof(_input), _file);
+	return 0 < _inputTop;
+}
+
+bool
+MM_VerboseBinaryReader::readByte(uint8_t *value)
+{
+	if ((_inputCursor == _inputTop) && !fill()) {
+		return false;
+	}
+	*value = _input[_inputCursor++];
+	return true;
+}
+
+bool
+MM_VerboseBinaryReader::readVarint(uint64_t *value)
+{
+	*value = 0;
+	for (uintptr_t shift = 0; shift < 64; shift += 7) {
+		uint8_t byte = 0;
+		if (!readByte(&byte)) {
+			return false;
+		}
+		*value |= (uint64_t)(byte & 0x7F) << shift;
+		if (0 == (byte & 0x80)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+bool
+MM_VerboseBinaryReader::readBytes(char *buffer, size_t length)
+{
+	for (size_t i = 0; i < length; i++) {
+		uint8_t byte = 0;
+		if (!readByte(&byte)) {
+			return false;
+		}
+		buffer[i] = (char)byte;
+	}
+	return true;
+}
+
+bool
+MM_VerboseBinaryReader::readFormat()
+{
+	uint64_t id = 0;
+	uint64_t length = 0;
+	/* formats are defined in order, once each */
+	if (!readVarint(&id) || (id != _formatCount) || !readVarint(&length) || (length > VERBOSEGC_BINARY_READER_INPUT_SIZE)) {
+		return false;
+	}
+
+	if (_formatCount == _formatCapacity) {
+		size_t capacity = (0 == _formatCapacity) ? 256 : (2 * _formatCapacity);
+		Format *formats = (Format *)realloc(_formats, capacity * sizeof(Format));
+		if (NULL == formats) {
+			return false;
+		}
+		_formats = formats;
+		_formatCapacity = capacity;
+	}
+	if ((_formatTextUsed + length + 1) > _formatTextSize) {
+		size_t size = 2 * (_formatTextSize + length + 1);
+		char *formatText = (char *)realloc(_formatText, size);
+		if (NULL == formatText) {
+			return false;
+		}
+		_formatText = formatText;
+		_formatTextSize = size;
+	}
+
+	char *text = _formatText + _formatTextUsed;
+	if (!readBytes(text, (size_t)length)) {
+		return false;
+	}
+	text[length] = '\0';
+
+	Format *format = &_formats[_formatCount];
+	format->offset = _formatTextUsed;
+	format->length = (size_t)length;
+	format->argumentCount = 0;
+	const char *cursor = strchr(text, '%');
+	while (NULL != cursor) {
+		uint8_t kind = VERBOSEGC_BINARY_ARGUMENT_NONE;
+		cursor = verboseBinaryParseConversion(cursor, &kind);
+		if ((VERBOSEGC_BINARY_ARGUMENT_UNSUPPORTED == kind) || (VERBOSEGC_BINARY_MAXIMUM_ARGUMENTS == format->argumentCount)) {
+			return false;
+		}
+		if (VERBOSEGC_BINARY_ARGUMENT_NONE != kind) {
+			format->kinds[format->argumentCount++] = kind;
+		}
+		cursor = strchr(cursor, '%');
+	}
+
+	_formatTextUsed += (size_t)length + 1;
+	_formatCount += 1;
+	return true;
+}
+
+bool
+MM_VerboseBinaryReader::readLine(Record *record)
+{
+	uint64_t id = 0;
+	uint64_t indent = 0;
+	if (!readVarint(&id) || (id >= _formatCount) || !readVarint(&indent) || (indent > VERBOSEGC_BINARY_READER_INPUT_SIZE)) {
+		return false;
+	}
+	Format *format = &_formats[id];
+
+	/* the string arguments are kept NUL terminated at the start of the scratch buffer */
+	uint64_t values[VERBOSEGC_BINARY_MAXIMUM_ARGUMENTS];
+	size_t stringOffsets[VERBOSEGC_BINARY_MAXIMUM_ARGUMENTS];
+	for (size_t i = 0; i < format->argumentCount; i++) {
+		if (!readVarint(&values[i])) {
+			return false;
+		}
+		if (VERBOSEGC_BINARY_ARGUMENT_STRING == format->kinds[i]) {
+			size_t length = (size_t)values[i];
+			if ((values[i] > VERBOSEGC_BINARY_READER_INPUT_SIZE * 1024) || !reserveScratch(length + 1) || !readBytes(_scratch + _scratchUsed, length)) {
+				return false;
+			}
+			stringOffsets[i] = _scratchUsed;
+			_scratch[_scratchUsed + length] = '\0';
+			_scratchUsed += length + 1;
+		}
+	}
+
+	size_t textOffset = _scratchUsed;
+	if (!reserveScratch((2 * (size_t)indent) + format->length + 1)) {
+		return false;
+	}
+	memset(_scratch + _scratchUsed, ' ', 2 * (size_t)indent);
+	_scratchUsed += 2 * (size_t)indent;
+
+	const char *cursor = _formatText + format->offset;
+	size_t argument = 0;
+	while ('\0' != *cursor) {
+		const char *conversion = strchr(cursor, '%');
+		size_t literalLength = (NULL == conversion) ? strlen(cursor) : (size_t)(conversion - cursor);
+		if (!reserveScratch(literalLength)) {
+			return false;
+		}
+		memcpy(_scratch + _scratchUsed, cursor, literalLength);
+		_scratchUsed += literalLength;
+		if (NULL == conversion) {
+			break;
+		}
+
+		uint8_t kind = VERBOSEGC_BINARY_ARGUMENT_NONE;
+		cursor = verboseBinaryParseConversion(conversion, &kind);
+		if (VERBOSEGC_BINARY_ARGUMENT_NONE == kind) {
+			if (!reserveScratch(1)) {
+				return false;
+			}
+			_scratch[_scratchUsed++] = '%';
+		} else {
+			const char *string = NULL;
+			if (VERBOSEGC_BINARY_ARGUMENT_STRING == kind) {
+				/* copied out as the scratch buffer may move while the conversion is appended */
+				size_t length = (size_t)values[argument];
+				char *copy = (char *)malloc(length + 1);
+				if (NULL == copy) {
+					return false;
+				}
+				memcpy(copy, _scratch + stringOffsets[argument], length + 1);
+				string = copy;
+			}
+			bool appended = appendConversion(conversion, cursor - conversion, kind, values[argument], string);
+			free((void *)string);
+			if (!appended) {
+				return false;
+			}
+			argument += 1;
+		}
+	}
+
+	if (!reserveScratch(1)) {
+		return false;
+	}
+	_scratch[_scratchUsed++] = '\n';
+
+	record->formatId = (size_t)id;
+	record->indent = (uintptr_t)indent;
+	record->text = _scratch + textOffset;
+	record->textLength = _scratchUsed - textOffset;
+	return true;
+}
+
+/**
+ * Append one conversion of a format to the scratch buffer as the writer's string formatting
+ * would have: integers through the C library with the ll length modifier and pointers as
+ * upper case hex padded to the writer's pointer width.
+ */
+bool
+MM_VerboseBinaryReader::appendConversion(const char *conversion, size_t conversionLength, uint8_t kind, uint64_t value, const char *string)
+{
+	char specification[48];
+	size_t length = 0;
+	if ((sizeof(specification) - 3) <= conversionLength) {
+		return false;
+	}
+	for (size_t i = 0; i < (conversionLength - 1); i++) {
+		if (('l' != conversion[i]) && ('z' != conversion[i])) {
+			specification[length++] = conversion[i];
+		}
+	}
+
+	int size = 0;
+	switch (kind) {
+	case VERBOSEGC_BINARY_ARGUMENT_STRING:
+		specification[length++] = conversion[conversionLength - 1];
+		specification[length] = '\0';
+		size = snprintf(NULL, 0, specification, string);
+		if ((0 > size) || !reserveScratch((size_t)size + 1)) {
+			return false;
+		}
+		snprintf(_scratch + _scratchUsed, (size_t)size + 1, specification, string);
+		break;
+	case VERBOSEGC_BINARY_ARGUMENT_POINTER:
+		size = snprintf(NULL, 0, "%0*llX", 2 * (int)_pointerSize, (unsigned long long)value);
+		if ((0 > size) || !reserveScratch((size_t)size + 1)) {
+			return false;
+		}
+		snprintf(_scratch + _scratchUsed, (size_t)size + 1, "%0*llX", 2 * (int)_pointerSize, (unsigned long long)value);
+		break;
+	case VERBOSEGC_BINARY_ARGUMENT_INT:
+	case VERBOSEGC_BINARY_ARGUMENT_LONG:
+	case VERBOSEGC_BINARY_ARGUMENT_LONG_LONG:
+	case VERBOSEGC_BINARY_ARGUMENT_SIZE:
+	{
+		long long signedValue = (long long)((value >> 1) ^ (0 - (value & 1)));
+		specification[length++] = 'l';
+		specification[length++] = 'l';
+		specification[length++] = conversion[conversionLength - 1];
+		specification[length] = '\0';
+		size = snprintf(NULL, 0, specification, signedValue);
+		if ((0 > size) || !reserveScratch((size_t)size + 1)) {
+			return false;
+		}
+		snprintf(_scratch + _scratchUsed, (size_t)size + 1, specification, signedValue);
+		break;
+	}
+	default:
+		specification[length++] = 'l';
+		specification[length++] = 'l';
+		specification[length++] = conversion[conversionLength - 1];
+		specification[length] = '\0';
+		size = snprintf(NULL, 0, specification, (unsigned long long)value);
+		if ((0 > size) || !reserveScratch((size_t)size + 1)) {
+			return false;
+		}
+		snprintf(_scratch + _scratchUsed, (size_t)size + 1, specification, (unsigned long long)value);
+		break;
+	}
+	_scratchUsed += (size_t)size;
+	return true;
+}
+
+bool
+MM_VerboseBinaryReader::reserveScratch(size_t size)
+{
+	if ((_scratchUsed + size) > _scratchSize) {
+		size_t scratchSize = 2 * (_scratchUsed + size);
+		char *scratch = (char *)realloc(_scratch, scratchSize);
+		if (NULL == scratch) {
+			return false;
+		}
+		_scratch = scratch;
+		_scratchSize = scratchSize;
+	}
+	return true;
+}
+
+MM_VerboseBinaryReader::RecordType
+MM_VerboseBinaryReader::fail(const char *error)
+{
+	_error = error;
+	return RECORD_ERROR;
+}
@@ -0,0 +1,150 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(VERBOSEBINARYREADER_HPP_)
+#define VERBOSEBINARYREADER_HPP_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "VerboseBinaryFormat.hpp"
+
+#define VERBOSEGC_BINARY_READER_INPUT_SIZE (64 * 1024)
+
+/**
+ * Streaming reader for the binary verbose GC format written by MM_VerboseWriterFileLoggingBinary.
+ * Depends only on the C library so that it can be linked into tools that run without a VM; it
+ * is not part of the GC library.
+ *
+ * Records are returned one at a time by next(), with LINE records expanded to the text the
+ * writer would have produced; the text stays valid until the following call.  A stream that
+ * ends on a record boundary (for example a file that is still being written) reads as a clean
+ * end of stream.
+ */
+class MM_VerboseBinaryReader
+{
+	/*
+	 * Data members
+	 */
+public:
+	typedef enum {
+		RECORD_LINE = 0,
+		RECORD_TEXT,
+		RECORD_END_OF_STREAM,
+		RECORD_ERROR
+	} RecordType;
+
+	struct Record {
+		RecordType type;
+		size_t formatId; /**< format of LINE records */
+		uintptr_t indent; /**< indent level of LINE records */
+		const char *text; /**< the expanded line, including its line break, or the contents of TEXT records */
+		size_t textLength;
+	};
+
+protected:
+private:
+	struct Format {
+		size_t offset; /**< offset of the format string in _formatText */
+		size_t length;
+		size_t argumentCount;
+		uint8_t kinds[VERBOSEGC_BINARY_MAXIMUM_ARGUMENTS];
+	};
+
+	FILE *_file;
+	uint8_t _input[VERBOSEGC_BINARY_READER_INPUT_SIZE];
+	size_t _inputCursor;
+	size_t _inputTop;
+
+	uint8_t _majorVersion;
+	uint8_t _minorVersion;
+	uint8_t _pointerSize;
+	const char *_error;
+
+	char *_formatText; /**< NUL terminated format strings defined so far */
+	size_t _formatTextUsed;
+	size_t _formatTextSize;
+	Format *_formats; /**< indexed by id */
+	size_t _formatCount;
+	size_t _formatCapacity;
+
+	char *_scratch; /**< text of the current record */
+	size_t _scratchUsed;
+	size_t _scratchSize;
+
+	/*
+	 * Function members
+	 */
+public:
+	MM_VerboseBinaryReader();
+	~MM_VerboseBinaryReader();
+
+	/**
+	 * Open a binary verbose GC file and validate its header.
+	 * @return true on success; on failure getError() describes the problem
+	 */
+	bool open(const char *filename);
+	void close();
+
+	/**
+	 * Read the next record.
+	 * @return the type of the record, RECORD_END_OF_STREAM when the stream is exhausted or
+	 * RECORD_ERROR if it is malformed
+	 */
+	RecordType next(Record *record);
+
+	/**
+	 * Write the remaining records as the XML they were recorded from.
+	 * @return true if the whole stream was converted
+	 */
+	bool writeXML(FILE *output);
+
+	/**
+	 * Convert a binary verbose GC file to the equivalent XML file.
+	 * @param[out] error if non-NULL, receives a description of the failure
+	 * @return true on success
+	 */
+	static bool convertToXML(const char *binaryFilename, const char *xmlFilename, const char **error);
+
+	const char *getError() const { return _error; }
+	uint8_t getMajorVersion() const { return _majorVersion; }
+	uint8_t getMinorVersion() const { return _minorVersion; }
+
+protected:
+private:
+	bool fill();
+	bool readByte(uint8_t *value);
+	bool readVarint(uint64_t *value);
+	bool readBytes(char *buffer, size_t length);
+	bool readFormat();
+	bool readLine(Record *record);
+	bool reserveScratch(size_t size);
+	bool appendConversion(const char *conversion, size_t conversionLength, uint8_t kind, uint64_t value, const char *string);
+	RecordType fail(const char *error);
+
+	/* the reader owns heap buffers and an open file */
+	MM_VerboseBinaryReader(const MM_VerboseBinaryReader &);
+	MM_VerboseBinaryReader &operator=(const MM_VerboseBinaryReader &);
+};
+
+#endif /* VERBOSEBINARYREADER_HPP_ */
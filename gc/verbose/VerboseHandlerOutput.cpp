@@ -31,6 +31,8 @@
 #include "HeapRegionManager.hpp"
 #include "ObjectAllocationInterface.hpp"
 #include "ParallelDispatcher.hpp"
+#include "SparseAddressOrderedFixedSizeDataPool.hpp"
+#include "SparseVirtualMemory.hpp"
 #include "VerboseHandlerOutput.hpp"
 #include "VerboseManager.hpp"
 #include "VerboseWriterChain.hpp"
@@ -65,6 +67,7 @@ MM_VerboseHandlerOutput::MM_VerboseHandlerOutput(MM_GCExtensionsBase *extensions
 	,_mmPrivateHooks(NULL)
 	,_mmOmrHooks(NULL)
 	,_manager(NULL)
+	,_gcEndsSinceHugePageCoverageSample(0)
 {}
 
 bool
@@ -334,6 +337,14 @@ MM_VerboseHandlerOutput::outputInitializedStanza(MM_EnvironmentBase *env, MM_Ver
 	}
 
 	buffer->formatAndOutput(env, 1, "<attribute name=\"packetListSplit\" value=\"%zu\" />", _extensions->packetListSplit);
+	buffer->formatAndOutput(env, 1, "<attribute name=\"packetListLockFree\" value=\"%s\" />", _extensions->packetListLockFree ? "true" : "false");
+	buffer->formatAndOutput(env, 1, "<attribute name=\"heapMapScan\" value=\"%s\" />", MM_HeapMapScan::getImplementationName(_extensions->heapMapScanImplementation));
+	buffer->formatAndOutput(env, 1, "<attribute name=\"freeListSizeClassIndex\" value=\"%s\" />", _extensions->freeListSizeClassIndex ? "true" : "false");
+#if defined(OMR_GC_MODRON_COMPACTION)
+	if (_extensions->incrementalCompact) {
+		buffer->formatAndOutput(env, 1, "<attribute name=\"incrementalCompactMaxLiveBytes\" value=\"%zu\" />", _extensions->incrementalCompactMaxLiveBytes);
+	}
+#endif /* OMR_GC_MODRON_COMPACTION */
 #if defined(OMR_GC_MODRON_SCAVENGER)
 	buffer->formatAndOutput(env, 1, "<attribute name=\"cacheListSplit\" value=\"%zu\" />", _extensions->cacheListSplit);
 #endif /* OMR_GC_MODRON_SCAVENGER */
@@ -826,6 +837,61 @@ MM_VerboseHandlerOutput::outputMemoryInfoInnerStanza(MM_EnvironmentBase *env, ui
 {
 }
 
+void
+MM_VerboseHandlerOutput::outputHugePageCoverage(MM_EnvironmentBase *env, uintptr_t indent)
+{
+	MM_VerboseWriterChain* writer = _manager->getWriterChain();
+	MM_Heap *heap = _extensions->heap;
+	uintptr_t committedMemory = heap->getActiveMemorySize();
+	uint64_t hugePageMemory = 0;
+	/* measuring the coverage reads /proc/self/smaps, which takes as long as the process has mappings, so only sample it now and then */
+	bool sampleCoverage = (0 == _gcEndsSinceHugePageCoverageSample);
+
+	_gcEndsSinceHugePageCoverageSample += 1;
+	if (_gcEndsSinceHugePageCoverageSample >= _extensions->gcCountBetweenHugePageCoverageSample) {
+		_gcEndsSinceHugePageCoverageSample = 0;
+	}
+
+	if (sampleCoverage && heap->getHugePageCoverage(env, &hugePageMemory)) {
+		/* partial huge pages at the edges of committed ranges may be backed too */
+		hugePageMemory = OMR_MIN(hugePageMemory, (uint64_t)committedMemory);
+		writer->formatAndOutput(env, indent, "<hugepages committed=\"%zu\" backed=\"%llu\" percent=\"%zu\" />",
+				committedMemory, hugePageMemory,
+				((committedMemory == 0) ? 0 : ((uintptr_t)((hugePageMemory * 100) / (uint64_t)committedMemory))));
+	} else {
+		writer->formatAndOutput(env, indent, "<hugepages committed=\"%zu\" />", committedMemory);
+	}
+}
+
+void
+MM_VerboseHandlerOutput::outputOffHeapInfo(MM_EnvironmentBase *env, uintptr_t indent)
+{
+	MM_VerboseWriterChain* writer = _manager->getWriterChain();
+	MM_SparseAddressOrderedFixedSizeDataPool *sparseDataPool = _extensions->largeObjectVirtualMemory->getSparseDataPool();
+
+	writer->formatAndOutput(env, indent, "<offheap objects=\"%zu\" committed=\"%zu\" reserved=\"%zu\" />",
+			sparseDataPool->getSparseDataEntryCount(), sparseDataPool->getFreeListPoolAllocBytes(), _extensions->largeObjectVirtualMemory->getReservedSize());
+}
+
+void
+MM_VerboseHandlerOutput::outputTaskThreadsInfo(MM_EnvironmentBase *env, uintptr_t indent, uint64_t startTime)
+{
+	MM_VerboseWriterChain* writer = _manager->getWriterChain();
+	MM_ParallelDispatcher *dispatcher = _extensions->dispatcher;
+
+	for (uintptr_t index = 0; index < PARALLEL_DISPATCHER_TASK_HISTORY_SIZE; index++) {
+		MM_DispatcherTaskHistory *history = dispatcher->getTaskHistory(index);
+		if (NULL == history->taskId) {
+			break;
+		}
+		/* only report the task types dispatched during this increment */
+		if (history->lastDispatchTime >= startTime) {
+			writer->formatAndOutput(env, indent, "<task-threads task=\"%s\" threads=\"%zu\" recommended=\"%zu\" utilization=\"%zu\" stealSuccess=\"%zu\" cpuLimit=\"%zu\" />",
+					history->taskId, history->threads, history->recommendedThreads, history->utilization, history->stealSuccess, history->cpuLimit);
+		}
+	}
+}
+
 void
 MM_VerboseHandlerOutput::printAllocationStats(MM_EnvironmentBase* env)
 {
@@ -851,6 +917,17 @@ MM_VerboseHandlerOutput::printAllocationStats(MM_EnvironmentBase* env)
 		/* for now, not covered the case of specs that do not have TLHs, but have arraylets */
 	}
 
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+	if (!_extensions->isSegregatedHeap()) {
+		if (_extensions->tlhAdaptiveSizing) {
+			writer->formatAndOutput(env, 1, "<tlh-stats refreshes=\"%zu\" wasted=\"%zu\" allocationRate=\"%zu\" refreshSize=\"%zu\" samples=\"%zu\" />",
+					systemStats->tlhRefreshCount(), systemStats->_tlhWastedBytes, systemStats->_tlhAllocationRate, systemStats->_tlhRefreshSize, systemStats->_tlhRateSampleCount);
+		} else {
+			writer->formatAndOutput(env, 1, "<tlh-stats refreshes=\"%zu\" wasted=\"%zu\" />", systemStats->tlhRefreshCount(), systemStats->_tlhWastedBytes);
+		}
+	}
+#endif /* defined(OMR_GC_THREAD_LOCAL_HEAP) */
+
 	if(0 != _extensions->bytesAllocatedMost){
 		const char *dots = "";
 		char escapedThreadName[128];
@@ -929,6 +1006,15 @@ MM_VerboseHandlerOutput::handleGCEnd(J9HookInterface** hook, uintptr_t eventNum,
 	}
 	writer->formatAndOutput(env, 0, "<gc-end %s activeThreads=\"%zu\">", tagTemplate, activeThreads);
 	outputMemoryInfo(env, _manager->getIndentLevel() + 1, stats);
+	if (_extensions->heapTransparentHugePages) {
+		outputHugePageCoverage(env, _manager->getIndentLevel() + 1);
+	}
+	if (NULL != _extensions->largeObjectVirtualMemory) {
+		outputOffHeapInfo(env, _manager->getIndentLevel() + 1);
+	}
+	if (_extensions->dispatcherAdaptiveThreadingEnabled()) {
+		outputTaskThreadsInfo(env, _manager->getIndentLevel() + 1, stats->_startTime);
+	}
 	writer->formatAndOutput(env, 0, "</gc-end>");
 	exitAtomicReportingBlock();
 }
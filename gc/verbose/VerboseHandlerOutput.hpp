@@ -50,6 +50,7 @@ protected:
 	J9HookInterface** _mmPrivateHooks;  /**< Pointers to the internal Hook interface */
 	J9HookInterface** _mmOmrHooks;  /**< Pointers to the internal Hook interface */
 	MM_VerboseManager *_manager; /* VerboseManager used to format and print output */
+	uintptr_t _gcEndsSinceHugePageCoverageSample; /**< gc-end stanzas output since huge page coverage was last sampled */
 public:
 
 private:
@@ -205,6 +206,29 @@ protected:
 
 	virtual void outputMemoryInfoInnerStanza(MM_EnvironmentBase *env, uintptr_t indent, MM_CollectionStatistics *stats);
 
+	/**
+	 * Output a stand-alone stanza on how much of the committed heap is backed by transparent huge pages.
+	 * The backed bytes are only sampled every gcCountBetweenHugePageCoverageSample stanzas.
+	 * @param env GC thread used for output.
+	 * @param indent base level of indentation for the summary.
+	 */
+	void outputHugePageCoverage(MM_EnvironmentBase *env, uintptr_t indent);
+
+	/**
+	 * Output a stand-alone stanza on the large objects whose data is held off-heap, in sparse virtual memory.
+	 * @param env GC thread used for output.
+	 * @param indent base level of indentation for the summary.
+	 */
+	void outputOffHeapInfo(MM_EnvironmentBase *env, uintptr_t indent);
+
+	/**
+	 * Output a stand-alone stanza for each task type the dispatcher sized from its utilization history.
+	 * @param env GC thread used for output.
+	 * @param indent base level of indentation for the summary.
+	 * @param startTime hi-res start time of the increment; task types last dispatched before it are skipped.
+	 */
+	void outputTaskThreadsInfo(MM_EnvironmentBase *env, uintptr_t indent, uint64_t startTime);
+
 	/**
 	 * Output a stand-alone stanza heap resize events.
 	 * @param env GC thread used for output.
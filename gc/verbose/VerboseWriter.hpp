@@ -25,6 +25,7 @@
 
 #include "omrcfg.h"
 #include "modronbase.h"
+#include "omrstdarg.h"
 
 #include "Base.hpp"
 
@@ -35,7 +36,8 @@ typedef enum {
 	VERBOSE_WRITER_FILE_LOGGING_SYNCHRONOUS = 2,
 	VERBOSE_WRITER_FILE_LOGGING_BUFFERED = 3,
 	VERBOSE_WRITER_TRACE = 4,
-	VERBOSE_WRITER_HOOK = 5
+	VERBOSE_WRITER_HOOK = 5,
+	VERBOSE_WRITER_FILE_LOGGING_BINARY = 6
 } WriterType;
 
 /**
@@ -69,6 +71,15 @@ public:
 
 	virtual void outputString(MM_EnvironmentBase *env, const char* string) = 0;
 
+	/**
+	 * Writers that record each line as its format and arguments, rather than as text, return true.
+	 * The writer chain then passes them every line through formatAndOutputV() and calls flush()
+	 * at the end of each stanza; outputString() only receives text that bypassed the chain.
+	 */
+	virtual bool recordsFormats() { return false; }
+	virtual void formatAndOutputV(MM_EnvironmentBase *env, uintptr_t indent, const char *format, va_list args) {}
+	virtual void flush(MM_EnvironmentBase *env) {}
+
 	virtual bool reconfigure(MM_EnvironmentBase *env, const char *filename, uintptr_t fileCount, uintptr_t iterations) = 0;
 
 	virtual void endOfCycle(MM_EnvironmentBase *env) = 0;
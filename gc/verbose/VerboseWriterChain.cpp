@@ -35,6 +35,7 @@
 MM_VerboseWriterChain::MM_VerboseWriterChain()
 	: MM_Base()
 	,_buffer(NULL)
+	,_formattedSize(0)
 	,_writers(NULL)
 {}
 
@@ -58,10 +59,27 @@ void
 MM_VerboseWriterChain::formatAndOutput(MM_EnvironmentBase *env, uintptr_t indent, const char *format, ...)
 {
 	va_list args;
+	bool formatText = false;
 
-	va_start(args, format);
-	_buffer->formatAndOutputV(env, indent, format, args);
-	va_end(args);
+	MM_VerboseWriter* writer = _writers;
+	while (NULL != writer) {
+		if (writer->recordsFormats()) {
+			va_start(args, format);
+			writer->formatAndOutputV(env, indent, format, args);
+			va_end(args);
+		} else {
+			formatText = true;
+		}
+		writer = writer->getNextWriter();
+	}
+
+	/* only format the text if some writer needs it */
+	if (formatText) {
+		va_start(args, format);
+		_buffer->formatAndOutputV(env, indent, format, args);
+		va_end(args);
+		_formattedSize = _buffer->currentSize();
+	}
 }
 
 void
@@ -69,10 +87,20 @@ MM_VerboseWriterChain::flush(MM_EnvironmentBase *env)
 {
 	MM_VerboseWriter* writer = _writers;
 	while (NULL != writer) {
-		writer->outputString(env, _buffer->contents());
+		if (writer->recordsFormats()) {
+			/* text added to the buffer directly has not been seen by this writer yet */
+			const char *text = _buffer->contents() + _formattedSize;
+			if ('\0' != *text) {
+				writer->outputString(env, text);
+			}
+			writer->flush(env);
+		} else {
+			writer->outputString(env, _buffer->contents());
+		}
 		writer = writer->getNextWriter();
 	}
 	_buffer->reset();
+	_formattedSize = 0;
 }
 
 void
@@ -44,6 +44,7 @@ public:
 protected:
 private:
 	MM_VerboseBuffer *_buffer;
+	uintptr_t _formattedSize; /**< bytes of _buffer that were also passed to writers that record formats */
 	MM_VerboseWriter *_writers;
 
 public:
@@ -51,6 +52,10 @@ public:
 
 	void kill(MM_EnvironmentBase *env);
 
+	/**
+	 * Output one line.  Writers that record formats keep the format by address, so it must
+	 * be a string literal; pass any text built at run time as a "%s" argument.
+	 */
 	void formatAndOutput(MM_EnvironmentBase *env, uintptr_t indent, const char *format, ...);
 	void flush(MM_EnvironmentBase *env);
 
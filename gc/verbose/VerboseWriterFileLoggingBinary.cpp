@@ -0,0 +1,666 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "modronapicore.hpp"
+#include "VerboseWriterFileLoggingBinary.hpp"
+
+#include "AtomicOperations.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "VerboseBinaryFormat.hpp"
+#include "VerboseManager.hpp"
+
+#include <string.h>
+
+#include "VerboseBuffer.hpp"
+#include "VerboseHandlerOutput.hpp"
+
+MM_VerboseWriterFileLoggingBinary::MM_VerboseWriterFileLoggingBinary(MM_EnvironmentBase *env, MM_VerboseManager *manager)
+	:MM_VerboseWriterFileLogging(env, manager, VERBOSE_WRITER_FILE_LOGGING_BINARY)
+	,_logFileDescriptor(-1)
+	,_monitor(NULL)
+	,_block(NULL)
+	,_blockReserved(VERBOSEGC_BINARY_BLOCK_CLOSED)
+	,_blockCommitted(0)
+	,_threadBufferKey(0)
+	,_threadBufferKeyAllocated(false)
+	,_threadBuffers(NULL)
+	,_formatKeys(NULL)
+	,_formatIds(NULL)
+	,_formatKeyCount(0)
+	,_formats(NULL)
+	,_formatArguments(NULL)
+	,_formatArgumentCounts(NULL)
+	,_formatCount(0)
+{
+	/* No implementation */
+}
+
+/**
+ * Create a new MM_VerboseWriterFileLoggingBinary instance.
+ * @return Pointer to the new MM_VerboseWriterFileLoggingBinary.
+ */
+MM_VerboseWriterFileLoggingBinary *
+MM_VerboseWriterFileLoggingBinary::newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager, char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+
+	MM_VerboseWriterFileLoggingBinary *agent = (MM_VerboseWriterFileLoggingBinary *)extensions->getForge()->allocate(sizeof(MM_VerboseWriterFileLoggingBinary), OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if(agent) {
+		new(agent) MM_VerboseWriterFileLoggingBinary(env, manager);
+		if(!agent->initialize(env, filename, numFiles, numCycles)) {
+			agent->kill(env);
+			agent = NULL;
+		}
+	}
+	return agent;
+}
+
+/**
+ * Initializes the MM_VerboseWriterFileLoggingBinary instance.
+ * Allocates the block, the format table and the thread buffer key before the first file is opened.
+ * @return true on success, false otherwise
+ */
+bool
+MM_VerboseWriterFileLoggingBinary::initialize(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	OMR::GC::Forge *forge = env->getExtensions()->getForge();
+
+	if (NULL == _block) {
+		_block = (uint8_t *)forge->allocate(VERBOSEGC_BINARY_BLOCK_SIZE, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+		_formatKeys = (const char * volatile *)forge->allocate(VERBOSEGC_BINARY_FORMAT_SLOTS * sizeof(const char *), OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+		_formatIds = (uint32_t *)forge->allocate(VERBOSEGC_BINARY_FORMAT_SLOTS * sizeof(uint32_t), OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+		_formats = (const char **)forge->allocate(VERBOSEGC_BINARY_MAXIMUM_FORMATS * sizeof(const char *), OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+		_formatArguments = (uint8_t (*)[VERBOSEGC_BINARY_MAXIMUM_ARGUMENTS])forge->allocate(VERBOSEGC_BINARY_MAXIMUM_FORMATS * VERBOSEGC_BINARY_MAXIMUM_ARGUMENTS, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+		_formatArgumentCounts = (uint8_t *)forge->allocate(VERBOSEGC_BINARY_MAXIMUM_FORMATS, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+		if ((NULL == _block) || (NULL == _formatKeys) || (NULL == _formatIds) || (NULL == _formats) || (NULL == _formatArguments) || (NULL == _formatArgumentCounts)) {
+			return false;
+		}
+		memset((void *)_formatKeys, 0, VERBOSEGC_BINARY_FORMAT_SLOTS * sizeof(const char *));
+
+		if (0 != omrthread_monitor_init_with_name(&_monitor, 0, "MM_VerboseWriterFileLoggingBinary")) {
+			return false;
+		}
+		if (0 != omrthread_tls_alloc(&_threadBufferKey)) {
+			return false;
+		}
+		_threadBufferKeyAllocated = true;
+	}
+
+	return MM_VerboseWriterFileLogging::initialize(env, filename, numFiles, numCycles);
+}
+
+/**
+ * Tear down the structures managed by the MM_VerboseWriterFileLoggingBinary.
+ * Writes out the committed records and frees the block, the format table and every thread buffer.
+ */
+void
+MM_VerboseWriterFileLoggingBinary::tearDown(MM_EnvironmentBase *env)
+{
+	OMR::GC::Forge *forge = env->getExtensions()->getForge();
+
+	if (NULL != _monitor) {
+		closeFile(env);
+		omrthread_monitor_destroy(_monitor);
+		_monitor = NULL;
+	}
+
+	while (NULL != _threadBuffers) {
+		ThreadBuffer *next = _threadBuffers->next;
+		forge->free(_threadBuffers);
+		_threadBuffers = next;
+	}
+	if (_threadBufferKeyAllocated) {
+		omrthread_tls_free(_threadBufferKey);
+		_threadBufferKeyAllocated = false;
+	}
+
+	forge->free(_block);
+	_block = NULL;
+	forge->free((void *)_formatKeys);
+	_formatKeys = NULL;
+	forge->free(_formatIds);
+	_formatIds = NULL;
+	forge->free(_formats);
+	_formats = NULL;
+	forge->free(_formatArguments);
+	_formatArguments = NULL;
+	forge->free(_formatArgumentCounts);
+	_formatArgumentCounts = NULL;
+
+	MM_VerboseWriterFileLogging::tearDown(env);
+}
+
+/**
+ * Opens the file to log output to and writes the file header, the XML header and every format
+ * defined so far, so rotated files can be read independently.
+ * @return true on sucess, false otherwise
+ */
+bool
+MM_VerboseWriterFileLoggingBinary::openFile(MM_EnvironmentBase *env, bool printInitializedHeader)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_GCExtensionsBase* extensions = env->getExtensions();
+	const char* version = omrgc_get_version(env->getOmrVM());
+
+	char *filenameToOpen = expandFilename(env, _currentFile);
+	if (NULL == filenameToOpen) {
+		return false;
+	}
+
+	omrthread_monitor_enter(_monitor);
+
+	_logFileDescriptor = omrfile_open(filenameToOpen, EsOpenRead | EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+	if(-1 == _logFileDescriptor) {
+		char *cursor = filenameToOpen;
+		/**
+		 * This may have failed due to directories in the path not being available.
+		 * Try to create these directories and attempt to open again before failing.
+		 */
+		while ( (cursor = strchr(++cursor, DIR_SEPARATOR)) != NULL ) {
+			*cursor = '\0';
+			omrfile_mkdir(filenameToOpen);
+			*cursor = DIR_SEPARATOR;
+		}
+
+		/* Try again */
+		_logFileDescriptor = omrfile_open(filenameToOpen, EsOpenRead | EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+		if (-1 == _logFileDescriptor) {
+			omrthread_monitor_exit(_monitor);
+			_manager->handleFileOpenError(env, filenameToOpen);
+			extensions->getForge()->free(filenameToOpen);
+			return false;
+		}
+	}
+
+	extensions->getForge()->free(filenameToOpen);
+
+	/* the block is closed while there is no file, so it can be filled without reserving space */
+	memcpy(_block, VERBOSEGC_BINARY_MAGIC, VERBOSEGC_BINARY_MAGIC_LENGTH);
+	_block[VERBOSEGC_BINARY_MAGIC_LENGTH] = VERBOSEGC_BINARY_VERSION_MAJOR;
+	_block[VERBOSEGC_BINARY_MAGIC_LENGTH + 1] = VERBOSEGC_BINARY_VERSION_MINOR;
+	_block[VERBOSEGC_BINARY_MAGIC_LENGTH + 2] = (uint8_t)sizeof(uintptr_t);
+	uintptr_t used = VERBOSEGC_BINARY_HEADER_LENGTH;
+
+	uintptr_t headerLength = omrstr_printf(NULL, 0, getHeader(env), version);
+	char *header = (char *)extensions->getForge()->allocate(headerLength, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if (NULL != header) {
+		omrstr_printf(header, headerLength, getHeader(env), version);
+		used = appendTextToClosedBlock(env, used, header);
+		extensions->getForge()->free(header);
+	}
+
+	for (uintptr_t id = 0; id < _formatCount; id++) {
+		uint8_t record[1 + 10 + 10 + VERBOSEGC_BINARY_MAXIMUM_FORMAT_LENGTH];
+		uintptr_t length = strlen(_formats[id]);
+		uint8_t *cursor = record;
+		*cursor++ = VERBOSEGC_BINARY_RECORD_FORMAT;
+		cursor = writeVarint(cursor, id);
+		cursor = writeVarint(cursor, length);
+		memcpy(cursor, _formats[id], length);
+		used = appendToClosedBlock(env, used, record, (cursor + length) - record);
+	}
+
+	/* Print an Initialized Stanza in new file */
+	if (printInitializedHeader) {
+		MM_VerboseBuffer* buffer = MM_VerboseBuffer::newInstance(env, INITIAL_BUFFER_SIZE);
+		if (NULL != buffer) {
+			_manager->getVerboseHandlerOutput()->outputInitializedStanza(env, buffer);
+			used = appendTextToClosedBlock(env, used, buffer->contents());
+			buffer->kill(env);
+		}
+	}
+
+	openBlock(used);
+	omrthread_monitor_exit(_monitor);
+
+	return true;
+}
+
+/**
+ * Writes out the committed records and the footer and closes the file being logged to.
+ * The block stays closed until the next file is opened.
+ */
+void
+MM_VerboseWriterFileLoggingBinary::closeFile(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	omrthread_monitor_enter(_monitor);
+	if(-1 != _logFileDescriptor) {
+		if (_threadBufferKeyAllocated) {
+			ThreadBuffer *buffer = (ThreadBuffer *)omrthread_tls_get(omrthread_self(), _threadBufferKey);
+			if (NULL != buffer) {
+				commitThreadBuffer(env, buffer);
+			}
+		}
+		writeBlock(env);
+		uintptr_t used = appendTextToClosedBlock(env, 0, getFooter(env));
+		used = appendTextToClosedBlock(env, used, "\n");
+		omrfile_write(_logFileDescriptor, _block, used);
+		omrfile_close(_logFileDescriptor);
+		_logFileDescriptor = -1;
+	}
+	omrthread_monitor_exit(_monitor);
+}
+
+/**
+ * Records text that did not come through formatAndOutputV(), such as the initialized stanza.
+ */
+void
+MM_VerboseWriterFileLoggingBinary::outputString(MM_EnvironmentBase *env, const char* string)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	if(-1 == _logFileDescriptor) {
+		/**
+		 * Under normal circumstances, new file should be opened during endOfCycle call.
+		 * This path works as one backup, in case we failed to open the file,  we’ll attempt to open it again before outputting the string.
+		 */
+		omrthread_monitor_enter(_monitor);
+		if(-1 == _logFileDescriptor) {
+			openFile(env);
+		}
+		omrthread_monitor_exit(_monitor);
+	}
+
+	ThreadBuffer *buffer = getThreadBuffer(env);
+	if((-1 != _logFileDescriptor) && (NULL != buffer)) {
+		encodeText(env, buffer, string, strlen(string));
+	} else {
+		omrfile_write_text(OMRPORT_TTY_ERR, string, strlen(string));
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::formatAndOutputV(MM_EnvironmentBase *env, uintptr_t indent, const char *format, va_list args)
+{
+	ThreadBuffer *buffer = getThreadBuffer(env);
+	if (NULL == buffer) {
+		return;
+	}
+
+	intptr_t id = lookupFormat(env, format);
+	if (0 > id) {
+		OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+		OMR::GC::Forge *forge = env->getExtensions()->getForge();
+		va_list argsCopy;
+
+		COPY_VA_LIST(argsCopy, args);
+		uintptr_t length = omrstr_vprintf(NULL, 0, format, argsCopy);
+		va_end(argsCopy);
+		uintptr_t indentLength = 2 * indent;
+		char *line = (char *)forge->allocate(indentLength + length + 1, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+		if (NULL != line) {
+			memset(line, ' ', indentLength);
+			omrstr_vprintf(line + indentLength, length, format, args);
+			line[indentLength + length - 1] = '\n';
+			encodeText(env, buffer, line, indentLength + length);
+			forge->free(line);
+		}
+		return;
+	}
+
+	const uint8_t *kinds = _formatArguments[id];
+	uintptr_t count = _formatArgumentCounts[id];
+	uint64_t values[VERBOSEGC_BINARY_MAXIMUM_ARGUMENTS];
+	const char *strings[VERBOSEGC_BINARY_MAXIMUM_ARGUMENTS];
+	uintptr_t size = 1 + 10 + 10;
+
+	for (uintptr_t i = 0; i < count; i++) {
+		switch (kinds[i]) {
+		case VERBOSEGC_BINARY_ARGUMENT_INT:
+			values[i] = zigzag(va_arg(args, int));
+			break;
+		case VERBOSEGC_BINARY_ARGUMENT_UNSIGNED_INT:
+			values[i] = va_arg(args, unsigned int);
+			break;
+		case VERBOSEGC_BINARY_ARGUMENT_LONG:
+			values[i] = zigzag(va_arg(args, long));
+			break;
+		case VERBOSEGC_BINARY_ARGUMENT_UNSIGNED_LONG:
+			values[i] = va_arg(args, unsigned long);
+			break;
+		case VERBOSEGC_BINARY_ARGUMENT_LONG_LONG:
+			values[i] = zigzag(va_arg(args, long long));
+			break;
+		case VERBOSEGC_BINARY_ARGUMENT_UNSIGNED_LONG_LONG:
+			values[i] = va_arg(args, unsigned long long);
+			break;
+		case VERBOSEGC_BINARY_ARGUMENT_SIZE:
+			values[i] = zigzag(va_arg(args, intptr_t));
+			break;
+		case VERBOSEGC_BINARY_ARGUMENT_UNSIGNED_SIZE:
+			values[i] = va_arg(args, size_t);
+			break;
+		case VERBOSEGC_BINARY_ARGUMENT_POINTER:
+			values[i] = (uintptr_t)va_arg(args, void *);
+			break;
+		default:
+			strings[i] = va_arg(args, const char *);
+			if (NULL == strings[i]) {
+				strings[i] = "";
+			}
+			values[i] = strlen(strings[i]);
+			size += values[i];
+			break;
+		}
+		size += 10;
+	}
+
+	/* a line is never split, so one too large for the thread buffer is committed on its own */
+	uint8_t *record = NULL;
+	if (VERBOSEGC_BINARY_THREAD_BUFFER_SIZE < size) {
+		record = (uint8_t *)env->getExtensions()->getForge()->allocate(size, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+		if (NULL == record) {
+			return;
+		}
+	} else {
+		if ((VERBOSEGC_BINARY_THREAD_BUFFER_SIZE - buffer->used) < size) {
+			commitThreadBuffer(env, buffer);
+		}
+		record = buffer->data + buffer->used;
+	}
+
+	uint8_t *cursor = record;
+	*cursor++ = VERBOSEGC_BINARY_RECORD_LINE;
+	cursor = writeVarint(cursor, (uint64_t)id);
+	cursor = writeVarint(cursor, indent);
+	for (uintptr_t i = 0; i < count; i++) {
+		cursor = writeVarint(cursor, values[i]);
+		if (VERBOSEGC_BINARY_ARGUMENT_STRING == kinds[i]) {
+			memcpy(cursor, strings[i], (uintptr_t)values[i]);
+			cursor += values[i];
+		}
+	}
+
+	if (VERBOSEGC_BINARY_THREAD_BUFFER_SIZE < size) {
+		commitThreadBuffer(env, buffer);
+		commit(env, record, cursor - record);
+		env->getExtensions()->getForge()->free(record);
+	} else {
+		buffer->used += cursor - record;
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::flush(MM_EnvironmentBase *env)
+{
+	ThreadBuffer *buffer = getThreadBuffer(env);
+	if (NULL != buffer) {
+		commitThreadBuffer(env, buffer);
+	}
+}
+
+/**
+ * Writes out the records committed during the cycle, then cycles the output files if necessary.
+ */
+void
+MM_VerboseWriterFileLoggingBinary::endOfCycle(MM_EnvironmentBase *env)
+{
+	omrthread_monitor_enter(_monitor);
+	if (-1 != _logFileDescriptor) {
+		writeBlock(env);
+		openBlock(0);
+	}
+	MM_VerboseWriterFileLogging::endOfCycle(env);
+	omrthread_monitor_exit(_monitor);
+}
+
+MM_VerboseWriterFileLoggingBinary::ThreadBuffer *
+MM_VerboseWriterFileLoggingBinary::getThreadBuffer(MM_EnvironmentBase *env)
+{
+	omrthread_t self = omrthread_self();
+	ThreadBuffer *buffer = (ThreadBuffer *)omrthread_tls_get(self, _threadBufferKey);
+	if (NULL == buffer) {
+		buffer = (ThreadBuffer *)env->getExtensions()->getForge()->allocate(sizeof(ThreadBuffer), OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+		if (NULL != buffer) {
+			buffer->used = 0;
+			omrthread_monitor_enter(_monitor);
+			buffer->next = _threadBuffers;
+			_threadBuffers = buffer;
+			omrthread_monitor_exit(_monitor);
+			omrthread_tls_set(self, _threadBufferKey, buffer);
+		}
+	}
+	return buffer;
+}
+
+intptr_t
+MM_VerboseWriterFileLoggingBinary::lookupFormat(MM_EnvironmentBase *env, const char *format)
+{
+	/* formats are string literals, so their address identifies them */
+	uintptr_t slot = (((uintptr_t)format >> 3) * 2654435761U) & (VERBOSEGC_BINARY_FORMAT_SLOTS - 1);
+	while (true) {
+		const char *key = _formatKeys[slot];
+		if (format == key) {
+			MM_AtomicOperations::readBarrier();
+			uint32_t id = _formatIds[slot];
+			return (VERBOSEGC_BINARY_FORMAT_AS_TEXT == id) ? -1 : (intptr_t)id;
+		}
+		if (NULL == key) {
+			return defineFormat(env, format, slot);
+		}
+		slot = (slot + 1) & (VERBOSEGC_BINARY_FORMAT_SLOTS - 1);
+	}
+}
+
+intptr_t
+MM_VerboseWriterFileLoggingBinary::defineFormat(MM_EnvironmentBase *env, const char *format, uintptr_t slot)
+{
+	intptr_t result = -1;
+
+	omrthread_monitor_enter(_monitor);
+
+	/* another thread may have claimed the slot or defined the format since it was probed */
+	while (NULL != _formatKeys[slot]) {
+		if (format == _formatKeys[slot]) {
+			uint32_t id = _formatIds[slot];
+			omrthread_monitor_exit(_monitor);
+			return (VERBOSEGC_BINARY_FORMAT_AS_TEXT == id) ? -1 : (intptr_t)id;
+		}
+		slot = (slot + 1) & (VERBOSEGC_BINARY_FORMAT_SLOTS - 1);
+	}
+
+	if (VERBOSEGC_BINARY_MAXIMUM_FORMATS > _formatKeyCount) {
+		uint32_t id = VERBOSEGC_BINARY_FORMAT_AS_TEXT;
+		uintptr_t length = strlen(format);
+		if (VERBOSEGC_BINARY_MAXIMUM_FORMAT_LENGTH >= length) {
+			uint8_t *kinds = _formatArguments[_formatCount];
+			uintptr_t count = 0;
+			const char *cursor = strchr(format, '%');
+			while (NULL != cursor) {
+				uint8_t kind = VERBOSEGC_BINARY_ARGUMENT_NONE;
+				cursor = verboseBinaryParseConversion(cursor, &kind);
+				if ((VERBOSEGC_BINARY_ARGUMENT_UNSUPPORTED == kind) || (VERBOSEGC_BINARY_MAXIMUM_ARGUMENTS == count)) {
+					count = VERBOSEGC_BINARY_MAXIMUM_ARGUMENTS + 1;
+					break;
+				}
+				if (VERBOSEGC_BINARY_ARGUMENT_NONE != kind) {
+					kinds[count] = kind;
+					count += 1;
+				}
+				cursor = strchr(cursor, '%');
+			}
+
+			if (VERBOSEGC_BINARY_MAXIMUM_ARGUMENTS >= count) {
+				id = (uint32_t)_formatCount;
+				_formats[id] = format;
+				_formatArgumentCounts[id] = (uint8_t)count;
+				_formatCount += 1;
+				result = id;
+
+				/* the definition reaches the block before any line that uses it */
+				uint8_t record[1 + 10 + 10 + VERBOSEGC_BINARY_MAXIMUM_FORMAT_LENGTH];
+				uint8_t *out = record;
+				*out++ = VERBOSEGC_BINARY_RECORD_FORMAT;
+				out = writeVarint(out, id);
+				out = writeVarint(out, length);
+				memcpy(out, format, length);
+				commit(env, record, (out + length) - record);
+			}
+		}
+
+		_formatIds[slot] = id;
+		_formatKeyCount += 1;
+		MM_AtomicOperations::writeBarrier();
+		_formatKeys[slot] = format;
+	}
+
+	omrthread_monitor_exit(_monitor);
+
+	return result;
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::encodeText(MM_EnvironmentBase *env, ThreadBuffer *buffer, const char *text, uintptr_t length)
+{
+	while (0 < length) {
+		uintptr_t chunk = OMR_MIN(length, VERBOSEGC_BINARY_THREAD_BUFFER_SIZE - 16);
+		if ((VERBOSEGC_BINARY_THREAD_BUFFER_SIZE - buffer->used) < (chunk + 16)) {
+			commitThreadBuffer(env, buffer);
+		}
+		uint8_t *out = buffer->data + buffer->used;
+		*out++ = VERBOSEGC_BINARY_RECORD_TEXT;
+		out = writeVarint(out, chunk);
+		memcpy(out, text, chunk);
+		buffer->used = (out + chunk) - buffer->data;
+		text += chunk;
+		length -= chunk;
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::commitThreadBuffer(MM_EnvironmentBase *env, ThreadBuffer *buffer)
+{
+	if (0 < buffer->used) {
+		commit(env, buffer->data, buffer->used);
+		buffer->used = 0;
+	}
+}
+
+bool
+MM_VerboseWriterFileLoggingBinary::tryCommit(const uint8_t *records, uintptr_t size)
+{
+	/* a closed block is larger than the block size, so no space can be reserved in it */
+	uintptr_t reserved = _blockReserved;
+	while ((reserved + size) <= VERBOSEGC_BINARY_BLOCK_SIZE) {
+		uintptr_t seen = MM_AtomicOperations::lockCompareExchange(&_blockReserved, reserved, reserved + size);
+		if (seen == reserved) {
+			memcpy(_block + reserved, records, size);
+			MM_AtomicOperations::add(&_blockCommitted, size);
+			return true;
+		}
+		reserved = seen;
+	}
+	return false;
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::commit(MM_EnvironmentBase *env, const uint8_t *records, uintptr_t size)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	if (tryCommit(records, size)) {
+		return;
+	}
+
+	omrthread_monitor_enter(_monitor);
+	if (-1 == _logFileDescriptor) {
+		/* see outputString() */
+		openFile(env);
+	}
+	if ((-1 != _logFileDescriptor) && !tryCommit(records, size)) {
+		writeBlock(env);
+		if (VERBOSEGC_BINARY_BLOCK_SIZE < size) {
+			omrfile_write(_logFileDescriptor, records, size);
+			openBlock(0);
+		} else {
+			memcpy(_block, records, size);
+			openBlock(size);
+		}
+	}
+	omrthread_monitor_exit(_monitor);
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::writeBlock(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	uintptr_t reserved = _blockReserved;
+	while (VERBOSEGC_BINARY_BLOCK_CLOSED != reserved) {
+		uintptr_t seen = MM_AtomicOperations::lockCompareExchange(&_blockReserved, reserved, VERBOSEGC_BINARY_BLOCK_CLOSED);
+		if (seen == reserved) {
+			/* wait for the threads still copying into their reserved space */
+			while (reserved != _blockCommitted) {
+				omrthread_yield();
+			}
+			MM_AtomicOperations::readBarrier();
+			if ((0 < reserved) && (-1 != _logFileDescriptor)) {
+				omrfile_write(_logFileDescriptor, _block, reserved);
+			}
+			_blockCommitted = 0;
+			break;
+		}
+		reserved = seen;
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::openBlock(uintptr_t used)
+{
+	_blockCommitted = used;
+	MM_AtomicOperations::writeBarrier();
+	_blockReserved = used;
+}
+
+uintptr_t
+MM_VerboseWriterFileLoggingBinary::appendToClosedBlock(MM_EnvironmentBase *env, uintptr_t used, const uint8_t *records, uintptr_t size)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	if ((VERBOSEGC_BINARY_BLOCK_SIZE - used) < size) {
+		omrfile_write(_logFileDescriptor, _block, used);
+		used = 0;
+	}
+	memcpy(_block + used, records, size);
+	return used + size;
+}
+
+uintptr_t
+MM_VerboseWriterFileLoggingBinary::appendTextToClosedBlock(MM_EnvironmentBase *env, uintptr_t used, const char *text)
+{
+	uintptr_t length = strlen(text);
+	while (0 < length) {
+		uint8_t record[1 + 10 + 1024];
+		uintptr_t chunk = OMR_MIN(length, 1024);
+		uint8_t *out = record;
+		*out++ = VERBOSEGC_BINARY_RECORD_TEXT;
+		out = writeVarint(out, chunk);
+		memcpy(out, text, chunk);
+		used = appendToClosedBlock(env, used, record, (out + chunk) - record);
+		text += chunk;
+		length -= chunk;
+	}
+	return used;
+}
@@ -0,0 +1,174 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(VERBOSEWRITERFILELOGGINGBINARY_HPP_)
+#define VERBOSEWRITERFILELOGGINGBINARY_HPP_
+
+#include "omrcfg.h"
+#include "omrstdarg.h"
+#include "omrthread.h"
+
+#include "VerboseBinaryFormat.hpp"
+#include "VerboseWriterFileLogging.hpp"
+
+#define VERBOSEGC_BINARY_BLOCK_SIZE (64 * 1024)
+#define VERBOSEGC_BINARY_THREAD_BUFFER_SIZE (8 * 1024)
+#define VERBOSEGC_BINARY_FORMAT_SLOTS 1024
+#define VERBOSEGC_BINARY_MAXIMUM_FORMATS 768
+#define VERBOSEGC_BINARY_MAXIMUM_FORMAT_LENGTH 1024
+#define VERBOSEGC_BINARY_BLOCK_CLOSED (VERBOSEGC_BINARY_BLOCK_SIZE + 1)
+#define VERBOSEGC_BINARY_FORMAT_AS_TEXT 0xFFFFFFFF
+
+/**
+ * Output agent which directs verbosegc output to file as the compact binary record stream
+ * described in VerboseBinaryFormat.hpp.
+ *
+ * The writer chain passes each line to formatAndOutputV() as its format and arguments.  The
+ * line is encoded into a buffer owned by the calling thread without taking a lock; no text is
+ * formatted.  When the stanza is flushed the thread's records are copied into the shared block
+ * at an offset reserved with a compare and swap, and the block is written to the file once per
+ * cycle or when it fills.  Only filling the block, defining a new format and rotating files
+ * take the writer's monitor.
+ * Use MM_VerboseBinaryReader to read the stream back or convert it to XML.
+ */
+class MM_VerboseWriterFileLoggingBinary : public MM_VerboseWriterFileLogging
+{
+	/*
+	 * Data members
+	 */
+public:
+protected:
+private:
+	/**
+	 * Records encoded by one thread that have not been copied into the shared block yet.
+	 */
+	struct ThreadBuffer {
+		ThreadBuffer *next; /**< next buffer owned by this writer */
+		uintptr_t used; /**< bytes of data holding records */
+		uint8_t data[VERBOSEGC_BINARY_THREAD_BUFFER_SIZE];
+	};
+
+	intptr_t _logFileDescriptor; /**< the file being written to */
+	omrthread_monitor_t _monitor; /**< serializes writing the block, defining formats and opening files */
+
+	uint8_t *_block; /**< records committed by all threads, in file order */
+	volatile uintptr_t _blockReserved; /**< bytes of _block handed out to committing threads, or VERBOSEGC_BINARY_BLOCK_CLOSED */
+	volatile uintptr_t _blockCommitted; /**< bytes of _block copied in by committing threads */
+
+	omrthread_tls_key_t _threadBufferKey; /**< the ThreadBuffer of each thread */
+	bool _threadBufferKeyAllocated;
+	ThreadBuffer *_threadBuffers; /**< every ThreadBuffer allocated, so they can be freed */
+
+	const char * volatile *_formatKeys; /**< open addressed table of format strings seen, by address */
+	uint32_t *_formatIds; /**< id of the format in the same slot of _formatKeys, or VERBOSEGC_BINARY_FORMAT_AS_TEXT */
+	uintptr_t _formatKeyCount; /**< number of slots of _formatKeys in use */
+	const char **_formats; /**< format of each id */
+	uint8_t (*_formatArguments)[VERBOSEGC_BINARY_MAXIMUM_ARGUMENTS]; /**< argument kinds of each id */
+	uint8_t *_formatArgumentCounts; /**< number of arguments of each id */
+	uintptr_t _formatCount; /**< number of formats defined */
+
+	/*
+	 * Function members
+	 */
+public:
+	static MM_VerboseWriterFileLoggingBinary *newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager, char* filename, uintptr_t fileCount, uintptr_t iterations);
+
+	virtual bool recordsFormats() { return true; }
+
+	virtual void formatAndOutputV(MM_EnvironmentBase *env, uintptr_t indent, const char *format, va_list args);
+
+	virtual void flush(MM_EnvironmentBase *env);
+
+	virtual void outputString(MM_EnvironmentBase *env, const char* string);
+
+	virtual void endOfCycle(MM_EnvironmentBase *env);
+
+protected:
+	MM_VerboseWriterFileLoggingBinary(MM_EnvironmentBase *env, MM_VerboseManager *manager);
+
+	virtual bool initialize(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles);
+
+private:
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+	bool openFile(MM_EnvironmentBase *env, bool printInitializedHeader = false);
+	void closeFile(MM_EnvironmentBase *env);
+
+	/**
+	 * Return the ThreadBuffer of the calling thread, allocating it on first use.
+	 * @return the buffer, or NULL if it could not be allocated
+	 */
+	ThreadBuffer *getThreadBuffer(MM_EnvironmentBase *env);
+
+	/**
+	 * Return the id of format, defining it in the stream the first time it is seen.
+	 * @return the id, or -1 if lines of this format must be recorded as text
+	 */
+	intptr_t lookupFormat(MM_EnvironmentBase *env, const char *format);
+	intptr_t defineFormat(MM_EnvironmentBase *env, const char *format, uintptr_t slot);
+
+	/**
+	 * Encode text as TEXT records in the calling thread's buffer.
+	 */
+	void encodeText(MM_EnvironmentBase *env, ThreadBuffer *buffer, const char *text, uintptr_t length);
+
+	/**
+	 * Copy size bytes of records into the shared block.  Records from one call are never
+	 * interleaved with records from another.  Records are dropped if no file can be opened.
+	 */
+	void commit(MM_EnvironmentBase *env, const uint8_t *records, uintptr_t size);
+	bool tryCommit(const uint8_t *records, uintptr_t size);
+	void commitThreadBuffer(MM_EnvironmentBase *env, ThreadBuffer *buffer);
+
+	/**
+	 * Close the block and write it to the file once every thread that reserved space in it has
+	 * copied its records.  The caller must own _monitor and reopen the block with openBlock().
+	 */
+	void writeBlock(MM_EnvironmentBase *env);
+	void openBlock(uintptr_t used);
+
+	/**
+	 * Append records to the closed block, writing it out as it fills.  The caller must own _monitor.
+	 * @return the bytes of the block in use
+	 */
+	uintptr_t appendToClosedBlock(MM_EnvironmentBase *env, uintptr_t used, const uint8_t *records, uintptr_t size);
+	uintptr_t appendTextToClosedBlock(MM_EnvironmentBase *env, uintptr_t used, const char *text);
+
+	MMINLINE static uint8_t *
+	writeVarint(uint8_t *cursor, uint64_t value)
+	{
+		while (value >= 0x80) {
+			*cursor++ = (uint8_t)(value | 0x80);
+			value >>= 7;
+		}
+		*cursor++ = (uint8_t)value;
+		return cursor;
+	}
+
+	MMINLINE static uint64_t
+	zigzag(int64_t value)
+	{
+		return ((uint64_t)value << 1) ^ (uint64_t)(value >> 63);
+	}
+};
+
+#endif /* VERBOSEWRITERFILELOGGINGBINARY_HPP_ */
@@ -30,6 +30,8 @@
 #include "CycleState.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
+#include "Heap.hpp"
+#include "HeapResizePredictor.hpp"
 #include "VerboseHandlerOutputStandard.hpp"
 #include "VerboseManager.hpp"
 #include "VerboseWriterChain.hpp"
@@ -74,6 +76,10 @@ static void verboseHandlerConcurrentCollectionStart(J9HookInterface** hook, uint
 static void verboseHandlerConcurrentAborted(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
 
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+static void verboseHandlerCompletedConcurrentSweep(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+#endif /* defined(OMR_GC_CONCURRENT_SWEEP) */
+
 MM_VerboseHandlerOutput *
 MM_VerboseHandlerOutputStandard::newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager)
 {
@@ -155,6 +161,9 @@ MM_VerboseHandlerOutputStandard::enableVerbose()
 	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_COMPLETE_TRACING_END, verboseHandlerConcurrentTracingEnd, OMR_GET_CALLSITE(), (void *)this);
 	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_COLLECTION_CARD_CLEANING_END, verboseHandlerConcurrentCardCleaningEnd, OMR_GET_CALLSITE(), (void *)this);
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_COMPLETED_CONCURRENT_SWEEP, verboseHandlerCompletedConcurrentSweep, OMR_GET_CALLSITE(), (void *)this);
+#endif /* defined(OMR_GC_CONCURRENT_SWEEP) */
 
 	/* Excessive GC */
 	(*_mmOmrHooks)->J9HookRegisterWithCallSite(_mmOmrHooks, J9HOOK_MM_OMR_EXCESSIVEGC_RAISED, verboseHandlerExcessiveGCRaised, OMR_GET_CALLSITE(), this);
@@ -214,6 +223,9 @@ MM_VerboseHandlerOutputStandard::disableVerbose()
 	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_COMPLETE_TRACING_END, verboseHandlerConcurrentTracingEnd, NULL);
 	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_COLLECTION_CARD_CLEANING_END, verboseHandlerConcurrentCardCleaningEnd, NULL);
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_COMPLETED_CONCURRENT_SWEEP, verboseHandlerCompletedConcurrentSweep, NULL);
+#endif /* defined(OMR_GC_CONCURRENT_SWEEP) */
 
 	/* Excessive GC */
 	(*_mmOmrHooks)->J9HookUnregister(_mmOmrHooks, J9HOOK_MM_OMR_EXCESSIVEGC_RAISED, verboseHandlerExcessiveGCRaised, NULL);
@@ -295,8 +307,18 @@ MM_VerboseHandlerOutputStandard::handleMarkEnd(J9HookInterface** hook, uintptr_t
 	enterAtomicReportingBlock();
 	handleGCOPOuterStanzaStart(env, "mark", env->_cycleState->_verboseContextID, duration, deltaTimeSuccess);
 
-	writer->formatAndOutput(env, 1, "<trace-info objectcount=\"%zu\" scancount=\"%zu\" scanbytes=\"%zu\" />",
-			markStats->_objectsMarked, markStats->_objectsScanned, markStats->_bytesScanned);
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	if (extensions->isSegregatedHeap() && extensions->segregatedNursery) {
+		MM_GlobalGCStats *globalGCStats = &extensions->globalGCStats;
+		writer->formatAndOutput(env, 1, "<trace-info objectcount=\"%zu\" scancount=\"%zu\" scanbytes=\"%zu\" nursery=\"%s\" rememberedcount=\"%zu\" />",
+				markStats->_objectsMarked, markStats->_objectsScanned, markStats->_bytesScanned,
+				globalGCStats->nurseryCollect ? "true" : "false", globalGCStats->nurseryRememberedCount);
+	} else
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
+	{
+		writer->formatAndOutput(env, 1, "<trace-info objectcount=\"%zu\" scancount=\"%zu\" scanbytes=\"%zu\" />",
+				markStats->_objectsMarked, markStats->_objectsScanned, markStats->_bytesScanned);
+	}
 
 	handleMarkEndInternal(env, eventData);
 
@@ -317,14 +339,27 @@ MM_VerboseHandlerOutputStandard::handleSweepEnd(J9HookInterface** hook, uintptr_
 	MM_SweepEndEvent* event = (MM_SweepEndEvent*)eventData;
 	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->currentThread);
 	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+	MM_VerboseManager* manager = getManager();
+	MM_VerboseWriterChain* writer = manager->getWriterChain();
 	MM_SweepStats *sweepStats = &extensions->globalGCStats.sweepStats;
 	uint64_t duration = 0;
 	bool deltaTimeSuccess = getTimeDeltaInMicroSeconds(&duration, sweepStats->_startTime, sweepStats->_endTime);
 
 	enterAtomicReportingBlock();
-	handleGCOPStanza(env, "sweep", env->_cycleState->_verboseContextID, duration, deltaTimeSuccess);
+	handleGCOPOuterStanzaStart(env, "sweep", env->_cycleState->_verboseContextID, duration, deltaTimeSuccess);
+
+	writer->formatAndOutput(env, 1, "<sweep-info liveobjects=\"%zu\" />", sweepStats->_liveObjectCount);
+
+	MM_HeapResizePredictor::Forecast *tenureConsumption = extensions->heap->getResizePredictor()->getTenureConsumption();
+	if ((NULL != tenureConsumption) && (0 != tenureConsumption->_samples)) {
+		writer->formatAndOutput(env, 1, "<tenure-resize-prediction consumedpredicted=\"%zu\" consumedactual=\"%zu\" demand=\"%zu\" />",
+				tenureConsumption->_lastPredicted, tenureConsumption->_lastActual, tenureConsumption->predict());
+	}
 
 	handleSweepEndInternal(env, eventData);
+
+	handleGCOPOuterStanzaEnd(env);
+	writer->flush(env);
 	exitAtomicReportingBlock();
 }
 
@@ -370,8 +405,18 @@ MM_VerboseHandlerOutputStandard::handleCompactEnd(J9HookInterface** hook, uintpt
 	handleGCOPOuterStanzaStart(env, "compact", env->_cycleState->_verboseContextID, duration, deltaTimeSuccess);
 
 	if(COMPACT_PREVENTED_NONE == compactStats->_compactPreventedReason) {
-		writer->formatAndOutput(env, 1, "<compact-info movecount=\"%zu\" movebytes=\"%zu\" reason=\"%s\" />",
-				compactStats->_movedObjects, compactStats->_movedBytes, getCompactionReasonAsString(compactStats->_compactReason));
+		/* an incremental compaction reports its window even when nothing was deferred */
+		if ((0 != compactStats->_evacuatedSubAreas) || (0 != compactStats->_deferredSubAreas)) {
+			OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+			uint64_t pauseReduction = omrtime_hires_delta(0, compactStats->_estimatedPauseReduction, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+			writer->formatAndOutput(env, 1, "<compact-info movecount=\"%zu\" movebytes=\"%zu\" reason=\"%s\" evacuatedsubareas=\"%zu\" evacuatedbytes=\"%zu\" deferredsubareas=\"%zu\" deferredbytes=\"%zu\" pausereductionms=\"%llu.%03llu\" />",
+					compactStats->_movedObjects, compactStats->_movedBytes, getCompactionReasonAsString(compactStats->_compactReason),
+					compactStats->_evacuatedSubAreas, compactStats->_evacuatedLiveBytes, compactStats->_deferredSubAreas, compactStats->_deferredLiveBytes,
+					pauseReduction / 1000, pauseReduction % 1000);
+		} else {
+			writer->formatAndOutput(env, 1, "<compact-info movecount=\"%zu\" movebytes=\"%zu\" reason=\"%s\" />",
+					compactStats->_movedObjects, compactStats->_movedBytes, getCompactionReasonAsString(compactStats->_compactReason));
+		}
 	} else {
 		writer->formatAndOutput(env, 1, "<compact-info reason=\"%s\" />", getCompactionReasonAsString(compactStats->_compactReason));
 		writer->formatAndOutput(env, 1, "<warning details=\"compaction prevented due to %s\" />", getCompactionPreventedReasonAsString(compactStats->_compactPreventedReason));
@@ -430,6 +475,43 @@ MM_VerboseHandlerOutputStandard::handleScavengeEndNoLock(J9HookInterface** hook,
 		writer->formatAndOutput(env, 1, "<copy-failed type=\"tenure\" objects=\"%zu\" bytes=\"%zu\" />",
 				scavengerStats->_failedTenureCount, scavengerStats->_failedTenureBytes);
 	}
+	if (0 != scavengerStats->_slotPrefetchCount) {
+		/* average ring occupancy in hundredths of a slot */
+		uint64_t averageOccupancy = (scavengerStats->_slotPrefetchRingOccupancySum * 100) / scavengerStats->_slotPrefetchCount;
+		writer->formatAndOutput(env, 1, "<scavenger-prefetch distance=\"%zu\" prefetched=\"%llu\" hits=\"%llu\" avgringoccupancy=\"%llu.%02llu\" />",
+				extensions->scavengerPrefetchDistance, scavengerStats->_slotPrefetchCount, scavengerStats->_slotPrefetchHitCount,
+				averageOccupancy / 100, averageOccupancy % 100);
+	}
+	if (0 != scavengerStats->_rememberedSetBatchCount) {
+		writer->formatAndOutput(env, 1, "<scavenger-remembered-set batchsize=\"%zu\" batches=\"%zu\" slots=\"%zu\" />",
+				extensions->scavengerRememberedSetScanBatchSize, scavengerStats->_rememberedSetBatchCount, scavengerStats->_rememberedSetBatchSlotCount);
+	}
+	if (extensions->scavengerNUMAAware) {
+		for (uintptr_t nodeIndex = 0; nodeIndex < OMR_SCAVENGER_NUMA_NODE_MAX; nodeIndex++) {
+			MM_ScavengerStats::NUMANodeStats *nodeStats = &scavengerStats->_numaNodeStats[nodeIndex];
+			if ((0 != nodeStats->_copiedBytes) || (0 != nodeStats->_localScanCacheCount) || (0 != nodeStats->_remoteScanCacheCount)) {
+				writer->formatAndOutput(env, 1, "<scavenger-numa node=\"%zu\" copiedbytes=\"%zu\" localscancaches=\"%zu\" remotescancaches=\"%zu\" localsurvivorbytes=\"%zu\" remotesurvivorbytes=\"%zu\" />",
+						nodeIndex, nodeStats->_copiedBytes, nodeStats->_localScanCacheCount, nodeStats->_remoteScanCacheCount,
+						nodeStats->_localSurvivorBytes, nodeStats->_remoteSurvivorBytes);
+			}
+		}
+	}
+	if (event->cycleEnd && extensions->scavengerHotFieldLearning) {
+		writer->formatAndOutput(env, 1, "<scavenger-hotfields samplingrate=\"%zu\" sampled=\"%llu\" learnedshapes=\"%zu\" />",
+				extensions->scavengerHotFieldSamplingRate, cycleScavengerStats->_hotFieldSampleCount, cycleScavengerStats->_hotFieldLearnedShapeCount);
+	}
+	if (event->cycleEnd) {
+		MM_HeapResizePredictor *predictor = extensions->heap->getResizePredictor();
+		MM_HeapResizePredictor::Forecast *allocationRate = predictor->getAllocationRate();
+		MM_HeapResizePredictor::Forecast *survivorBytes = predictor->getSurvivorBytes();
+		if ((NULL != survivorBytes) && (0 != survivorBytes->_samples)) {
+			/* load factor in hundredths */
+			uintptr_t loadFactor = (uintptr_t)(predictor->getScavengeLoadFactor() * 100);
+			writer->formatAndOutput(env, 1, "<nursery-resize-prediction allocratepredicted=\"%zu\" allocrateactual=\"%zu\" survivorpredicted=\"%zu\" survivoractual=\"%zu\" loadfactor=\"%zu.%02zu\" />",
+					allocationRate->_lastPredicted, allocationRate->_lastActual, survivorBytes->_lastPredicted, survivorBytes->_lastActual,
+					loadFactor / 100, loadFactor % 100);
+		}
+	}
 
 	handleScavengeEndInternal(env, eventData);
 	
@@ -542,6 +624,11 @@ MM_VerboseHandlerOutputStandard::handleConcurrentMarkEnd(J9HookInterface** hook,
 			writer->formatAndOutput(env, 1, "<card-cleaning reason=\"%s\" bytesTraced=\"%zu\" cardsCleaned=\"%zu\" />", cardCleaningReasonString, (collectionStats->getConHelperCardCleanCount() + collectionStats->getCardCleanCount()), stats->_cardTableStats->getConcurrentCleanedCards());
 		}
 	}
+	if (NULL != stats->_sATBStats) {
+		MM_ConcurrentSATBStats *sATBStats = stats->_sATBStats;
+		writer->formatAndOutput(env, 1, "<satb-barrier packetsPublished=\"%zu\" batchRefills=\"%zu\" drainerWakeups=\"%zu\" bytesDrained=\"%zu\" pendingPackets=\"%zu\" />",
+				sATBStats->getPacketsPublished(), sATBStats->getBatchRefills(), sATBStats->getDrainerWakeups(), sATBStats->getBytesDrained(), sATBStats->getPendingPackets());
+	}
 	handleGCOPOuterStanzaEnd(env);
 	writer->flush(env);
 }
@@ -609,8 +696,8 @@ MM_VerboseHandlerOutputStandard::handleConcurrentCardCleaningEnd(J9HookInterface
 	handleGCOPOuterStanzaStart(env, "card-cleaning", env->_cycleState->_verboseContextID, durationUs, true);
 
 	writer->formatAndOutput(
-			env, 1, "<card-cleaning cardsCleaned=\"%zu\" bytesTraced=\"%zu\" workStackOverflowCount=\"%zu\" />",
-			event->finalcleanedCards, event->bytesTraced, event->workStackOverflowCount);
+			env, 1, "<card-cleaning cardsCleaned=\"%zu\" cardsScanned=\"%zu\" cardsScannedPerMicrosecond=\"%zu\" bytesTraced=\"%zu\" workStackOverflowCount=\"%zu\" />",
+			event->finalcleanedCards, event->finalCardsScanned, event->finalCardsScannedPerMicrosecond, event->bytesTraced, event->workStackOverflowCount);
 
 	handleConcurrentCardCleaningEndInternal(env, eventData);
 
@@ -872,6 +959,55 @@ MM_VerboseHandlerOutputStandard::handleConcurrentAbortedInternal(MM_EnvironmentB
 }
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
 
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+void
+MM_VerboseHandlerOutputStandard::handleCompletedConcurrentSweep(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
+{
+	MM_CompletedConcurrentSweep* event = (MM_CompletedConcurrentSweep*)eventData;
+	MM_VerboseManager* manager = getManager();
+	MM_VerboseWriterChain* writer = manager->getWriterChain();
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	char tagTemplate[100];
+	enterAtomicReportingBlock();
+	getTagTemplate(tagTemplate, sizeof(tagTemplate), manager->getIdAndIncrement(), omrtime_current_time_millis());
+	writer->formatAndOutput(env, 0, "<concurrent-sweep-completed %s>", tagTemplate);
+
+	const char* reason;
+	switch((SweepCompletionReason)event->reason) {
+	case ABOUT_TO_GC:
+		reason = "about to gc";
+		break;
+	case COMPACTION_REQUIRED:
+		reason = "compaction required";
+		break;
+	case CONTRACTION_REQUIRED:
+		reason = "contraction required";
+		break;
+	case EXPANSION_REQUIRED:
+		reason = "expansion required";
+		break;
+	case LOA_RESIZE:
+		reason = "loa resize";
+		break;
+	case SYSTEM_GC:
+		reason = "system gc";
+		break;
+	default:
+		reason = "unknown";
+		break;
+	}
+
+	writer->formatAndOutput(env, 1, "<concurrent-sweep-info reason=\"%s\" bytesSwept=\"%zu\" sweepms=\"%llu.%03.3llu\" lazyBytesSwept=\"%zu\" backgroundBytesSwept=\"%zu\" bytesConnected=\"%zu\" connectms=\"%llu.%03.3llu\" />",
+		reason, event->bytesSwept, event->timeElapsedSweep / 1000, event->timeElapsedSweep % 1000,
+		event->lazyBytesSwept, event->backgroundBytesSwept,
+		event->bytesConnected, event->timeElapsedConnect / 1000, event->timeElapsedConnect % 1000);
+	writer->formatAndOutput(env, 0, "</concurrent-sweep-completed>");
+	writer->flush(env);
+	exitAtomicReportingBlock();
+}
+#endif /* defined(OMR_GC_CONCURRENT_SWEEP) */
+
 bool
 MM_VerboseHandlerOutputStandard::hasOutputMemoryInfoInnerStanza()
 {
@@ -896,7 +1032,7 @@ MM_VerboseHandlerOutputStandard::outputMemType(MM_EnvironmentBase* env, uintptr_
 		bufPos += omrstr_printf(memInfoBuffer + bufPos, INITIAL_BUFFER_SIZE - bufPos," macro-fragmented=\"%zu\"", (size_t) macroFragment);
 	}
 	bufPos += omrstr_printf(memInfoBuffer + bufPos, INITIAL_BUFFER_SIZE - bufPos, " />");
-	writer->formatAndOutput(env, indent, memInfoBuffer);
+	writer->formatAndOutput(env, indent, "%s", memInfoBuffer);
 }
 
 void
@@ -940,7 +1076,7 @@ MM_VerboseHandlerOutputStandard::outputMemoryInfoInnerStanza(MM_EnvironmentBase
 			bufPos += omrstr_printf(tenureMemInfoBuffer + bufPos, INITIAL_BUFFER_SIZE - bufPos, " macro-fragmented=\"%zu\"", (size_t) stats->_macroFragmentedSize);
 		}
 		bufPos += omrstr_printf(tenureMemInfoBuffer + bufPos, INITIAL_BUFFER_SIZE - bufPos, ">");
-		writer->formatAndOutput(env, indent, tenureMemInfoBuffer);
+		writer->formatAndOutput(env, indent, "%s", tenureMemInfoBuffer);
 
 		outputMemType(env, indent + 1, "soa", (stats->_totalFreeTenureHeapSize - stats->_totalFreeLOAHeapSize), (stats->_totalTenureHeapSize - stats->_totalLOAHeapSize));
 		outputMemType(env, indent + 1, "loa", stats->_totalFreeLOAHeapSize, stats->_totalLOAHeapSize);
@@ -1144,6 +1280,14 @@ verboseHandlerConcurrentAborted(J9HookInterface** hook, uintptr_t eventNum, void
 }
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
 
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+void
+verboseHandlerCompletedConcurrentSweep(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	((MM_VerboseHandlerOutputStandard *)userData)->handleCompletedConcurrentSweep(hook, eventNum, eventData);
+}
+#endif /* defined(OMR_GC_CONCURRENT_SWEEP) */
+
 void
 verboseHandlerExcessiveGCRaised(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
 {
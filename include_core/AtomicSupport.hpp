@@ -168,6 +168,24 @@ public:
 #endif /* !defined(ATOMIC_SUPPORT_STUB) */
 	}
 
+	/**
+	 * Hint to the processor that the cache line containing the given address will be read soon.
+	 * Generates no code on compilers that do not provide a prefetch intrinsic.
+	 *
+	 * @param address the address to prefetch
+	 */
+	VMINLINE static void
+	prefetchForRead(const void *address)
+	{
+#if !defined(ATOMIC_SUPPORT_STUB)
+#if defined(__GNUC__)
+		__builtin_prefetch(address, 0, 3);
+#elif defined(_MSC_VER) && (defined(J9X86) || defined(J9HAMMER)) /* __GNUC__ */
+		_mm_prefetch((const char *)address, _MM_HINT_T0);
+#endif /* _MSC_VER && (J9X86 || J9HAMMER) */
+#endif /* !defined(ATOMIC_SUPPORT_STUB) */
+	}
+
 	/**
 	 * Prevents compiler reordering of reads and writes across the barrier.
 	 * This does not prevent processor reordering.
@@ -24,15 +24,18 @@
 #include "codegen/CodeGenerator.hpp"
 #include "compile/CompilationTypes.hpp"
 #include "compile/Method.hpp"
+#include "control/CompilationQueue.hpp"
 #include "control/CompileMethod.hpp"
 #include "env/CompilerEnv.hpp"
 #include "env/FrontEnd.hpp"
 #include "env/IO.hpp"
 #include "env/RawAllocator.hpp"
+#include "env/SharedSegmentPool.hpp"
 #include "ilgen/IlGeneratorMethodDetails_inlines.hpp"
 #include "ilgen/MethodBuilder.hpp"
 #include "ilgen/TypeDictionary.hpp"
 #include "runtime/CodeCache.hpp"
+#include "runtime/PersistentCodeCache.hpp"
 #include "runtime/Runtime.hpp"
 #include "runtime/JBJitConfig.hpp"
 
@@ -89,13 +92,14 @@ initializeCodeCache(TR::CodeCacheManager & codeCacheManager)
    codeCacheConfig._trampolineSpacePercentage = 5;
    codeCacheConfig._allowedToGrowCache = true;
    codeCacheConfig._lowCodeCacheThreshold = 0;
-   codeCacheConfig._verboseCodeCache = false;
+   codeCacheConfig._verboseCodeCache = TR::Options::getVerboseOption(TR_VerboseCodeCache);
    codeCacheConfig._verbosePerformance = false;
    codeCacheConfig._verboseReclamation = false;
    codeCacheConfig._doSanityChecks = false;
    codeCacheConfig._codeCacheTotalKB = 16*1024;
    codeCacheConfig._codeCacheKB = 128;
    codeCacheConfig._codeCachePadKB = 0;
+   codeCacheConfig._hotCodeCacheKB = TR::Options::getCmdLineOptions()->getHotCodeCacheKB();
    codeCacheConfig._codeCacheAlignment = 32;
    codeCacheConfig._codeCacheFreeBlockRecylingEnabled = true;
    codeCacheConfig._largeCodePageSize = 0;
@@ -184,19 +188,19 @@ internal_initializeJit()
    return initializeJitBuilder(0, 0, 0, (char *)"-Xjit:acceptHugeMethods,enableBasicBlockHoisting,omitFramePointer,useILValidator");
    }
 
-int32_t
-internal_compileMethodBuilder(TR::MethodBuilder *m, void **entry)
+#if defined(AIXPPC)
+struct FunctionDescriptor
    {
-   auto rc = m->Compile(entry);
+   void* func;
+   void* toc;
+   void* environment;
+   };
+#endif
 
+static void
+wrapEntryPoint(void **entry)
+   {
 #if defined(AIXPPC)
-   struct FunctionDescriptor
-      {
-      void* func;
-      void* toc;
-      void* environment;
-      };
-
    FunctionDescriptor* fd = new FunctionDescriptor();
    fd->func = *entry;
    // TODO: There should really be a better way to get this. Usually, we would use
@@ -206,15 +210,93 @@ internal_compileMethodBuilder(TR::MethodBuilder *m, void **entry)
 
    *entry = (uint8_t*) fd;
 #endif
+   }
 
+int32_t
+internal_compileMethodBuilder(TR::MethodBuilder *m, void **entry)
+   {
+   auto rc = m->Compile(entry);
+   wrapEntryPoint(entry);
    return rc;
    }
 
+// Starts the threads that compileMethodBuilderAsync() hands its work to
+bool
+internal_startCompilationThreads(int32_t numThreads)
+   {
+   if (numThreads <= 0)
+      return false;
+
+   return TR::CompilationQueue::startup(static_cast<uint32_t>(numThreads)) != NULL;
+   }
+
+int32_t
+internal_compileMethodBuilderAsync(TR::MethodBuilder *m, int32_t hotness)
+   {
+   return m->CompileAsync(hotness);
+   }
+
+int32_t
+internal_compiledMethodBuilderEntry(TR::MethodBuilder *m, void **entry, bool wait)
+   {
+   auto rc = m->CompileAsyncResult(entry, wait);
+   if (rc == COMPILATION_SUCCEEDED)
+      wrapEntryPoint(entry);
+   return rc;
+   }
+
+// Reclaims the code of a method compiled earlier, which must not be called any more
+bool
+internal_freeCompiledMethod(void *entry)
+   {
+#if defined(AIXPPC)
+   entry = static_cast<FunctionDescriptor *>(entry)->func;
+#endif
+   auto fe = JitBuilder::FrontEnd::instance();
+   return fe->codeCacheManager().freeMethodBody(entry);
+   }
+
+// Bounds of the code cache hot compilations are placed in, or NULL if there
+// is none
+void *
+internal_getHotCodeCacheBase()
+   {
+   TR::CodeCache *hotCodeCache = JitBuilder::FrontEnd::instance()->codeCacheManager().getHotCodeCache();
+   return (NULL != hotCodeCache) ? hotCodeCache->getCodeBase() : NULL;
+   }
+
+void *
+internal_getHotCodeCacheTop()
+   {
+   TR::CodeCache *hotCodeCache = JitBuilder::FrontEnd::instance()->codeCacheManager().getHotCodeCache();
+   return (NULL != hotCodeCache) ? hotCodeCache->getCodeTop() : NULL;
+   }
+
+// Counts of compilations that did and did not install a body from the
+// persistent code cache, or zero if there is none
+int64_t
+internal_getPersistentCodeCacheHits()
+   {
+   TR::PersistentCodeCache *cache = TR::PersistentCodeCache::instance();
+   return (NULL != cache) ? static_cast<int64_t>(cache->hits()) : 0;
+   }
+
+int64_t
+internal_getPersistentCodeCacheMisses()
+   {
+   TR::PersistentCodeCache *cache = TR::PersistentCodeCache::instance();
+   return (NULL != cache) ? static_cast<int64_t>(cache->misses()) : 0;
+   }
+
 void
 internal_shutdownJit()
    {
    auto fe = JitBuilder::FrontEnd::instance();
 
+   TR::CompilationQueue::shutdown();
+   TR::PersistentCodeCache::destroy();
+   TR::SharedSegmentPool::destroy();
+
    TR::CodeCacheManager &codeCacheManager = fe->codeCacheManager();
    codeCacheManager.destroy();
 
@@ -37,6 +37,8 @@ const char* XPATH_GET_ALL_MARK_TIME = "/verbosegc/gc-op[@type='mark']";
 const char* XPATH_GET_ALL_SWEEP_TIME = "/verbosegc/gc-op[@type='sweep']";
 const char* XPATH_GET_ALL_EXPAND_TIME = "/verbosegc/heap-resize[@type='expand']";
 const char* XPATH_GET_TOTAL_GC_TIME = "/verbosegc/gc-end[@type='global']";
+const char* XPATH_GET_SWEEP_HEAP_SIZE = "following-sibling::gc-end[1]/mem-info";
+const double BYTES_PER_GB = 1024.0 * 1024.0 * 1024.0;
 const char* SRC_DIR = "./";
 const char* VERBOSE_GC_FILE_PREFIX = "VerboseGC";
 
@@ -107,6 +109,7 @@ analyze(char* fileName, OMRPortLibrary portLibrary)
 {
 	std::vector<double> mark_values;
 	std::vector<double> sweep_values;
+	std::vector<double> sweep_per_gb_values;
 	std::vector<double> expand_values;
 	std::vector<double> gcduration_values;
 
@@ -123,6 +126,10 @@ analyze(char* fileName, OMRPortLibrary portLibrary)
 	double minSweep = 0;
 	double avgSweep = 0;
 
+	double maxSweepPerGB = 0;
+	double minSweepPerGB = 0;
+	double avgSweepPerGB = 0;
+
 	double maxExpand = 0;
 	double minExpand = 0;
 	double avgExpand = 0;
@@ -154,6 +161,11 @@ analyze(char* fileName, OMRPortLibrary portLibrary)
 	    pugi::xpath_node node = *it;
 	    double value = node.node().attribute("timems").as_double();
 	    sweep_values.push_back(value);
+	    /* normalize by the size of the heap swept, as reported at the end of the same collection */
+	    double heapSize = node.node().select_node(XPATH_GET_SWEEP_HEAP_SIZE).node().attribute("total").as_double();
+	    if (0 < heapSize) {
+	        sweep_per_gb_values.push_back(value / (heapSize / BYTES_PER_GB));
+	    }
 	}
 
 	expandTimes = doc.select_nodes(XPATH_GET_ALL_EXPAND_TIME);
@@ -182,6 +194,12 @@ analyze(char* fileName, OMRPortLibrary portLibrary)
 		avgSweep = getAvg(sweep_values);
 	}
 
+	if (!sweep_per_gb_values.empty()) {
+		maxSweepPerGB = *std::max_element(sweep_per_gb_values.begin(), sweep_per_gb_values.end());
+		minSweepPerGB = *std::min_element(sweep_per_gb_values.begin(), sweep_per_gb_values.end());
+		avgSweepPerGB = getAvg(sweep_per_gb_values);
+	}
+
 	if (!expand_values.empty()) {
 		maxExpand = *std::max_element(expand_values.begin(), expand_values.end());
 		minExpand = *std::min_element(expand_values.begin(), expand_values.end());
@@ -194,14 +212,14 @@ analyze(char* fileName, OMRPortLibrary portLibrary)
 		avgGCDuration = getAvg(gcduration_values);
 	}
 
-	omrtty_printf("            Mark           Sweep          Expand        GCDuration\n");
-	omrtty_printf("-------------------------------------------------------------------\n");
-	omrtty_printf("Max     : %f        %f        %f        %f\n",
-						maxMark, maxSweep, maxExpand, maxGCDuration);
+	omrtty_printf("            Mark           Sweep          Sweep/GB       Expand        GCDuration\n");
+	omrtty_printf("----------------------------------------------------------------------------------\n");
+	omrtty_printf("Max     : %f        %f        %f        %f        %f\n",
+						maxMark, maxSweep, maxSweepPerGB, maxExpand, maxGCDuration);
 
-	omrtty_printf("Min     : %f        %f        %f        %f\n",
-								minMark, minSweep, minExpand, minGCDuration);
+	omrtty_printf("Min     : %f        %f        %f        %f        %f\n",
+								minMark, minSweep, minSweepPerGB, minExpand, minGCDuration);
 
-	omrtty_printf("Average : %f        %f        %f        %f\n\n",
-								avgMark, avgSweep, avgExpand, avgGCDuration);
+	omrtty_printf("Average : %f        %f        %f        %f        %f\n\n",
+								avgMark, avgSweep, avgSweepPerGB, avgExpand, avgGCDuration);
 }
@@ -433,3 +433,37 @@ omrvmem_get_process_memory_size(struct OMRPortLibrary *portLibrary, J9VMemMemory
 {
 	return OMRPORT_ERROR_VMEM_NOT_SUPPORTED;
 }
+
+/**
+ * Advise the operating system on the use of transparent huge pages for a range of memory.
+ * The range is trimmed inward to the base page size of the platform.
+ *
+ * OMRPORT_VMEM_HUGEPAGE_ADVISE marks the range as eligible to be backed by huge pages.
+ * OMRPORT_VMEM_HUGEPAGE_COLLAPSE requests that the range be backed by huge pages immediately.
+ *
+ * @param [in] portLibrary port library
+ * @param [in] address the start of the range, must be within committed memory
+ * @param [in] byteAmount the size of the range
+ * @param [in] advice bitwise OR of OMRPORT_VMEM_HUGEPAGE_* flags
+ * @return 0 on success, OMRPORT_ERROR_VMEM_OPFAILED if an error occurred, or OMRPORT_ERROR_VMEM_NOT_SUPPORTED.
+ */
+int32_t
+omrvmem_advise_hugepages(struct OMRPortLibrary *portLibrary, void *address, uintptr_t byteAmount, uintptr_t advice)
+{
+	return OMRPORT_ERROR_VMEM_NOT_SUPPORTED;
+}
+
+/**
+ * Get the number of bytes in a range of memory which are currently backed by transparent huge pages.
+ *
+ * @param [in] portLibrary port library
+ * @param [in] address the start of the range
+ * @param [in] byteAmount the size of the range
+ * @param [out] hugePageBytes pointer to variable to receive result
+ * @return 0 on success, OMRPORT_ERROR_VMEM_OPFAILED if an error occurred, or OMRPORT_ERROR_VMEM_NOT_SUPPORTED.
+ */
+int32_t
+omrvmem_get_hugepage_coverage(struct OMRPortLibrary *portLibrary, void *address, uintptr_t byteAmount, uint64_t *hugePageBytes)
+{
+	return OMRPORT_ERROR_VMEM_NOT_SUPPORTED;
+}
@@ -55,6 +55,10 @@
 #if !defined(MADV_HUGEPAGE)
 #define MADV_HUGEPAGE 14
 #endif /* MADV_HUGEPAGE */
+/* MADV_COLLAPSE is only defined in <sys/mman.h> from glibc 2.37; the kernel supports it from Linux 6.1 */
+#if !defined(MADV_COLLAPSE)
+#define MADV_COLLAPSE 25
+#endif /* MADV_COLLAPSE */
 
 #if !defined(MFD_HUGETLB)
 #define MFD_HUGETLB 0x4
@@ -2280,6 +2284,85 @@ omrvmem_get_process_memory_size(struct OMRPortLibrary *portLibrary, J9VMemMemory
 	return result;
 }
 
+int32_t
+omrvmem_advise_hugepages(struct OMRPortLibrary *portLibrary, void *address, uintptr_t byteAmount, uintptr_t advice)
+{
+	int32_t result = 0;
+	uintptr_t start = (uintptr_t)address;
+	uintptr_t end = (uintptr_t)address + byteAmount;
+
+	Trc_PRT_vmem_advise_hugepages_entry(address, byteAmount, advice);
+
+	/* Align start and end to be page-size aligned */
+	start = start + ((start % PPG_vmem_pageSize[0]) ? (PPG_vmem_pageSize[0] - (start % PPG_vmem_pageSize[0])) : 0);
+	end = end - (end % PPG_vmem_pageSize[0]);
+	if (start < end) {
+		if (OMR_ARE_ANY_BITS_SET(advice, OMRPORT_VMEM_HUGEPAGE_ADVISE)) {
+			if (0 != madvise((void *)start, end - start, MADV_HUGEPAGE)) {
+				int madviseError = errno;
+				Trc_PRT_vmem_advise_hugepages_failed("MADV_HUGEPAGE", madviseError);
+				/* kernels built without transparent huge pages reject the advice as invalid */
+				result = (EINVAL == madviseError) ? OMRPORT_ERROR_VMEM_NOT_SUPPORTED : OMRPORT_ERROR_VMEM_OPFAILED;
+			}
+		}
+		if ((0 == result) && OMR_ARE_ANY_BITS_SET(advice, OMRPORT_VMEM_HUGEPAGE_COLLAPSE)) {
+			if (0 != madvise((void *)start, end - start, MADV_COLLAPSE)) {
+				int madviseError = errno;
+				Trc_PRT_vmem_advise_hugepages_failed("MADV_COLLAPSE", madviseError);
+				/* kernels older than 6.1 reject the advice as invalid */
+				result = (EINVAL == madviseError) ? OMRPORT_ERROR_VMEM_NOT_SUPPORTED : OMRPORT_ERROR_VMEM_OPFAILED;
+			}
+		}
+	}
+
+	Trc_PRT_vmem_advise_hugepages_exit(result);
+	return result;
+}
+
+int32_t
+omrvmem_get_hugepage_coverage(struct OMRPortLibrary *portLibrary, void *address, uintptr_t byteAmount, uint64_t *hugePageBytes)
+{
+	int32_t result = OMRPORT_ERROR_VMEM_OPFAILED;
+	const char *smapsFilename = "/proc/self/smaps";
+	FILE *smapsStream = fopen(smapsFilename, "r");
+
+	if (NULL != smapsStream) {
+		uintptr_t rangeStart = (uintptr_t)address;
+		uintptr_t rangeEnd = (uintptr_t)address + byteAmount;
+		uintptr_t overlap = 0;
+		uint64_t coverage = 0;
+		BOOLEAN atLineStart = TRUE;
+		char line[256];
+
+		while (NULL != fgets(line, sizeof(line), smapsStream)) {
+			BOOLEAN isLineStart = atLineStart;
+			/* lines longer than the buffer (mapped file names) are read in pieces; only parse the first piece */
+			atLineStart = (NULL != strchr(line, '\n'));
+			if (isLineStart) {
+				unsigned long vmaStart = 0;
+				unsigned long vmaEnd = 0;
+				unsigned long anonHugePagesKB = 0;
+
+				if (2 == sscanf(line, "%lx-%lx ", &vmaStart, &vmaEnd)) {
+					/* header of the next mapping: remember how much of it falls within the range */
+					uintptr_t overlapStart = OMR_MAX(rangeStart, (uintptr_t)vmaStart);
+					uintptr_t overlapEnd = OMR_MIN(rangeEnd, (uintptr_t)vmaEnd);
+					overlap = (overlapStart < overlapEnd) ? (overlapEnd - overlapStart) : 0;
+				} else if ((0 != overlap) && (1 == sscanf(line, "AnonHugePages: %lu kB", &anonHugePagesKB))) {
+					coverage += OMR_MIN((uint64_t)anonHugePagesKB * 1024, (uint64_t)overlap);
+				}
+			}
+		}
+		fclose(smapsStream);
+		*hugePageBytes = coverage;
+		result = 0;
+	} else {
+		Trc_PRT_vmem_get_hugepage_coverage_failed(smapsFilename);
+	}
+
+	return result;
+}
+
 static void
 addressIterator_init(AddressIterator *iterator, ADDRESS minimum, ADDRESS maximum, uintptr_t alignment, intptr_t direction)
 {
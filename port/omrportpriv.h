@@ -913,6 +913,10 @@ extern J9_CFUNC int32_t
 omrvmem_get_available_physical_memory(struct OMRPortLibrary *portLibrary, uint64_t *freePhysicalMemorySize);
 extern J9_CFUNC int32_t
 omrvmem_get_process_memory_size(struct OMRPortLibrary *portLibrary, J9VMemMemoryQuery queryType, uint64_t *memorySize);
+extern J9_CFUNC int32_t
+omrvmem_advise_hugepages(struct OMRPortLibrary *portLibrary, void *address, uintptr_t byteAmount, uintptr_t advice);
+extern J9_CFUNC int32_t
+omrvmem_get_hugepage_coverage(struct OMRPortLibrary *portLibrary, void *address, uintptr_t byteAmount, uint64_t *hugePageBytes);
 
 /* J9SourcePort*/
 extern J9_CFUNC int32_t
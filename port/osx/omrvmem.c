@@ -855,6 +855,18 @@ omrvmem_get_process_memory_size(struct OMRPortLibrary *portLibrary, J9VMemMemory
 	return result;
 }
 
+int32_t
+omrvmem_advise_hugepages(struct OMRPortLibrary *portLibrary, void *address, uintptr_t byteAmount, uintptr_t advice)
+{
+	return OMRPORT_ERROR_VMEM_NOT_SUPPORTED;
+}
+
+int32_t
+omrvmem_get_hugepage_coverage(struct OMRPortLibrary *portLibrary, void *address, uintptr_t byteAmount, uint64_t *hugePageBytes)
+{
+	return OMRPORT_ERROR_VMEM_NOT_SUPPORTED;
+}
+
 /**
  *  Restores memory region associated with double mapped region, to what it was previously
  *  If omrvmem_create_double_mapped_region was called with a NULL preferredAddress then we just
@@ -1623,6 +1623,18 @@ omrvmem_get_process_memory_size(struct OMRPortLibrary *portLibrary, J9VMemMemory
 	return OMRPORT_ERROR_VMEM_NOT_SUPPORTED;
 }
 
+int32_t
+omrvmem_advise_hugepages(struct OMRPortLibrary *portLibrary, void *address, uintptr_t byteAmount, uintptr_t advice)
+{
+	return OMRPORT_ERROR_VMEM_NOT_SUPPORTED;
+}
+
+int32_t
+omrvmem_get_hugepage_coverage(struct OMRPortLibrary *portLibrary, void *address, uintptr_t byteAmount, uint64_t *hugePageBytes)
+{
+	return OMRPORT_ERROR_VMEM_NOT_SUPPORTED;
+}
+
 #if defined(OMR_ENV_DATA64)
 static BOOLEAN
 isRmode64Supported()